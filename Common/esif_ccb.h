@@ -110,6 +110,7 @@ typedef unsigned long long u64;
 #define ESIF_ATTR_OS		"Linux"			/* OS Is Generic Linux */
 #endif
 #define ESIF_INLINE			inline		/* Inline Function Directive */
+#define ESIF_THREAD_LOCAL	__thread	/* Thread Local Storage Directive */
 #define ESIF_FUNC			__func__	/* Current Function Name */
 #define ESIF_CALLCONV					/* Func Calling Convention */
 #define ESIF_PATH_SEP		"/"			/* Path Separator String */
@@ -66,5 +66,7 @@ typedef volatile atomic_basetype atomic_t;
 #define atomic_dec(v)		__atomic_sub_fetch(v, 1, __ATOMIC_SEQ_CST)
 #define atomic_add(i, v)	__atomic_fetch_add(v, i, __ATOMIC_SEQ_CST)
 #define atomic_sub(i, v)	__atomic_fetch_sub(v, i, __ATOMIC_SEQ_CST)
+#define atomic_cmpxchg(v, old, new)	__sync_val_compare_and_swap(v, old, new) /* Returns prior value */
+#define atomic_fence()		__atomic_thread_fence(__ATOMIC_SEQ_CST)
 #endif /* !DISABLE */
 
@@ -22,6 +22,8 @@
 #include <errno.h>
 #include <unistd.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
 #include "esif_ccb_string.h"
 
 /*
@@ -84,6 +86,39 @@ static ESIF_INLINE int esif_ccb_file_exists(esif_string filename)
 	return (0 == esif_ccb_stat(filename, &st));
 }
 
+// Map an entire file into memory as Read-Only. Returns NULL if the file is empty or cannot be mapped.
+// The file must not be truncated while mapped, so only use this for Read-Only files.
+static ESIF_INLINE void *esif_ccb_mmap_file(esif_string filename, size_t *sizePtr)
+{
+	void *addr = NULL;
+	struct stat st = { 0 };
+	int fd = -1;
+
+	if (esif_ccb_drop_symlink(filename) == 0) {
+		fd = open(filename, O_RDONLY | O_CLOEXEC);
+	}
+	if (fd >= 0) {
+		if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+			addr = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+			if (addr == MAP_FAILED) {
+				addr = NULL;
+			}
+			else if (sizePtr) {
+				*sizePtr = (size_t)st.st_size;
+			}
+		}
+		close(fd);
+	}
+	return addr;
+}
+
+static ESIF_INLINE void esif_ccb_munmap_file(void *addr, size_t size)
+{
+	if (addr) {
+		munmap(addr, size);
+	}
+}
+
 // mode parameters for esif_ccb_fopen() that can be combined
 #define FILEMODE_READ		"r"		// Open for Read-only; File must exist
 #define FILEMODE_WRITE		"w"		// Open for Write, Overwrite existing file; Create if does not exist
@@ -23,6 +23,7 @@
 #include <netinet/in.h>
 #include <arpa/inet.h>
 #include <netdb.h>
+#include <sys/uio.h>
 
 typedef int esif_ccb_socket_t;
 
@@ -82,3 +83,17 @@ static int ESIF_INLINE esif_ccb_socket_shutdown(esif_ccb_socket_t socket, int ho
 
 #define esif_ccb_socketpair(af, typ, prot, sock)	socketpair(af, typ, prot, sock)
 
+// Scatter/Gather I/O Vector
+typedef struct iovec esif_ccb_iovec_t;
+
+#define esif_ccb_iovec_set(iov, buf, len)	do { (iov)->iov_base = (void *)(buf); (iov)->iov_len = (len); } while (0)
+
+// Send multiple buffers with a single call
+static ssize_t ESIF_INLINE esif_ccb_socket_sendv(esif_ccb_socket_t socket, esif_ccb_iovec_t *iov, size_t iovcnt, int flags)
+{
+	struct msghdr msg = { 0 };
+	msg.msg_iov = iov;
+	msg.msg_iovlen = iovcnt;
+	return sendmsg(socket, &msg, flags);
+}
+
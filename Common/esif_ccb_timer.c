@@ -51,6 +51,7 @@
 **
 *******************************************************************************/
 #include "esif_ccb_timer.h"
+#include "esif_ccb_thread.h"
 #include "esif_link_list.h"
 
 /*
@@ -61,14 +62,20 @@
 #define ESIF_CNT_HNDL_RETRIES_MAX 10000
 
 /*
-* Time delay between destroying all timers at exit and when the manager is
-* destroyed.  This is required because timers which are destroyed may or may
-* not already be queued for callback when the binary is being unloaded;
-* specifically DLL/SO.  The code protects against the use of invalid contexts
-* being used in the callback, but cannot protect against the code being
-* removed without disallowing waiting for timer exits in callbacks.
-*/
-#define ESIF_TIMER_DISABLE_DELAY 50
+ * Timer Wheel Thread States
+ * The wheel thread is started when a timer is first set and stops once the
+ * last timer is destroyed, so that no thread is left running in a binary that
+ * is about to be unloaded (specifically DLL/SO).
+ */
+#define ESIF_TMRM_THREAD_STOPPED	0	/* No thread */
+#define ESIF_TMRM_THREAD_RUNNING	1	/* Thread is dispatching timers */
+#define ESIF_TMRM_THREAD_EXITED		2	/* Thread exited on its own and must be joined */
+
+/*
+ * Maximum number of callback worker threads. With no workers, the wheel thread
+ * calls every callback itself, so a slow callback delays all other timers.
+ */
+#define ESIF_TMRM_MAX_WORKERS		256
 
 /*
  * STRUCTURE DECLARATIONS
@@ -79,19 +86,29 @@ struct esif_timer_manager {
 	u8 marked_for_delete; /* Indicates no additional timers may be created */
 	esif_ccb_lock_t mgr_lock;
 	struct esif_link_list *timer_list_ptr; /* List of initialized timers */
+
+	struct esif_ccb_wheel wheel; /* Armed timers */
+	esif_thread_t wheel_thread; /* Thread which runs the wheel and calls the callbacks */
+	u8 wheel_thread_state;
+	u32 wheel_generation; /* Changed whenever the wheel thread is started or stopped */
+
+	u32 worker_count; /* Number of callback worker threads to start */
+	esif_thread_t *worker_threads; /* Running callback worker threads or NULL */
+	u32 workers_started; /* Number of entries in worker_threads */
+	u8 workers_stopping; /* Worker threads must exit */
+	esif_ccb_sem_t worker_sem; /* Signaled once per expired timer and once per worker on exit */
+};
+
+/* Context owned by each instance of the wheel thread */
+struct esif_tmrm_wheel_ctx {
+	int fd; /* timerfd used to wake the thread */
+	u32 generation; /* Thread exits when this no longer matches the manager */
 };
 
 struct esif_tmrm_item {
 	struct esif_timer_obj *timer_obj_ptr;
 
 	esif_ccb_timer_handle_t timer_handle;	/* Look-up handle */
-	/*
-	 * When the timer is set, a new CB handle is assigned
-	 * It is used to uniquely identify a "set" instance so that you do not
-	 * handle multiple threads associated with a single timer because
-	 * cancelling was unsuccesful at the OS level when a timer was reset.
-	 */
-	esif_ccb_timer_handle_t timer_cb_handle;
 
 	u8 is_in_cb; /* Is in CallBack */
 	u8 marked_for_delete;
@@ -107,7 +124,6 @@ struct esif_tmrm_item {
 struct esif_timer_manager g_tmrm = {0};
 
 u32 g_next_timer_handle = 0;
-u32 g_next_timer_cb_handle = 0;
 
 
 static enum esif_rc esif_ccb_timer_kill_w_event(
@@ -143,18 +159,10 @@ static struct esif_link_list_node *esif_ccb_tmrm_find_timer_node_wlock(
 	esif_ccb_timer_handle_t handle
 	);
 
-static struct esif_link_list_node *esif_ccb_tmrm_find_timer_node_by_cb_wlock(
-	esif_ccb_timer_handle_t cb_handle
-	);
-
 static enum esif_rc esif_ccb_tmrm_get_next_handle(
 	esif_ccb_timer_handle_t *handle_ptr
 	);
 	
-static void esif_ccb_tmrm_get_next_cb_handle_wlock(
-	esif_ccb_timer_handle_t *handle_ptr
-	);
-	
 static void esif_ccb_tmrm_destroy_timer_node_wlock(
 	struct esif_link_list_node *node_ptr
 	);
@@ -163,6 +171,31 @@ static void esif_ccb_tmrm_destroy_timer_node_wlock(
 static enum esif_rc esif_ccb_tmrm_get_first_timer(
 	esif_ccb_timer_t *timer_ptr
 	);
+
+static enum esif_rc esif_ccb_tmrm_start_thread_wlock(void);
+
+static Bool esif_ccb_tmrm_stop_thread_wlock(
+	esif_thread_t *thread_ptr
+	);
+
+static void *ESIF_CALLCONV esif_ccb_tmrm_wheel_thread(
+	void *ptr
+	);
+
+static void esif_ccb_tmrm_dispatch_expired_wlock(void);
+
+static void esif_ccb_tmrm_call_expired_wlock(
+	struct esif_timer_obj *timer_obj_ptr
+	);
+
+static enum esif_rc esif_ccb_tmrm_start_workers_wlock(void);
+
+static void esif_ccb_tmrm_stop_workers(void);
+
+static void *ESIF_CALLCONV esif_ccb_tmrm_worker_thread(
+	void *ptr
+	);
+
 /*
  * TIMER OBJECT FUNCTION PROTOTYPES
  */
@@ -178,8 +211,7 @@ static void esif_ccb_timer_obj_destroy(
 
 static void esif_ccb_timer_obj_save_pending_timeout(
 	struct esif_timer_obj *self,
-	esif_ccb_time_t timeout,
-	esif_ccb_timer_handle_t timer_cb_handle
+	esif_ccb_time_t timeout
 	);
 
 static enum esif_rc esif_ccb_timer_obj_set_pending_timeout(
@@ -221,6 +253,7 @@ enum esif_rc esif_ccb_timer_init(
 
 	/* Place the handle into the timer being initialized*/
 	timer_ptr->timer_handle = tmrm_item_ptr->timer_handle;
+	tmrm_item_ptr->timer_obj_ptr->owner_ptr = tmrm_item_ptr;
 
 	/*
 	 * We create the manager list dynamically so that we don't have to call
@@ -278,6 +311,8 @@ static enum esif_rc esif_ccb_timer_kill_w_event(
 	enum esif_rc rc = ESIF_E_UNSPECIFIED;
 	struct esif_tmrm_item *tmrm_item_ptr = NULL;
 	struct esif_link_list_node *node_ptr = NULL;
+	esif_thread_t wheel_thread = ESIF_THREAD_NULL;
+	Bool join_thread = ESIF_FALSE;
 
 	if (NULL == timer_ptr) {
 		rc = ESIF_E_PARAMETER_IS_NULL;
@@ -305,10 +340,19 @@ static enum esif_rc esif_ccb_timer_kill_w_event(
 	/* If not in callback, the timer can be destroyed now */
 	if (!tmrm_item_ptr->is_in_cb) {
 		esif_ccb_tmrm_destroy_timer_node_wlock(node_ptr);
+
+		/* Stop the wheel thread once the last timer is gone */
+		if (NULL == g_tmrm.timer_list_ptr) {
+			join_thread = esif_ccb_tmrm_stop_thread_wlock(&wheel_thread);
+		}
 	}
 	rc = ESIF_OK;
 lock_exit:
 	esif_ccb_write_unlock(&g_tmrm.mgr_lock);
+
+	if (join_thread) {
+		esif_ccb_thread_join(&wheel_thread);
+	}
 exit:
 	if ((rc != ESIF_OK) && (event_ptr != NULL)) {
 		esif_ccb_event_set(event_ptr);
@@ -334,7 +378,6 @@ enum esif_rc esif_ccb_timer_set_msec(
 	struct esif_link_list_node *node_ptr = NULL;
 	struct esif_tmrm_item *tmrm_item_ptr = NULL;
 	struct esif_timer_obj *timer_obj_ptr = NULL;
-	esif_ccb_timer_handle_t timer_cb_handle = {0};
 
 	if (NULL == timer_ptr) {
 		rc = ESIF_E_PARAMETER_IS_NULL;
@@ -365,15 +408,14 @@ enum esif_rc esif_ccb_timer_set_msec(
 		goto lock_exit;
 	}
 
-	esif_ccb_tmrm_get_next_cb_handle_wlock(&timer_cb_handle);
-	tmrm_item_ptr->timer_cb_handle = timer_cb_handle;
-
 	timer_obj_ptr = tmrm_item_ptr->timer_obj_ptr;
-	esif_ccb_timer_obj_save_pending_timeout(timer_obj_ptr,
-		timeout,
-		timer_cb_handle);
+	esif_ccb_timer_obj_save_pending_timeout(timer_obj_ptr, timeout);
 
 	if (!tmrm_item_ptr->is_in_cb) {
+		rc = esif_ccb_tmrm_start_thread_wlock();
+		if (rc != ESIF_OK)
+			goto lock_exit;
+
 		rc = esif_ccb_timer_obj_set_pending_timeout(timer_obj_ptr);
 	} else {
 		rc = ESIF_OK;
@@ -392,6 +434,9 @@ exit:
 enum esif_rc esif_ccb_tmrm_init(void)
 {
 	esif_ccb_lock_init(&g_tmrm.mgr_lock);
+	esif_ccb_sem_init(&g_tmrm.worker_sem);
+	esif_ccb_wheel_init(&g_tmrm.wheel);
+	g_tmrm.wheel_thread_state = ESIF_TMRM_THREAD_STOPPED;
 	g_tmrm.enabled = ESIF_TRUE;
 	return ESIF_OK;
 }
@@ -423,6 +468,8 @@ exit:
 void esif_ccb_tmrm_exit(void)
 {
 	esif_ccb_timer_t cur_timer;
+	esif_thread_t wheel_thread = ESIF_THREAD_NULL;
+	Bool join_thread = ESIF_FALSE;
 
 	if (!g_tmrm.enabled)
 		goto exit;
@@ -435,10 +482,18 @@ void esif_ccb_tmrm_exit(void)
 		esif_ccb_timer_kill_w_wait(&cur_timer);
 	}
 
-	/* Wait for any possible callbacks to be processed before exiting */
-	esif_ccb_sleep_msec(ESIF_TIMER_DISABLE_DELAY);
+	/* Wait for the wheel thread to exit so no callbacks are still in flight */
+	esif_ccb_write_lock(&g_tmrm.mgr_lock);
+	join_thread = esif_ccb_tmrm_stop_thread_wlock(&wheel_thread);
+	esif_ccb_write_unlock(&g_tmrm.mgr_lock);
+
+	if (join_thread) {
+		esif_ccb_thread_join(&wheel_thread);
+	}
+	esif_ccb_tmrm_stop_workers();
 
 	g_tmrm.enabled = ESIF_FALSE;
+	esif_ccb_sem_uninit(&g_tmrm.worker_sem);
 	esif_ccb_lock_uninit(&g_tmrm.mgr_lock);
 	g_tmrm.marked_for_delete = ESIF_FALSE;
 exit:
@@ -446,6 +501,23 @@ exit:
 }
 
 
+/*
+ * Sets the number of worker threads used to call timer callbacks. Takes effect
+ * when the worker threads are next started, which is when a timer is first set
+ * after the timer manager is initialized.
+ */
+enum esif_rc esif_ccb_tmrm_set_worker_count(
+	u32 count
+	)
+{
+	if (count > ESIF_TMRM_MAX_WORKERS) {
+		return ESIF_E_REQUEST_DATA_OUT_OF_BOUNDS;
+	}
+	g_tmrm.worker_count = count;
+	return ESIF_OK;
+}
+
+
 static enum esif_rc esif_ccb_tmrm_get_first_timer(
 	esif_ccb_timer_t *timer_ptr
 	)
@@ -475,52 +547,300 @@ exit:
 }
 
 
-void esif_ccb_tmrm_callback(
-	esif_ccb_timer_handle_t cb_handle
+static enum esif_rc esif_ccb_tmrm_start_thread_wlock(void)
+{
+	enum esif_rc rc = ESIF_OK;
+	struct esif_tmrm_wheel_ctx *ctx_ptr = NULL;
+
+	rc = esif_ccb_tmrm_start_workers_wlock();
+	if (rc != ESIF_OK)
+		goto exit;
+
+	if (ESIF_TMRM_THREAD_RUNNING == g_tmrm.wheel_thread_state)
+		goto exit;
+
+	/* A thread that exited on its own no longer needs the lock, so it may be joined here */
+	if (ESIF_TMRM_THREAD_EXITED == g_tmrm.wheel_thread_state) {
+		esif_ccb_thread_join(&g_tmrm.wheel_thread);
+		esif_ccb_thread_close(&g_tmrm.wheel_thread);
+		g_tmrm.wheel_thread_state = ESIF_TMRM_THREAD_STOPPED;
+	}
+
+	ctx_ptr = (struct esif_tmrm_wheel_ctx *)esif_ccb_malloc(sizeof(*ctx_ptr));
+	if (NULL == ctx_ptr) {
+		rc = ESIF_E_NO_MEMORY;
+		goto exit;
+	}
+
+	ctx_ptr->fd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+	if (ctx_ptr->fd < 0) {
+		rc = ESIF_E_UNSPECIFIED;
+		goto exit;
+	}
+	ctx_ptr->generation = ++g_tmrm.wheel_generation;
+
+	g_tmrm.wheel.fd = ctx_ptr->fd;
+	g_tmrm.wheel.armed = ESIF_CCB_WHEEL_NEVER;
+	g_tmrm.wheel.dispatching = ESIF_FALSE;
+
+	rc = esif_ccb_thread_create(&g_tmrm.wheel_thread, esif_ccb_tmrm_wheel_thread, ctx_ptr);
+	if (rc != ESIF_OK) {
+		g_tmrm.wheel.fd = -1;
+		goto exit;
+	}
+	g_tmrm.wheel_thread_state = ESIF_TMRM_THREAD_RUNNING;
+	ctx_ptr = NULL;
+exit:
+	if (ctx_ptr != NULL) {
+		if (ctx_ptr->fd >= 0)
+			close(ctx_ptr->fd);
+		esif_ccb_free(ctx_ptr);
+	}
+	return rc;
+}
+
+
+/*
+ * Stops the wheel thread, if any. Returns TRUE if the thread must be joined
+ * by the caller after releasing the lock.
+ */
+static Bool esif_ccb_tmrm_stop_thread_wlock(
+	esif_thread_t *thread_ptr
 	)
 {
-	struct esif_link_list_node *node_ptr = NULL;
-	struct esif_tmrm_item *tmrm_item_ptr = NULL;
-	struct esif_timer_obj *timer_obj_ptr = NULL;
+	Bool join_thread = ESIF_FALSE;
+
+	ESIF_ASSERT(thread_ptr != NULL);
+
+	switch (g_tmrm.wheel_thread_state) {
+	case ESIF_TMRM_THREAD_RUNNING:
+		g_tmrm.wheel_generation++;
+		esif_ccb_wheel_wake(&g_tmrm.wheel);
+		g_tmrm.wheel.fd = -1;
+		g_tmrm.wheel.armed = ESIF_CCB_WHEEL_NEVER;
+		/* fall through */
+	case ESIF_TMRM_THREAD_EXITED:
+		*thread_ptr = g_tmrm.wheel_thread;
+		esif_ccb_thread_close(&g_tmrm.wheel_thread);
+		join_thread = ESIF_TRUE;
+		break;
+	default:
+		break;
+	}
+	g_tmrm.wheel_thread_state = ESIF_TMRM_THREAD_STOPPED;
+	return join_thread;
+}
+
+
+/*
+ * Starts the callback worker threads, if any are configured and not yet running.
+ * Once started, the workers run until esif_ccb_tmrm_exit.
+ */
+static enum esif_rc esif_ccb_tmrm_start_workers_wlock(void)
+{
+	enum esif_rc rc = ESIF_OK;
+
+	if ((0 == g_tmrm.worker_count) || (g_tmrm.worker_threads != NULL))
+		goto exit;
+
+	g_tmrm.worker_threads = (esif_thread_t *)esif_ccb_malloc(g_tmrm.worker_count * sizeof(esif_thread_t));
+	if (NULL == g_tmrm.worker_threads) {
+		rc = ESIF_E_NO_MEMORY;
+		goto exit;
+	}
+	g_tmrm.workers_stopping = ESIF_FALSE;
+
+	for (g_tmrm.workers_started = 0; g_tmrm.workers_started < g_tmrm.worker_count; g_tmrm.workers_started++) {
+		rc = esif_ccb_thread_create(&g_tmrm.worker_threads[g_tmrm.workers_started], esif_ccb_tmrm_worker_thread, NULL);
+		if (rc != ESIF_OK)
+			break;
+	}
+
+	/* Run with the workers that did start; the wheel thread calls the callbacks if none did */
+	if (g_tmrm.workers_started > 0) {
+		rc = ESIF_OK;
+	} else {
+		esif_ccb_free(g_tmrm.worker_threads);
+		g_tmrm.worker_threads = NULL;
+	}
+exit:
+	return rc;
+}
+
+
+/* Stops and joins the callback worker threads; must be called without the lock */
+static void esif_ccb_tmrm_stop_workers(void)
+{
+	esif_thread_t *worker_threads = NULL;
+	u32 workers_started = 0;
+	u32 index = 0;
 
 	esif_ccb_write_lock(&g_tmrm.mgr_lock);
+	worker_threads = g_tmrm.worker_threads;
+	workers_started = g_tmrm.workers_started;
+	g_tmrm.worker_threads = NULL;
+	g_tmrm.workers_started = 0;
+	g_tmrm.workers_stopping = ESIF_TRUE;
+	for (index = 0; index < workers_started; index++) {
+		esif_ccb_sem_up(&g_tmrm.worker_sem);
+	}
+	esif_ccb_write_unlock(&g_tmrm.mgr_lock);
 
-	node_ptr = esif_ccb_tmrm_find_timer_node_by_cb_wlock(cb_handle);
+	for (index = 0; index < workers_started; index++) {
+		esif_ccb_thread_join(&worker_threads[index]);
+		esif_ccb_thread_close(&worker_threads[index]);
+	}
+	esif_ccb_free(worker_threads);
+}
 
-	if ((NULL == node_ptr) || (NULL == node_ptr->data_ptr)) {
-		goto lock_exit;	
+
+/*
+ * Worker thread which calls the callback of one expired timer each time the
+ * wheel thread signals that a timer has expired. A timer is only on the expired
+ * list while it is not in its callback, so callbacks of the same timer are never
+ * run concurrently, but callbacks of different timers may be.
+ */
+static void *ESIF_CALLCONV esif_ccb_tmrm_worker_thread(
+	void *ptr
+	)
+{
+	struct esif_ccb_wheel_node *wheel_node_ptr = NULL;
+
+	UNREFERENCED_PARAMETER(ptr);
+
+	for (;;) {
+		esif_ccb_sem_down(&g_tmrm.worker_sem);
+
+		esif_ccb_write_lock(&g_tmrm.mgr_lock);
+		if (g_tmrm.workers_stopping) {
+			esif_ccb_write_unlock(&g_tmrm.mgr_lock);
+			break;
+		}
+
+		/* NULL if the timer was killed or reset since it expired */
+		wheel_node_ptr = esif_ccb_wheel_pop_expired(&g_tmrm.wheel);
+		if (wheel_node_ptr != NULL) {
+			esif_ccb_tmrm_call_expired_wlock((struct esif_timer_obj *)wheel_node_ptr);
+
+			/* Let the wheel thread exit if that was the last timer */
+			if (NULL == g_tmrm.timer_list_ptr) {
+				esif_ccb_wheel_wake(&g_tmrm.wheel);
+			}
+		}
+		esif_ccb_write_unlock(&g_tmrm.mgr_lock);
 	}
+	return NULL;
+}
 
-	tmrm_item_ptr = (struct esif_tmrm_item *)node_ptr->data_ptr;
 
-	/* Clear the CB handle to lower probability of hitting same handle */
-	tmrm_item_ptr->timer_cb_handle = 0;
+/*
+ * Single thread which sleeps on the timerfd until the next timer in the wheel
+ * expires. It then hands each expired timer to a worker thread or, if there are
+ * no workers, calls the callbacks of all expired timers itself, one at a time.
+ */
+static void *ESIF_CALLCONV esif_ccb_tmrm_wheel_thread(
+	void *ptr
+	)
+{
+	struct esif_tmrm_wheel_ctx *ctx_ptr = (struct esif_tmrm_wheel_ctx *)ptr;
+	struct esif_ccb_wheel *wheel_ptr = &g_tmrm.wheel;
+	u64 expirations = 0;
+	ssize_t bytes = 0;
+	u32 expired = 0;
+
+	esif_ccb_write_lock(&g_tmrm.mgr_lock);
+
+	while (ctx_ptr->generation == g_tmrm.wheel_generation) {
+
+		/* Exit on our own once the last timer has been destroyed */
+		if (NULL == g_tmrm.timer_list_ptr) {
+			g_tmrm.wheel_thread_state = ESIF_TMRM_THREAD_EXITED;
+			wheel_ptr->fd = -1;
+			wheel_ptr->armed = ESIF_CCB_WHEEL_NEVER;
+			break;
+		}
+
+		wheel_ptr->dispatching = ESIF_TRUE;
+		expired = esif_ccb_wheel_run(wheel_ptr, esif_ccb_wheel_now(wheel_ptr));
+		if (g_tmrm.worker_threads != NULL) {
+			while (expired-- > 0) {
+				esif_ccb_sem_up(&g_tmrm.worker_sem);
+			}
+		} else {
+			esif_ccb_tmrm_dispatch_expired_wlock();
+		}
+
+		if (ctx_ptr->generation != g_tmrm.wheel_generation)
+			break;
+
+		wheel_ptr->dispatching = ESIF_FALSE;
+		esif_ccb_wheel_arm(wheel_ptr, esif_ccb_wheel_next_expiration(wheel_ptr));
+
+		esif_ccb_write_unlock(&g_tmrm.mgr_lock);
+		bytes = read(ctx_ptr->fd, &expirations, sizeof(expirations));
+		UNREFERENCED_PARAMETER(bytes);
+		esif_ccb_write_lock(&g_tmrm.mgr_lock);
+	}
+
+	esif_ccb_write_unlock(&g_tmrm.mgr_lock);
+
+	close(ctx_ptr->fd);
+	esif_ccb_free(ctx_ptr);
+	return NULL;
+}
+
+
+/*
+ * Calls the callback of each expired timer with the lock released. Timers
+ * killed or reset before their callback is called are simply removed from the
+ * expired list, so no stale callbacks are ever made.
+ */
+static void esif_ccb_tmrm_dispatch_expired_wlock(void)
+{
+	struct esif_ccb_wheel_node *wheel_node_ptr = NULL;
+
+	while ((wheel_node_ptr = esif_ccb_wheel_pop_expired(&g_tmrm.wheel)) != NULL) {
+		esif_ccb_tmrm_call_expired_wlock((struct esif_timer_obj *)wheel_node_ptr);
+	}
+}
+
+
+/*
+ * Calls the callback of a timer removed from the expired list with the lock
+ * released, then destroys the timer if it was killed in the meantime or sets
+ * any timeout requested while in the callback.
+ */
+static void esif_ccb_tmrm_call_expired_wlock(
+	struct esif_timer_obj *timer_obj_ptr
+	)
+{
+	struct esif_link_list_node *node_ptr = NULL;
+	struct esif_tmrm_item *tmrm_item_ptr = (struct esif_tmrm_item *)timer_obj_ptr->owner_ptr;
+
 	tmrm_item_ptr->is_in_cb = ESIF_TRUE;
 
 	esif_ccb_write_unlock(&g_tmrm.mgr_lock);
 
 	/* Call the timer callback function */
-	timer_obj_ptr = tmrm_item_ptr->timer_obj_ptr;
 	esif_ccb_timer_obj_call_cb(timer_obj_ptr);
 
 	/*
 	 * Upon return, perform post processing
-	 * Note:  The item and node pointers will still be valid as the node
-	 * will not be removed while in the callback function
+	 * Note:  The item will still be valid as it will not be
+	 * destroyed while in the callback function
 	 */
 	esif_ccb_write_lock(&g_tmrm.mgr_lock);
 
 	tmrm_item_ptr->is_in_cb = ESIF_FALSE;
 
 	if (tmrm_item_ptr->marked_for_delete) {
-		esif_ccb_tmrm_destroy_timer_node_wlock(node_ptr);
-		goto lock_exit;
+		node_ptr = esif_ccb_tmrm_find_timer_node_wlock(tmrm_item_ptr->timer_handle);
+		if (node_ptr != NULL)
+			esif_ccb_tmrm_destroy_timer_node_wlock(node_ptr);
+		return;
 	}
 
-	 esif_ccb_timer_obj_set_pending_timeout(timer_obj_ptr);
-lock_exit:
-	esif_ccb_write_unlock(&g_tmrm.mgr_lock);
-	return;
+	esif_ccb_timer_obj_set_pending_timeout(timer_obj_ptr);
 }
 
 
@@ -605,18 +925,6 @@ exit:
 }
 
 
-static void esif_ccb_tmrm_get_next_cb_handle_wlock(
-	esif_ccb_timer_handle_t *handle_ptr
-	)
-{
-	g_next_timer_cb_handle++;
-	if (0 == g_next_timer_cb_handle)
-		g_next_timer_cb_handle++;
-
-	*handle_ptr = (esif_ccb_timer_handle_t)(size_t)g_next_timer_cb_handle;
-}
-
-
 static struct esif_link_list_node *esif_ccb_tmrm_find_timer_node_wlock(
 	esif_ccb_timer_handle_t handle
 	)
@@ -642,31 +950,6 @@ exit:
 }
 
 
-static struct esif_link_list_node *esif_ccb_tmrm_find_timer_node_by_cb_wlock(
-	esif_ccb_timer_handle_t cb_handle
-	)
-{
-	struct esif_link_list_node *node_ptr = NULL;
-	struct esif_tmrm_item *tmrm_item_ptr = NULL;
-
-	if (NULL == g_tmrm.timer_list_ptr)
-		goto exit;
-
-	node_ptr = g_tmrm.timer_list_ptr->head_ptr;
-	while (node_ptr != NULL) {
-		tmrm_item_ptr = (struct esif_tmrm_item *)node_ptr->data_ptr;
-		if (NULL == tmrm_item_ptr) /* Should never happen */
-			continue;
-
-		if (cb_handle == tmrm_item_ptr->timer_cb_handle)
-			break;	
-		node_ptr = node_ptr->next_ptr;
-	}
-exit:
-	return node_ptr;
-}
-
-
 static void esif_ccb_tmrm_destroy_timer_node_wlock(
 	struct esif_link_list_node *node_ptr
 	)
@@ -775,7 +1058,7 @@ static void esif_ccb_timer_obj_destroy(
 	if (NULL == self)
 		return;
 
-	esif_ccb_timer_obj_disable_timer(self);
+	esif_ccb_timer_obj_disable_timer(self, &g_tmrm.wheel);
 
 	esif_ccb_free(self);
 }
@@ -792,15 +1075,13 @@ static void esif_ccb_timer_obj_call_cb(
 
 static void esif_ccb_timer_obj_save_pending_timeout(
 	struct esif_timer_obj *self,
-	esif_ccb_time_t timeout,
-	esif_ccb_timer_handle_t timer_cb_handle
+	esif_ccb_time_t timeout
 	)
 {
 	ESIF_ASSERT(self != NULL);
 
 	self->set_is_pending = ESIF_TRUE;
 	self->pending_timeout = timeout;
-	self->timer_cb_handle = timer_cb_handle;
 }
 
 
@@ -817,7 +1098,7 @@ static enum esif_rc esif_ccb_timer_obj_set_pending_timeout(
 
 	self->set_is_pending = ESIF_FALSE;
 
-	rc = esif_ccb_timer_obj_enable_timer(self, self->pending_timeout);
+	rc = esif_ccb_timer_obj_enable_timer(self, &g_tmrm.wheel, self->pending_timeout);
 exit:
 	return rc;
 }
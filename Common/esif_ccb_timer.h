@@ -80,13 +80,18 @@
  *
  *    esif_ccb_timer_set_msec - Sets the timeout and starts the timer
  *
- *    esif_ccb_timer_cb - Timer callback typedef
+ *    esif_ccb_timer_cb - Timer callback typedef (Unless worker threads are
+ *        configured, callbacks are called one at a time from a single timer
+ *        thread, so they should not block for long.)
  *
  *    esif_ccb_tmrm_init - May optionally be called before any timer is
  *        initialized (The code will self-initialize if not called, but calling
  *        this will prevent issues if more than one thread may attempt to create
  *        the first timer at the same time.)
  *
+ *    esif_ccb_tmrm_set_worker_count - Sets the number of worker threads which
+ *        call timer callbacks so that a slow callback does not delay others
+ *
  *    esif_ccb_tmrm_exit - Should be called to cleanup the timer manager after
  *        all timers are destroyed and no other timers will be created.
  *        This functions is expected to be called when the system is in a
@@ -142,6 +147,17 @@ enum esif_rc esif_ccb_tmrm_init(void);
  */
 void esif_ccb_tmrm_exit(void);
 
+/*
+ * Sets the number of worker threads that call timer callbacks. With the default
+ * of 0, all callbacks are called one at a time from the single timer thread, so
+ * a slow callback delays every other timer. With workers, callbacks of different
+ * timers may run concurrently, but a timer's callback never overlaps itself.
+ * Should be called before the first timer is set.
+ */
+enum esif_rc esif_ccb_tmrm_set_worker_count(
+	u32 count
+	);
+
 /*
  * Every init should have a matching kill to release resources.
  * Also, a timer should not be re-init'd without first killing it
@@ -172,10 +188,6 @@ enum esif_rc esif_ccb_timer_set_msec(
 	const esif_ccb_time_t timeout	/* Timeout in msec */
 	);
 
-void esif_ccb_tmrm_callback(
-	esif_ccb_timer_handle_t cb_handle
-	);
-
 #ifdef __cplusplus
 }
 #endif
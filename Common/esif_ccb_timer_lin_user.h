@@ -23,16 +23,64 @@
  * This file contains OS-specific implementation code and NOT interface code.
  */
 
+#include <time.h>
+#include <unistd.h>
+#include <sys/timerfd.h>
 
-#include <signal.h>
+/*
+ * Timer Wheel
+ *
+ * Armed timers are kept in a hierarchical timing wheel with a resolution of
+ * one tick (1 msec of CLOCK_MONOTONIC since the wheel was initialized). Each
+ * level has 64 slots, each covering 64 times the ticks of a slot on the level
+ * below it, so 5 levels cover 2^30 msec (~12 days). Timeouts beyond that are
+ * clamped to the last level and re-cascaded until they are due.
+ *
+ * Each slot is a circular list of intrusive nodes and each level keeps a bitmap
+ * of non-empty slots, so adding or removing a timer is O(1) and finding the next
+ * expiration does not walk empty slots. All wheel functions must be called with
+ * the timer manager lock held; they do not block except to reprogram the timerfd
+ * that wakes the thread which runs the wheel.
+ */
+#define ESIF_CCB_WHEEL_LEVELS		5
+#define ESIF_CCB_WHEEL_SLOT_BITS	6
+#define ESIF_CCB_WHEEL_SLOTS		(1 << ESIF_CCB_WHEEL_SLOT_BITS)
+#define ESIF_CCB_WHEEL_SLOT_MASK	(ESIF_CCB_WHEEL_SLOTS - 1)
+#define ESIF_CCB_WHEEL_MAX_DELTA	(((u64)1 << (ESIF_CCB_WHEEL_LEVELS * ESIF_CCB_WHEEL_SLOT_BITS)) - 1)
+#define ESIF_CCB_WHEEL_EXPIRED		ESIF_CCB_WHEEL_LEVELS	/* Node level when on the expired list */
+#define ESIF_CCB_WHEEL_NEVER		((u64)-1)
 
-typedef void (*esif_ccb_tmrm_cb_t)(esif_ccb_timer_handle_t cb_handle);
+/*
+ * Optional timer slack in msec. The timerfd is armed this long after the next
+ * expiration so that timers expiring close together are dispatched in a single
+ * wakeup. Timers never fire early, but may fire up to this much late.
+ */
+#ifndef ESIF_CCB_TIMER_SLACK_MSEC
+#define ESIF_CCB_TIMER_SLACK_MSEC	0
+#endif
 
-#pragma pack(push, 1)
+struct esif_ccb_wheel_node {
+	struct esif_ccb_wheel_node *next_ptr;
+	struct esif_ccb_wheel_node *prev_ptr;
+	u64 expires;	/* Expiration tick */
+	u8 level;	/* Wheel level, or ESIF_CCB_WHEEL_EXPIRED */
+	u8 slot;	/* Slot within level */
+};
+
+struct esif_ccb_wheel {
+	struct esif_ccb_wheel_node slots[ESIF_CCB_WHEEL_LEVELS][ESIF_CCB_WHEEL_SLOTS];
+	u64 bitmaps[ESIF_CCB_WHEEL_LEVELS];	/* Non-empty slots of each level */
+	struct esif_ccb_wheel_node expired;	/* Expired timers waiting to be dispatched */
+	u64 epoch;		/* CLOCK_MONOTONIC nsec of tick 0 */
+	u64 cur;		/* Next tick to be processed */
+	u32 count;		/* Number of timers in the wheel (excluding expired) */
+	int fd;			/* timerfd used to wake the wheel thread or -1 */
+	u64 armed;		/* Tick the timerfd is armed for or ESIF_CCB_WHEEL_NEVER */
+	u8 dispatching;		/* Wheel thread is awake and will rearm the timerfd itself */
+};
 
 struct esif_timer_obj {
-	/* TODO: OS-specific items*/
-	timer_t  timer;
+	struct esif_ccb_wheel_node node;	/* Wheel linkage (must be first) */
 
 	esif_ccb_timer_cb function_ptr;		/* Callback when timer fires */
 	void *context_ptr;			/* Callback context if any */
@@ -46,92 +94,381 @@ struct esif_timer_obj {
 	 */
 	u8 set_is_pending;
 	esif_ccb_time_t pending_timeout;
-	esif_ccb_timer_handle_t timer_cb_handle;
+	void *owner_ptr;			/* Timer manager item owning this object */
 };
 
-struct esif_tmrm_cb_obj {
-	esif_ccb_tmrm_cb_t func;
-	esif_ccb_timer_handle_t cb_handle;
-};
 
-#pragma pack(pop)
+static ESIF_INLINE u64 esif_ccb_wheel_clock(void)
+{
+	struct timespec ts = {0};
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((u64)ts.tv_sec * 1000000000) + (u64)ts.tv_nsec;
+}
 
-static ESIF_INLINE void esif_ccb_timer_obj_disable_timer(
-	struct esif_timer_obj *self
-	);
 
-static ESIF_INLINE enum esif_rc esif_ccb_timer_obj_create_timer(
-	struct esif_timer_obj *self
+/* Current tick, rounded down */
+static ESIF_INLINE u64 esif_ccb_wheel_now(
+	struct esif_ccb_wheel *self
 	)
 {
-	UNREFERENCED_PARAMETER(self);
+	return (esif_ccb_wheel_clock() - self->epoch) / 1000000;
+}
 
-	return ESIF_OK;
+
+static ESIF_INLINE void esif_ccb_wheel_list_init(
+	struct esif_ccb_wheel_node *head_ptr
+	)
+{
+	head_ptr->next_ptr = head_ptr;
+	head_ptr->prev_ptr = head_ptr;
 }
 
-static ESIF_INLINE enum esif_rc esif_ccb_timer_obj_enable_timer(
-	struct esif_timer_obj *self,
-	const esif_ccb_time_t timeout	/* Timeout in msec */
+
+static ESIF_INLINE void esif_ccb_wheel_list_add(
+	struct esif_ccb_wheel_node *head_ptr,
+	struct esif_ccb_wheel_node *node_ptr
 	)
 {
-	enum esif_rc rc = ESIF_OK;
-	struct sigevent se = { 0 };
-	struct itimerspec its = { 0 };
-	u64 freq_nanosecs = timeout * 1000 * 1000; /* convert msec to nsec */
-	struct esif_tmrm_cb_obj *cb_object_ptr = NULL;
+	node_ptr->next_ptr = head_ptr;
+	node_ptr->prev_ptr = head_ptr->prev_ptr;
+	head_ptr->prev_ptr->next_ptr = node_ptr;
+	head_ptr->prev_ptr = node_ptr;
+}
 
-	ESIF_ASSERT(self != NULL);
 
-	esif_ccb_timer_obj_disable_timer(self);
+static ESIF_INLINE void esif_ccb_wheel_init(
+	struct esif_ccb_wheel *self
+	)
+{
+	int level = 0;
+	int slot = 0;
+
+	for (level = 0; level < ESIF_CCB_WHEEL_LEVELS; level++) {
+		for (slot = 0; slot < ESIF_CCB_WHEEL_SLOTS; slot++) {
+			esif_ccb_wheel_list_init(&self->slots[level][slot]);
+		}
+		self->bitmaps[level] = 0;
+	}
+	esif_ccb_wheel_list_init(&self->expired);
+	self->epoch = esif_ccb_wheel_clock();
+	self->cur = 0;
+	self->count = 0;
+	self->fd = -1;
+	self->armed = ESIF_CCB_WHEEL_NEVER;
+	self->dispatching = ESIF_FALSE;
+}
+
+
+/* Place a node in the slot for its expiration relative to the current tick */
+static ESIF_INLINE void esif_ccb_wheel_place(
+	struct esif_ccb_wheel *self,
+	struct esif_ccb_wheel_node *node_ptr
+	)
+{
+	u64 expires = node_ptr->expires;
+	u64 delta = 0;
+	u8 level = 0;
+	u8 slot = 0;
+
+	if (expires < self->cur) {
+		expires = self->cur;
+	}
+	delta = expires - self->cur;
+	if (delta > ESIF_CCB_WHEEL_MAX_DELTA) {
+		delta = ESIF_CCB_WHEEL_MAX_DELTA;
+		expires = self->cur + delta;
+	}
+	while ((level < ESIF_CCB_WHEEL_LEVELS - 1) &&
+		(delta >> ((level + 1) * ESIF_CCB_WHEEL_SLOT_BITS)) != 0) {
+		level++;
+	}
+	slot = (u8)((expires >> (level * ESIF_CCB_WHEEL_SLOT_BITS)) & ESIF_CCB_WHEEL_SLOT_MASK);
+
+	node_ptr->level = level;
+	node_ptr->slot = slot;
+	esif_ccb_wheel_list_add(&self->slots[level][slot], node_ptr);
+	self->bitmaps[level] |= ((u64)1 << slot);
+	self->count++;
+}
+
+
+/* Unlink a node from the wheel or the expired list; no-op if not linked */
+static ESIF_INLINE void esif_ccb_wheel_remove(
+	struct esif_ccb_wheel *self,
+	struct esif_ccb_wheel_node *node_ptr
+	)
+{
+	if (NULL == node_ptr->next_ptr) {
+		return;
+	}
+
+	node_ptr->prev_ptr->next_ptr = node_ptr->next_ptr;
+	node_ptr->next_ptr->prev_ptr = node_ptr->prev_ptr;
+
+	if (node_ptr->level < ESIF_CCB_WHEEL_LEVELS) {
+		struct esif_ccb_wheel_node *head_ptr = &self->slots[node_ptr->level][node_ptr->slot];
+		if (head_ptr->next_ptr == head_ptr) {
+			self->bitmaps[node_ptr->level] &= ~((u64)1 << node_ptr->slot);
+		}
+		self->count--;
+	}
+	node_ptr->next_ptr = NULL;
+	node_ptr->prev_ptr = NULL;
+}
+
+
+/* Program the timerfd to expire at the given tick (plus slack), or disarm it */
+static ESIF_INLINE void esif_ccb_wheel_arm(
+	struct esif_ccb_wheel *self,
+	u64 tick
+	)
+{
+	struct itimerspec its = {{0}};
+	u64 nsec = 0;
+
+	self->armed = tick;
+	if (self->fd < 0) {
+		return;
+	}
+	if (tick != ESIF_CCB_WHEEL_NEVER) {
+		nsec = self->epoch + ((tick + ESIF_CCB_TIMER_SLACK_MSEC) * 1000000);
+		its.it_value.tv_sec = (time_t)(nsec / 1000000000);
+		its.it_value.tv_nsec = (long)(nsec % 1000000000);
+	}
+	timerfd_settime(self->fd, TFD_TIMER_ABSTIME, &its, NULL);
+}
+
+
+/* Wake the wheel thread immediately */
+static ESIF_INLINE void esif_ccb_wheel_wake(
+	struct esif_ccb_wheel *self
+	)
+{
+	struct itimerspec its = {{0}};
+
+	if (self->fd >= 0) {
+		its.it_value.tv_nsec = 1; /* Absolute time in the past */
+		timerfd_settime(self->fd, TFD_TIMER_ABSTIME, &its, NULL);
+	}
+}
+
+
+/* Add a node expiring timeout msec from now, waking the wheel thread if it is now the earliest */
+static ESIF_INLINE void esif_ccb_wheel_add(
+	struct esif_ccb_wheel *self,
+	struct esif_ccb_wheel_node *node_ptr,
+	const esif_ccb_time_t timeout
+	)
+{
+	u64 elapsed = esif_ccb_wheel_clock() - self->epoch;
+	u64 now = elapsed / 1000000;
+
+	esif_ccb_wheel_remove(self, node_ptr);
+
+	/* Round up so the timer never fires early */
+	node_ptr->expires = (elapsed + (timeout * 1000000) + 999999) / 1000000;
 
-	/* Use native malloc() because if the associated timer is disabled
-	 * (due to ESIF UF exiting for example), then the esif_ccb_memtrace functions
-	 * will report memory leaks. This is not a real issue though because once
-	 * the daemon process exists, all the heaps allocated by esif_ufd will
-	 * be reclaimed by the OS.
+	/* Keep placement relative to the current time when the wheel is idle */
+	if ((0 == self->count) && (self->cur < now)) {
+		self->cur = now;
+	}
+	esif_ccb_wheel_place(self, node_ptr);
+
+	if (!self->dispatching && (node_ptr->expires < self->armed)) {
+		esif_ccb_wheel_arm(self, node_ptr->expires);
+	}
+}
+
+
+/* Rotate a slot bitmap right so that bit 0 corresponds to the given slot */
+static ESIF_INLINE u64 esif_ccb_wheel_rotate(
+	u64 bitmap,
+	u64 slot
+	)
+{
+	slot &= ESIF_CCB_WHEEL_SLOT_MASK;
+	return (slot ? ((bitmap >> slot) | (bitmap << (ESIF_CCB_WHEEL_SLOTS - slot))) : bitmap);
+}
+
+
+/*
+ * Returns the first tick at or after the current tick at which the given level
+ * has a non-empty slot to process: the slot's tick for level 0, or the tick at
+ * which the slot is cascaded to the level below for higher levels.
+ */
+static ESIF_INLINE u64 esif_ccb_wheel_next_slot_tick(
+	struct esif_ccb_wheel *self,
+	int level
+	)
+{
+	u64 bitmap = self->bitmaps[level];
+	int shift = level * ESIF_CCB_WHEEL_SLOT_BITS;
+	u64 block = self->cur >> shift;
+	u64 start = 0;
+
+	if (0 == bitmap) {
+		return ESIF_CCB_WHEEL_NEVER;
+	}
+
+	/* A cascade boundary at the current tick is still pending */
+	if (self->cur & (((u64)1 << shift) - 1)) {
+		start = 1;
+	}
+	block += start;
+	return (block + (u64)__builtin_ctzll(esif_ccb_wheel_rotate(bitmap, block))) << shift;
+}
+
+
+/* Returns the earliest expiration tick of all timers in the wheel */
+static ESIF_INLINE u64 esif_ccb_wheel_next_expiration(
+	struct esif_ccb_wheel *self
+	)
+{
+	u64 next = esif_ccb_wheel_next_slot_tick(self, 0);
+	int level = 0;
+
+	/*
+	 * The first non-empty slot of a level holds timers that expire before
+	 * those in its later slots, so only that slot needs to be examined.
 	 */
-	cb_object_ptr = (struct esif_tmrm_cb_obj *) malloc(sizeof(*cb_object_ptr));
-	if (NULL == cb_object_ptr) {
-		rc = ESIF_E_NO_MEMORY;
-		goto exit;
+	for (level = 1; level < ESIF_CCB_WHEEL_LEVELS; level++) {
+		u64 tick = esif_ccb_wheel_next_slot_tick(self, level);
+		struct esif_ccb_wheel_node *head_ptr = NULL;
+		struct esif_ccb_wheel_node *node_ptr = NULL;
+
+		if ((ESIF_CCB_WHEEL_NEVER == tick) || (tick >= next)) {
+			continue;
+		}
+		head_ptr = &self->slots[level][(tick >> (level * ESIF_CCB_WHEEL_SLOT_BITS)) & ESIF_CCB_WHEEL_SLOT_MASK];
+		for (node_ptr = head_ptr->next_ptr; node_ptr != head_ptr; node_ptr = node_ptr->next_ptr) {
+			if (node_ptr->expires < next) {
+				next = node_ptr->expires;
+			}
+		}
 	}
-	cb_object_ptr->func = esif_ccb_tmrm_callback;
-	cb_object_ptr->cb_handle = self->timer_cb_handle;
+	if ((next != ESIF_CCB_WHEEL_NEVER) && (next < self->cur)) {
+		next = self->cur;
+	}
+	return next;
+}
+
+
+/* Re-place all nodes of a slot relative to the current tick */
+static ESIF_INLINE void esif_ccb_wheel_cascade(
+	struct esif_ccb_wheel *self,
+	int level
+	)
+{
+	u8 slot = (u8)((self->cur >> (level * ESIF_CCB_WHEEL_SLOT_BITS)) & ESIF_CCB_WHEEL_SLOT_MASK);
+	struct esif_ccb_wheel_node *head_ptr = &self->slots[level][slot];
+	struct esif_ccb_wheel_node *node_ptr = NULL;
+
+	while ((node_ptr = head_ptr->next_ptr) != head_ptr) {
+		esif_ccb_wheel_remove(self, node_ptr);
+		esif_ccb_wheel_place(self, node_ptr);
+	}
+}
 
-	se.sigev_notify = SIGEV_SIGNAL;
-	se.sigev_signo = SIGRTMIN;
-	se.sigev_value.sival_ptr = cb_object_ptr;
 
-	if (0 != timer_create(CLOCK_REALTIME,
-		&se,
-		(timer_t *)&self->timer)) {
-		rc = ESIF_E_UNSPECIFIED;
-		goto exit;
-	} 
+/*
+ * Process all ticks up to and including now, moving due timers to the expired
+ * list. Returns the number of timers moved.
+ */
+static ESIF_INLINE u32 esif_ccb_wheel_run(
+	struct esif_ccb_wheel *self,
+	u64 now
+	)
+{
+	struct esif_ccb_wheel_node *head_ptr = NULL;
+	struct esif_ccb_wheel_node *node_ptr = NULL;
+	u64 next = 0;
+	int level = 0;
+	u32 expired = 0;
+
+	while (self->count > 0) {
+		/* Skip directly to the next tick that has a slot to process */
+		next = esif_ccb_wheel_next_slot_tick(self, 0);
+		for (level = 1; level < ESIF_CCB_WHEEL_LEVELS; level++) {
+			u64 tick = esif_ccb_wheel_next_slot_tick(self, level);
+			if (tick < next) {
+				next = tick;
+			}
+		}
+		if (next > now) {
+			break;
+		}
+		self->cur = next;
 
-	its.it_value.tv_sec     = freq_nanosecs / 1000000000;
-	its.it_value.tv_nsec    = freq_nanosecs % 1000000000;
-	its.it_interval.tv_sec  = 0;
-	its.it_interval.tv_nsec = 0;
+		for (level = ESIF_CCB_WHEEL_LEVELS - 1; level > 0; level--) {
+			if (0 == (self->cur & (((u64)1 << (level * ESIF_CCB_WHEEL_SLOT_BITS)) - 1))) {
+				esif_ccb_wheel_cascade(self, level);
+			}
+		}
 
-	if (0 != timer_settime(self->timer, 0, &its, NULL)) {
-		rc = ESIF_E_UNSPECIFIED;
-		goto exit;
+		head_ptr = &self->slots[0][self->cur & ESIF_CCB_WHEEL_SLOT_MASK];
+		while ((node_ptr = head_ptr->next_ptr) != head_ptr) {
+			esif_ccb_wheel_remove(self, node_ptr);
+			node_ptr->level = ESIF_CCB_WHEEL_EXPIRED;
+			esif_ccb_wheel_list_add(&self->expired, node_ptr);
+			expired++;
+		}
+		self->cur++;
 	}
-exit:
-	return rc;
+	if (self->cur <= now) {
+		self->cur = now + 1;
+	}
+	return expired;
 }
 
 
-static ESIF_INLINE void esif_ccb_timer_obj_disable_timer(
+/* Remove and return the first expired node, or NULL if none */
+static ESIF_INLINE struct esif_ccb_wheel_node *esif_ccb_wheel_pop_expired(
+	struct esif_ccb_wheel *self
+	)
+{
+	struct esif_ccb_wheel_node *node_ptr = self->expired.next_ptr;
+
+	if (node_ptr == &self->expired) {
+		return NULL;
+	}
+	esif_ccb_wheel_remove(self, node_ptr);
+	return node_ptr;
+}
+
+
+static ESIF_INLINE enum esif_rc esif_ccb_timer_obj_create_timer(
 	struct esif_timer_obj *self
 	)
+{
+	UNREFERENCED_PARAMETER(self);
+
+	return ESIF_OK;
+}
+
+
+static ESIF_INLINE enum esif_rc esif_ccb_timer_obj_enable_timer(
+	struct esif_timer_obj *self,
+	struct esif_ccb_wheel *wheel_ptr,
+	const esif_ccb_time_t timeout	/* Timeout in msec */
+	)
 {
 	ESIF_ASSERT(self != NULL);
+	ESIF_ASSERT(wheel_ptr != NULL);
 
-	if (self->timer != 0) {
-		timer_delete(self->timer);
-		self->timer = 0;
-	}
+	self->timeout = timeout;
+	esif_ccb_wheel_add(wheel_ptr, &self->node, timeout);
+	return ESIF_OK;
 }
 
+
+static ESIF_INLINE void esif_ccb_timer_obj_disable_timer(
+	struct esif_timer_obj *self,
+	struct esif_ccb_wheel *wheel_ptr
+	)
+{
+	ESIF_ASSERT(self != NULL);
+	ESIF_ASSERT(wheel_ptr != NULL);
+
+	esif_ccb_wheel_remove(wheel_ptr, &self->node);
+}
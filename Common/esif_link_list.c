@@ -53,6 +53,27 @@
 
 #include "esif_link_list.h"
 
+#ifdef ESIF_FEAT_OPT_MEMPOOL
+#include "esif.h"
+
+/* Nodes are allocated from the List Node Memory Pool once it exists */
+static ESIF_INLINE struct esif_link_list_node *esif_link_list_alloc_node(void)
+{
+	struct esif_link_list_node *node_ptr = (struct esif_link_list_node *)
+		esif_ccb_mempool_alloc(ESIF_MEMPOOL_TYPE_LIST_NODE);
+
+	if (NULL == node_ptr) {
+		node_ptr = (struct esif_link_list_node *)esif_ccb_malloc(sizeof(*node_ptr));
+	}
+	return node_ptr;
+}
+
+#define esif_link_list_free_node(node_ptr)	esif_ccb_mempool_free(ESIF_MEMPOOL_TYPE_LIST_NODE, node_ptr)
+#else
+#define esif_link_list_alloc_node()		((struct esif_link_list_node *)esif_ccb_malloc(sizeof(struct esif_link_list_node)))
+#define esif_link_list_free_node(node_ptr)	esif_ccb_free(node_ptr)
+#endif
+
 enum esif_rc esif_link_list_init(void)
 {
 	/* Placeholder...should be called in case this is changed in the future */
@@ -165,8 +186,7 @@ struct esif_link_list_node *esif_link_list_create_node(void *data_ptr)
 {
 	struct esif_link_list_node *new_node_ptr = NULL;
 
-	new_node_ptr = (struct esif_link_list_node *)
-			esif_ccb_malloc(sizeof(*new_node_ptr));
+	new_node_ptr = esif_link_list_alloc_node();
 	if (NULL == new_node_ptr)
 		goto exit;
 
@@ -181,7 +201,7 @@ exit:
 /* Destroy Node */
 void esif_link_list_destroy_node(struct esif_link_list_node *node_ptr)
 {
-	esif_ccb_free(node_ptr);
+	esif_link_list_free_node(node_ptr);
 }
 
 
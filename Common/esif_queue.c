@@ -53,6 +53,10 @@
 #include "esif_queue.h"
 #include "esif_ccb_string.h"
 
+static enum esif_rc esif_queue_ring_enqueue(struct esif_queue_instance *self, void *data_ptr);
+static enum esif_rc esif_queue_ring_requeue(struct esif_queue_instance *self, void *data_ptr);
+static void *esif_queue_ring_dequeue(struct esif_queue_instance *self);
+
 /* Queue Create */
 struct esif_queue_instance *esif_queue_create(
 	u32 depth,
@@ -94,6 +98,42 @@ exit:
 }
 
 
+/* Queue Create (Ring Buffer) */
+struct esif_queue_instance *esif_queue_create_ring(
+	u32 depth,
+	char *name_ptr,
+	u32 ms_timeout,
+	u32 ring_size
+	)
+{
+	struct esif_queue_instance *queue_ptr = NULL;
+	u32 capacity = 2;
+	u32 i = 0;
+
+	queue_ptr = esif_queue_create(depth, name_ptr, ms_timeout);
+	if (NULL == queue_ptr)
+		goto exit;
+
+	while ((capacity < ring_size) && (capacity < ESIF_QUEUE_RING_SIZE_MAX))
+		capacity <<= 1;
+
+	queue_ptr->ring_ptr = (struct esif_queue_cell *)
+		esif_ccb_malloc(sizeof(*queue_ptr->ring_ptr) * capacity);
+	if (NULL == queue_ptr->ring_ptr) {
+		esif_queue_destroy(queue_ptr, NULL);
+		queue_ptr = NULL;
+		goto exit;
+	}
+
+	for (i = 0; i < capacity; i++)
+		atomic_set(&queue_ptr->ring_ptr[i].sequence, i);
+
+	queue_ptr->ring_mask = capacity - 1;
+exit:
+	return queue_ptr;
+}
+
+
 /* Queue Destroy */
 void esif_queue_destroy(
 	struct esif_queue_instance *self,
@@ -117,6 +157,7 @@ void esif_queue_destroy(
 	esif_ccb_event_uninit(&self->event);
 	esif_ccb_lock_uninit(&self->lock);
 
+	esif_ccb_free(self->ring_ptr);
 	esif_ccb_free(self->queue_list_ptr);
 	esif_ccb_free(self);
 exit:
@@ -135,16 +176,21 @@ enum esif_rc esif_queue_enqueue(
 	if (NULL == self)
 		goto exit;
 
+	if (self->ring_ptr != NULL) {
+		rc = esif_queue_ring_enqueue(self, data_ptr);
+		goto exit;
+	}
+
 	esif_ccb_write_lock(&self->lock);
 
-	if (self->current_size >= self->max_size)
+	if (atomic_read(&self->current_size) >= self->max_size)
 		goto lock_exit;
 
 	rc = esif_link_list_add_at_back(self->queue_list_ptr, data_ptr);
 	if (rc != ESIF_OK)
 		goto lock_exit;
 
-	self->current_size++;
+	atomic_inc(&self->current_size);
 
 	/* Wakeup */
 	esif_ccb_event_set(&self->event);
@@ -174,9 +220,14 @@ enum esif_rc esif_queue_requeue(
 	if (NULL == self)
 		goto exit;
 
+	if (self->ring_ptr != NULL) {
+		rc = esif_queue_ring_requeue(self, data_ptr);
+		goto exit;
+	}
+
 	esif_ccb_write_lock(&self->lock);
 
-	if (self->current_size >= self->max_size)
+	if (atomic_read(&self->current_size) >= self->max_size)
 		goto lock_exit;
 
 	node_ptr = esif_link_list_create_node(data_ptr);
@@ -185,7 +236,7 @@ enum esif_rc esif_queue_requeue(
 
 	/* Put at front; insted of back for requeue */
 	esif_link_list_add_node_at_front(self->queue_list_ptr, node_ptr);
-	self->current_size++;
+	atomic_inc(&self->current_size);
 
 	esif_queue_signal_event(self);
 
@@ -206,11 +257,16 @@ void *esif_queue_dequeue(struct esif_queue_instance *self)
 	if ((NULL == self)  || (NULL == self->queue_list_ptr))
 		goto exit;
 
+	if (self->ring_ptr != NULL) {
+		data_ptr = esif_queue_ring_dequeue(self);
+		goto exit;
+	}
+
 	esif_ccb_write_lock(&self->lock);
 
 	node_ptr = self->queue_list_ptr->head_ptr;
 	if (NULL == node_ptr) {
-		self->current_size = 0;
+		atomic_set(&self->current_size, 0);
 		goto lock_exit;
 	}
 
@@ -218,10 +274,10 @@ void *esif_queue_dequeue(struct esif_queue_instance *self)
 
 	esif_link_list_node_remove(self->queue_list_ptr, node_ptr);
 
-	self->current_size--;
+	atomic_dec(&self->current_size);
 
 lock_exit:
-	if (!self->current_size) {
+	if (!atomic_read(&self->current_size)) {
 		esif_ccb_event_reset(&self->event);
 	}
 	esif_ccb_write_unlock(&self->lock);
@@ -261,7 +317,7 @@ u32 esif_queue_size(struct esif_queue_instance *self)
 	if (NULL == self)
 		return 0;
 
-	return self->current_size;
+	return (u32)atomic_read(&self->current_size);
 }
 
 /* Used to allow a waiting event thread to exit before destruction */
@@ -272,6 +328,217 @@ void esif_queue_signal_event(struct esif_queue_instance *self)
 }
 
 
+/*
+ * Ring Buffer Implementation
+ * Bounded multi-producer queue; each cell's sequence number is advanced by the
+ * producer once the item is stored and by the consumer once it is removed, so
+ * that positions are claimed with a single compare-and-swap and no lock.
+ */
+
+/* Returns ESIF_FALSE if the ring is full */
+static Bool esif_queue_ring_push(
+	struct esif_queue_instance *self,
+	void *data_ptr
+	)
+{
+	struct esif_queue_cell *cell_ptr = NULL;
+	atomic_basetype pos = atomic_read(&self->enqueue_pos);
+	atomic_basetype diff = 0;
+
+	for (;;) {
+		cell_ptr = &self->ring_ptr[pos & self->ring_mask];
+		diff = atomic_read(&cell_ptr->sequence) - pos;
+
+		if (0 == diff) {
+			if (atomic_cmpxchg(&self->enqueue_pos, pos, pos + 1) == pos) {
+				cell_ptr->data_ptr = data_ptr;
+				atomic_set(&cell_ptr->sequence, pos + 1);
+				return ESIF_TRUE;
+			}
+		} else if (diff < 0) {
+			return ESIF_FALSE;
+		}
+		pos = atomic_read(&self->enqueue_pos);
+	}
+}
+
+
+/* Returns NULL if the ring is empty */
+static void *esif_queue_ring_pop(struct esif_queue_instance *self)
+{
+	struct esif_queue_cell *cell_ptr = NULL;
+	atomic_basetype pos = atomic_read(&self->dequeue_pos);
+	atomic_basetype diff = 0;
+	void *data_ptr = NULL;
+
+	for (;;) {
+		cell_ptr = &self->ring_ptr[pos & self->ring_mask];
+		diff = atomic_read(&cell_ptr->sequence) - (pos + 1);
+
+		if (0 == diff) {
+			if (atomic_cmpxchg(&self->dequeue_pos, pos, pos + 1) == pos) {
+				data_ptr = cell_ptr->data_ptr;
+				atomic_set(&cell_ptr->sequence, pos + self->ring_mask + 1);
+				return data_ptr;
+			}
+		} else if (diff < 0) {
+			return NULL;
+		}
+		pos = atomic_read(&self->dequeue_pos);
+	}
+}
+
+
+/*
+ * Wakeup the consumer; only the first producer after the consumer last found
+ * the queue empty sets the event, so the others do not take the event lock
+ */
+static void esif_queue_ring_wake(struct esif_queue_instance *self)
+{
+	if (0 == atomic_cmpxchg(&self->wake_pending, 0, 1))
+		esif_ccb_event_set(&self->event);
+}
+
+
+static enum esif_rc esif_queue_ring_enqueue(
+	struct esif_queue_instance *self,
+	void *data_ptr
+	)
+{
+	enum esif_rc rc = ESIF_OK;
+
+	if (atomic_inc(&self->current_size) > self->max_size) {
+		atomic_dec(&self->current_size);
+		rc = ESIF_E_NO_MEMORY;
+		goto exit;
+	}
+
+	/* Items must go to the overflow list while it is in use to maintain order */
+	if ((0 == atomic_read(&self->overflow_count)) && esif_queue_ring_push(self, data_ptr))
+		goto wake;
+
+	esif_ccb_write_lock(&self->lock);
+
+	if ((0 == atomic_read(&self->overflow_count)) && esif_queue_ring_push(self, data_ptr)) {
+		esif_ccb_write_unlock(&self->lock);
+		goto wake;
+	}
+
+	rc = esif_link_list_add_at_back(self->queue_list_ptr, data_ptr);
+	if (ESIF_OK == rc) {
+		atomic_inc(&self->overflow_count);
+		self->overflow_total++;
+	}
+
+	esif_ccb_write_unlock(&self->lock);
+
+	if (rc != ESIF_OK) {
+		atomic_dec(&self->current_size);
+		goto exit;
+	}
+wake:
+	esif_queue_ring_wake(self);
+exit:
+	return rc;
+}
+
+
+/* Requeued items are kept at the front of the list and returned before any others */
+static enum esif_rc esif_queue_ring_requeue(
+	struct esif_queue_instance *self,
+	void *data_ptr
+	)
+{
+	enum esif_rc rc = ESIF_E_NO_MEMORY;
+	struct esif_link_list_node *node_ptr = NULL;
+
+	esif_ccb_write_lock(&self->lock);
+
+	if (atomic_read(&self->current_size) >= self->max_size)
+		goto lock_exit;
+
+	node_ptr = esif_link_list_create_node(data_ptr);
+	if (NULL == node_ptr)
+		goto lock_exit;
+
+	esif_link_list_add_node_at_front(self->queue_list_ptr, node_ptr);
+	atomic_inc(&self->requeue_count);
+	atomic_inc(&self->current_size);
+
+	esif_queue_signal_event(self);
+
+	rc = ESIF_OK;
+lock_exit:
+	esif_ccb_write_unlock(&self->lock);
+	return rc;
+}
+
+
+/* Removes the item at the front of the list; lock must be held */
+static void *esif_queue_ring_list_pop(struct esif_queue_instance *self)
+{
+	struct esif_link_list_node *node_ptr = self->queue_list_ptr->head_ptr;
+	void *data_ptr = NULL;
+
+	if (NULL == node_ptr)
+		return NULL;
+
+	data_ptr = node_ptr->data_ptr;
+	esif_link_list_node_remove(self->queue_list_ptr, node_ptr);
+
+	if (atomic_read(&self->requeue_count) > 0)
+		atomic_dec(&self->requeue_count);
+	else
+		atomic_dec(&self->overflow_count);
+
+	return data_ptr;
+}
+
+
+static void *esif_queue_ring_dequeue(struct esif_queue_instance *self)
+{
+	void *data_ptr = NULL;
+
+	if (atomic_read(&self->requeue_count) > 0) {
+		esif_ccb_write_lock(&self->lock);
+		if (atomic_read(&self->requeue_count) > 0)
+			data_ptr = esif_queue_ring_list_pop(self);
+		esif_ccb_write_unlock(&self->lock);
+	}
+
+	if (NULL == data_ptr)
+		data_ptr = esif_queue_ring_pop(self);
+
+	if ((NULL == data_ptr) && (atomic_read(&self->overflow_count) > 0)) {
+		/*
+		 * Check the ring again with the lock held, as items pushed to the
+		 * ring before the list items were added must be returned first
+		 */
+		esif_ccb_write_lock(&self->lock);
+		data_ptr = esif_queue_ring_pop(self);
+		if (NULL == data_ptr)
+			data_ptr = esif_queue_ring_list_pop(self);
+		esif_ccb_write_unlock(&self->lock);
+	}
+
+	if (data_ptr != NULL)
+		atomic_dec(&self->current_size);
+
+	/*
+	 * Reset the event when empty, then recheck in case an item was queued
+	 * after the size was read but before the reset, as that producer may
+	 * have found a wakeup still pending and not set the event
+	 */
+	if (0 == atomic_read(&self->current_size)) {
+		atomic_set(&self->wake_pending, 0);
+		esif_ccb_event_reset(&self->event);
+		if (atomic_read(&self->current_size) > 0)
+			esif_ccb_event_set(&self->event);
+	}
+	return data_ptr;
+}
+
+
 /* Init */
 enum esif_rc esif_queue_init(void)
 {
@@ -57,19 +57,45 @@
 #include "esif_link_list.h"
 #include "esif_ccb_sem.h"
 #include "esif_ccb_lock.h"
+#include "esif_ccb_atomic.h"
 
 #define ESIF_QUEUE_NAME_LEN 32
 #define ESIF_QUEUE_TIMEOUT_INFINITE 0
+#define ESIF_QUEUE_RING_SIZE_MAX 0x10000	/* Maximum ring buffer capacity in items */
 
-/* Queue Instance */
+/* Ring buffer cell; the sequence indicates whether the cell is free or holds an item for a given position */
+struct esif_queue_cell {
+	atomic_t sequence;
+	void *data_ptr;
+};
+
+/*
+ * Queue Instance
+ * By default, items are kept in a linked list protected by the queue lock.
+ * Queues created with esif_queue_create_ring keep items in a bounded ring
+ * buffer which producers and the consumer access without taking the lock;
+ * the linked list is then only used for requeued items (which are returned
+ * first) and for items queued while the ring is full (which are returned
+ * after all items in the ring, so that FIFO order is maintained).
+ */
 struct esif_queue_instance {
 	u32  ms_timeout;	/* Timeout in milliseconds */
 	u32  max_size;		/* Maximum allowable queue size in items */
-	u32  current_size;	/* Current queeue size in items */
+	atomic_t current_size;	/* Current queeue size in items */
 	esif_ccb_lock_t lock;	/* Lock */
 	esif_ccb_event_t event;	/* Allow blocking if queue is empty */
 	struct esif_link_list	*queue_list_ptr;
 	char queue_name[ESIF_QUEUE_NAME_LEN];		/* Queue Name */
+
+	/* Ring buffer queues only */
+	struct esif_queue_cell *ring_ptr;	/* NULL for linked list queues */
+	u32 ring_mask;			/* Ring capacity - 1 */
+	atomic_t requeue_count;		/* Requeued items at the front of queue_list_ptr */
+	atomic_t overflow_count;	/* Items queued in queue_list_ptr while the ring was full */
+	u64 overflow_total;		/* Number of times the ring was full when queuing */
+	atomic_t wake_pending;		/* Set by the producer which signals the event; cleared by the consumer */
+	atomic_t enqueue_pos;
+	atomic_t dequeue_pos;
 };
 
 typedef struct esif_queue_instance EsifQueue, *EsifQueuePtr;
@@ -87,6 +113,14 @@ struct esif_queue_instance *esif_queue_create(
 	u32 us_timeout
 	);
 
+/* Create a queue backed by a ring buffer of the given capacity (rounded up to a power of 2) */
+struct esif_queue_instance *esif_queue_create_ring(
+	u32 depth,
+	char *name_ptr,
+	u32 ms_timeout,
+	u32 ring_size
+	);
+
 void esif_queue_destroy(
 	struct esif_queue_instance *self,
 	queue_item_destroy_func destroy_func_ptr
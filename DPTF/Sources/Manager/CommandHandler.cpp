@@ -18,6 +18,7 @@
 #include "CommandHandler.h"
 #include "esif_ccb_string.h"
 #include "EsifTime.h"
+#include "StringConverter.h"
 #include <time.h>
 #include <fstream>
 
@@ -60,3 +61,47 @@ void CommandHandler::setResultCode(const eEsifError resultCode)
 {
 	m_resultCode = resultCode;
 }
+
+void CommandHandler::throwIfTooManyArguments(
+	const CommandArguments& arguments,
+	UInt32 maxArguments,
+	const string& usage) const
+{
+	if (arguments.size() > maxArguments)
+	{
+		throw command_failure(ESIF_E_INVALID_ARGUMENT_COUNT, "Invalid argument count.  Usage: " + usage);
+	}
+}
+
+// Returns the optional numeric argument at the given index, or the default value if it was not given
+UInt32 CommandHandler::getUInt32Argument(
+	const CommandArguments& arguments,
+	UInt32 index,
+	const string& name,
+	UInt32 defaultValue,
+	UInt32 minValue,
+	UInt32 maxValue) const
+{
+	if (arguments.size() <= index)
+	{
+		return defaultValue;
+	}
+
+	UInt32 value;
+	try
+	{
+		value = StringConverter::toUInt32(arguments[index].getDataAsString());
+	}
+	catch (...)
+	{
+		throw command_failure(ESIF_E_COMMAND_DATA_INVALID, "Argument given is not a valid number.");
+	}
+
+	if ((value < minValue) || (value > maxValue))
+	{
+		throw command_failure(
+			ESIF_E_COMMAND_DATA_INVALID,
+			name + " must be " + to_string(minValue) + "-" + to_string(maxValue) + ".");
+	}
+	return value;
+}
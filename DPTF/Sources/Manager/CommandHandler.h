@@ -34,6 +34,14 @@ protected:
 	void setResultMessage(const std::string& message);
 	void setDefaultResultMessage();
 	void setResultCode(const eEsifError resultCode);
+	void throwIfTooManyArguments(const CommandArguments& arguments, UInt32 maxArguments, const std::string& usage) const;
+	UInt32 getUInt32Argument(
+		const CommandArguments& arguments,
+		UInt32 index,
+		const std::string& name,
+		UInt32 defaultValue,
+		UInt32 minValue,
+		UInt32 maxValue) const;
 	std::string m_resultMessage;
 	eEsifError m_resultCode;
 	DptfManagerInterface* m_dptfManager;
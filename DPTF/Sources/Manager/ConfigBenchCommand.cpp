@@ -0,0 +1,183 @@
+/******************************************************************************
+** Copyright (c) 2013-2023 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "ConfigBenchCommand.h"
+#include "DttConfiguration.h"
+#include "EsifTime.h"
+using namespace std;
+
+// Measures the DttConfiguration segment selection performed when policies are loaded and the
+// key queries that policies run against the selected segments, using a private configuration
+// laid out like a multi-platform configuration file. Each segment applies to its own CPU IDs,
+// so only one segment matches the environment profile being looked up.
+
+static const UInt32 DefaultSegments = 32;
+static const UInt32 MinSegments = 1;
+static const UInt32 MaxSegments = 1000;
+static const UInt32 CpuIdsPerSegment = 3;
+static const UInt32 PoliciesPerSegment = 8;
+static const UInt32 ParticipantsPerSegment = 16;
+static const UInt32 KeysPerParticipant = 24;
+static const UInt32 DefaultRounds = 100;
+static const UInt32 MaxRounds = 100000;
+static const UInt64 FirstBenchCpuId = 0x10000;
+
+static UInt64 cpuIdForSegment(UInt32 segment, UInt32 cpuIdIndex)
+{
+	return FirstBenchCpuId + (((UInt64)segment * CpuIdsPerSegment + cpuIdIndex) << 4);
+}
+
+static DttConfigurationSegment createSegment(UInt32 segment)
+{
+	map<string, string> keyValues;
+	for (UInt32 cpuIdIndex = 0; cpuIdIndex < CpuIdsPerSegment; cpuIdIndex++)
+	{
+		const auto cpuIdWithoutStepping = EnvironmentProfile(cpuIdForSegment(segment, cpuIdIndex)).cpuIdWithoutStepping;
+		keyValues["/ApplicableEnvironment/PlatformCpuIds/" + to_string(cpuIdIndex)] = "\"" + cpuIdWithoutStepping + "\"";
+	}
+	keyValues["/ApplicableEnvironment/SocBasePower/0"] = "\"\"";
+	keyValues["/ApplicableEnvironment/Label/0"] = "\"Segment" + to_string(segment) + "\"";
+	for (UInt32 policy = 0; policy < PoliciesPerSegment; policy++)
+	{
+		keyValues["/DefaultPolicies/" + to_string(policy)] = "\"Policy" + to_string(policy) + "\"";
+	}
+	for (UInt32 participant = 0; participant < ParticipantsPerSegment; participant++)
+	{
+		const auto participantPath = "/participants/PART" + to_string(participant) + ".D0/";
+		for (UInt32 key = 0; key < KeysPerParticipant; key++)
+		{
+			keyValues[participantPath + "setting" + to_string(key)] = to_string(key * 1000);
+		}
+		keyValues[participantPath + "ppm/Balanced/trt"] = "\"" + to_string(participant) + "\"";
+	}
+	return DttConfigurationSegment(keyValues);
+}
+
+ConfigBenchCommand::ConfigBenchCommand(DptfManagerInterface* dptfManager)
+	: CommandHandler(dptfManager)
+{
+}
+
+string ConfigBenchCommand::getCommandName() const
+{
+	return "configbench";
+}
+
+void ConfigBenchCommand::execute(const CommandArguments& arguments)
+{
+	try
+	{
+		throwIfTooManyArguments(arguments, 3, "configbench [segments] [rounds]");
+		const UInt32 segments = getUInt32Argument(arguments, 1, "Segments", DefaultSegments, MinSegments, MaxSegments);
+		const UInt32 rounds = getUInt32Argument(arguments, 2, "Rounds", DefaultRounds, 1, MaxRounds);
+		setResultMessage(runBenchmark(segments, rounds));
+		setResultCode(ESIF_OK);
+	}
+	catch (const command_failure& e)
+	{
+		setResultCode(e.getErrorCode());
+		setResultMessage(e.getDescription());
+	}
+}
+
+string ConfigBenchCommand::runBenchmark(UInt32 segments, UInt32 rounds) const
+{
+	vector<DttConfigurationSegment> configSegments;
+	for (UInt32 segment = 0; segment < segments; segment++)
+	{
+		configSegments.emplace_back(createSegment(segment));
+	}
+	const DttConfiguration configuration(configSegments);
+	const EnvironmentProfile environmentProfile(cpuIdForSegment(segments / 2, 1));
+	const list<DttConfigurationQuery> queries{
+		DttConfigurationQuery("/DefaultPolicies/.*"s),
+		DttConfigurationQuery("/participants/PART7.D0/setting12"s),
+		DttConfigurationQuery("/participants/.*/ppm/Balanced/.*"s)};
+
+	UInt64 selected = 0;
+	UInt64 matchedKeys = 0;
+	UInt64 referenceKeys = 0;
+
+	// Segment selection by environment profile, as done after each configuration reload
+	EsifTime selectStart;
+	for (UInt32 round = 0; round < rounds; round++)
+	{
+		const DttConfiguration reloadedConfiguration(configSegments);
+		selected += reloadedConfiguration.getSegmentsWithEnvironmentProfile(environmentProfile).size();
+	}
+	const TimeSpan selectTime = EsifTime() - selectStart;
+
+	// Segment selection repeated for the same environment profile
+	EsifTime cachedSelectStart;
+	for (UInt32 round = 0; round < rounds; round++)
+	{
+		selected += configuration.getSegmentsWithEnvironmentProfile(environmentProfile).size();
+	}
+	const TimeSpan cachedSelectTime = EsifTime() - cachedSelectStart;
+
+	// Key queries against every segment
+	EsifTime queryStart;
+	for (UInt32 round = 0; round < rounds; round++)
+	{
+		for (const auto& segment : configSegments)
+		{
+			for (const auto& query : queries)
+			{
+				matchedKeys += segment.getKeysThatMatch(query).size();
+			}
+		}
+	}
+	const TimeSpan queryTime = EsifTime() - queryStart;
+
+	// Reference: the same key queries evaluated as a regex against every key
+	EsifTime referenceStart;
+	for (UInt32 round = 0; round < rounds; round++)
+	{
+		for (const auto& segment : configSegments)
+		{
+			for (const auto& query : queries)
+			{
+				for (const auto& key : segment.getKeys())
+				{
+					if (regex_match(key, regex(query.toString())))
+					{
+						referenceKeys++;
+					}
+				}
+			}
+		}
+	}
+	const TimeSpan referenceTime = EsifTime() - referenceStart;
+
+	const UInt64 keyQueries = (UInt64)rounds * segments * queries.size();
+	stringstream result;
+	result << "DttConfiguration Benchmark: " << segments << " segments, "
+		   << configSegments.front().getKeys().size() << " keys per segment, " << rounds << " rounds" << endl;
+	result << fixed << setprecision(1);
+	result << "Segment selection:          " << (selectTime.asMicroseconds() / (double)rounds) << " us per call"
+		   << " (" << selectTime.asMillisecondsInt() << " ms, " << selected / (2 * rounds) << " selected)" << endl;
+	result << "Segment selection (cached): " << (cachedSelectTime.asMicroseconds() / (double)rounds) << " us per call"
+		   << " (" << cachedSelectTime.asMillisecondsInt() << " ms)" << endl;
+	result << "Key query:                  " << (queryTime.asMicroseconds() * 1000.0 / keyQueries) << " ns per call"
+		   << " (" << queryTime.asMillisecondsInt() << " ms)" << endl;
+	result << "Key query (regex):          " << (referenceTime.asMicroseconds() * 1000.0 / keyQueries) << " ns per call"
+		   << " (" << referenceTime.asMillisecondsInt() << " ms)" << endl;
+	result << "Query mismatches:           " << (matchedKeys > referenceKeys ? matchedKeys - referenceKeys : referenceKeys - matchedKeys)
+		   << endl;
+	return result.str();
+}
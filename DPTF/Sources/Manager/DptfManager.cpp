@@ -43,6 +43,8 @@
 #include "PlatformCpuIdCommand.h"
 #include "RealEnvironmentProfileGenerator.h"
 #include "PoliciesCommand.h"
+#include "IndexBenchCommand.h"
+#include "ConfigBenchCommand.h"
 #include "RealEnvironmentProfileUpdater.h"
 #include "RealEventNotifier.h"
 
@@ -652,6 +654,8 @@ void DptfManager::createCommands()
 	m_commands.push_back(make_shared<CaptureCommand>(this, m_fileIo));
 	m_commands.push_back(make_shared<PlatformCpuIdCommand>(this));
 	m_commands.push_back(make_shared<PoliciesCommand>(this));
+	m_commands.push_back(make_shared<IndexBenchCommand>(this));
+	m_commands.push_back(make_shared<ConfigBenchCommand>(this));
 	registerCommands();
 }
 
@@ -34,9 +34,24 @@
 #include "ManagerMessage.h"
 #include "ManagerLogger.h"
 #include "EsifDataTime.h"
+#include "WorkItemQueueManagerInterface.h"
+#include "ManagerStateLock.h"
 
 using namespace std;
 
+namespace
+{
+	struct PrefetchedPrimitive
+	{
+		esif_data_type dataType;
+		eEsifError rc;
+		DptfBuffer data;
+	};
+}
+
+// results of the primitives prefetched by the current thread, by participant, domain, primitive and instance
+static thread_local map<tuple<UIntN, UIntN, ePrimitiveType, UInt8>, PrefetchedPrimitive> PrefetchedPrimitives;
+
 EsifServices::EsifServices(
 	const DptfManagerInterface* dptfManager,
 	const esif_handle_t esifHandle,
@@ -290,11 +305,9 @@ UInt8 EsifServices::primitiveExecuteGetAsUInt8(
 
 	EsifDataUInt8 esifResult;
 
-	const auto rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		reinterpret_cast<const esif_handle_t>(m_dptfManager),
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
+	const auto rc = executePrimitive(
+		participantIndex,
+		domainIndex,
 		EsifDataVoid(),
 		esifResult,
 		primitive,
@@ -313,11 +326,9 @@ void EsifServices::primitiveExecuteSetAsUInt8(
 {
 	throwIfParticipantDomainCombinationInvalid(FLF, participantIndex, domainIndex);
 
-	const auto rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		reinterpret_cast<const esif_handle_t>(m_dptfManager),
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
+	const auto rc = executePrimitive(
+		participantIndex,
+		domainIndex,
 		EsifDataUInt8(elementValue),
 		EsifDataVoid(),
 		primitive,
@@ -335,11 +346,9 @@ UInt32 EsifServices::primitiveExecuteGetAsUInt32(
 
 	EsifDataUInt32 esifResult;
 
-	const auto rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		reinterpret_cast<const esif_handle_t>(m_dptfManager),
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
+	const auto rc = executePrimitive(
+		participantIndex,
+		domainIndex,
 		EsifDataVoid(),
 		esifResult,
 		primitive,
@@ -358,11 +367,9 @@ void EsifServices::primitiveExecuteSetAsUInt32(
 {
 	throwIfParticipantDomainCombinationInvalid(FLF, participantIndex, domainIndex);
 
-	const auto rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		reinterpret_cast<const esif_handle_t>(m_dptfManager),
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
+	const auto rc = executePrimitive(
+		participantIndex,
+		domainIndex,
 		EsifDataUInt32(elementValue),
 		EsifDataVoid(),
 		primitive,
@@ -380,11 +387,9 @@ UInt64 EsifServices::primitiveExecuteGetAsUInt64(
 
 	EsifDataUInt64 esifResult;
 
-	const auto rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		reinterpret_cast<const esif_handle_t>(m_dptfManager),
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
+	const auto rc = executePrimitive(
+		participantIndex,
+		domainIndex,
 		EsifDataVoid(),
 		esifResult,
 		primitive,
@@ -403,11 +408,9 @@ void EsifServices::primitiveExecuteSetAsUInt64(
 {
 	throwIfParticipantDomainCombinationInvalid(FLF, participantIndex, domainIndex);
 
-	const auto rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		reinterpret_cast<const esif_handle_t>(m_dptfManager),
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
+	const auto rc = executePrimitive(
+		participantIndex,
+		domainIndex,
 		EsifDataUInt64(elementValue),
 		EsifDataVoid(),
 		primitive,
@@ -425,11 +428,9 @@ Temperature EsifServices::primitiveExecuteGetAsTemperatureTenthK(
 
 	EsifDataTemperature esifResult;
 
-	eEsifError rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		reinterpret_cast<const esif_handle_t>(m_dptfManager),
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
+	eEsifError rc = executePrimitive(
+		participantIndex,
+		domainIndex,
 		EsifDataVoid(),
 		esifResult,
 		primitive,
@@ -488,11 +489,9 @@ void EsifServices::primitiveExecuteSetAsTemperatureTenthK(
 	}
 #endif
 
-	eEsifError rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		reinterpret_cast<const esif_handle_t>(m_dptfManager),
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
+	eEsifError rc = executePrimitive(
+		participantIndex,
+		domainIndex,
 		EsifDataTemperature(temperature),
 		EsifDataVoid(),
 		primitive,
@@ -531,11 +530,9 @@ Percentage EsifServices::primitiveExecuteGetAsPercentage(
 
 	EsifDataPercentage esifResult;
 
-	const auto rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		reinterpret_cast<const esif_handle_t>(m_dptfManager),
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
+	const auto rc = executePrimitive(
+		participantIndex,
+		domainIndex,
 		EsifDataVoid(),
 		esifResult,
 		primitive,
@@ -554,11 +551,9 @@ void EsifServices::primitiveExecuteSetAsPercentage(
 {
 	throwIfParticipantDomainCombinationInvalid(FLF, participantIndex, domainIndex);
 
-	const auto rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		reinterpret_cast<const esif_handle_t>(m_dptfManager),
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
+	const auto rc = executePrimitive(
+		participantIndex,
+		domainIndex,
 		EsifDataPercentage(percentage),
 		EsifDataVoid(),
 		primitive,
@@ -576,11 +571,9 @@ Frequency EsifServices::primitiveExecuteGetAsFrequency(
 
 	EsifDataFrequency esifResult;
 
-	const auto rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		reinterpret_cast<const esif_handle_t>(m_dptfManager),
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
+	const auto rc = executePrimitive(
+		participantIndex,
+		domainIndex,
 		EsifDataVoid(),
 		esifResult,
 		primitive,
@@ -599,11 +592,9 @@ void EsifServices::primitiveExecuteSetAsFrequency(
 {
 	throwIfParticipantDomainCombinationInvalid(FLF, participantIndex, domainIndex);
 
-	const auto rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		reinterpret_cast<const esif_handle_t>(m_dptfManager),
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
+	const auto rc = executePrimitive(
+		participantIndex,
+		domainIndex,
 		EsifDataFrequency(frequency),
 		EsifDataVoid(),
 		primitive,
@@ -621,11 +612,9 @@ Power EsifServices::primitiveExecuteGetAsPower(
 
 	EsifDataPower esifResult;
 
-	const auto rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		reinterpret_cast<const esif_handle_t>(m_dptfManager),
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
+	const auto rc = executePrimitive(
+		participantIndex,
+		domainIndex,
 		EsifDataVoid(),
 		esifResult,
 		primitive,
@@ -644,11 +633,9 @@ void EsifServices::primitiveExecuteSetAsPower(
 {
 	throwIfParticipantDomainCombinationInvalid(FLF, participantIndex, domainIndex);
 
-	const auto rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		reinterpret_cast<const esif_handle_t>(m_dptfManager),
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
+	const auto rc = executePrimitive(
+		participantIndex,
+		domainIndex,
 		EsifDataPower(power),
 		EsifDataVoid(),
 		primitive,
@@ -666,11 +653,9 @@ TimeSpan EsifServices::primitiveExecuteGetAsTimeInMilliseconds(
 
 	EsifDataTime esifResult;
 
-	const auto rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		reinterpret_cast<const esif_handle_t>(m_dptfManager),
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
+	const auto rc = executePrimitive(
+		participantIndex,
+		domainIndex,
 		EsifDataVoid(),
 		esifResult,
 		primitive,
@@ -689,11 +674,9 @@ void EsifServices::primitiveExecuteSetAsTimeInMilliseconds(
 {
 	throwIfParticipantDomainCombinationInvalid(FLF, participantIndex, domainIndex);
 
-	const auto rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		reinterpret_cast<const esif_handle_t>(m_dptfManager),
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
+	const auto rc = executePrimitive(
+		participantIndex,
+		domainIndex,
 		EsifDataTime(time.asMillisecondsInt()),
 		EsifDataVoid(),
 		primitive,
@@ -711,11 +694,9 @@ string EsifServices::primitiveExecuteGetAsString(
 
 	EsifDataString esifResult(Constants::DefaultBufferSize);
 
-	const auto rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		reinterpret_cast<const esif_handle_t>(m_dptfManager),
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
+	const auto rc = executePrimitive(
+		participantIndex,
+		domainIndex,
 		EsifDataVoid(),
 		esifResult,
 		primitive,
@@ -734,11 +715,9 @@ void EsifServices::primitiveExecuteSetAsString(
 {
 	throwIfParticipantDomainCombinationInvalid(FLF, participantIndex, domainIndex);
 
-	const auto rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		reinterpret_cast<const esif_handle_t>(m_dptfManager),
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
+	const auto rc = executePrimitive(
+		participantIndex,
+		domainIndex,
 		EsifDataString(stringValue),
 		EsifDataVoid(),
 		primitive,
@@ -757,11 +736,9 @@ DptfBuffer EsifServices::primitiveExecuteGet(
 
 	DptfBuffer buffer(Constants::DefaultBufferSize);
 	EsifDataContainer esifData(esifDataType, buffer.get(), buffer.size(), 0);
-	eEsifError rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		reinterpret_cast<const esif_handle_t>(m_dptfManager),
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
+	eEsifError rc = executePrimitive(
+		participantIndex,
+		domainIndex,
 		EsifDataVoid(),
 		esifData,
 		primitive,
@@ -770,12 +747,9 @@ DptfBuffer EsifServices::primitiveExecuteGet(
 	{
 		buffer.allocate(esifData.getDataLength());
 		EsifDataContainer esifDataTryAgain(esifDataType, buffer.get(), buffer.size(), 0);
-		rc = m_appServices->executePrimitive(
-			m_esifHandle,
-			reinterpret_cast<const esif_handle_t>(m_dptfManager),
-			m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-			m_dptfManager->getIndexContainer()->getDomainHandle(
-				participantIndex, domainIndex),
+		rc = executePrimitive(
+			participantIndex,
+			domainIndex,
 			EsifDataVoid(),
 			esifDataTryAgain,
 			primitive,
@@ -804,11 +778,9 @@ DptfBuffer EsifServices::primitiveExecuteGetWithArgument(
 		EsifDataContainer esifResponse(
 			esif_data_type::ESIF_DATA_STRUCTURE, esifResult.get(), size, size);
 
-		const auto rc = m_appServices->executePrimitive(
-			m_esifHandle,
-			reinterpret_cast<const esif_handle_t>(m_dptfManager),
-			m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-			m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
+		const auto rc = executePrimitive(
+			participantIndex,
+			domainIndex,
 			esifRequest,
 			esifResponse,
 			primitive,
@@ -834,11 +806,9 @@ void EsifServices::primitiveExecuteSet(
 {
 	throwIfParticipantDomainCombinationInvalid(FLF, participantIndex, domainIndex);
 
-	const auto rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		reinterpret_cast<const esif_handle_t>(m_dptfManager),
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
+	const auto rc = executePrimitive(
+		participantIndex,
+		domainIndex,
 		EsifDataContainer(esifDataType, bufferPtr, bufferLength, dataLength),
 		EsifDataVoid(),
 		primitive,
@@ -846,6 +816,170 @@ void EsifServices::primitiveExecuteSet(
 	throwIfNotSuccessful(FLF, rc, primitive, participantIndex, domainIndex, instance);
 }
 
+eEsifError EsifServices::executePrimitive(
+	UIntN participantIndex,
+	UIntN domainIndex,
+	const EsifDataPtr request,
+	EsifDataPtr response,
+	const ePrimitiveType primitive,
+	const UInt8 instance)
+{
+	eEsifError prefetchedRc = ESIF_OK;
+	if (usePrefetchedPrimitive(participantIndex, domainIndex, request, response, primitive, instance, prefetchedRc))
+	{
+		return prefetchedRc;
+	}
+
+	const auto participantHandle = m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex);
+	const auto domainHandle = m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex);
+
+	// Once the handles have been looked up the manager state lock is not needed while the primitive executes.  The
+	// participant is not destroyed until the lock has been taken back.  Set primitives have no response data.
+	ManagerStateLockRelease managerStateLockRelease(
+		getManagerStateLock(),
+		(response != nullptr) && (response->type == esif_data_type::ESIF_DATA_VOID),
+		participantIndex);
+
+	return m_appServices->executePrimitive(
+		m_esifHandle,
+		reinterpret_cast<const esif_handle_t>(m_dptfManager),
+		participantHandle,
+		domainHandle,
+		request,
+		response,
+		primitive,
+		instance);
+}
+
+void EsifServices::prefetchPrimitives(const std::vector<EsifPrimitiveRequest>& primitives)
+{
+	// group the primitives by participant and domain so the handles are looked up once per domain
+	map<pair<UIntN, UIntN>, vector<EsifPrimitiveRequest>> primitivesByDomain;
+	for (auto primitive = primitives.begin(); primitive != primitives.end(); ++primitive)
+	{
+		primitivesByDomain[make_pair(primitive->participantIndex, primitive->domainIndex)].push_back(*primitive);
+	}
+
+	vector<UIntN> participantIndexes;
+	vector<pair<esif_handle_t, esif_handle_t>> domainHandles;
+	for (auto domain = primitivesByDomain.begin(); domain != primitivesByDomain.end(); ++domain)
+	{
+		const auto participantIndex = domain->first.first;
+		const auto domainIndex = domain->first.second;
+		participantIndexes.push_back(participantIndex);
+		domainHandles.push_back(make_pair(
+			m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
+			m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex)));
+	}
+
+	// the manager state lock is released once for the whole batch
+	map<tuple<UIntN, UIntN, ePrimitiveType, UInt8>, PrefetchedPrimitive> results;
+	{
+		ManagerStateLockRelease managerStateLockRelease(getManagerStateLock(), participantIndexes);
+
+		auto handles = domainHandles.begin();
+		for (auto domain = primitivesByDomain.begin(); domain != primitivesByDomain.end(); ++domain, ++handles)
+		{
+			if (handles->first == ESIF_INVALID_HANDLE)
+			{
+				continue;
+			}
+
+			for (auto primitive = domain->second.begin(); primitive != domain->second.end(); ++primitive)
+			{
+				DptfBuffer buffer(Constants::DefaultBufferSize);
+				EsifDataContainer esifData(primitive->dataType, buffer.get(), buffer.size(), 0);
+				eEsifError rc = m_appServices->executePrimitive(
+					m_esifHandle,
+					reinterpret_cast<const esif_handle_t>(m_dptfManager),
+					handles->first,
+					handles->second,
+					EsifDataVoid(),
+					esifData,
+					primitive->primitive,
+					primitive->instance);
+				UInt32 dataLength = esifData.getDataLength();
+				if (rc == ESIF_E_NEED_LARGER_BUFFER)
+				{
+					buffer.allocate(dataLength);
+					EsifDataContainer esifDataTryAgain(primitive->dataType, buffer.get(), buffer.size(), 0);
+					rc = m_appServices->executePrimitive(
+						m_esifHandle,
+						reinterpret_cast<const esif_handle_t>(m_dptfManager),
+						handles->first,
+						handles->second,
+						EsifDataVoid(),
+						esifDataTryAgain,
+						primitive->primitive,
+						primitive->instance);
+					dataLength = esifDataTryAgain.getDataLength();
+				}
+				buffer.trim((rc == ESIF_OK) ? dataLength : 0);
+
+				PrefetchedPrimitive result = {primitive->dataType, rc, buffer};
+				results[make_tuple(domain->first.first, domain->first.second, primitive->primitive, primitive->instance)] =
+					result;
+			}
+		}
+	}
+
+	PrefetchedPrimitives.insert(results.begin(), results.end());
+}
+
+void EsifServices::clearPrefetchedPrimitives(void)
+{
+	PrefetchedPrimitives.clear();
+}
+
+Bool EsifServices::usePrefetchedPrimitive(
+	UIntN participantIndex,
+	UIntN domainIndex,
+	const EsifDataPtr request,
+	EsifDataPtr response,
+	const ePrimitiveType primitive,
+	const UInt8 instance,
+	eEsifError& rc) const
+{
+	if (PrefetchedPrimitives.empty() || (request == nullptr) || (request->type != esif_data_type::ESIF_DATA_VOID)
+		|| (response == nullptr))
+	{
+		return false;
+	}
+
+	auto prefetched = PrefetchedPrimitives.find(make_tuple(participantIndex, domainIndex, primitive, instance));
+	if ((prefetched == PrefetchedPrimitives.end()) || (prefetched->second.dataType != response->type))
+	{
+		return false;
+	}
+
+	// each result is only used once, so a primitive executed again later in the batch reads the current value
+	Bool used = false;
+	const auto& data = prefetched->second.data;
+	if (prefetched->second.rc != ESIF_OK)
+	{
+		rc = prefetched->second.rc;
+		used = true;
+	}
+	else if ((response->buf_ptr != nullptr) && (data.size() <= response->buf_len))
+	{
+		if (data.size() > 0)
+		{
+			esif_ccb_memcpy(response->buf_ptr, data.get(), data.size());
+		}
+		response->data_len = data.size();
+		rc = ESIF_OK;
+		used = true;
+	}
+	PrefetchedPrimitives.erase(prefetched);
+	return used;
+}
+
+ManagerStateLock* EsifServices::getManagerStateLock(void) const
+{
+	const auto workItemQueueManager = m_dptfManager->getWorkItemQueueManager();
+	return (workItemQueueManager != nullptr) ? workItemQueueManager->getManagerStateLock() : nullptr;
+}
+
 void EsifServices::writeMessageFatal(const string& message, MessageCategory::Type messageCategory)
 {
 	if (eLogType::eLogTypeFatal <= m_currentLogVerbosityLevel)
@@ -20,6 +20,8 @@
 
 #include "EsifServicesInterface.h"
 
+class ManagerStateLock;
+
 class dptf_export EsifServices : public EsifServicesInterface
 {
 public:
@@ -195,6 +197,9 @@ public:
 		UIntN domainIndex = Constants::Esif::NoDomain,
 		UInt8 instance = Constants::Esif::NoInstance) override;
 
+	virtual void prefetchPrimitives(const std::vector<EsifPrimitiveRequest>& primitives) override;
+	virtual void clearPrefetchedPrimitives(void) override;
+
 	// Message logging
 
 	virtual void writeMessageFatal(
@@ -246,6 +251,23 @@ private:
 
 	void writeMessage(eLogType messageLevel, MessageCategory::Type messageCategory, const std::string& message) const;
 
+	eEsifError executePrimitive(
+		UIntN participantIndex,
+		UIntN domainIndex,
+		const EsifDataPtr request,
+		EsifDataPtr response,
+		const ePrimitiveType primitive,
+		const UInt8 instance);
+	Bool usePrefetchedPrimitive(
+		UIntN participantIndex,
+		UIntN domainIndex,
+		const EsifDataPtr request,
+		EsifDataPtr response,
+		const ePrimitiveType primitive,
+		const UInt8 instance,
+		eEsifError& rc) const;
+	ManagerStateLock* getManagerStateLock(void) const;
+
 	std::string getParticipantName(UIntN participantIndex);
 	std::string getDomainName(UIntN participantIndex, UIntN domainIndex);
 
@@ -28,6 +28,7 @@
 #include "MessageCategory.h"
 #include "DptfBuffer.h"
 #include "TimeSpan.h"
+#include "EsifPrimitiveRequest.h"
 
 //
 // Implements the ESIF services interface which allows the framework to call into ESIF.  See the ESIF HLD for a
@@ -204,6 +205,11 @@ public:
 		UIntN domainIndex = Constants::Esif::NoDomain,
 		UInt8 instance = Constants::Esif::NoInstance) = 0;
 
+	// Executes a batch of get primitives for the current thread.  Each result is used once, by the first matching get
+	// primitive the thread executes before clearPrefetchedPrimitives() is called.
+	virtual void prefetchPrimitives(const std::vector<EsifPrimitiveRequest>& primitives) = 0;
+	virtual void clearPrefetchedPrimitives(void) = 0;
+
 	// Message logging
 
 	virtual void writeMessageFatal(
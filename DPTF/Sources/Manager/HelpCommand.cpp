@@ -80,5 +80,7 @@ ui getmodulesingroup <group ID>                               Returns module IDs
 ui getmoduledata <group ID> <module ID>                       Returns XML data for group ID and module ID
 capture [file name]                                           Export settings to file
 getCpuId                                                      Returns platform CPU ID without stepping
+indexbench [participants] [rounds]                            Measures participant/domain handle lookup overhead
+configbench [segments] [rounds]                               Measures configuration segment selection and key query overhead
 )";
 }
\ No newline at end of file
@@ -0,0 +1,131 @@
+/******************************************************************************
+** Copyright (c) 2013-2023 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "IndexBenchCommand.h"
+#include "IndexContainer.h"
+#include "EsifTime.h"
+using namespace std;
+
+// Measures the Participant/Domain Handle lookups that EsifServices performs for every primitive
+// call, and the reverse lookups performed for every ESIF event, using a private IndexContainer
+// populated the same way as the ESIF Participant/Domain create callbacks populate the live one.
+
+static const UInt32 DefaultParticipants = 64;
+static const UInt32 MinParticipants = 1;
+static const UInt32 MaxParticipants = 1000;
+static const UInt32 DomainsPerParticipant = 4;
+static const UInt32 DefaultRounds = 10000;
+static const UInt32 MaxRounds = 1000000;
+static const esif_handle_t FirstBenchHandle = 0x10000;
+
+IndexBenchCommand::IndexBenchCommand(DptfManagerInterface* dptfManager)
+	: CommandHandler(dptfManager)
+{
+}
+
+string IndexBenchCommand::getCommandName() const
+{
+	return "indexbench";
+}
+
+void IndexBenchCommand::execute(const CommandArguments& arguments)
+{
+	try
+	{
+		throwIfTooManyArguments(arguments, 3, "indexbench [participants] [rounds]");
+		const UInt32 participants = getUInt32Argument(arguments, 1, "Participants", DefaultParticipants, MinParticipants, MaxParticipants);
+		const UInt32 rounds = getUInt32Argument(arguments, 2, "Rounds", DefaultRounds, 1, MaxRounds);
+		setResultMessage(runBenchmark(participants, rounds));
+		setResultCode(ESIF_OK);
+	}
+	catch (const command_failure& e)
+	{
+		setResultCode(e.getErrorCode());
+		setResultMessage(e.getDescription());
+	}
+}
+
+string IndexBenchCommand::runBenchmark(UInt32 participants, UInt32 rounds) const
+{
+	IndexContainer container;
+	esif_handle_t nextHandle = FirstBenchHandle;
+
+	for (UInt32 participantIndex = 0; participantIndex < participants; participantIndex++)
+	{
+		const esif_handle_t participantHandle = nextHandle++;
+		container.insertHandle(participantIndex, Constants::Invalid, participantHandle, ESIF_INVALID_HANDLE);
+		for (UInt32 domainIndex = 0; domainIndex < DomainsPerParticipant; domainIndex++)
+		{
+			container.insertHandle(participantIndex, domainIndex, participantHandle, nextHandle++);
+		}
+	}
+
+	const UInt64 lookups = (UInt64)rounds * participants * DomainsPerParticipant;
+	UInt64 misses = 0;
+
+	// Primitive Calls: Participant and Domain Index -> ESIF Handles
+	EsifTime handleStart;
+	for (UInt32 round = 0; round < rounds; round++)
+	{
+		for (UInt32 participantIndex = 0; participantIndex < participants; participantIndex++)
+		{
+			for (UInt32 domainIndex = 0; domainIndex < DomainsPerParticipant; domainIndex++)
+			{
+				const esif_handle_t participantHandle = container.getParticipantHandle(participantIndex);
+				const esif_handle_t domainHandle = container.getDomainHandle(participantIndex, domainIndex);
+				if ((participantHandle == ESIF_INVALID_HANDLE) || (domainHandle == ESIF_INVALID_HANDLE))
+				{
+					misses++;
+				}
+			}
+		}
+	}
+	const TimeSpan handleTime = EsifTime() - handleStart;
+
+	// ESIF Events: ESIF Handles -> Participant and Domain Index
+	EsifTime indexStart;
+	for (UInt32 round = 0; round < rounds; round++)
+	{
+		esif_handle_t handle = FirstBenchHandle;
+		for (UInt32 participantIndex = 0; participantIndex < participants; participantIndex++)
+		{
+			const esif_handle_t participantHandle = handle++;
+			for (UInt32 domainIndex = 0; domainIndex < DomainsPerParticipant; domainIndex++)
+			{
+				const esif_handle_t domainHandle = handle++;
+				if ((container.getParticipantIndex(participantHandle) != participantIndex) ||
+					(container.getDomainIndex(participantHandle, domainHandle) != domainIndex))
+				{
+					misses++;
+				}
+			}
+		}
+	}
+	const TimeSpan indexTime = EsifTime() - indexStart;
+
+	stringstream result;
+	result << "IndexContainer Benchmark: " << participants << " participants, "
+		   << participants * DomainsPerParticipant << " domains, " << lookups << " lookups per test" << endl;
+	result << fixed << setprecision(1);
+	result << "Primitive handle lookup: " << (handleTime.asMicroseconds() * 1000.0 / lookups) << " ns per call"
+		   << " (" << handleTime.asMillisecondsInt() << " ms)" << endl;
+	result << "Event index lookup:      " << (indexTime.asMicroseconds() * 1000.0 / lookups) << " ns per call"
+		   << " (" << indexTime.asMillisecondsInt() << " ms)" << endl;
+	result << "Lookup errors:           " << misses << endl;
+	return result.str();
+}
@@ -18,11 +18,17 @@
 
 #include "IndexContainer.h"
 #include "EsifMutexHelper.h"
+#include <thread>
 
 // Do not throw exceptions from within this file
 
 IndexContainer::IndexContainer()
+	: m_table(nullptr)
+	, m_readerSlot(0)
 {
+	m_readers[0] = 0;
+	m_readers[1] = 0;
+	m_table = buildTable(std::vector<IndexStruct>());
 }
 
 IndexContainer::~IndexContainer(void)
@@ -30,12 +36,7 @@ IndexContainer::~IndexContainer(void)
 	EsifMutexHelper esifMutexHelper(&m_mutex);
 	esifMutexHelper.lock();
 
-	for (UIntN i = 0; i < m_vectorIndexStructPtr.size(); i++)
-	{
-		DELETE_MEMORY_TC(m_vectorIndexStructPtr[i]);
-	}
-
-	m_vectorIndexStructPtr.clear();
+	delete m_table.exchange(nullptr);
 
 	esifMutexHelper.unlock();
 }
@@ -49,14 +50,16 @@ void IndexContainer::insertHandle(UIntN participantIndex,
 	EsifMutexHelper esifMutexHelper(&m_mutex);
 	esifMutexHelper.lock();
 
-	IndexStructPtr indexStructPtr = new IndexStruct;
+	IndexStruct indexStruct;
 
-	indexStructPtr->participantIndex = participantIndex;
-	indexStructPtr->domainIndex = domainIndex;
-	indexStructPtr->participantHandle = participantHandle;
-	indexStructPtr->domainHandle = domainHandle;
+	indexStruct.participantIndex = participantIndex;
+	indexStruct.domainIndex = domainIndex;
+	indexStruct.participantHandle = participantHandle;
+	indexStruct.domainHandle = domainHandle;
 
-	m_vectorIndexStructPtr.push_back(indexStructPtr);
+	std::vector<IndexStruct> entries(m_table.load()->entries);
+	entries.push_back(indexStruct);
+	publishTable(buildTable(std::move(entries)));
 
 	esifMutexHelper.unlock();
 }
@@ -66,13 +69,15 @@ void IndexContainer::removeHandle(esif_handle_t participantHandle, esif_handle_t
 	EsifMutexHelper esifMutexHelper(&m_mutex);
 	esifMutexHelper.lock();
 
-	for (UIntN i = 0; i < m_vectorIndexStructPtr.size(); i++)
+	const IndexTable* table = m_table.load();
+	for (UIntN i = 0; i < table->entries.size(); i++)
 	{
-		if ((m_vectorIndexStructPtr[i]->participantHandle == participantHandle) &&
-			(m_vectorIndexStructPtr[i]->domainHandle == domainHandle))
+		if ((table->entries[i].participantHandle == participantHandle) &&
+			(table->entries[i].domainHandle == domainHandle))
 		{
-			DELETE_MEMORY_TC(m_vectorIndexStructPtr[i]);
-			m_vectorIndexStructPtr.erase(m_vectorIndexStructPtr.begin() + i);
+			std::vector<IndexStruct> entries(table->entries);
+			entries.erase(entries.begin() + i);
+			publishTable(buildTable(std::move(entries)));
 			break;
 		}
 	}
@@ -83,21 +88,28 @@ void IndexContainer::removeHandle(esif_handle_t participantHandle, esif_handle_t
 esif_handle_t IndexContainer::getParticipantHandle(UIntN participantIndex)
 {
 	esif_handle_t participantHandle = ESIF_INVALID_HANDLE;
-	UInt64 currentVectorSize = 0;
 
-	EsifMutexHelper esifMutexHelper(&m_mutex);
-	esifMutexHelper.lock();
+	TableReader reader(this);
+	const IndexTable* table = reader.get();
 
-	currentVectorSize = m_vectorIndexStructPtr.size();
-	for (UIntN i = 0; i < currentVectorSize; i++)
+	if (participantIndex < MaxDenseIndex)
 	{
-		if (m_vectorIndexStructPtr[i]->participantIndex == participantIndex)
+		if (participantIndex < table->participantHandles.size())
 		{
-			participantHandle = m_vectorIndexStructPtr[i]->participantHandle;
-			break;
+			participantHandle = table->participantHandles[participantIndex];
+		}
+	}
+	else
+	{
+		for (auto entry = table->entries.begin(); entry != table->entries.end(); ++entry)
+		{
+			if (entry->participantIndex == participantIndex)
+			{
+				participantHandle = entry->participantHandle;
+				break;
+			}
 		}
 	}
-	esifMutexHelper.unlock();
 
 	return participantHandle;
 }
@@ -105,23 +117,29 @@ esif_handle_t IndexContainer::getParticipantHandle(UIntN participantIndex)
 esif_handle_t IndexContainer::getDomainHandle(UIntN participantIndex, UIntN domainIndex)
 {
 	esif_handle_t domainHandle = ESIF_INVALID_HANDLE;
-	UInt64 currentVectorSize = 0;
-
-	EsifMutexHelper esifMutexHelper(&m_mutex);
-	esifMutexHelper.lock();
 
-	currentVectorSize = m_vectorIndexStructPtr.size();
+	TableReader reader(this);
+	const IndexTable* table = reader.get();
 
-	for (UIntN i = 0; i < currentVectorSize; i++)
+	if ((participantIndex < MaxDenseIndex) && (domainIndex < MaxDenseIndex))
 	{
-		if ((m_vectorIndexStructPtr[i]->participantIndex == participantIndex) &&
-			(m_vectorIndexStructPtr[i]->domainIndex == domainIndex))
+		if ((participantIndex < table->domainHandles.size()) &&
+			(domainIndex < table->domainHandles[participantIndex].size()))
 		{
-			domainHandle = m_vectorIndexStructPtr[i]->domainHandle;
-			break;
+			domainHandle = table->domainHandles[participantIndex][domainIndex];
+		}
+	}
+	else
+	{
+		for (auto entry = table->entries.begin(); entry != table->entries.end(); ++entry)
+		{
+			if ((entry->participantIndex == participantIndex) && (entry->domainIndex == domainIndex))
+			{
+				domainHandle = entry->domainHandle;
+				break;
+			}
 		}
 	}
-	esifMutexHelper.unlock();
 
 	return domainHandle;
 }
@@ -129,22 +147,15 @@ esif_handle_t IndexContainer::getDomainHandle(UIntN participantIndex, UIntN doma
 UIntN IndexContainer::getParticipantIndex(esif_handle_t participantHandle)
 {
 	UIntN participantIndex = Constants::Invalid;
-	UInt64 currentVectorSize = 0;
 
-	EsifMutexHelper esifMutexHelper(&m_mutex);
-	esifMutexHelper.lock();
+	TableReader reader(this);
+	const IndexTable* table = reader.get();
 
-	currentVectorSize = m_vectorIndexStructPtr.size();
-
-	for (UIntN i = 0; i < currentVectorSize; i++)
+	auto found = table->participantIndexes.find(participantHandle);
+	if (found != table->participantIndexes.end())
 	{
-		if (m_vectorIndexStructPtr[i]->participantHandle == participantHandle)
-		{
-			participantIndex = m_vectorIndexStructPtr[i]->participantIndex;
-			break;
-		}
+		participantIndex = found->second;
 	}
-	esifMutexHelper.unlock();
 
 	return participantIndex;
 }
@@ -152,23 +163,92 @@ UIntN IndexContainer::getParticipantIndex(esif_handle_t participantHandle)
 UIntN IndexContainer::getDomainIndex(esif_handle_t participantHandle, esif_handle_t domainHandle)
 {
 	UIntN domainIndex = Constants::Invalid;
-	UInt64 currentVectorSize = 0;
 
-	EsifMutexHelper esifMutexHelper(&m_mutex);
-	esifMutexHelper.lock();
+	TableReader reader(this);
+	const IndexTable* table = reader.get();
 
-	currentVectorSize = m_vectorIndexStructPtr.size();
+	auto found = table->domainIndexes.find({participantHandle, domainHandle});
+	if (found != table->domainIndexes.end())
+	{
+		domainIndex = found->second;
+	}
 
-	for (UIntN i = 0; i < currentVectorSize; i++)
+	return domainIndex;
+}
+
+size_t IndexContainer::DomainHandleKeyHash::operator()(const DomainHandleKey& key) const
+{
+	std::hash<esif_handle_t> hasher;
+	return hasher(key.participantHandle) ^ static_cast<size_t>(hasher(key.domainHandle) * 0x9E3779B97F4A7C15ULL);
+}
+
+IndexContainer::IndexTable* IndexContainer::buildTable(std::vector<IndexStruct>&& entries)
+{
+	IndexTable* table = new IndexTable;
+	table->entries = std::move(entries);
+
+	// Visit the entries in reverse so that the first matching entry wins, as with a linear search
+	for (auto entry = table->entries.rbegin(); entry != table->entries.rend(); ++entry)
 	{
-		if ((m_vectorIndexStructPtr[i]->participantHandle == participantHandle) &&
-			(m_vectorIndexStructPtr[i]->domainHandle == domainHandle))
+		if (entry->participantIndex < MaxDenseIndex)
 		{
-			domainIndex = m_vectorIndexStructPtr[i]->domainIndex;
-			break;
+			if (entry->participantIndex >= table->participantHandles.size())
+			{
+				table->participantHandles.resize(entry->participantIndex + 1, ESIF_INVALID_HANDLE);
+				table->domainHandles.resize(entry->participantIndex + 1);
+			}
+			table->participantHandles[entry->participantIndex] = entry->participantHandle;
+
+			if (entry->domainIndex < MaxDenseIndex)
+			{
+				auto& domainHandles = table->domainHandles[entry->participantIndex];
+				if (entry->domainIndex >= domainHandles.size())
+				{
+					domainHandles.resize(entry->domainIndex + 1, ESIF_INVALID_HANDLE);
+				}
+				domainHandles[entry->domainIndex] = entry->domainHandle;
+			}
 		}
+		table->participantIndexes[entry->participantHandle] = entry->participantIndex;
+		table->domainIndexes[{entry->participantHandle, entry->domainHandle}] = entry->domainIndex;
 	}
-	esifMutexHelper.unlock();
 
-	return domainIndex;
-}
\ No newline at end of file
+	return table;
+}
+
+// Called with m_mutex held.  Readers register in one of two slots before loading the table, so once the
+// new table is published, waiting for each slot to drain in turn guarantees the old table is unused.
+void IndexContainer::publishTable(IndexTable* table)
+{
+	const IndexTable* oldTable = m_table.exchange(table);
+
+	for (UIntN pass = 0; pass < 2; pass++)
+	{
+		UInt32 drainSlot = m_readerSlot.fetch_xor(1) & 1;
+		while (m_readers[drainSlot].load() != 0)
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	delete oldTable;
+}
+
+IndexContainer::TableReader::TableReader(IndexContainer* container)
+	: m_container(container)
+	, m_readerSlot(container->m_readerSlot.load() & 1)
+	, m_table(nullptr)
+{
+	m_container->m_readers[m_readerSlot].fetch_add(1);
+	m_table = m_container->m_table.load();
+}
+
+IndexContainer::TableReader::~TableReader(void)
+{
+	m_container->m_readers[m_readerSlot].fetch_sub(1);
+}
+
+const IndexContainer::IndexTable* IndexContainer::TableReader::get() const
+{
+	return m_table;
+}
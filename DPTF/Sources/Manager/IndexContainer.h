@@ -21,7 +21,12 @@
 #include "Dptf.h"
 #include "EsifMutex.h"
 #include "IndexContainerInterface.h"
+#include <atomic>
+#include <unordered_map>
 
+// Maps DPTF Participant/Domain Indexes to and from ESIF Participant/Domain Handles.
+// Lookups read an immutable, published IndexTable without taking a lock.  Updates build a new
+// table under m_mutex, publish it, and free the old table once no reader can still be using it.
 class IndexContainer : public IndexContainerInterface
 {
 public:
@@ -45,7 +50,55 @@ private:
 	IndexContainer(const IndexContainer& rhs);
 	IndexContainer& operator=(const IndexContainer& rhs);
 
+	// Indexes below this limit are looked up in the dense tables; any others by searching the entries
+	static const UIntN MaxDenseIndex = 1024;
+
+	struct DomainHandleKey
+	{
+		esif_handle_t participantHandle;
+		esif_handle_t domainHandle;
+
+		Bool operator==(const DomainHandleKey& rhs) const
+		{
+			return (participantHandle == rhs.participantHandle) && (domainHandle == rhs.domainHandle);
+		}
+	};
+
+	struct DomainHandleKeyHash
+	{
+		size_t operator()(const DomainHandleKey& key) const;
+	};
+
+	// Immutable snapshot of all mappings.  Where several entries match, the first one inserted wins.
+	struct IndexTable
+	{
+		std::vector<IndexStruct> entries;
+		std::vector<esif_handle_t> participantHandles; // [participantIndex]
+		std::vector<std::vector<esif_handle_t>> domainHandles; // [participantIndex][domainIndex]
+		std::unordered_map<esif_handle_t, UIntN> participantIndexes;
+		std::unordered_map<DomainHandleKey, UIntN, DomainHandleKeyHash> domainIndexes;
+	};
+
+	// Holds a reference to the published table for the lifetime of a lookup
+	class TableReader
+	{
+	public:
+		TableReader(IndexContainer* container);
+		~TableReader(void);
+		const IndexTable* get() const;
+
+	private:
+		IndexContainer* m_container;
+		UInt32 m_readerSlot;
+		const IndexTable* m_table;
+	};
+
+	static IndexTable* buildTable(std::vector<IndexStruct>&& entries);
+	void publishTable(IndexTable* table);
+
 	EsifMutex m_mutex;
 
-	std::vector<IndexStructPtr> m_vectorIndexStructPtr;
+	std::atomic<const IndexTable*> m_table;
+	std::atomic<UInt32> m_readerSlot;
+	std::atomic<UInt32> m_readers[2];
 };
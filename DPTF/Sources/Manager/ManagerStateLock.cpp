@@ -0,0 +1,202 @@
+/******************************************************************************
+** Copyright (c) 2013-2023 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "ManagerStateLock.h"
+
+ManagerStateLock::ManagerStateLock(void)
+	: m_isOwned(false)
+	, m_ownerThreadId(esif_ccb_thread_id_current())
+	, m_lockCount(0)
+	, m_participantPrimitiveCounts()
+	, m_participantPrimitiveWaiters(0)
+{
+}
+
+ManagerStateLock::~ManagerStateLock(void)
+{
+}
+
+void ManagerStateLock::lock(void)
+{
+	m_mutex.lock();
+	if (m_lockCount == 0)
+	{
+		m_ownerThreadId = esif_ccb_thread_id_current();
+		m_isOwned = true;
+	}
+	m_lockCount++;
+}
+
+void ManagerStateLock::unlock(void)
+{
+	m_lockCount--;
+	if (m_lockCount == 0)
+	{
+		m_isOwned = false;
+	}
+	m_mutex.unlock();
+}
+
+Bool ManagerStateLock::isHeldByCurrentThread(void) const
+{
+	// the owner id is stored before the lock is marked as owned, so another thread can never see its own id here
+	return (m_isOwned == true) && (m_ownerThreadId == esif_ccb_thread_id_current());
+}
+
+UIntN ManagerStateLock::releaseAll(void)
+{
+	if (isHeldByCurrentThread() == false)
+	{
+		return 0;
+	}
+
+	UIntN lockCount = m_lockCount;
+	for (UIntN i = 0; i < lockCount; i++)
+	{
+		unlock();
+	}
+	return lockCount;
+}
+
+void ManagerStateLock::reacquire(UIntN lockCount)
+{
+	for (UIntN i = 0; i < lockCount; i++)
+	{
+		lock();
+	}
+}
+
+void ManagerStateLock::lockPrimitiveSetOrder(void)
+{
+	m_primitiveSetOrderMutex.lock();
+}
+
+void ManagerStateLock::unlockPrimitiveSetOrder(void)
+{
+	m_primitiveSetOrderMutex.unlock();
+}
+
+void ManagerStateLock::beginParticipantPrimitive(UIntN participantIndex)
+{
+	lock();
+	m_participantPrimitiveCounts[participantIndex]++;
+	unlock();
+}
+
+void ManagerStateLock::endParticipantPrimitive(UIntN participantIndex)
+{
+	lock();
+	auto primitiveCount = m_participantPrimitiveCounts.find(participantIndex);
+	if (primitiveCount != m_participantPrimitiveCounts.end())
+	{
+		primitiveCount->second--;
+		if (primitiveCount->second == 0)
+		{
+			m_participantPrimitiveCounts.erase(primitiveCount);
+			if (m_participantPrimitiveWaiters > 0)
+			{
+				m_participantPrimitivesCompleted.signal();
+			}
+		}
+	}
+	unlock();
+}
+
+void ManagerStateLock::waitForParticipantPrimitives(UIntN participantIndex)
+{
+	lock();
+	while (m_participantPrimitiveCounts.find(participantIndex) != m_participantPrimitiveCounts.end())
+	{
+		// the semaphore is signaled each time any participant's primitives complete, so check again after waking
+		m_participantPrimitiveWaiters++;
+		const UIntN heldLockCount = releaseAll();
+		m_participantPrimitivesCompleted.wait();
+		reacquire(heldLockCount);
+		m_participantPrimitiveWaiters--;
+	}
+	unlock();
+}
+
+ManagerStateLockHolder::ManagerStateLockHolder(ManagerStateLock* managerStateLock)
+	: m_managerStateLock(managerStateLock)
+{
+	m_managerStateLock->lock();
+}
+
+ManagerStateLockHolder::~ManagerStateLockHolder(void)
+{
+	m_managerStateLock->unlock();
+}
+
+ManagerStateLockRelease::ManagerStateLockRelease(
+	ManagerStateLock* managerStateLock,
+	Bool isSetPrimitive,
+	UIntN participantIndex)
+	: m_managerStateLock(managerStateLock)
+	, m_isSetPrimitive(isSetPrimitive)
+	, m_participantIndexes(1, participantIndex)
+	, m_heldLockCount(0)
+{
+	release();
+}
+
+ManagerStateLockRelease::ManagerStateLockRelease(
+	ManagerStateLock* managerStateLock,
+	const std::vector<UIntN>& participantIndexes)
+	: m_managerStateLock(managerStateLock)
+	, m_isSetPrimitive(false)
+	, m_participantIndexes(participantIndexes)
+	, m_heldLockCount(0)
+{
+	release();
+}
+
+ManagerStateLockRelease::~ManagerStateLockRelease(void)
+{
+	if (m_managerStateLock != nullptr)
+	{
+		// the set order lock is never held while waiting for the manager state lock
+		if (m_isSetPrimitive == true)
+		{
+			m_managerStateLock->unlockPrimitiveSetOrder();
+		}
+		m_managerStateLock->reacquire(m_heldLockCount);
+		for (auto participantIndex = m_participantIndexes.begin(); participantIndex != m_participantIndexes.end();
+			 ++participantIndex)
+		{
+			m_managerStateLock->endParticipantPrimitive(*participantIndex);
+		}
+	}
+}
+
+void ManagerStateLockRelease::release(void)
+{
+	if (m_managerStateLock != nullptr)
+	{
+		if (m_isSetPrimitive == true)
+		{
+			m_managerStateLock->lockPrimitiveSetOrder();
+		}
+		for (auto participantIndex = m_participantIndexes.begin(); participantIndex != m_participantIndexes.end();
+			 ++participantIndex)
+		{
+			m_managerStateLock->beginParticipantPrimitive(*participantIndex);
+		}
+		m_heldLockCount = m_managerStateLock->releaseAll();
+	}
+}
@@ -0,0 +1,131 @@
+/******************************************************************************
+** Copyright (c) 2013-2023 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include "EsifMutex.h"
+#include "EsifSemaphore.h"
+#include "esif_ccb_thread.h"
+#include <atomic>
+#include <map>
+
+//
+// Serializes access to the manager state (participants, arbitrators, caches and the event cache) between the work
+// item thread and the threads that run policies.  The work item thread holds the lock while a work item executes
+// and policies take it for the duration of each policy services call.  The lock is recursive.  A thread that has to
+// wait for a policy executor releases every level it holds for the wait with releaseAll() and takes them back with
+// reacquire(), so the policy it is waiting for can still call policy services.
+//
+// The lock only covers reads and writes of the manager state; it is released while a primitive is executed (see
+// ManagerStateLockRelease), so slow primitive I/O for one policy does not hold up the others.  The thread executing
+// the primitive is still running inside the participant's objects, so a participant or domain is not destroyed
+// until the primitives executing for its participant have taken the lock back.
+//
+
+class ManagerStateLock final
+{
+public:
+	ManagerStateLock(void);
+	~ManagerStateLock(void);
+
+	void lock(void);
+	void unlock(void);
+	Bool isHeldByCurrentThread(void) const;
+
+	// returns the number of levels that were released
+	UIntN releaseAll(void);
+	void reacquire(UIntN lockCount);
+
+	// keeps set primitives in the order they were issued while the lock was held
+	void lockPrimitiveSetOrder(void);
+	void unlockPrimitiveSetOrder(void);
+
+	// tracks the primitives executing for a participant while the lock is released
+	void beginParticipantPrimitive(UIntN participantIndex);
+	void endParticipantPrimitive(UIntN participantIndex);
+
+	// called by the thread destroying a participant or domain, which must hold the lock.  The lock is released
+	// while waiting.
+	void waitForParticipantPrimitives(UIntN participantIndex);
+
+private:
+	// hide the copy constructor and assignment operator.
+	ManagerStateLock(const ManagerStateLock& rhs);
+	ManagerStateLock& operator=(const ManagerStateLock& rhs);
+
+	EsifMutex m_mutex;
+	EsifMutex m_primitiveSetOrderMutex;
+
+	// only written by the owning thread while it holds m_mutex
+	std::atomic<Bool> m_isOwned;
+	std::atomic<esif_thread_id_t> m_ownerThreadId;
+	UIntN m_lockCount;
+
+	// only accessed while m_mutex is held
+	std::map<UIntN, UIntN> m_participantPrimitiveCounts;
+	UIntN m_participantPrimitiveWaiters;
+	EsifSemaphore m_participantPrimitivesCompleted;
+};
+
+//
+// Holds the manager state lock from construction until the object goes out of scope.
+//
+
+class ManagerStateLockHolder final
+{
+public:
+	ManagerStateLockHolder(ManagerStateLock* managerStateLock);
+	~ManagerStateLockHolder(void);
+
+private:
+	// hide the copy constructor and assignment operator.
+	ManagerStateLockHolder(const ManagerStateLockHolder& rhs);
+	ManagerStateLockHolder& operator=(const ManagerStateLockHolder& rhs);
+
+	ManagerStateLock* m_managerStateLock;
+};
+
+//
+// Releases the manager state lock held by the current thread while primitives are executed and takes it back
+// afterwards.  The participants are kept from being destroyed until the lock has been taken back.  A set primitive
+// takes the set order lock before the manager state lock is released, so values that were arbitrated under the
+// manager state lock are written in the same order they were arbitrated.
+//
+
+class ManagerStateLockRelease final
+{
+public:
+	ManagerStateLockRelease(ManagerStateLock* managerStateLock, Bool isSetPrimitive, UIntN participantIndex);
+
+	// used for a batch of get primitives
+	ManagerStateLockRelease(ManagerStateLock* managerStateLock, const std::vector<UIntN>& participantIndexes);
+	~ManagerStateLockRelease(void);
+
+private:
+	// hide the copy constructor and assignment operator.
+	ManagerStateLockRelease(const ManagerStateLockRelease& rhs);
+	ManagerStateLockRelease& operator=(const ManagerStateLockRelease& rhs);
+
+	ManagerStateLock* m_managerStateLock;
+	Bool m_isSetPrimitive;
+	std::vector<UIntN> m_participantIndexes;
+	UIntN m_heldLockCount;
+
+	void release(void);
+};
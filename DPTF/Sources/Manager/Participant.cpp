@@ -26,6 +26,8 @@
 #include "MapOps.h"
 #include "Utility.h"
 #include "ManagerLogger.h"
+#include "WorkItemQueueManagerInterface.h"
+#include "ManagerStateLock.h"
 
 Participant::Participant(DptfManagerInterface* dptfManager)
 	: m_participantCreated(false)
@@ -110,6 +112,7 @@ void Participant::destroyParticipant()
 {
 	try
 	{
+		waitForExecutingPrimitives();
 		destroyAllDomains();
 	}
 	catch (...)
@@ -215,6 +218,7 @@ void Participant::destroyDomain(UIntN domainIndex)
 	{
 		try
 		{
+			waitForExecutingPrimitives();
 			m_domains[domainIndex]->destroyDomain();
 		}
 		catch (...)
@@ -1600,3 +1604,14 @@ UInt32 Participant::getSocDgpuPerformanceHintPoints(UIntN domainIndex)
 	throwIfDomainInvalid(domainIndex);
 	return m_domains[domainIndex]->getSocDgpuPerformanceHintPoints();
 }
+
+void Participant::waitForExecutingPrimitives() const
+{
+	// A policy thread may still be running inside this participant's objects while one of its primitives executes
+	// with the manager state lock released.
+	const auto workItemQueueManager = m_dptfManager->getWorkItemQueueManager();
+	if ((workItemQueueManager != nullptr) && (m_participantIndex != Constants::Invalid))
+	{
+		workItemQueueManager->getManagerStateLock()->waitForParticipantPrimitives(m_participantIndex);
+	}
+}
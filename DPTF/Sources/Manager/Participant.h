@@ -378,5 +378,6 @@ private:
 
 	void throwIfDomainInvalid(UIntN domainIndex) const;
 	void throwIfRealParticipantIsInvalid() const;
+	void waitForExecutingPrimitives() const;
 	EsifServicesInterface* getEsifServices() const;
 };
@@ -51,6 +51,8 @@
 #include "ManagerLogger.h"
 #include "ManagerMessage.h"
 #include "StringConverter.h"
+#include "WorkItemQueueManagerInterface.h"
+#include "PolicyExecutor.h"
 using namespace std;
 
 Policy::Policy(DptfManagerInterface* dptfManager)
@@ -77,6 +79,10 @@ EsifServicesInterface* Policy::getEsifServices()
 
 Policy::~Policy(void)
 {
+	if (m_executor != nullptr)
+	{
+		m_executor->shutDown();
+	}
 }
 
 void Policy::createPolicy(
@@ -93,6 +99,7 @@ void Policy::createPolicy(
 
 	m_policyFileName = policyFileName;
 	m_policyIndex = newPolicyIndex;
+	m_executor = m_dptfManager->getWorkItemQueueManager()->createPolicyExecutor(m_policyIndex);
 
 	// Load the .dll/.so.  If it can't load the library it will throw an exception and we're done.
 	m_esifLibrary = new EsifLibrary(m_policyFileName);
@@ -176,7 +183,9 @@ void Policy::createPolicy(
 	createPolicyServices();
 
 	m_theRealPolicyCreated = true;
-	m_theRealPolicy->create(true, m_policyServices, newPolicyIndex, m_dynamicPolicyUuidString, dynamicPolicyName);
+	m_executor->submitAndWait([&]() {
+		m_theRealPolicy->create(true, m_policyServices, newPolicyIndex, m_dynamicPolicyUuidString, dynamicPolicyName);
+	});
 	sendPolicyLogDataIfLoggingEnabled(true);
 }
 
@@ -187,7 +196,7 @@ void Policy::destroyPolicy()
 		if ((m_theRealPolicy != nullptr) && (m_theRealPolicyCreated == true))
 		{
 			sendPolicyLogDataIfLoggingEnabled(false);
-			m_theRealPolicy->destroy();
+			m_executor->submitAndWait([=]() { m_theRealPolicy->destroy(); });
 		}
 		m_policyName = std::string("");
 	}
@@ -195,6 +204,12 @@ void Policy::destroyPolicy()
 	{
 	}
 
+	// nothing may run in the policy once the instance is gone
+	if (m_executor != nullptr)
+	{
+		m_executor->shutDown();
+	}
+
 	destroyPolicyServices();
 
 	// Call the function that is exposed in the .dll/.so and ask it to destroy the instance of the class
@@ -218,32 +233,32 @@ Guid Policy::getGuid(void)
 
 void Policy::bindParticipant(UIntN participantIndex)
 {
-	m_theRealPolicy->bindParticipant(participantIndex);
+	m_executor->submitAndWait([=]() { m_theRealPolicy->bindParticipant(participantIndex); });
 }
 
 void Policy::unbindParticipant(UIntN participantIndex)
 {
-	m_theRealPolicy->unbindParticipant(participantIndex);
+	m_executor->submitAndWait([=]() { m_theRealPolicy->unbindParticipant(participantIndex); });
 }
 
 void Policy::bindDomain(UIntN participantIndex, UIntN domainIndex)
 {
-	m_theRealPolicy->bindDomain(participantIndex, domainIndex);
+	m_executor->submitAndWait([=]() { m_theRealPolicy->bindDomain(participantIndex, domainIndex); });
 }
 
 void Policy::unbindDomain(UIntN participantIndex, UIntN domainIndex)
 {
-	m_theRealPolicy->unbindDomain(participantIndex, domainIndex);
+	m_executor->submitAndWait([=]() { m_theRealPolicy->unbindDomain(participantIndex, domainIndex); });
 }
 
 void Policy::enable(void)
 {
-	m_theRealPolicy->enable();
+	m_executor->submitAndWait([=]() { m_theRealPolicy->enable(); });
 }
 
 void Policy::disable(void)
 {
-	m_theRealPolicy->disable();
+	m_executor->submitAndWait([=]() { m_theRealPolicy->disable(); });
 }
 
 string Policy::getName(void) const
@@ -263,12 +278,16 @@ UIntN Policy::getPolicyIndex() const
 
 string Policy::getStatusAsXml(void) const
 {
-	return m_theRealPolicy->getStatusAsXml();
+	string status;
+	m_executor->submitAndWait([&]() { status = m_theRealPolicy->getStatusAsXml(); });
+	return status;
 }
 
 string Policy::getDiagnosticsAsXml(void) const
 {
-	return m_theRealPolicy->getDiagnosticsAsXml();
+	string diagnostics;
+	m_executor->submitAndWait([&]() { diagnostics = m_theRealPolicy->getDiagnosticsAsXml(); });
+	return diagnostics;
 }
 
 Bool Policy::isDynamicPolicy(void)
@@ -285,7 +304,7 @@ void Policy::executeIgccBroadcastReceived(IgccBroadcastData::IgccToDttNotificati
 {
 	if (isEventRegistered(PolicyEvent::DptfAppBroadcastUnprivileged))
 	{
-		m_theRealPolicy->igccBroadcastReceived(broadcastNotificationData);
+		m_executor->submit([=]() { m_theRealPolicy->igccBroadcastReceived(broadcastNotificationData); });
 	}
 }
 
@@ -293,7 +312,7 @@ void Policy::executeConnectedStandbyEntry(void)
 {
 	if (isEventRegistered(PolicyEvent::DptfConnectedStandbyEntry))
 	{
-		m_theRealPolicy->connectedStandbyEntry();
+		m_executor->submitAndWait([=]() { m_theRealPolicy->connectedStandbyEntry(); });
 	}
 }
 
@@ -301,7 +320,7 @@ void Policy::executeConnectedStandbyExit(void)
 {
 	if (isEventRegistered(PolicyEvent::DptfConnectedStandbyExit))
 	{
-		m_theRealPolicy->connectedStandbyExit();
+		m_executor->submitAndWait([=]() { m_theRealPolicy->connectedStandbyExit(); });
 	}
 }
 
@@ -309,7 +328,7 @@ void Policy::executeLowPowerModeEntry(void)
 {
 	if (isEventRegistered(PolicyEvent::DptfLowPowerModeEntry))
 	{
-		m_theRealPolicy->lowPowerModeEntry();
+		m_executor->submitAndWait([=]() { m_theRealPolicy->lowPowerModeEntry(); });
 	}
 }
 
@@ -317,7 +336,7 @@ void Policy::executeLowPowerModeExit(void)
 {
 	if (isEventRegistered(PolicyEvent::DptfLowPowerModeExit))
 	{
-		m_theRealPolicy->lowPowerModeExit();
+		m_executor->submitAndWait([=]() { m_theRealPolicy->lowPowerModeExit(); });
 	}
 }
 
@@ -325,7 +344,7 @@ void Policy::executeSuspend(void)
 {
 	if (isEventRegistered(PolicyEvent::DptfSuspend))
 	{
-		m_theRealPolicy->suspend();
+		m_executor->submitAndWait([=]() { m_theRealPolicy->suspend(); });
 	}
 }
 
@@ -333,7 +352,7 @@ void Policy::executeResume(void)
 {
 	if (isEventRegistered(PolicyEvent::DptfResume))
 	{
-		m_theRealPolicy->resume();
+		m_executor->submitAndWait([=]() { m_theRealPolicy->resume(); });
 	}
 }
 
@@ -341,7 +360,7 @@ void Policy::executeDomainCoreControlCapabilityChanged(UIntN participantIndex)
 {
 	if (isEventRegistered(PolicyEvent::DomainCoreControlCapabilityChanged))
 	{
-		m_theRealPolicy->domainCoreControlCapabilityChanged(participantIndex);
+		m_executor->submit([=]() { m_theRealPolicy->domainCoreControlCapabilityChanged(participantIndex); });
 	}
 }
 
@@ -349,7 +368,7 @@ void Policy::executeDomainDisplayControlCapabilityChanged(UIntN participantIndex
 {
 	if (isEventRegistered(PolicyEvent::DomainDisplayControlCapabilityChanged))
 	{
-		m_theRealPolicy->domainDisplayControlCapabilityChanged(participantIndex);
+		m_executor->submit([=]() { m_theRealPolicy->domainDisplayControlCapabilityChanged(participantIndex); });
 	}
 }
 
@@ -357,7 +376,7 @@ void Policy::executeDomainDisplayStatusChanged(UIntN participantIndex)
 {
 	if (isEventRegistered(PolicyEvent::DomainDisplayStatusChanged))
 	{
-		m_theRealPolicy->domainDisplayStatusChanged(participantIndex);
+		m_executor->submit([=]() { m_theRealPolicy->domainDisplayStatusChanged(participantIndex); });
 	}
 }
 
@@ -365,7 +384,7 @@ void Policy::executeDomainPerformanceControlCapabilityChanged(UIntN participantI
 {
 	if (isEventRegistered(PolicyEvent::DomainPerformanceControlCapabilityChanged))
 	{
-		m_theRealPolicy->domainPerformanceControlCapabilityChanged(participantIndex);
+		m_executor->submit([=]() { m_theRealPolicy->domainPerformanceControlCapabilityChanged(participantIndex); });
 	}
 }
 
@@ -373,7 +392,7 @@ void Policy::executeDomainPerformanceControlsChanged(UIntN participantIndex)
 {
 	if (isEventRegistered(PolicyEvent::DomainPerformanceControlsChanged))
 	{
-		m_theRealPolicy->domainPerformanceControlsChanged(participantIndex);
+		m_executor->submit([=]() { m_theRealPolicy->domainPerformanceControlsChanged(participantIndex); });
 	}
 }
 
@@ -381,7 +400,7 @@ void Policy::executeDomainPowerControlCapabilityChanged(UIntN participantIndex)
 {
 	if (isEventRegistered(PolicyEvent::DomainPowerControlCapabilityChanged))
 	{
-		m_theRealPolicy->domainPowerControlCapabilityChanged(participantIndex);
+		m_executor->submit([=]() { m_theRealPolicy->domainPowerControlCapabilityChanged(participantIndex); });
 	}
 }
 
@@ -389,7 +408,7 @@ void Policy::executeDomainPriorityChanged(UIntN participantIndex)
 {
 	if (isEventRegistered(PolicyEvent::DomainPriorityChanged))
 	{
-		m_theRealPolicy->domainPriorityChanged(participantIndex);
+		m_executor->submit([=]() { m_theRealPolicy->domainPriorityChanged(participantIndex); });
 	}
 }
 
@@ -399,7 +418,9 @@ void Policy::executeDomainRadioConnectionStatusChanged(
 {
 	if (isEventRegistered(PolicyEvent::DomainRadioConnectionStatusChanged))
 	{
-		m_theRealPolicy->domainRadioConnectionStatusChanged(participantIndex, radioConnectionStatus);
+		m_executor->submit([=]() {
+			m_theRealPolicy->domainRadioConnectionStatusChanged(participantIndex, radioConnectionStatus);
+		});
 	}
 }
 
@@ -407,7 +428,7 @@ void Policy::executeDomainRfProfileChanged(UIntN participantIndex)
 {
 	if (isEventRegistered(PolicyEvent::DomainRfProfileChanged))
 	{
-		m_theRealPolicy->domainRfProfileChanged(participantIndex);
+		m_executor->submit([=]() { m_theRealPolicy->domainRfProfileChanged(participantIndex); });
 	}
 }
 
@@ -415,7 +436,7 @@ void Policy::executeDomainTemperatureThresholdCrossed(UIntN participantIndex)
 {
 	if (isEventRegistered(PolicyEvent::DomainTemperatureThresholdCrossed))
 	{
-		m_theRealPolicy->domainTemperatureThresholdCrossed(participantIndex);
+		m_executor->submit([=]() { m_theRealPolicy->domainTemperatureThresholdCrossed(participantIndex); });
 	}
 }
 
@@ -423,7 +444,7 @@ void Policy::executeDomainEnergyThresholdCrossed(UIntN participantIndex)
 {
 	if (isEventRegistered(PolicyEvent::DomainEnergyThresholdCrossed))
 	{
-		m_theRealPolicy->domainEnergyThresholdCrossed(participantIndex);
+		m_executor->submit([=]() { m_theRealPolicy->domainEnergyThresholdCrossed(participantIndex); });
 	}
 }
 
@@ -431,7 +452,7 @@ void Policy::executeDomainFanCapabilityChanged(UIntN participantIndex)
 {
 	if (isEventRegistered(PolicyEvent::DomainFanCapabilityChanged))
 	{
-		m_theRealPolicy->domainFanCapabilityChanged(participantIndex);
+		m_executor->submit([=]() { m_theRealPolicy->domainFanCapabilityChanged(participantIndex); });
 	}
 }
 
@@ -439,7 +460,7 @@ void Policy::executeDomainVirtualSensorCalibrationTableChanged(UIntN participant
 {
 	if (isEventRegistered(PolicyEvent::DomainVirtualSensorCalibrationTableChanged))
 	{
-		m_theRealPolicy->domainVirtualSensorCalibrationTableChanged(participantIndex);
+		m_executor->submit([=]() { m_theRealPolicy->domainVirtualSensorCalibrationTableChanged(participantIndex); });
 	}
 }
 
@@ -447,7 +468,7 @@ void Policy::executeDomainVirtualSensorPollingTableChanged(UIntN participantInde
 {
 	if (isEventRegistered(PolicyEvent::DomainVirtualSensorPollingTableChanged))
 	{
-		m_theRealPolicy->domainVirtualSensorPollingTableChanged(participantIndex);
+		m_executor->submit([=]() { m_theRealPolicy->domainVirtualSensorPollingTableChanged(participantIndex); });
 	}
 }
 
@@ -455,7 +476,7 @@ void Policy::executeDomainVirtualSensorRecalcChanged(UIntN participantIndex)
 {
 	if (isEventRegistered(PolicyEvent::DomainVirtualSensorRecalcChanged))
 	{
-		m_theRealPolicy->domainVirtualSensorRecalcChanged(participantIndex);
+		m_executor->submit([=]() { m_theRealPolicy->domainVirtualSensorRecalcChanged(participantIndex); });
 	}
 }
 
@@ -467,8 +488,10 @@ void Policy::executeDomainSocWorkloadClassificationChanged(
 	if (isEventRegistered(PolicyEvent::DomainSocWorkloadClassificationChanged)
 		|| isEventRegistered(PolicyEvent::DomainHardwareSocWorkloadHintChanged))
 	{
-		m_theRealPolicy->domainSocWorkloadClassificationChanged(
-			participantIndex, domainIndex, socWorkloadClassification);
+		m_executor->submit([=]() {
+			m_theRealPolicy->domainSocWorkloadClassificationChanged(
+				participantIndex, domainIndex, socWorkloadClassification);
+		});
 	}
 }
 
@@ -479,7 +502,9 @@ void Policy::executeDomainSocPowerFloorChanged(
 {
 	if (isEventRegistered(PolicyEvent::DomainSocPowerFloorChanged))
 	{
-		m_theRealPolicy->domainSocPowerFloorChanged(+participantIndex, domainIndex, socPowerFloor);
+		m_executor->submit([=]() {
+			m_theRealPolicy->domainSocPowerFloorChanged(+participantIndex, domainIndex, socPowerFloor);
+		});
 	}
 }
 
@@ -488,7 +513,9 @@ void Policy::executeDomainEppSensitivityHintChanged(UIntN participantIndex, UInt
 	if (isEventRegistered(PolicyEvent::DomainEppSensitivityHintChanged)
 		|| isEventRegistered(PolicyEvent::DomainHardwareSocWorkloadHintChanged))
 	{
-		m_theRealPolicy->domainEppSensitivityHintChanged(participantIndex, domainIndex, mbtHint);
+		m_executor->submit([=]() {
+			m_theRealPolicy->domainEppSensitivityHintChanged(participantIndex, domainIndex, mbtHint);
+		});
 	}
 }
 
@@ -499,8 +526,10 @@ void Policy::executeDomainExtendedWorkloadPredictionChanged(
 {
 	if (isEventRegistered(PolicyEvent::DomainExtendedWorkloadPredictionChanged))
 	{
-		m_theRealPolicy->domainExtendedWorkloadPredictionChanged(
-			participantIndex, domainIndex, extendedWorkloadPrediction);
+		m_executor->submit([=]() {
+			m_theRealPolicy->domainExtendedWorkloadPredictionChanged(
+				participantIndex, domainIndex, extendedWorkloadPrediction);
+		});
 	}
 }
 
@@ -511,7 +540,9 @@ void Policy::executeDomainFanOperatingModeChanged(
 {
 	if (isEventRegistered(PolicyEvent::DomainFanOperatingModeChanged))
 	{
-		m_theRealPolicy->domainFanOperatingModeChanged(participantIndex, domainIndex, fanOperatingMode);
+		m_executor->submit([=]() {
+			m_theRealPolicy->domainFanOperatingModeChanged(participantIndex, domainIndex, fanOperatingMode);
+		});
 	}
 }
 
@@ -522,7 +553,9 @@ void Policy::executeDomainPcieThrottleRequested(
 {
 	if (isEventRegistered(PolicyEvent::DomainPcieThrottleRequested))
 	{
-		m_theRealPolicy->domainPcieThrottleRequested(participantIndex, domainIndex, pcieThrottleRequested);
+		m_executor->submit([=]() {
+			m_theRealPolicy->domainPcieThrottleRequested(participantIndex, domainIndex, pcieThrottleRequested);
+		});
 	}
 }
 
@@ -530,7 +563,7 @@ void Policy::executeParticipantSpecificInfoChanged(UIntN participantIndex)
 {
 	if (isEventRegistered(PolicyEvent::ParticipantSpecificInfoChanged))
 	{
-		m_theRealPolicy->participantSpecificInfoChanged(participantIndex);
+		m_executor->submit([=]() { m_theRealPolicy->participantSpecificInfoChanged(participantIndex); });
 	}
 }
 
@@ -538,7 +571,7 @@ void Policy::executePolicyActiveRelationshipTableChanged(void)
 {
 	if (isEventRegistered(PolicyEvent::PolicyActiveRelationshipTableChanged))
 	{
-		m_theRealPolicy->activeRelationshipTableChanged();
+		m_executor->submit([=]() { m_theRealPolicy->activeRelationshipTableChanged(); });
 	}
 }
 
@@ -546,7 +579,7 @@ void Policy::executePolicyCoolingModePolicyChanged(CoolingMode::Type coolingMode
 {
 	if (isEventRegistered(PolicyEvent::PolicyCoolingModePolicyChanged))
 	{
-		m_theRealPolicy->coolingModePolicyChanged(coolingMode);
+		m_executor->submit([=]() { m_theRealPolicy->coolingModePolicyChanged(coolingMode); });
 	}
 }
 
@@ -554,20 +587,34 @@ void Policy::executePolicyForegroundApplicationChanged(const string& foregroundA
 {
 	if (isEventRegistered(PolicyEvent::PolicyForegroundApplicationChanged))
 	{
-		m_theRealPolicy->foregroundApplicationChanged(foregroundApplicationName);
+		m_executor->submit([=]() { m_theRealPolicy->foregroundApplicationChanged(foregroundApplicationName); });
 	}
 }
 
-void Policy::executePolicyInitiatedCallback(UInt64 policyDefinedEventCode, UInt64 param1, void* param2)
+void Policy::executePolicyInitiatedCallback(
+	UInt64 callbackHandle,
+	UInt64 policyDefinedEventCode,
+	UInt64 param1,
+	void* param2)
 {
-	m_theRealPolicy->policyInitiatedCallback(policyDefinedEventCode, param1, param2);
+	m_executor->submit(
+		[=]() { m_theRealPolicy->policyInitiatedCallback(policyDefinedEventCode, param1, param2); }, callbackHandle);
+}
+
+UIntN Policy::cancelPolicyInitiatedCallback(UInt64 callbackHandle)
+{
+	if (m_executor == nullptr)
+	{
+		return 0;
+	}
+	return m_executor->cancel(callbackHandle);
 }
 
 void Policy::executePolicyOperatingSystemPowerSourceChanged(OsPowerSource::Type powerSource)
 {
 	if (isEventRegistered(PolicyEvent::PolicyOperatingSystemPowerSourceChanged))
 	{
-		m_theRealPolicy->operatingSystemPowerSourceChanged(powerSource);
+		m_executor->submit([=]() { m_theRealPolicy->operatingSystemPowerSourceChanged(powerSource); });
 	}
 }
 
@@ -575,7 +622,7 @@ void Policy::executePolicyOperatingSystemLidStateChanged(OsLidState::Type lidSta
 {
 	if (isEventRegistered(PolicyEvent::PolicyOperatingSystemLidStateChanged))
 	{
-		m_theRealPolicy->operatingSystemLidStateChanged(lidState);
+		m_executor->submit([=]() { m_theRealPolicy->operatingSystemLidStateChanged(lidState); });
 	}
 }
 
@@ -583,7 +630,7 @@ void Policy::executePolicyOperatingSystemBatteryPercentageChanged(UIntN batteryP
 {
 	if (isEventRegistered(PolicyEvent::PolicyOperatingSystemBatteryPercentageChanged))
 	{
-		m_theRealPolicy->operatingSystemBatteryPercentageChanged(batteryPercentage);
+		m_executor->submit([=]() { m_theRealPolicy->operatingSystemBatteryPercentageChanged(batteryPercentage); });
 	}
 }
 
@@ -591,7 +638,7 @@ void Policy::executePolicyOperatingSystemPlatformTypeChanged(OsPlatformType::Typ
 {
 	if (isEventRegistered(PolicyEvent::PolicyOperatingSystemPlatformTypeChanged))
 	{
-		m_theRealPolicy->operatingSystemPlatformTypeChanged(platformType);
+		m_executor->submit([=]() { m_theRealPolicy->operatingSystemPlatformTypeChanged(platformType); });
 	}
 }
 
@@ -599,7 +646,7 @@ void Policy::executePolicyOperatingSystemDockModeChanged(OsDockMode::Type dockMo
 {
 	if (isEventRegistered(PolicyEvent::PolicyOperatingSystemDockModeChanged))
 	{
-		m_theRealPolicy->operatingSystemDockModeChanged(dockMode);
+		m_executor->submit([=]() { m_theRealPolicy->operatingSystemDockModeChanged(dockMode); });
 	}
 }
 
@@ -607,7 +654,9 @@ void Policy::executePolicyOperatingSystemEmergencyCallModeStateChanged(OnOffTogg
 {
 	if (isEventRegistered(PolicyEvent::PolicyOperatingSystemMobileNotification))
 	{
-		m_theRealPolicy->operatingSystemEmergencyCallModeStateChanged(emergencyCallModeState);
+		m_executor->submit([=]() {
+			m_theRealPolicy->operatingSystemEmergencyCallModeStateChanged(emergencyCallModeState);
+		});
 	}
 }
 
@@ -617,7 +666,7 @@ void Policy::executePolicyOperatingSystemMobileNotification(
 {
 	if (isEventRegistered(PolicyEvent::PolicyOperatingSystemMobileNotification))
 	{
-		m_theRealPolicy->operatingSystemMobileNotification(notificationType, value);
+		m_executor->submit([=]() { m_theRealPolicy->operatingSystemMobileNotification(notificationType, value); });
 	}
 }
 
@@ -625,7 +674,7 @@ void Policy::executePolicyOperatingSystemMixedRealityModeChanged(OnOffToggle::Ty
 {
 	if (isEventRegistered(PolicyEvent::PolicyOperatingSystemMixedRealityModeChanged))
 	{
-		m_theRealPolicy->operatingSystemMixedRealityModeChanged(osMixedRealityMode);
+		m_executor->submit([=]() { m_theRealPolicy->operatingSystemMixedRealityModeChanged(osMixedRealityMode); });
 	}
 }
 
@@ -633,7 +682,7 @@ void Policy::executePolicyOperatingSystemUserPresenceChanged(OsUserPresence::Typ
 {
 	if (isEventRegistered(PolicyEvent::PolicyOperatingSystemUserPresenceChanged))
 	{
-		m_theRealPolicy->operatingSystemUserPresenceChanged(userPresence);
+		m_executor->submit([=]() { m_theRealPolicy->operatingSystemUserPresenceChanged(userPresence); });
 	}
 }
 
@@ -641,7 +690,7 @@ void Policy::executePolicyOperatingSystemSessionStateChanged(OsSessionState::Typ
 {
 	if (isEventRegistered(PolicyEvent::PolicyOperatingSystemSessionStateChanged))
 	{
-		m_theRealPolicy->operatingSystemSessionStateChanged(sessionState);
+		m_executor->submit([=]() { m_theRealPolicy->operatingSystemSessionStateChanged(sessionState); });
 	}
 }
 
@@ -649,7 +698,7 @@ void Policy::executePolicyOperatingSystemScreenStateChanged(OnOffToggle::Type sc
 {
 	if (isEventRegistered(PolicyEvent::PolicyOperatingSystemScreenStateChanged))
 	{
-		m_theRealPolicy->operatingSystemScreenStateChanged(screenState);
+		m_executor->submit([=]() { m_theRealPolicy->operatingSystemScreenStateChanged(screenState); });
 	}
 }
 
@@ -657,7 +706,7 @@ void Policy::executePolicyProcessLoaded(const string& processName)
 {
 	if (isEventRegistered(PolicyEvent::PolicyProcessLoadNotification))
 	{
-		m_theRealPolicy->processLoaded(processName);
+		m_executor->submit([=]() { m_theRealPolicy->processLoaded(processName); });
 	}
 }
 
@@ -665,7 +714,7 @@ void Policy::executePolicyPassiveTableChanged(void)
 {
 	if (isEventRegistered(PolicyEvent::PolicyPassiveTableChanged))
 	{
-		m_theRealPolicy->passiveTableChanged();
+		m_executor->submit([=]() { m_theRealPolicy->passiveTableChanged(); });
 	}
 }
 
@@ -673,7 +722,7 @@ void Policy::executePolicySensorOrientationChanged(SensorOrientation::Type senso
 {
 	if (isEventRegistered(PolicyEvent::PolicySensorOrientationChanged))
 	{
-		m_theRealPolicy->sensorOrientationChanged(sensorOrientation);
+		m_executor->submit([=]() { m_theRealPolicy->sensorOrientationChanged(sensorOrientation); });
 	}
 }
 
@@ -681,7 +730,7 @@ void Policy::executePolicySensorMotionChanged(OnOffToggle::Type sensorMotion)
 {
 	if (isEventRegistered(PolicyEvent::PolicySensorMotionChanged))
 	{
-		m_theRealPolicy->sensorMotionChanged(sensorMotion);
+		m_executor->submit([=]() { m_theRealPolicy->sensorMotionChanged(sensorMotion); });
 	}
 }
 
@@ -689,7 +738,7 @@ void Policy::executePolicySensorSpatialOrientationChanged(SensorSpatialOrientati
 {
 	if (isEventRegistered(PolicyEvent::PolicySensorSpatialOrientationChanged))
 	{
-		m_theRealPolicy->sensorSpatialOrientationChanged(sensorSpatialOrientation);
+		m_executor->submit([=]() { m_theRealPolicy->sensorSpatialOrientationChanged(sensorSpatialOrientation); });
 	}
 }
 
@@ -697,7 +746,7 @@ void Policy::executePolicyThermalRelationshipTableChanged(void)
 {
 	if (isEventRegistered(PolicyEvent::PolicyThermalRelationshipTableChanged))
 	{
-		m_theRealPolicy->thermalRelationshipTableChanged();
+		m_executor->submit([=]() { m_theRealPolicy->thermalRelationshipTableChanged(); });
 	}
 }
 
@@ -705,7 +754,7 @@ void Policy::executePolicyAdaptivePerformanceConditionsTableChanged(void)
 {
 	if (isEventRegistered(PolicyEvent::PolicyAdaptivePerformanceConditionsTableChanged))
 	{
-		m_theRealPolicy->adaptivePerformanceConditionsTableChanged();
+		m_executor->submit([=]() { m_theRealPolicy->adaptivePerformanceConditionsTableChanged(); });
 	}
 }
 
@@ -713,7 +762,7 @@ void Policy::executePolicyDdrfTableChanged(void)
 {
 	if (isEventRegistered(PolicyEvent::PolicyDdrfTableChanged))
 	{
-		m_theRealPolicy->ddrfTableChanged();
+		m_executor->submit([=]() { m_theRealPolicy->ddrfTableChanged(); });
 	}
 }
 
@@ -721,7 +770,7 @@ void Policy::executePolicyRfimTableChanged(void)
 {
 	if (isEventRegistered(PolicyEvent::PolicyRfimTableChanged))
 	{
-		m_theRealPolicy->rfimTableChanged();
+		m_executor->submit([=]() { m_theRealPolicy->rfimTableChanged(); });
 	}
 }
 
@@ -729,7 +778,7 @@ void Policy::executePolicyTpgaTableChanged(void)
 {
 	if (isEventRegistered(PolicyEvent::PolicyTpgaTableChanged))
 	{
-		m_theRealPolicy->tpgaTableChanged();
+		m_executor->submit([=]() { m_theRealPolicy->tpgaTableChanged(); });
 	}
 }
 
@@ -737,7 +786,7 @@ void Policy::executePolicyAdaptivePerformanceActionsTableChanged(void)
 {
 	if (isEventRegistered(PolicyEvent::PolicyAdaptivePerformanceActionsTableChanged))
 	{
-		m_theRealPolicy->adaptivePerformanceActionsTableChanged();
+		m_executor->submit([=]() { m_theRealPolicy->adaptivePerformanceActionsTableChanged(); });
 	}
 }
 
@@ -745,7 +794,7 @@ void Policy::executePolicyOemVariablesChanged(void)
 {
 	if (isEventRegistered(PolicyEvent::PolicyOemVariablesChanged))
 	{
-		m_theRealPolicy->oemVariablesChanged();
+		m_executor->submit([=]() { m_theRealPolicy->oemVariablesChanged(); });
 	}
 }
 
@@ -753,7 +802,7 @@ void Policy::executeSwOemVariablesChanged()
 {
 	if (isEventRegistered(PolicyEvent::PolicySwOemVariablesChanged))
 	{
-		m_theRealPolicy->swOemVariablesChanged();
+		m_executor->submit([=]() { m_theRealPolicy->swOemVariablesChanged(); });
 	}
 }
 
@@ -761,7 +810,7 @@ void Policy::executeEnvironmentProfileChanged(const EnvironmentProfile& environm
 {
 	if (isEventRegistered(PolicyEvent::DptfEnvironmentProfileChanged))
 	{
-		m_theRealPolicy->environmentProfileChanged(environmentProfile);
+		m_executor->submit([=]() { m_theRealPolicy->environmentProfileChanged(environmentProfile); });
 	}
 }
 
@@ -769,7 +818,7 @@ void Policy::executePolicyPowerBossConditionsTableChanged(void)
 {
 	if (isEventRegistered(PolicyEvent::PolicyPowerBossConditionsTableChanged))
 	{
-		m_theRealPolicy->powerBossConditionsTableChanged();
+		m_executor->submit([=]() { m_theRealPolicy->powerBossConditionsTableChanged(); });
 	}
 }
 
@@ -777,7 +826,7 @@ void Policy::executePolicyPowerBossActionsTableChanged(void)
 {
 	if (isEventRegistered(PolicyEvent::PolicyPowerBossActionsTableChanged))
 	{
-		m_theRealPolicy->powerBossActionsTableChanged();
+		m_executor->submit([=]() { m_theRealPolicy->powerBossActionsTableChanged(); });
 	}
 }
 
@@ -785,7 +834,7 @@ void Policy::executePolicyPowerBossMathTableChanged(void)
 {
 	if (isEventRegistered(PolicyEvent::PolicyPowerBossMathTableChanged))
 	{
-		m_theRealPolicy->powerBossMathTableChanged();
+		m_executor->submit([=]() { m_theRealPolicy->powerBossMathTableChanged(); });
 	}
 }
 
@@ -793,7 +842,7 @@ void Policy::executePolicyVoltageThresholdMathTableChanged(void)
 {
 	if (isEventRegistered(PolicyEvent::PolicyVoltageThresholdMathTableChanged))
 	{
-		m_theRealPolicy->voltageThresholdMathTableChanged();
+		m_executor->submit([=]() { m_theRealPolicy->voltageThresholdMathTableChanged(); });
 	}
 }
 
@@ -802,7 +851,9 @@ void Policy::executePolicyOperatingSystemPowerSchemePersonalityChanged(
 {
 	if (isEventRegistered(PolicyEvent::PolicyOperatingSystemPowerSchemePersonalityChanged))
 	{
-		m_theRealPolicy->operatingSystemPowerSchemePersonalityChanged(powerSchemePersonality);
+		m_executor->submit([=]() {
+			m_theRealPolicy->operatingSystemPowerSchemePersonalityChanged(powerSchemePersonality);
+		});
 	}
 }
 
@@ -810,7 +861,7 @@ void Policy::executePolicyOperatingSystemBatteryCountChanged(UIntN batteryCount)
 {
 	if (isEventRegistered(PolicyEvent::PolicyOperatingSystemBatteryCountChanged))
 	{
-		m_theRealPolicy->operatingSystemBatteryCountChanged(batteryCount);
+		m_executor->submit([=]() { m_theRealPolicy->operatingSystemBatteryCountChanged(batteryCount); });
 	}
 }
 
@@ -818,7 +869,7 @@ void Policy::executePolicyOperatingSystemPowerSliderChanged(OsPowerSlider::Type
 {
 	if (isEventRegistered(PolicyEvent::PolicyOperatingSystemPowerSliderChanged))
 	{
-		m_theRealPolicy->operatingSystemPowerSliderChanged(powerSlider);
+		m_executor->submit([=]() { m_theRealPolicy->operatingSystemPowerSliderChanged(powerSlider); });
 	}
 }
 
@@ -826,7 +877,7 @@ void Policy::executePolicySystemModeChanged(SystemMode::Type systemMode)
 {
 	if (isEventRegistered(PolicyEvent::PolicySystemModeChanged))
 	{
-		m_theRealPolicy->systemModeChanged(systemMode);
+		m_executor->submit([=]() { m_theRealPolicy->systemModeChanged(systemMode); });
 	}
 }
 
@@ -845,7 +896,7 @@ void Policy::executePolicyEmergencyCallModeTableChanged(void)
 {
 	if (isEventRegistered(PolicyEvent::PolicyEmergencyCallModeTableChanged))
 	{
-		m_theRealPolicy->emergencyCallModeTableChanged();
+		m_executor->submit([=]() { m_theRealPolicy->emergencyCallModeTableChanged(); });
 	}
 }
 
@@ -853,7 +904,7 @@ void Policy::executePolicyPidAlgorithmTableChanged(void)
 {
 	if (isEventRegistered(PolicyEvent::PolicyPidAlgorithmTableChanged))
 	{
-		m_theRealPolicy->pidAlgorithmTableChanged();
+		m_executor->submit([=]() { m_theRealPolicy->pidAlgorithmTableChanged(); });
 	}
 }
 
@@ -861,7 +912,7 @@ void Policy::executePolicyActiveControlPointRelationshipTableChanged(void)
 {
 	if (isEventRegistered(PolicyEvent::PolicyActiveControlPointRelationshipTableChanged))
 	{
-		m_theRealPolicy->activeControlPointRelationshipTableChanged();
+		m_executor->submit([=]() { m_theRealPolicy->activeControlPointRelationshipTableChanged(); });
 	}
 }
 
@@ -869,7 +920,7 @@ void Policy::executePolicyPowerShareAlgorithmTableChanged(void)
 {
 	if (isEventRegistered(PolicyEvent::PolicyPowerShareAlgorithmTableChanged))
 	{
-		m_theRealPolicy->powerShareAlgorithmTableChanged();
+		m_executor->submit([=]() { m_theRealPolicy->powerShareAlgorithmTableChanged(); });
 	}
 }
 
@@ -877,7 +928,7 @@ void Policy::executePolicyIntelligentThermalManagementTableChanged(void)
 {
 	if (isEventRegistered(PolicyEvent::PolicyIntelligentThermalManagementTableChanged))
 	{
-		m_theRealPolicy->intelligentThermalManagementTableChanged();
+		m_executor->submit([=]() { m_theRealPolicy->intelligentThermalManagementTableChanged(); });
 	}
 }
 
@@ -885,7 +936,7 @@ void Policy::executePolicyPowerShareAlgorithmTable2Changed(void)
 {
 	if (isEventRegistered(PolicyEvent::PolicyPowerShareAlgorithmTable2Changed))
 	{
-		m_theRealPolicy->powerShareAlgorithmTable2Changed();
+		m_executor->submit([=]() { m_theRealPolicy->powerShareAlgorithmTable2Changed(); });
 	}
 }
 
@@ -893,7 +944,7 @@ void Policy::executePolicyEnergyPerformanceOptimizerTableChanged(void)
 {
 	if (isEventRegistered(PolicyEvent::PolicyEnergyPerformanceOptimizerTableChanged))
 	{
-		m_theRealPolicy->energyPerformanceOptimizerTableChanged();
+		m_executor->submit([=]() { m_theRealPolicy->energyPerformanceOptimizerTableChanged(); });
 	}
 }
 
@@ -901,7 +952,7 @@ void Policy::executePowerLimitChanged(void)
 {
 	if (isEventRegistered(PolicyEvent::PowerLimitChanged))
 	{
-		m_theRealPolicy->powerLimitChanged();
+		m_executor->submit([=]() { m_theRealPolicy->powerLimitChanged(); });
 	}
 }
 
@@ -909,7 +960,7 @@ void Policy::executePowerLimitTimeWindowChanged(void)
 {
 	if (isEventRegistered(PolicyEvent::PowerLimitTimeWindowChanged))
 	{
-		m_theRealPolicy->powerLimitTimeWindowChanged();
+		m_executor->submit([=]() { m_theRealPolicy->powerLimitTimeWindowChanged(); });
 	}
 }
 
@@ -917,7 +968,7 @@ void Policy::executePerformanceCapabilitiesChanged(UIntN participantIndex)
 {
 	if (isEventRegistered(PolicyEvent::PerformanceCapabilitiesChanged))
 	{
-		m_theRealPolicy->performanceCapabilitiesChanged(participantIndex);
+		m_executor->submit([=]() { m_theRealPolicy->performanceCapabilitiesChanged(participantIndex); });
 	}
 }
 
@@ -925,7 +976,7 @@ void Policy::executePolicyWorkloadHintConfigurationChanged(void)
 {
 	if (isEventRegistered(PolicyEvent::PolicyWorkloadHintConfigurationChanged))
 	{
-		m_theRealPolicy->workloadHintConfigurationChanged();
+		m_executor->submit([=]() { m_theRealPolicy->workloadHintConfigurationChanged(); });
 	}
 }
 
@@ -1041,7 +1092,7 @@ void Policy::executeDomainBatteryStatusChanged(UIntN participantIndex)
 {
 	if (isEventRegistered(PolicyEvent::DomainBatteryStatusChanged))
 	{
-		m_theRealPolicy->domainBatteryStatusChanged(participantIndex);
+		m_executor->submit([=]() { m_theRealPolicy->domainBatteryStatusChanged(participantIndex); });
 	}
 }
 
@@ -1049,7 +1100,7 @@ void Policy::executeDomainBatteryInformationChanged(UIntN participantIndex)
 {
 	if (isEventRegistered(PolicyEvent::DomainBatteryInformationChanged))
 	{
-		m_theRealPolicy->domainBatteryInformationChanged(participantIndex);
+		m_executor->submit([=]() { m_theRealPolicy->domainBatteryInformationChanged(participantIndex); });
 	}
 }
 
@@ -1057,7 +1108,7 @@ void Policy::executeDomainBatteryHighFrequencyImpedanceChanged(UIntN participant
 {
 	if (isEventRegistered(PolicyEvent::DomainBatteryHighFrequencyImpedanceChanged))
 	{
-		m_theRealPolicy->domainBatteryHighFrequencyImpedanceChanged(participantIndex);
+		m_executor->submit([=]() { m_theRealPolicy->domainBatteryHighFrequencyImpedanceChanged(participantIndex); });
 	}
 }
 
@@ -1065,7 +1116,7 @@ void Policy::executeDomainBatteryNoLoadVoltageChanged(UIntN participantIndex)
 {
 	if (isEventRegistered(PolicyEvent::DomainBatteryNoLoadVoltageChanged))
 	{
-		m_theRealPolicy->domainBatteryNoLoadVoltageChanged(participantIndex);
+		m_executor->submit([=]() { m_theRealPolicy->domainBatteryNoLoadVoltageChanged(participantIndex); });
 	}
 }
 
@@ -1073,7 +1124,7 @@ void Policy::executeDomainMaxBatteryPeakCurrentChanged(UIntN participantIndex)
 {
 	if (isEventRegistered(PolicyEvent::DomainMaxBatteryPeakCurrentChanged))
 	{
-		m_theRealPolicy->domainMaxBatteryPeakCurrentChanged(participantIndex);
+		m_executor->submit([=]() { m_theRealPolicy->domainMaxBatteryPeakCurrentChanged(participantIndex); });
 	}
 }
 
@@ -1081,7 +1132,7 @@ void Policy::executeDomainPlatformPowerSourceChanged(UIntN participantIndex)
 {
 	if (isEventRegistered(PolicyEvent::DomainPlatformPowerSourceChanged))
 	{
-		m_theRealPolicy->domainPlatformPowerSourceChanged(participantIndex);
+		m_executor->submit([=]() { m_theRealPolicy->domainPlatformPowerSourceChanged(participantIndex); });
 	}
 }
 
@@ -1089,7 +1140,7 @@ void Policy::executeDomainAdapterPowerRatingChanged(UIntN participantIndex)
 {
 	if (isEventRegistered(PolicyEvent::DomainAdapterPowerRatingChanged))
 	{
-		m_theRealPolicy->domainAdapterPowerRatingChanged(participantIndex);
+		m_executor->submit([=]() { m_theRealPolicy->domainAdapterPowerRatingChanged(participantIndex); });
 	}
 }
 
@@ -1097,7 +1148,7 @@ void Policy::executeDomainChargerTypeChanged(UIntN participantIndex)
 {
 	if (isEventRegistered(PolicyEvent::DomainChargerTypeChanged))
 	{
-		m_theRealPolicy->domainChargerTypeChanged(participantIndex);
+		m_executor->submit([=]() { m_theRealPolicy->domainChargerTypeChanged(participantIndex); });
 	}
 }
 
@@ -1105,7 +1156,7 @@ void Policy::executeDomainPlatformRestOfPowerChanged(UIntN participantIndex)
 {
 	if (isEventRegistered(PolicyEvent::DomainPlatformRestOfPowerChanged))
 	{
-		m_theRealPolicy->domainPlatformRestOfPowerChanged(participantIndex);
+		m_executor->submit([=]() { m_theRealPolicy->domainPlatformRestOfPowerChanged(participantIndex); });
 	}
 }
 
@@ -1113,7 +1164,7 @@ void Policy::executeDomainMaxBatteryPowerChanged(UIntN participantIndex)
 {
 	if (isEventRegistered(PolicyEvent::DomainMaxBatteryPowerChanged))
 	{
-		m_theRealPolicy->domainMaxBatteryPowerChanged(participantIndex);
+		m_executor->submit([=]() { m_theRealPolicy->domainMaxBatteryPowerChanged(participantIndex); });
 	}
 }
 
@@ -1121,7 +1172,7 @@ void Policy::executeDomainPlatformBatterySteadyStateChanged(UIntN participantInd
 {
 	if (isEventRegistered(PolicyEvent::DomainPlatformBatterySteadyStateChanged))
 	{
-		m_theRealPolicy->domainPlatformBatterySteadyStateChanged(participantIndex);
+		m_executor->submit([=]() { m_theRealPolicy->domainPlatformBatterySteadyStateChanged(participantIndex); });
 	}
 }
 
@@ -1129,7 +1180,7 @@ void Policy::executeDomainACNominalVoltageChanged(UIntN participantIndex)
 {
 	if (isEventRegistered(PolicyEvent::DomainACNominalVoltageChanged))
 	{
-		m_theRealPolicy->domainACNominalVoltageChanged(participantIndex);
+		m_executor->submit([=]() { m_theRealPolicy->domainACNominalVoltageChanged(participantIndex); });
 	}
 }
 
@@ -1137,7 +1188,7 @@ void Policy::executeDomainACOperationalCurrentChanged(UIntN participantIndex)
 {
 	if (isEventRegistered(PolicyEvent::DomainACOperationalCurrentChanged))
 	{
-		m_theRealPolicy->domainACOperationalCurrentChanged(participantIndex);
+		m_executor->submit([=]() { m_theRealPolicy->domainACOperationalCurrentChanged(participantIndex); });
 	}
 }
 
@@ -1145,7 +1196,7 @@ void Policy::executeDomainAC1msPercentageOverloadChanged(UIntN participantIndex)
 {
 	if (isEventRegistered(PolicyEvent::DomainAC1msPercentageOverloadChanged))
 	{
-		m_theRealPolicy->domainAC1msPercentageOverloadChanged(participantIndex);
+		m_executor->submit([=]() { m_theRealPolicy->domainAC1msPercentageOverloadChanged(participantIndex); });
 	}
 }
 
@@ -1153,7 +1204,7 @@ void Policy::executeDomainAC2msPercentageOverloadChanged(UIntN participantIndex)
 {
 	if (isEventRegistered(PolicyEvent::DomainAC2msPercentageOverloadChanged))
 	{
-		m_theRealPolicy->domainAC2msPercentageOverloadChanged(participantIndex);
+		m_executor->submit([=]() { m_theRealPolicy->domainAC2msPercentageOverloadChanged(participantIndex); });
 	}
 }
 
@@ -1161,7 +1212,7 @@ void Policy::executeDomainAC10msPercentageOverloadChanged(UIntN participantIndex
 {
 	if (isEventRegistered(PolicyEvent::DomainAC10msPercentageOverloadChanged))
 	{
-		m_theRealPolicy->domainAC10msPercentageOverloadChanged(participantIndex);
+		m_executor->submit([=]() { m_theRealPolicy->domainAC10msPercentageOverloadChanged(participantIndex); });
 	}
 }
 
@@ -1169,7 +1220,7 @@ void Policy::executePolicyPlatformUserPresenceChanged(SensorUserPresence::Type u
 {
 	if (isEventRegistered(PolicyEvent::PolicyPlatformUserPresenceChanged))
 	{
-		m_theRealPolicy->platformUserPresenceChanged(userPresence);
+		m_executor->submit([=]() { m_theRealPolicy->platformUserPresenceChanged(userPresence); });
 	}
 }
 
@@ -1177,7 +1228,7 @@ void Policy::executePolicyExternalMonitorStateChanged(Bool externalMonitorState)
 {
 	if (isEventRegistered(PolicyEvent::PolicyExternalMonitorStateChanged))
 	{
-		m_theRealPolicy->externalMonitorStateChanged(externalMonitorState);
+		m_executor->submit([=]() { m_theRealPolicy->externalMonitorStateChanged(externalMonitorState); });
 	}
 }
 
@@ -1200,7 +1251,7 @@ void Policy::executePolicyOperatingSystemGameModeChanged(OnOffToggle::Type osGam
 {
 	if (isEventRegistered(PolicyEvent::PolicyOperatingSystemGameModeChanged))
 	{
-		m_theRealPolicy->operatingSystemGameModeChanged(osGameMode);
+		m_executor->submit([=]() { m_theRealPolicy->operatingSystemGameModeChanged(osGameMode); });
 	}
 }
 
@@ -1208,7 +1259,7 @@ void Policy::executePolicyUserInteractionChanged(UserInteraction::Type userInter
 {
 	if (isEventRegistered(PolicyEvent::PolicyUserInteractionChanged))
 	{
-		m_theRealPolicy->userInteractionChanged(userInteraction);
+		m_executor->submit([=]() { m_theRealPolicy->userInteractionChanged(userInteraction); });
 	}
 }
 
@@ -1216,7 +1267,7 @@ void Policy::executePolicyForegroundRatioChanged(UIntN ratio)
 {
 	if (isEventRegistered(PolicyEvent::PolicyForegroundRatioChanged))
 	{
-		m_theRealPolicy->foregroundRatioChanged(ratio);
+		m_executor->submit([=]() { m_theRealPolicy->foregroundRatioChanged(ratio); });
 	}
 }
 
@@ -1224,7 +1275,7 @@ void Policy::executePolicyCollaborationChanged(OnOffToggle::Type collaboration)
 {
 	if (isEventRegistered(PolicyEvent::PolicyCollaborationChanged))
 	{
-		m_theRealPolicy->collaborationModeChanged(collaboration);
+		m_executor->submit([=]() { m_theRealPolicy->collaborationModeChanged(collaboration); });
 	}
 }
 
@@ -1232,7 +1283,7 @@ void Policy::executePolicyThirdPartyGraphicsPowerStateChanged(UInt32 tpgPowerSta
 {
 	if (isEventRegistered(PolicyEvent::PolicyThirdPartyGraphicsPowerStateChanged))
 	{
-		m_theRealPolicy->thirdPartyGraphicsPowerStateChanged(tpgPowerStateOff);
+		m_executor->submit([=]() { m_theRealPolicy->thirdPartyGraphicsPowerStateChanged(tpgPowerStateOff); });
 	}
 }
 
@@ -1240,6 +1291,6 @@ void Policy::executePolicyThirdPartyGraphicsTPPLimitChanged(OsPowerSource::Type
 {
 	if (isEventRegistered(PolicyEvent::PolicyThirdPartyGraphicsTPPLimitChanged))
 	{
-		m_theRealPolicy->thirdPartyGraphicsTPPLimitChanged(powerSourceForTPP);
+		m_executor->submit([=]() { m_theRealPolicy->thirdPartyGraphicsTPPLimitChanged(powerSourceForTPP); });
 	}
 }
\ No newline at end of file
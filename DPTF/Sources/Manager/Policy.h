@@ -25,6 +25,7 @@
 #include "esif_sdk_logging_data.h"
 
 class DptfManager;
+class PolicyExecutor;
 
 class dptf_export IPolicy
 {
@@ -132,7 +133,12 @@ public:
 	virtual void executePolicyActiveRelationshipTableChanged(void) = 0;
 	virtual void executePolicyCoolingModePolicyChanged(CoolingMode::Type coolingMode) = 0;
 	virtual void executePolicyForegroundApplicationChanged(const std::string& foregroundApplicationName) = 0;
-	virtual void executePolicyInitiatedCallback(UInt64 policyDefinedEventCode, UInt64 param1, void* param2) = 0;
+	virtual void executePolicyInitiatedCallback(
+		UInt64 callbackHandle,
+		UInt64 policyDefinedEventCode,
+		UInt64 param1,
+		void* param2) = 0;
+	virtual UIntN cancelPolicyInitiatedCallback(UInt64 callbackHandle) = 0;
 	virtual void executePolicyPassiveTableChanged(void) = 0;
 	virtual void executePolicySensorOrientationChanged(SensorOrientation::Type sensorOrientation) = 0;
 	virtual void executePolicySensorMotionChanged(OnOffToggle::Type sensorMotion) = 0;
@@ -300,7 +306,12 @@ public:
 	void executePolicyActiveRelationshipTableChanged(void) override;
 	void executePolicyCoolingModePolicyChanged(CoolingMode::Type coolingMode) override;
 	void executePolicyForegroundApplicationChanged(const std::string& foregroundApplicationName) override;
-	void executePolicyInitiatedCallback(UInt64 policyDefinedEventCode, UInt64 param1, void* param2) override;
+	void executePolicyInitiatedCallback(
+		UInt64 callbackHandle,
+		UInt64 policyDefinedEventCode,
+		UInt64 param1,
+		void* param2) override;
+	UIntN cancelPolicyInitiatedCallback(UInt64 callbackHandle) override;
 	void executePolicyPassiveTableChanged(void) override;
 	void executePolicySensorOrientationChanged(SensorOrientation::Type sensorOrientation) override;
 	void executePolicySensorMotionChanged(OnOffToggle::Type sensorMotion) override;
@@ -372,6 +383,10 @@ private:
 	PolicyInterface* m_theRealPolicy;
 	Bool m_theRealPolicyCreated;
 
+	// Every call into m_theRealPolicy goes through the executor.  Event handlers are queued and run in parallel with
+	// the work item thread and the other policies; the remaining calls wait until they have run.
+	std::shared_ptr<PolicyExecutor> m_executor;
+
 	// The index assigned by the policy manager
 	UIntN m_policyIndex;
 
@@ -0,0 +1,380 @@
+/******************************************************************************
+** Copyright (c) 2013-2023 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "PolicyExecutor.h"
+#include "PolicyExecutorThreadPool.h"
+#include "ManagerStateLock.h"
+#include "WorkItemStatistics.h"
+#include "ParticipantManagerInterface.h"
+#include "EsifServicesInterface.h"
+#include "EsifMutexHelper.h"
+#include "EsifTime.h"
+#include "ManagerLogger.h"
+#include "ManagerMessage.h"
+
+static const UInt64 NoTaskHandle = 0xFFFFFFFFFFFFFFFFULL;
+
+// the executor whose task is running on the current thread, if any, and the event dispatch that task is part of
+static thread_local PolicyExecutor* CurrentExecutor = nullptr;
+static thread_local std::shared_ptr<PolicyEventDispatch> CurrentEventDispatch;
+
+PolicyEventDispatch::PolicyEventDispatch(DptfManagerInterface* dptfManager, ManagerStateLock* managerStateLock)
+	: m_dptfManager(dptfManager)
+	, m_managerStateLock(managerStateLock)
+	, m_hasTasks(false)
+{
+}
+
+PolicyEventDispatch::~PolicyEventDispatch(void)
+{
+	if (m_hasTasks == false)
+	{
+		return;
+	}
+
+	try
+	{
+		ManagerStateLockHolder managerStateLock(m_managerStateLock);
+		m_dptfManager->getParticipantManager()->clearAllParticipantCachedData();
+	}
+	catch (...)
+	{
+	}
+}
+
+void PolicyEventDispatch::addTask(void)
+{
+	m_hasTasks = true;
+}
+
+PolicyExecutor::PolicyExecutor(
+	DptfManagerInterface* dptfManager,
+	UIntN policyIndex,
+	PolicyExecutorThreadPool* threadPool,
+	ManagerStateLock* managerStateLock,
+	WorkItemStatistics* workItemStatistics)
+	: m_dptfManager(dptfManager)
+	, m_policyIndex(policyIndex)
+	, m_threadPool(threadPool)
+	, m_managerStateLock(managerStateLock)
+	, m_workItemStatistics(workItemStatistics)
+	, m_state(State::Idle)
+	, m_runningThreadId(esif_ccb_thread_id_current())
+	, m_isShutDown(false)
+{
+}
+
+PolicyExecutor::~PolicyExecutor(void)
+{
+}
+
+void PolicyExecutor::submit(const std::function<void(void)>& task)
+{
+	submit(task, NoTaskHandle);
+}
+
+void PolicyExecutor::submit(const std::function<void(void)>& task, UInt64 taskHandle)
+{
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+
+	if (m_isShutDown == true)
+	{
+		return;
+	}
+
+	m_tasks.push_back({task, taskHandle, EsifTime().getTimeStamp(), nullptr, nullptr, CurrentEventDispatch});
+	if (CurrentEventDispatch != nullptr)
+	{
+		CurrentEventDispatch->addTask();
+	}
+	const Bool needsScheduling = (m_state == State::Idle);
+	if (needsScheduling == true)
+	{
+		m_state = State::Scheduled;
+	}
+
+	esifMutexHelper.unlock();
+
+	if (needsScheduling == true)
+	{
+		m_threadPool->schedule(shared_from_this());
+	}
+}
+
+void PolicyExecutor::submitAndWait(const std::function<void(void)>& task)
+{
+	if (isRunningOnCurrentThread() == true)
+	{
+		// The policy called back into the manager and the manager is calling the policy again.  Queueing the call
+		// would deadlock, so it is treated like a function call, which is what it was before policies had their
+		// own executors.
+		task();
+		return;
+	}
+
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+	if (m_isShutDown == true)
+	{
+		throw dptf_exception("Policy executor has been shut down.");
+	}
+	esifMutexHelper.unlock();
+
+	waitFor(task);
+}
+
+UIntN PolicyExecutor::cancel(UInt64 taskHandle)
+{
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+
+	// the removed tasks are destroyed once the mutex is released, as releasing their event dispatch may clear the
+	// participant caches, which takes the manager state lock
+	std::deque<Task> removedTasks;
+	auto task = m_tasks.begin();
+	while (task != m_tasks.end())
+	{
+		if ((task->handle == taskHandle) && (task->completionSemaphore == nullptr))
+		{
+			removedTasks.push_back(*task);
+			task = m_tasks.erase(task);
+		}
+		else
+		{
+			task++;
+		}
+	}
+
+	esifMutexHelper.unlock();
+
+	return (UIntN)removedTasks.size();
+}
+
+void PolicyExecutor::shutDown(void)
+{
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+	m_isShutDown = true;
+	esifMutexHelper.unlock();
+
+	if (isRunningOnCurrentThread() == false)
+	{
+		waitFor([]() {});
+	}
+}
+
+void PolicyExecutor::runIfScheduled(void)
+{
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+
+	// A thread waiting in submitAndWait() may have taken the executor over since it was scheduled.
+	if (m_state != State::Scheduled)
+	{
+		return;
+	}
+	m_state = State::Running;
+	m_runningThreadId = esif_ccb_thread_id_current();
+
+	esifMutexHelper.unlock();
+
+	runTasks(nullptr);
+}
+
+void PolicyExecutor::setEventDispatch(std::shared_ptr<PolicyEventDispatch> eventDispatch)
+{
+	CurrentEventDispatch = eventDispatch;
+}
+
+void PolicyExecutor::waitFor(const std::function<void(void)>& task)
+{
+	EsifSemaphore completionSemaphore;
+	std::exception_ptr exception;
+
+	PolicyExecutor* waitingExecutor = CurrentExecutor;
+	if ((waitingExecutor != nullptr) && (m_threadPool->beginWait(waitingExecutor, this) == false))
+	{
+		// This policy is waiting, directly or through other policies, for the policy making the call, so waiting
+		// for it would deadlock.  Running the call here would run this policy on a second thread while its executor
+		// is busy, so the call fails instead and the calling policy unwinds.
+		throw dptf_exception(
+			"Policy " + std::to_string(m_policyIndex) + " is waiting for policy "
+			+ std::to_string(waitingExecutor->m_policyIndex) + ", so it cannot be called from that policy.");
+	}
+
+	// The policy may need the manager state lock to get to this task.
+	UIntN heldLockCount = m_managerStateLock->releaseAll();
+
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+
+	m_tasks.push_back(
+		{task, NoTaskHandle, EsifTime().getTimeStamp(), &completionSemaphore, &exception, CurrentEventDispatch});
+	if (CurrentEventDispatch != nullptr)
+	{
+		CurrentEventDispatch->addTask();
+	}
+	const Bool runOnCurrentThread = (m_state != State::Running);
+	if (runOnCurrentThread == true)
+	{
+		m_state = State::Running;
+		m_runningThreadId = esif_ccb_thread_id_current();
+	}
+
+	esifMutexHelper.unlock();
+
+	if (runOnCurrentThread == true)
+	{
+		runTasks(&completionSemaphore);
+	}
+	completionSemaphore.wait();
+
+	if (waitingExecutor != nullptr)
+	{
+		m_threadPool->endWait(waitingExecutor);
+	}
+	m_managerStateLock->reacquire(heldLockCount);
+
+	if (exception != nullptr)
+	{
+		std::rethrow_exception(exception);
+	}
+}
+
+Bool PolicyExecutor::isRunningOnCurrentThread(void)
+{
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+
+	Bool isRunningOnCurrentThread =
+		(m_state == State::Running) && (m_runningThreadId == esif_ccb_thread_id_current());
+
+	esifMutexHelper.unlock();
+
+	return isRunningOnCurrentThread;
+}
+
+void PolicyExecutor::runTasks(EsifSemaphore* lastCompletionSemaphore)
+{
+	// Pool threads run the executor until its queue is empty.  A thread that took the executor over in
+	// submitAndWait() stops after its own task and hands whatever is left back to the pool.
+
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	while (true)
+	{
+		esifMutexHelper.lock();
+		if (m_tasks.empty())
+		{
+			m_state = State::Idle;
+			esifMutexHelper.unlock();
+			return;
+		}
+		Task task = m_tasks.front();
+		m_tasks.pop_front();
+		esifMutexHelper.unlock();
+
+		runTask(task);
+
+		if ((lastCompletionSemaphore != nullptr) && (task.completionSemaphore == lastCompletionSemaphore))
+		{
+			esifMutexHelper.lock();
+			const Bool needsScheduling = (m_tasks.empty() == false);
+			m_state = needsScheduling ? State::Scheduled : State::Idle;
+			esifMutexHelper.unlock();
+
+			if (needsScheduling == true)
+			{
+				m_threadPool->schedule(shared_from_this());
+			}
+			return;
+		}
+	}
+}
+
+void PolicyExecutor::runTask(Task& task)
+{
+	const TimeSpan startTime = EsifTime().getTimeStamp();
+
+	// a thread that took the executor over in submitAndWait() may already be running a task of another executor
+	PolicyExecutor* previousExecutor = CurrentExecutor;
+	std::shared_ptr<PolicyEventDispatch> previousEventDispatch = CurrentEventDispatch;
+	CurrentExecutor = this;
+	CurrentEventDispatch = task.eventDispatch;
+
+	try
+	{
+		task.function();
+	}
+	catch (...)
+	{
+		if (task.exception != nullptr)
+		{
+			*task.exception = std::current_exception();
+		}
+		else
+		{
+			logTaskFailure(std::current_exception());
+		}
+	}
+
+	CurrentExecutor = previousExecutor;
+	CurrentEventDispatch = previousEventDispatch;
+
+	const TimeSpan endTime = EsifTime().getTimeStamp();
+
+	try
+	{
+		m_workItemStatistics->incrementPolicyTotals(m_policyIndex, startTime - task.submitTime, endTime - startTime);
+	}
+	catch (...)
+	{
+	}
+
+	if (task.completionSemaphore != nullptr)
+	{
+		task.completionSemaphore->signal();
+	}
+}
+
+void PolicyExecutor::logTaskFailure(std::exception_ptr exception)
+{
+	try
+	{
+		std::rethrow_exception(exception);
+	}
+	catch (std::exception& ex)
+	{
+		ManagerStateLockHolder managerStateLock(m_managerStateLock);
+		MANAGER_LOG_MESSAGE_WARNING_EX({
+			ManagerMessage message = ManagerMessage(
+				m_dptfManager, _file, _line, _function, "Unhandled exception caught during execution of policy task");
+			message.setExceptionCaught("PolicyExecutor::runTask", ex.what());
+			message.setPolicyIndex(m_policyIndex);
+			return message;
+		});
+	}
+	catch (...)
+	{
+	}
+}
+
+EsifServicesInterface* PolicyExecutor::getEsifServices(void) const
+{
+	return m_dptfManager->getEsifServices();
+}
@@ -0,0 +1,144 @@
+/******************************************************************************
+** Copyright (c) 2013-2023 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include "DptfManagerInterface.h"
+#include "EsifMutex.h"
+#include "EsifSemaphore.h"
+#include "esif_ccb_thread.h"
+#include <atomic>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+
+class PolicyExecutorThreadPool;
+class ManagerStateLock;
+class WorkItemStatistics;
+class EsifServicesInterface;
+
+//
+// Runs the calls into a single policy one at a time and in the order they were submitted, on the threads of the
+// shared PolicyExecutorThreadPool.  Executors for different policies run in parallel.
+//
+// - submit() queues an event handler and returns.  The work item thread uses this to fan an event out to the
+//   policies once it has updated the manager state for the event.
+// - submitAndWait() queues a call behind everything already queued for the policy and returns once it has run,
+//   rethrowing anything it threw.  If the executor is not running on another thread the caller runs the queue
+//   itself, so a waiting thread never depends on a free pool thread.  A call made while running one of this
+//   executor's own tasks runs directly.
+// - A call that would wait for a policy which is itself waiting, directly or through other policies, for the
+//   calling policy throws instead of waiting, so the calling policy unwinds and no policy ever runs on two threads.
+// - The queue and execution time of each task are added to the work item statistics.
+//
+
+//
+// Clears the participant caches once every policy task an event was fanned out to has run.  The work item thread
+// sets one up for each work item with PolicyExecutor::setEventDispatch(); the tasks submitted while the work item
+// executes, and any submitted from those tasks, share it.  The work item thread still clears the caches after the
+// work item itself, so they are cleared at most twice per event rather than after every policy task.
+//
+
+class PolicyEventDispatch final
+{
+public:
+	PolicyEventDispatch(DptfManagerInterface* dptfManager, ManagerStateLock* managerStateLock);
+	~PolicyEventDispatch(void);
+
+	void addTask(void);
+
+private:
+	// hide the copy constructor and assignment operator.
+	PolicyEventDispatch(const PolicyEventDispatch& rhs);
+	PolicyEventDispatch& operator=(const PolicyEventDispatch& rhs);
+
+	DptfManagerInterface* m_dptfManager;
+	ManagerStateLock* m_managerStateLock;
+	std::atomic<Bool> m_hasTasks;
+};
+
+class PolicyExecutor : public std::enable_shared_from_this<PolicyExecutor>
+{
+public:
+	PolicyExecutor(
+		DptfManagerInterface* dptfManager,
+		UIntN policyIndex,
+		PolicyExecutorThreadPool* threadPool,
+		ManagerStateLock* managerStateLock,
+		WorkItemStatistics* workItemStatistics);
+	~PolicyExecutor(void);
+
+	void submit(const std::function<void(void)>& task);
+	void submit(const std::function<void(void)>& task, UInt64 taskHandle);
+	void submitAndWait(const std::function<void(void)>& task);
+
+	// removes queued tasks that were submitted with the given handle and returns how many were removed
+	UIntN cancel(UInt64 taskHandle);
+
+	// runs everything still queued and drops any task submitted afterwards
+	void shutDown(void);
+
+	// called by the thread pool for each time the executor was scheduled
+	void runIfScheduled(void);
+
+	// tasks submitted from the current thread are part of the given event dispatch until it is set to null
+	static void setEventDispatch(std::shared_ptr<PolicyEventDispatch> eventDispatch);
+
+private:
+	// hide the copy constructor and assignment operator.
+	PolicyExecutor(const PolicyExecutor& rhs);
+	PolicyExecutor& operator=(const PolicyExecutor& rhs);
+
+	enum class State
+	{
+		Idle,
+		Scheduled,
+		Running
+	};
+
+	struct Task
+	{
+		std::function<void(void)> function;
+		UInt64 handle;
+		TimeSpan submitTime;
+		EsifSemaphore* completionSemaphore;
+		std::exception_ptr* exception;
+		std::shared_ptr<PolicyEventDispatch> eventDispatch;
+	};
+
+	DptfManagerInterface* m_dptfManager;
+	UIntN m_policyIndex;
+	PolicyExecutorThreadPool* m_threadPool;
+	ManagerStateLock* m_managerStateLock;
+	WorkItemStatistics* m_workItemStatistics;
+
+	EsifMutex m_mutex;
+	std::deque<Task> m_tasks;
+	State m_state;
+	esif_thread_id_t m_runningThreadId;
+	Bool m_isShutDown;
+
+	void waitFor(const std::function<void(void)>& task);
+	Bool isRunningOnCurrentThread(void);
+	void runTasks(EsifSemaphore* lastCompletionSemaphore);
+	void runTask(Task& task);
+	void logTaskFailure(std::exception_ptr exception);
+	EsifServicesInterface* getEsifServices(void) const;
+};
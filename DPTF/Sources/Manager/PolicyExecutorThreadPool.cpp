@@ -0,0 +1,157 @@
+/******************************************************************************
+** Copyright (c) 2013-2023 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "PolicyExecutorThreadPool.h"
+#include "PolicyExecutor.h"
+#include "EsifMutexHelper.h"
+
+// set on each pool thread so isPoolThread() does not need to take the pool mutex
+static thread_local const PolicyExecutorThreadPool* CurrentThreadPool = nullptr;
+
+PolicyExecutorThreadPool::PolicyExecutorThreadPool(UIntN threadCount)
+	: m_destroyThreads(false)
+{
+	try
+	{
+		for (UIntN i = 0; i < threadCount; i++)
+		{
+			m_threads.push_back(new EsifThread(PolicyExecutorThreadStart, this));
+		}
+	}
+	catch (...)
+	{
+		destroyThreads();
+		throw;
+	}
+}
+
+PolicyExecutorThreadPool::~PolicyExecutorThreadPool(void)
+{
+	destroyThreads();
+}
+
+void PolicyExecutorThreadPool::schedule(std::shared_ptr<PolicyExecutor> executor)
+{
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+
+	// Executors are shut down before the pool is destroyed, so anything scheduled afterwards has nowhere to run.
+	if (m_destroyThreads == true)
+	{
+		return;
+	}
+	m_runQueue.push_back(executor);
+
+	esifMutexHelper.unlock();
+
+	m_runQueueSemaphore.signal();
+}
+
+Bool PolicyExecutorThreadPool::isPoolThread(void) const
+{
+	return (CurrentThreadPool == this);
+}
+
+Bool PolicyExecutorThreadPool::beginWait(PolicyExecutor* waitingExecutor, PolicyExecutor* executor)
+{
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+
+	auto waitedFor = executor;
+	while (waitedFor != nullptr)
+	{
+		if (waitedFor == waitingExecutor)
+		{
+			esifMutexHelper.unlock();
+			return false;
+		}
+		auto wait = m_waits.find(waitedFor);
+		waitedFor = (wait != m_waits.end()) ? wait->second : nullptr;
+	}
+	m_waits[waitingExecutor] = executor;
+
+	esifMutexHelper.unlock();
+
+	return true;
+}
+
+void PolicyExecutorThreadPool::endWait(PolicyExecutor* waitingExecutor)
+{
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+	m_waits.erase(waitingExecutor);
+	esifMutexHelper.unlock();
+}
+
+void PolicyExecutorThreadPool::executeThread(void)
+{
+	CurrentThreadPool = this;
+
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	while (true)
+	{
+		m_runQueueSemaphore.wait();
+
+		esifMutexHelper.lock();
+		if (m_destroyThreads == true)
+		{
+			esifMutexHelper.unlock();
+			break;
+		}
+		std::shared_ptr<PolicyExecutor> executor;
+		if (m_runQueue.empty() == false)
+		{
+			executor = m_runQueue.front();
+			m_runQueue.pop_front();
+		}
+		esifMutexHelper.unlock();
+
+		if (executor != nullptr)
+		{
+			executor->runIfScheduled();
+		}
+	}
+}
+
+void PolicyExecutorThreadPool::destroyThreads(void)
+{
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+	m_destroyThreads = true;
+	m_runQueue.clear();
+	esifMutexHelper.unlock();
+
+	for (UIntN i = 0; i < m_threads.size(); i++)
+	{
+		m_runQueueSemaphore.signal();
+	}
+
+	// deleting the thread waits for it to exit
+	for (auto thread = m_threads.begin(); thread != m_threads.end(); thread++)
+	{
+		DELETE_MEMORY_TC(*thread);
+	}
+	m_threads.clear();
+}
+
+void* PolicyExecutorThreadStart(void* contextPtr)
+{
+	PolicyExecutorThreadPool* threadPool = static_cast<PolicyExecutorThreadPool*>(contextPtr);
+	threadPool->executeThread();
+	return nullptr;
+}
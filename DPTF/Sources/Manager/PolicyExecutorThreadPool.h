@@ -0,0 +1,69 @@
+/******************************************************************************
+** Copyright (c) 2013-2023 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include "EsifMutex.h"
+#include "EsifSemaphore.h"
+#include "EsifThread.h"
+#include <deque>
+#include <map>
+#include <memory>
+#include <vector>
+
+class PolicyExecutor;
+
+//
+// A fixed set of threads shared by all policy executors.  An executor with queued tasks is placed on the run queue
+// and the first free thread runs it until its queue is empty, so each policy runs on at most one thread at a time
+// while different policies run in parallel.
+//
+
+class PolicyExecutorThreadPool
+{
+public:
+	PolicyExecutorThreadPool(UIntN threadCount);
+	~PolicyExecutorThreadPool(void);
+
+	void schedule(std::shared_ptr<PolicyExecutor> executor);
+	Bool isPoolThread(void) const;
+
+	// records that a task of the waiting executor waits for the other executor; returns false, without recording
+	// it, if the other executor is already waiting for the waiting executor, directly or through other executors
+	Bool beginWait(PolicyExecutor* waitingExecutor, PolicyExecutor* executor);
+	void endWait(PolicyExecutor* waitingExecutor);
+
+private:
+	// hide the copy constructor and assignment operator.
+	PolicyExecutorThreadPool(const PolicyExecutorThreadPool& rhs);
+	PolicyExecutorThreadPool& operator=(const PolicyExecutorThreadPool& rhs);
+
+	EsifMutex m_mutex;
+	EsifSemaphore m_runQueueSemaphore;
+	std::deque<std::shared_ptr<PolicyExecutor>> m_runQueue;
+	std::map<PolicyExecutor*, PolicyExecutor*> m_waits;
+	Bool m_destroyThreads;
+	std::vector<EsifThread*> m_threads;
+
+	friend void* PolicyExecutorThreadStart(void* contextPtr);
+	void executeThread(void);
+	void destroyThreads(void);
+};
+
+void* PolicyExecutorThreadStart(void* contextPtr);
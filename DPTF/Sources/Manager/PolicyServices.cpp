@@ -31,6 +31,7 @@ PolicyServices::PolicyServices(DptfManagerInterface* dptfManager, UIntN policyIn
 	m_participantManager = m_dptfManager->getParticipantManager();
 	m_workItemQueueManager = m_dptfManager->getWorkItemQueueManager();
 	m_esifServices = m_dptfManager->getEsifServices();
+	m_managerStateLock = m_workItemQueueManager->getManagerStateLock();
 }
 
 DptfManagerInterface* PolicyServices::getDptfManager(void) const
@@ -68,6 +69,11 @@ EsifServicesInterface* PolicyServices::getEsifServices(void) const
 	return m_esifServices;
 }
 
+ManagerStateLock* PolicyServices::getManagerStateLock(void) const
+{
+	return m_managerStateLock;
+}
+
 void PolicyServices::throwIfNotWorkItemThread(void) const
 {
 	if (m_workItemQueueManager->isWorkItemThread() == false)
@@ -75,3 +81,9 @@ void PolicyServices::throwIfNotWorkItemThread(void) const
 		throw dptf_exception("Policy Services functionality called from an unknown thread.");
 	}
 }
+
+ManagerStateLockHolder PolicyServices::lockManagerState(void) const
+{
+	throwIfNotWorkItemThread();
+	return ManagerStateLockHolder(m_managerStateLock);
+}
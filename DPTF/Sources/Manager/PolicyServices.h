@@ -20,6 +20,7 @@
 
 #include "Dptf.h"
 #include "DptfManagerInterface.h"
+#include "ManagerStateLock.h"
 class PolicyManagerInterface;
 class IPolicy;
 class ParticipantManagerInterface;
@@ -38,8 +39,13 @@ public:
 	ParticipantManagerInterface* getParticipantManager(void) const;
 	WorkItemQueueManagerInterface* getWorkItemQueueManager(void) const;
 	EsifServicesInterface* getEsifServices(void) const;
+	ManagerStateLock* getManagerStateLock(void) const;
 	void throwIfNotWorkItemThread(void) const;
 
+	// Policies run on their own executors, in parallel with the work item thread and with each other.  Each policy
+	// services call holds the manager state lock until it returns, except while a primitive is executed.
+	ManagerStateLockHolder lockManagerState(void) const;
+
 private:
 	DptfManagerInterface* m_dptfManager;
 	UIntN m_policyIndex;
@@ -48,4 +54,5 @@ private:
 	ParticipantManagerInterface* m_participantManager;
 	WorkItemQueueManagerInterface* m_workItemQueueManager;
 	EsifServicesInterface* m_esifServices;
+	ManagerStateLock* m_managerStateLock;
 };
@@ -28,48 +28,48 @@ PolicyServicesDomainActivityStatus::PolicyServicesDomainActivityStatus(
 
 Percentage PolicyServicesDomainActivityStatus::getUtilizationThreshold(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getUtilizationThreshold(domainIndex);
 }
 
 Percentage PolicyServicesDomainActivityStatus::getResidencyUtilization(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getResidencyUtilization(domainIndex);
 }
 
 UInt64 PolicyServicesDomainActivityStatus::getCoreActivityCounter(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getCoreActivityCounter(domainIndex);
 }
 
 UInt32 PolicyServicesDomainActivityStatus::getCoreActivityCounterWidth(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getCoreActivityCounterWidth(domainIndex);
 }
 
 UInt64 PolicyServicesDomainActivityStatus::getTimestampCounter(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getTimestampCounter(domainIndex);
 }
 
 UInt32 PolicyServicesDomainActivityStatus::getTimestampCounterWidth(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getTimestampCounterWidth(domainIndex);
 }
 
 CoreActivityInfo PolicyServicesDomainActivityStatus::getCoreActivityInfo(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getCoreActivityInfo(domainIndex);
 }
 
 UInt32 PolicyServicesDomainActivityStatus::getSocDgpuPerformanceHintPoints(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getSocDgpuPerformanceHintPoints(domainIndex);
 }
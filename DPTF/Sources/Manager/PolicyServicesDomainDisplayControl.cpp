@@ -30,7 +30,7 @@ DisplayControlDynamicCaps PolicyServicesDomainDisplayControl::getDisplayControlD
 	UIntN participantIndex,
 	UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getDisplayControlDynamicCaps(domainIndex);
 }
 
@@ -38,37 +38,37 @@ DisplayControlStatus PolicyServicesDomainDisplayControl::getDisplayControlStatus
 	UIntN participantIndex,
 	UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getDisplayControlStatus(domainIndex);
 }
 
 UIntN PolicyServicesDomainDisplayControl::getUserPreferredDisplayIndex(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getUserPreferredDisplayIndex(domainIndex);
 }
 
 UIntN PolicyServicesDomainDisplayControl::getUserPreferredSoftBrightnessIndex(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getUserPreferredSoftBrightnessIndex(domainIndex);
 }
 
 Bool PolicyServicesDomainDisplayControl::isUserPreferredIndexModified(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->isUserPreferredIndexModified(domainIndex);
 }
 
 UIntN PolicyServicesDomainDisplayControl::getSoftBrightnessIndex(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getSoftBrightnessIndex(domainIndex);
 }
 
 DisplayControlSet PolicyServicesDomainDisplayControl::getDisplayControlSet(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getDisplayControlSet(domainIndex);
 }
 
@@ -77,7 +77,7 @@ void PolicyServicesDomainDisplayControl::setDisplayControl(
 	UIntN domainIndex,
 	UIntN displayControlIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->setDisplayControl(domainIndex, getPolicyIndex(), displayControlIndex);
@@ -88,7 +88,7 @@ void PolicyServicesDomainDisplayControl::setSoftBrightness(
 	UIntN domainIndex,
 	UIntN displayControlIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->setSoftBrightness(domainIndex, getPolicyIndex(), displayControlIndex);
@@ -98,7 +98,7 @@ void PolicyServicesDomainDisplayControl::updateUserPreferredSoftBrightnessIndex(
 	UIntN participantIndex,
 	UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->updateUserPreferredSoftBrightnessIndex(domainIndex);
@@ -108,7 +108,7 @@ void PolicyServicesDomainDisplayControl::restoreUserPreferredSoftBrightness(
 	UIntN participantIndex,
 	UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getParticipantManager()->getParticipantPtr(participantIndex)->restoreUserPreferredSoftBrightness(domainIndex);
 }
 
@@ -117,7 +117,7 @@ void PolicyServicesDomainDisplayControl::setDisplayControlDynamicCaps(
 	UIntN domainIndex,
 	DisplayControlDynamicCaps newCapabilities)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->setDisplayControlDynamicCaps(domainIndex, getPolicyIndex(), newCapabilities);
@@ -125,7 +125,7 @@ void PolicyServicesDomainDisplayControl::setDisplayControlDynamicCaps(
 
 void PolicyServicesDomainDisplayControl::setDisplayCapsLock(UIntN participantIndex, UIntN domainIndex, Bool lock)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->setDisplayCapsLock(domainIndex, getPolicyIndex(), lock);
@@ -26,37 +26,37 @@ PolicyServicesDomainEnergyControl::PolicyServicesDomainEnergyControl(DptfManager
 
 UInt32 PolicyServicesDomainEnergyControl::getRaplEnergyCounter(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getRaplEnergyCounter(domainIndex);
 }
 
 EnergyCounterInfo PolicyServicesDomainEnergyControl::getRaplEnergyCounterInfo(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getRaplEnergyCounterInfo(domainIndex);
 }
 
 double PolicyServicesDomainEnergyControl::getRaplEnergyUnit(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getRaplEnergyUnit(domainIndex);
 }
 
 UInt32 PolicyServicesDomainEnergyControl::getRaplEnergyCounterWidth(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getRaplEnergyCounterWidth(domainIndex);
 }
 
 Power PolicyServicesDomainEnergyControl::getInstantaneousPower(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getInstantaneousPower(domainIndex);
 }
 
 UInt32 PolicyServicesDomainEnergyControl::getEnergyThreshold(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getEnergyThreshold(domainIndex);
 }
 
@@ -65,7 +65,7 @@ void PolicyServicesDomainEnergyControl::setEnergyThreshold(
 	UIntN domainIndex,
 	UInt32 energyThreshold)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getParticipantManager()->getParticipantPtr(participantIndex)->setEnergyThreshold(domainIndex, energyThreshold);
 }
 
@@ -73,7 +73,7 @@ void PolicyServicesDomainEnergyControl::setEnergyThresholdInterruptDisable(
 	UIntN participantIndex,
 	UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->setEnergyThresholdInterruptDisable(domainIndex);
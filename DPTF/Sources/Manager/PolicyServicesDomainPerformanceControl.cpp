@@ -30,7 +30,7 @@ PerformanceControlStaticCaps PolicyServicesDomainPerformanceControl::getPerforma
 	UIntN participantIndex,
 	UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getPerformanceControlStaticCaps(domainIndex);
 }
 
@@ -38,7 +38,7 @@ PerformanceControlDynamicCaps PolicyServicesDomainPerformanceControl::getPerform
 	UIntN participantIndex,
 	UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getPerformanceControlDynamicCaps(domainIndex);
 }
 
@@ -46,7 +46,7 @@ PerformanceControlStatus PolicyServicesDomainPerformanceControl::getPerformanceC
 	UIntN participantIndex,
 	UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getPerformanceControlStatus(domainIndex);
 }
 
@@ -54,7 +54,7 @@ PerformanceControlSet PolicyServicesDomainPerformanceControl::getPerformanceCont
 	UIntN participantIndex,
 	UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getPerformanceControlSet(domainIndex);
 }
 
@@ -63,7 +63,7 @@ void PolicyServicesDomainPerformanceControl::setPerformanceControl(
 	UIntN domainIndex,
 	UIntN performanceControlIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->setPerformanceControl(domainIndex, getPolicyIndex(), performanceControlIndex);
@@ -74,7 +74,7 @@ void PolicyServicesDomainPerformanceControl::setPerformanceControlDynamicCaps(
 	UIntN domainIndex,
 	PerformanceControlDynamicCaps newCapabilities)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->setPerformanceControlDynamicCaps(domainIndex, getPolicyIndex(), newCapabilities);
@@ -85,7 +85,7 @@ void PolicyServicesDomainPerformanceControl::setPerformanceCapsLock(
 	UIntN domainIndex,
 	Bool lock)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->setPerformanceCapsLock(domainIndex, getPolicyIndex(), lock);
@@ -28,7 +28,7 @@ PowerControlDynamicCapsSet PolicyServicesDomainPowerControl::getPowerControlDyna
 	UIntN participantIndex,
 	UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getPowerControlDynamicCapsSet(domainIndex);
 }
 
@@ -37,7 +37,7 @@ void PolicyServicesDomainPowerControl::setPowerControlDynamicCapsSet(
 	UIntN domainIndex,
 	PowerControlDynamicCapsSet capsSet)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->setPowerControlDynamicCapsSet(domainIndex, getPolicyIndex(), capsSet);
@@ -48,7 +48,7 @@ Bool PolicyServicesDomainPowerControl::isPowerLimitEnabled(
 	UIntN domainIndex,
 	PowerControlType::Type controlType)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->isPowerLimitEnabled(domainIndex, controlType);
 }
 
@@ -57,7 +57,7 @@ Power PolicyServicesDomainPowerControl::getPowerLimit(
 	UIntN domainIndex,
 	PowerControlType::Type controlType)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getPowerLimit(domainIndex, controlType);
 }
 
@@ -66,7 +66,7 @@ Power PolicyServicesDomainPowerControl::getPowerLimitWithoutCache(
 	UIntN domainIndex,
 	PowerControlType::Type controlType)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->getPowerLimitWithoutCache(domainIndex, controlType);
@@ -74,19 +74,19 @@ Power PolicyServicesDomainPowerControl::getPowerLimitWithoutCache(
 
 Bool PolicyServicesDomainPowerControl::isSocPowerFloorEnabled(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->isSocPowerFloorEnabled(domainIndex);
 }
 
 Bool PolicyServicesDomainPowerControl::isSocPowerFloorSupported(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->isSocPowerFloorSupported(domainIndex);
 }
 
 UInt32 PolicyServicesDomainPowerControl::getSocPowerFloorState(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getSocPowerFloorState(domainIndex);
 }
 
@@ -96,7 +96,7 @@ void PolicyServicesDomainPowerControl::setPowerLimitMin(
 	PowerControlType::Type controlType,
 	const Power& powerLimit)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->setPowerLimitMin(domainIndex, getPolicyIndex(), controlType, powerLimit);
@@ -108,7 +108,7 @@ void PolicyServicesDomainPowerControl::setPowerLimit(
 	PowerControlType::Type controlType,
 	const Power& powerLimit)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->setPowerLimit(domainIndex, getPolicyIndex(), controlType, powerLimit);
@@ -120,7 +120,7 @@ void PolicyServicesDomainPowerControl::setPowerLimitWithoutUpdatingEnabled(
 	PowerControlType::Type controlType,
 	const Power& powerLimit)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->setPowerLimitWithoutUpdatingEnabled(domainIndex, getPolicyIndex(), controlType, powerLimit);
@@ -132,7 +132,7 @@ void PolicyServicesDomainPowerControl::setPowerLimitIgnoringCaps(
 	PowerControlType::Type controlType,
 	const Power& powerLimit)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->setPowerLimitIgnoringCaps(domainIndex, getPolicyIndex(), controlType, powerLimit);
@@ -143,7 +143,7 @@ TimeSpan PolicyServicesDomainPowerControl::getPowerLimitTimeWindow(
 	UIntN domainIndex,
 	PowerControlType::Type controlType)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->getPowerLimitTimeWindow(domainIndex, controlType);
@@ -155,7 +155,7 @@ void PolicyServicesDomainPowerControl::setPowerLimitTimeWindow(
 	PowerControlType::Type controlType,
 	const TimeSpan& timeWindow)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->setPowerLimitTimeWindow(domainIndex, getPolicyIndex(), controlType, timeWindow);
@@ -167,7 +167,7 @@ void PolicyServicesDomainPowerControl::setPowerLimitTimeWindowWithoutUpdatingEna
 	PowerControlType::Type controlType,
 	const TimeSpan& timeWindow)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->setPowerLimitTimeWindowWithoutUpdatingEnabled(domainIndex, getPolicyIndex(), controlType, timeWindow);
@@ -179,7 +179,7 @@ void PolicyServicesDomainPowerControl::setPowerLimitTimeWindowIgnoringCaps(
 	PowerControlType::Type controlType,
 	const TimeSpan& timeWindow)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->setPowerLimitTimeWindowIgnoringCaps(domainIndex, getPolicyIndex(), controlType, timeWindow);
@@ -190,7 +190,7 @@ Percentage PolicyServicesDomainPowerControl::getPowerLimitDutyCycle(
 	UIntN domainIndex,
 	PowerControlType::Type controlType)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->getPowerLimitDutyCycle(domainIndex, controlType);
@@ -202,7 +202,7 @@ void PolicyServicesDomainPowerControl::setPowerLimitDutyCycle(
 	PowerControlType::Type controlType,
 	const Percentage& dutyCycle)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->setPowerLimitDutyCycle(domainIndex, getPolicyIndex(), controlType, dutyCycle);
@@ -213,7 +213,7 @@ void PolicyServicesDomainPowerControl::setSocPowerFloorState(
 	UIntN domainIndex,
 	Bool socPowerFloorState)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->setSocPowerFloorState(domainIndex, getPolicyIndex(), socPowerFloorState);
@@ -221,7 +221,7 @@ void PolicyServicesDomainPowerControl::setSocPowerFloorState(
 
 void PolicyServicesDomainPowerControl::clearPowerLimitMin(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->clearPowerLimitMin(domainIndex);
@@ -229,7 +229,7 @@ void PolicyServicesDomainPowerControl::clearPowerLimitMin(UIntN participantIndex
 
 void PolicyServicesDomainPowerControl::clearPowerLimit(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->clearPowerLimit(domainIndex, getPolicyIndex());
@@ -237,67 +237,67 @@ void PolicyServicesDomainPowerControl::clearPowerLimit(UIntN participantIndex, U
 
 void PolicyServicesDomainPowerControl::setPowerCapsLock(UIntN participantIndex, UIntN domainIndex, Bool lock)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getParticipantManager()->getParticipantPtr(participantIndex)->setPowerCapsLock(domainIndex, getPolicyIndex(), lock);
 }
 
 TimeSpan PolicyServicesDomainPowerControl::getPowerSharePowerLimitTimeWindow(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getPowerSharePowerLimitTimeWindow(domainIndex);
 }
 
 Bool PolicyServicesDomainPowerControl::isPowerShareControl(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->isPowerShareControl(domainIndex);
 }
 
 double PolicyServicesDomainPowerControl::getPidKpTerm(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getPidKpTerm(domainIndex);
 }
 
 double PolicyServicesDomainPowerControl::getPidKiTerm(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getPidKiTerm(domainIndex);
 }
 
 TimeSpan PolicyServicesDomainPowerControl::getAlpha(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getAlpha(domainIndex);
 }
 
 TimeSpan PolicyServicesDomainPowerControl::getFastPollTime(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getFastPollTime(domainIndex);
 }
 
 TimeSpan PolicyServicesDomainPowerControl::getSlowPollTime(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getSlowPollTime(domainIndex);
 }
 
 TimeSpan PolicyServicesDomainPowerControl::getWeightedSlowPollAvgConstant(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getWeightedSlowPollAvgConstant(domainIndex);
 }
 
 Power PolicyServicesDomainPowerControl::getSlowPollPowerThreshold(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getSlowPollPowerThreshold(domainIndex);
 }
 
 Power PolicyServicesDomainPowerControl::getThermalDesignPower(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getThermalDesignPower(domainIndex);
 }
 
@@ -306,7 +306,7 @@ void PolicyServicesDomainPowerControl::removePowerLimitPolicyRequest(
 	UIntN domainIndex,
 	PowerControlType::Type controlType)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->removePowerLimitPolicyRequest(domainIndex, getPolicyIndex(), controlType);
@@ -317,7 +317,7 @@ void PolicyServicesDomainPowerControl::setPowerSharePolicyPower(
 	UIntN domainIndex,
 	const Power& powerSharePolicyPower)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->setPowerSharePolicyPower(domainIndex, powerSharePolicyPower);
@@ -325,7 +325,7 @@ void PolicyServicesDomainPowerControl::setPowerSharePolicyPower(
 
 void PolicyServicesDomainPowerControl::setPowerShareEffectiveBias(UIntN participantIndex, UIntN domainIndex, UInt32 powerShareEffectiveBias)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->setPowerShareEffectiveBias(domainIndex, powerShareEffectiveBias);
@@ -26,7 +26,7 @@ PolicyServicesDomainPowerStatus::PolicyServicesDomainPowerStatus(DptfManagerInte
 
 PowerStatus PolicyServicesDomainPowerStatus::getPowerStatus(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getPowerStatus(domainIndex);
 }
 
@@ -35,13 +35,13 @@ Power PolicyServicesDomainPowerStatus::getAveragePower(
 	UIntN domainIndex,
 	const PowerControlDynamicCaps& capabilities)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getAveragePower(domainIndex, capabilities);
 }
 
 Power PolicyServicesDomainPowerStatus::getPowerValue(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getPowerValue(domainIndex);
 }
 
@@ -50,6 +50,6 @@ void PolicyServicesDomainPowerStatus::setCalculatedAveragePower(
 	UIntN domainIndex,
 	Power powerValue)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getParticipantManager()->getParticipantPtr(participantIndex)->setCalculatedAveragePower(domainIndex, powerValue);
 }
\ No newline at end of file
@@ -26,6 +26,6 @@ PolicyServicesDomainPriority::PolicyServicesDomainPriority(DptfManagerInterface*
 
 DomainPriority PolicyServicesDomainPriority::getDomainPriority(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getDomainPriority(domainIndex);
 }
@@ -28,37 +28,37 @@ PolicyServicesDomainRfProfileStatus::PolicyServicesDomainRfProfileStatus(
 
 RfProfileDataSet PolicyServicesDomainRfProfileStatus::getRfProfileDataSet(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getRfProfileDataSet(domainIndex);
 }
 
 UInt32 PolicyServicesDomainRfProfileStatus::getWifiCapabilities(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getWifiCapabilities(domainIndex);
 }
 
 UInt32 PolicyServicesDomainRfProfileStatus::getRfiDisable(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getRfiDisable(domainIndex);
 }
 
 UInt64 PolicyServicesDomainRfProfileStatus::getDvfsPoints(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getDvfsPoints(domainIndex);
 }
 
 UInt32 PolicyServicesDomainRfProfileStatus::getDlvrSsc(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getDlvrSsc(domainIndex);
 }
 
 Frequency PolicyServicesDomainRfProfileStatus::getDlvrCenterFrequency(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getDlvrCenterFrequency(domainIndex);
 }
 
@@ -67,7 +67,7 @@ void PolicyServicesDomainRfProfileStatus::setDdrRfiTable(
 	UIntN domainIndex,
 	const DdrfChannelBandPackage::WifiRfiDdr& ddrRfiStruct)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getParticipantManager()->getParticipantPtr(participantIndex)->setDdrRfiTable(domainIndex, ddrRfiStruct);
 }
 
@@ -76,7 +76,7 @@ void PolicyServicesDomainRfProfileStatus::sendMasterControlStatus(
 	UIntN domainIndex,
 	UInt32 masterControlStatus)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->sendMasterControlStatus(domainIndex, masterControlStatus);
@@ -87,7 +87,7 @@ void PolicyServicesDomainRfProfileStatus::setProtectRequest(
 	UIntN domainIndex,
 	UInt64 frequencyRate)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getParticipantManager()->getParticipantPtr(participantIndex)->setProtectRequest(domainIndex, frequencyRate);
 }
 
@@ -96,7 +96,7 @@ void PolicyServicesDomainRfProfileStatus::setDlvrCenterFrequency(
 	UIntN domainIndex,
 	Frequency frequency)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getParticipantManager()->getParticipantPtr(participantIndex)->setDlvrCenterFrequency(domainIndex, frequency);
 }
 
@@ -105,7 +105,7 @@ void PolicyServicesDomainRfProfileStatus::setRfProfileOverride(
 	UIntN domainIndex,
 	const DptfBuffer& rfProfileBufferData)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->setRfProfileOverride(domainIndex, domainIndex, rfProfileBufferData);
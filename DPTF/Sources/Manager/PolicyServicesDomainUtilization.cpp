@@ -26,12 +26,12 @@ PolicyServicesDomainUtilization::PolicyServicesDomainUtilization(DptfManagerInte
 
 UtilizationStatus PolicyServicesDomainUtilization::getUtilizationStatus(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getUtilizationStatus(domainIndex);
 }
 
 Percentage PolicyServicesDomainUtilization::getMaxCoreUtilization(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getMaxCoreUtilization(domainIndex);
 }
@@ -19,6 +19,7 @@
 #include "PolicyServicesDptfServiceRequest.h"
 #include "PolicyRequest.h"
 #include "ParticipantManagerInterface.h"
+#include "EsifServicesInterface.h"
 
 PolicyServicesDptfServiceRequest::PolicyServicesDptfServiceRequest(DptfManagerInterface* dptfManager, UIntN policyIndex)
 	: PolicyServices(dptfManager, policyIndex)
@@ -28,7 +29,60 @@ PolicyServicesDptfServiceRequest::PolicyServicesDptfServiceRequest(DptfManagerIn
 
 DptfRequestResult PolicyServicesDptfServiceRequest::submitRequest(DptfRequest request)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	PolicyRequest policyRequest(getPolicyIndex(), request);
 	return m_requestDispatcher->dispatch(policyRequest);
 }
+
+std::vector<DptfRequestResult> PolicyServicesDptfServiceRequest::submitRequests(const std::vector<DptfRequest>& requests)
+{
+	auto managerStateLock = lockManagerState();
+
+	// execute the primitives the handlers will need together before the requests are processed
+	std::vector<EsifPrimitiveRequest> primitives;
+	for (const auto& request : requests)
+	{
+		PolicyRequest policyRequest(getPolicyIndex(), request);
+		auto requestPrimitives = m_requestDispatcher->getPrimitivesForRequest(policyRequest);
+		primitives.insert(primitives.end(), requestPrimitives.begin(), requestPrimitives.end());
+	}
+
+	auto esifServices = getEsifServices();
+	std::vector<DptfRequestResult> results;
+	results.reserve(requests.size());
+	try
+	{
+		if (primitives.empty() == false)
+		{
+			try
+			{
+				esifServices->prefetchPrimitives(primitives);
+			}
+			catch (...)
+			{
+				// the handlers execute any primitive that was not prefetched themselves
+			}
+		}
+
+		for (const auto& request : requests)
+		{
+			try
+			{
+				PolicyRequest policyRequest(getPolicyIndex(), request);
+				results.emplace_back(m_requestDispatcher->dispatch(policyRequest));
+			}
+			catch (const std::exception& ex)
+			{
+				results.emplace_back(false, ex.what(), request);
+			}
+		}
+	}
+	catch (...)
+	{
+		esifServices->clearPrefetchedPrimitives();
+		throw;
+	}
+	esifServices->clearPrefetchedPrimitives();
+
+	return results;
+}
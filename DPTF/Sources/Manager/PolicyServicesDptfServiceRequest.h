@@ -29,6 +29,7 @@ class PolicyServicesDptfServiceRequest : public PolicyServices, public DptfServi
 public:
 	PolicyServicesDptfServiceRequest(DptfManagerInterface* dptfManager, UIntN policyIndex);
 	virtual DptfRequestResult submitRequest(DptfRequest request) override;
+	virtual std::vector<DptfRequestResult> submitRequests(const std::vector<DptfRequest>& requests) override;
 
 private:
 	std::shared_ptr<RequestDispatcherInterface> m_requestDispatcher;
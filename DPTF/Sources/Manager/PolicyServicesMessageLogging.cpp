@@ -28,7 +28,7 @@ PolicyServicesMessageLogging::PolicyServicesMessageLogging(DptfManagerInterface*
 
 void PolicyServicesMessageLogging::writeMessageFatal(const DptfMessage& message)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 
 	MANAGER_LOG_MESSAGE_FATAL({
 		ManagerMessage updatedMessage = ManagerMessage(getDptfManager(), message);
@@ -39,7 +39,7 @@ void PolicyServicesMessageLogging::writeMessageFatal(const DptfMessage& message)
 
 void PolicyServicesMessageLogging::writeMessageError(const DptfMessage& message)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 
 	MANAGER_LOG_MESSAGE_ERROR({
 		ManagerMessage updatedMessage = ManagerMessage(getDptfManager(), message);
@@ -50,7 +50,7 @@ void PolicyServicesMessageLogging::writeMessageError(const DptfMessage& message)
 
 void PolicyServicesMessageLogging::writeMessageWarning(const DptfMessage& message)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 
 	MANAGER_LOG_MESSAGE_WARNING({
 		ManagerMessage updatedMessage = ManagerMessage(getDptfManager(), message);
@@ -61,7 +61,7 @@ void PolicyServicesMessageLogging::writeMessageWarning(const DptfMessage& messag
 
 void PolicyServicesMessageLogging::writeMessageInfo(const DptfMessage& message)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 
 	MANAGER_LOG_MESSAGE_INFO({
 		ManagerMessage updatedMessage = ManagerMessage(getDptfManager(), message);
@@ -72,7 +72,7 @@ void PolicyServicesMessageLogging::writeMessageInfo(const DptfMessage& message)
 
 void PolicyServicesMessageLogging::writeMessageDebug(const DptfMessage& message)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 
 	MANAGER_LOG_MESSAGE_DEBUG({
 		ManagerMessage updatedMessage = ManagerMessage(getDptfManager(), message);
@@ -83,6 +83,6 @@ void PolicyServicesMessageLogging::writeMessageDebug(const DptfMessage& message)
 
 eLogType PolicyServicesMessageLogging::getLoggingLevel()
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getEsifServices()->getCurrentLogVerbosityLevel();
 }
@@ -35,7 +35,7 @@ PolicyServicesPlatformConfigurationData::PolicyServicesPlatformConfigurationData
 
 UInt32 PolicyServicesPlatformConfigurationData::readConfigurationUInt32(const std::string& key)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getEsifServices()->readConfigurationUInt32(key);
 }
 
@@ -43,19 +43,19 @@ UInt32 PolicyServicesPlatformConfigurationData::readConfigurationUInt32(
 	const std::string& nameSpace,
 	const std::string& key)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getEsifServices()->readConfigurationUInt32(nameSpace, key);
 }
 
 void PolicyServicesPlatformConfigurationData::writeConfigurationUInt32(const std::string& key, UInt32 data)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getEsifServices()->writeConfigurationUInt32(key, data);
 }
 
 void PolicyServicesPlatformConfigurationData::writeConfigurationString(const std::string& key, const std::string& data)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getEsifServices()->writeConfigurationString(key, data);
 }
 
@@ -63,7 +63,7 @@ std::string PolicyServicesPlatformConfigurationData::readConfigurationString(
 	const std::string& nameSpace,
 	const std::string& key)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getEsifServices()->readConfigurationString(nameSpace, key);
 }
 
@@ -71,7 +71,7 @@ DptfBuffer PolicyServicesPlatformConfigurationData::readConfigurationBinary(
 	const std::string& nameSpace,
 	const std::string& key)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getEsifServices()->readConfigurationBinary(nameSpace, key);
 }
 
@@ -82,7 +82,7 @@ void PolicyServicesPlatformConfigurationData::writeConfigurationBinary(
 	const std::string& nameSpace,
 	const std::string& key)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getEsifServices()->writeConfigurationBinary(bufferPtr, bufferLength, dataLength, nameSpace, key);
 }
 
@@ -90,19 +90,19 @@ void PolicyServicesPlatformConfigurationData::deleteConfigurationBinary(
 	const std::string& nameSpace,
 	const std::string& key)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getEsifServices()->deleteConfigurationBinary(nameSpace, key);
 }
 
 eEsifError PolicyServicesPlatformConfigurationData::sendCommand(UInt32 argc, const std::string& argv)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getEsifServices()->sendCommand(argc, argv);
 }
 
 TimeSpan PolicyServicesPlatformConfigurationData::getMinimumAllowableSamplePeriod()
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 
 	if (m_defaultSamplePeriod.isInvalid())
 	{
@@ -115,64 +115,64 @@ TimeSpan PolicyServicesPlatformConfigurationData::getMinimumAllowableSamplePerio
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getActiveRelationshipTable()
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getEsifServices()->primitiveExecuteGet(esif_primitive_type::GET_ACTIVE_RELATIONSHIP_TABLE, ESIF_DATA_BINARY);
 }
 
 void PolicyServicesPlatformConfigurationData::setActiveRelationshipTable(DptfBuffer data)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getDptfManager()->getDataManager()->setTableObjectForNoPersist(data, TableObjectType::Type::Art);
 }
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getThermalRelationshipTable()
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getEsifServices()->primitiveExecuteGet(
 		esif_primitive_type::GET_THERMAL_RELATIONSHIP_TABLE, ESIF_DATA_BINARY);
 }
 
 void PolicyServicesPlatformConfigurationData::setThermalRelationshipTable(DptfBuffer data)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getDptfManager()->getDataManager()->setTableObjectForNoPersist(data, TableObjectType::Type::Trt);
 
 }
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getPassiveTable()
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getEsifServices()->primitiveExecuteGet(
 		esif_primitive_type::GET_PASSIVE_RELATIONSHIP_TABLE, ESIF_DATA_BINARY);
 }
 
 void PolicyServicesPlatformConfigurationData::setPassiveTable(DptfBuffer data)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getDptfManager()->getDataManager()->setTableObjectForNoPersist(data, TableObjectType::Psvt);
 }
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getAdaptivePerformanceConditionsTable(std::string uuid)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getDptfManager()->getDataManager()->getTableObject(TableObjectType::Type::Apct, uuid).getData();
 }
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getAdaptivePerformanceActionsTable(std::string uuid)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getDptfManager()->getDataManager()->getTableObject(TableObjectType::Type::Apat, uuid).getData();
 }
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getOemVariables()
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getEsifServices()->primitiveExecuteGet(esif_primitive_type::GET_OEM_VARS, ESIF_DATA_BINARY);
 }
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getSwOemVariables()
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getDptfManager()
 		->getDataManager()
 		->getTableObject(TableObjectType::Type::SwOemVariables, Constants::EmptyString)
@@ -181,14 +181,14 @@ DptfBuffer PolicyServicesPlatformConfigurationData::getSwOemVariables()
 
 void PolicyServicesPlatformConfigurationData::setSwOemVariables(const DptfBuffer& swOemVariablesData)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getDptfManager()->getDataManager()->setTableObjectForNoPersist(
 		swOemVariablesData, TableObjectType::SwOemVariables);
 }
 
 UInt64 PolicyServicesPlatformConfigurationData::getHwpfState(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getEsifServices()->primitiveExecuteGetAsUInt64(
 			esif_primitive_type::GET_HWPF_STATE, participantIndex, domainIndex);
 }
@@ -196,7 +196,7 @@ UInt64 PolicyServicesPlatformConfigurationData::getHwpfState(UIntN participantIn
 // TODO: Move it to ConfigTDP domain control
 UInt32 PolicyServicesPlatformConfigurationData::getProcessorConfigTdpControl(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getEsifServices()->primitiveExecuteGetAsUInt32(
 		esif_primitive_type::GET_CONFIG_TDP_CONTROL, participantIndex, domainIndex);
 }
@@ -207,7 +207,7 @@ Power PolicyServicesPlatformConfigurationData::getProcessorConfigTdpLevel(
 	UIntN domainIndex,
 	UIntN configTdpControl)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 
 	switch (configTdpControl)
 	{
@@ -228,21 +228,21 @@ Power PolicyServicesPlatformConfigurationData::getProcessorConfigTdpLevel(
 // TODO: Move it to ConfigTDP domain control
 UInt32 PolicyServicesPlatformConfigurationData::getProcessorConfigTdpLock(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getEsifServices()->primitiveExecuteGetAsUInt32(
 		esif_primitive_type::GET_CONFIG_TDP_LOCK, participantIndex, domainIndex);
 }
 
 Power PolicyServicesPlatformConfigurationData::getProcessorTdp(UIntN participantIndex, UIntN domainIndex) const
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getEsifServices()->primitiveExecuteGetAsPower(
 		esif_primitive_type::GET_PROC_THERMAL_DESIGN_POWER, participantIndex, domainIndex);
 }
 
 Temperature PolicyServicesPlatformConfigurationData::getProcessorTjMax(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getEsifServices()->primitiveExecuteGetAsTemperatureTenthK(
 		esif_primitive_type::GET_PROC_TJMAX, participantIndex, domainIndex);
 }
@@ -267,7 +267,7 @@ const Guid DptfDppeGroup(
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getPowerBossConditionsTable()
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getDptfManager()
 		->getDataManager()
 		->getTableObject(TableObjectType::Type::Pbct, Constants::EmptyString)
@@ -276,7 +276,7 @@ DptfBuffer PolicyServicesPlatformConfigurationData::getPowerBossConditionsTable(
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getPowerBossActionsTable()
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getDptfManager()
 		->getDataManager()
 		->getTableObject(TableObjectType::Type::Pbat, Constants::EmptyString)
@@ -285,25 +285,25 @@ DptfBuffer PolicyServicesPlatformConfigurationData::getPowerBossActionsTable()
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getEmergencyCallModeTable()
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getEsifServices()->primitiveExecuteGet(esif_primitive_type::GET_EMERGENCY_CALL_MODE_TABLE, ESIF_DATA_BINARY);
 }
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getPidAlgorithmTable()
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getEsifServices()->primitiveExecuteGet(esif_primitive_type::GET_PID_ALGORITHM_TABLE, ESIF_DATA_BINARY);
 }
 
 void PolicyServicesPlatformConfigurationData::setPidAlgorithmTable(DptfBuffer data)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getDptfManager()->getDataManager()->setTableObjectForNoPersist(data, TableObjectType::Type::Pida);
 }
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getPowerBossMathTable()
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getDptfManager()
 		->getDataManager()
 		->getTableObject(TableObjectType::Type::Pbmt, Constants::EmptyString)
@@ -312,7 +312,7 @@ DptfBuffer PolicyServicesPlatformConfigurationData::getPowerBossMathTable()
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getVoltageThresholdMathTable()
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getDptfManager()
 		->getDataManager()
 		->getTableObject(TableObjectType::Type::Vtmt, Constants::EmptyString)
@@ -321,7 +321,7 @@ DptfBuffer PolicyServicesPlatformConfigurationData::getVoltageThresholdMathTable
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getActiveControlPointRelationshipTable()
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getDptfManager()
 		->getDataManager()
 		->getTableObject(TableObjectType::Type::Acpr, Constants::EmptyString)
@@ -330,13 +330,13 @@ DptfBuffer PolicyServicesPlatformConfigurationData::getActiveControlPointRelatio
 
 void PolicyServicesPlatformConfigurationData::setActiveControlPointRelationshipTable(DptfBuffer data)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getDptfManager()->getDataManager()->setTableObjectForNoPersist(data, TableObjectType::Acpr);
 }
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getIntelligentThermalManagementTable()
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getDptfManager()
 		->getDataManager()
 		->getTableObject(TableObjectType::Type::Itmt, Constants::EmptyString)
@@ -345,13 +345,13 @@ DptfBuffer PolicyServicesPlatformConfigurationData::getIntelligentThermalManagem
 
 void PolicyServicesPlatformConfigurationData::setIntelligentThermalManagementTable(DptfBuffer data)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getDptfManager()->getDataManager()->setTableObjectForNoPersist(data, TableObjectType::Itmt);
 }
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getEnergyPerformanceOptimizerTable()
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getDptfManager()
 		->getDataManager()
 		->getTableObject(TableObjectType::Type::Epot, Constants::EmptyString)
@@ -360,13 +360,13 @@ DptfBuffer PolicyServicesPlatformConfigurationData::getEnergyPerformanceOptimize
 
 void PolicyServicesPlatformConfigurationData::setEnergyPerformanceOptimizerTable(DptfBuffer data)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getDptfManager()->getDataManager()->setTableObjectForNoPersist(data, TableObjectType::Type::Epot);
 }
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getPowerShareAlgorithmTable()
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getDptfManager()
 		->getDataManager()
 		->getTableObject(TableObjectType::Type::Psha, Constants::EmptyString)
@@ -375,13 +375,13 @@ DptfBuffer PolicyServicesPlatformConfigurationData::getPowerShareAlgorithmTable(
 
 void PolicyServicesPlatformConfigurationData::setPowerShareAlgorithmTable(DptfBuffer data)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getDptfManager()->getDataManager()->setTableObjectForNoPersist(data, TableObjectType::Psha);
 }
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getPowerShareAlgorithmTable2()
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getDptfManager()
 		->getDataManager()
 		->getTableObject(TableObjectType::Type::Psh2, Constants::EmptyString)
@@ -390,7 +390,7 @@ DptfBuffer PolicyServicesPlatformConfigurationData::getPowerShareAlgorithmTable2
 
 void PolicyServicesPlatformConfigurationData::setPowerShareAlgorithmTable2(DptfBuffer data)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getDptfManager()->getDataManager()->setTableObjectForNoPersist(data, TableObjectType::Psh2);
 }
 
@@ -587,7 +587,7 @@ void PolicyServicesPlatformConfigurationData::resetAllTables() const
 
 Bool PolicyServicesPlatformConfigurationData::getDisplayRequired()
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	const auto displayRequired = getEsifServices()->primitiveExecuteGetAsUInt32(
 		esif_primitive_type::GET_ES_DISPLAY_REQUIRED,
 		Constants::Esif::NoParticipant,
@@ -598,7 +598,7 @@ Bool PolicyServicesPlatformConfigurationData::getDisplayRequired()
 
 void PolicyServicesPlatformConfigurationData::setPpmPackage(DptfBuffer package)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	const auto pkgHeader = reinterpret_cast<EsifPpmParamValuesHeader*>(package.get());
 	const auto numParams = pkgHeader->numberElement;
 	if (numParams > 0)
@@ -614,7 +614,7 @@ void PolicyServicesPlatformConfigurationData::setPpmPackage(DptfBuffer package)
 
 void PolicyServicesPlatformConfigurationData::setPpmPackageForNonBalancedSchemePersonality(DptfBuffer package)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	const auto pkgHeader = reinterpret_cast<EsifPpmParamValuesHeader*>(package.get());
 	const auto numParams = pkgHeader->numberElement;
 	if (numParams > 0)
@@ -630,7 +630,7 @@ void PolicyServicesPlatformConfigurationData::setPpmPackageForNonBalancedSchemeP
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getPpmPackage(DptfBuffer requestPackage)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 
 	DptfBuffer buffer = getEsifServices()->primitiveExecuteGetWithArgument(
 		esif_primitive_type::GET_PPM_PARAM_VALUES,
@@ -648,7 +648,7 @@ DptfBuffer PolicyServicesPlatformConfigurationData::getPpmPackage(DptfBuffer req
 
 void PolicyServicesPlatformConfigurationData::setPowerSchemeEpp(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 
 	try
 	{
@@ -661,7 +661,7 @@ void PolicyServicesPlatformConfigurationData::setPowerSchemeEpp(UInt32 value)
 
 void PolicyServicesPlatformConfigurationData::setActivePowerScheme()
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 
 	try
 	{
@@ -675,7 +675,7 @@ void PolicyServicesPlatformConfigurationData::setActivePowerScheme()
 
 void PolicyServicesPlatformConfigurationData::clearPpmPackageSettings()
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 
 	try
 	{
@@ -689,14 +689,14 @@ void PolicyServicesPlatformConfigurationData::clearPpmPackageSettings()
 
 TimeSpan PolicyServicesPlatformConfigurationData::getExpectedBatteryLife()
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getEsifServices()->primitiveExecuteGetAsTimeInMilliseconds(
 			esif_primitive_type::GET_EXPECTED_BATTERY_LIFE);
 }
 
 UInt32 PolicyServicesPlatformConfigurationData::getAggressivenessLevel()
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getEsifServices()->primitiveExecuteGetAsUInt32(
 			esif_primitive_type::GET_AGGRESSIVENESS_LEVEL,
 			Constants::Esif::NoParticipant,
@@ -706,7 +706,7 @@ UInt32 PolicyServicesPlatformConfigurationData::getAggressivenessLevel()
 
 void PolicyServicesPlatformConfigurationData::setForegroundAppRatioPeriod(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getEsifServices()->primitiveExecuteSetAsUInt32(
 		esif_primitive_type::SET_FOREGROUND_APP_RATIO_PERIOD,
 		value,
@@ -717,7 +717,7 @@ void PolicyServicesPlatformConfigurationData::setForegroundAppRatioPeriod(UInt32
 
 void PolicyServicesPlatformConfigurationData::setProcessAffinityMask(const std::string& processName, UInt32 maskValue)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 
 	AffinityCommand affinityCommand;
 	affinityCommand.version = AFFINITY_CMD_VERSION;
@@ -737,7 +737,7 @@ void PolicyServicesPlatformConfigurationData::setProcessAffinityMask(const std::
 
 void PolicyServicesPlatformConfigurationData::setApplicationCompatibility(const DptfBuffer& processData)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 
 	getEsifServices()->primitiveExecuteSet(
 		esif_primitive_type::SET_APP_COMPAT,
@@ -752,7 +752,7 @@ void PolicyServicesPlatformConfigurationData::setApplicationCompatibility(const
 
 void PolicyServicesPlatformConfigurationData::deleteApplicationCompatibility()
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 
 	AppCompatDeleteCommand applicationCompatibilityDeleteCommand;
 	esif_guid_t applicationCompatibilityGuid = APPLICATION_OPTIMIZATION_APPCOMPAT_GUID;
@@ -774,7 +774,7 @@ void PolicyServicesPlatformConfigurationData::deleteApplicationCompatibility()
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getDdrfTable()
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getDptfManager()
 		->getDataManager()
 		->getTableObject(TableObjectType::Type::Ddrf, Constants::EmptyString)
@@ -783,7 +783,7 @@ DptfBuffer PolicyServicesPlatformConfigurationData::getDdrfTable()
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getRfimTable()
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getDptfManager()
 		->getDataManager()
 		->getTableObject(TableObjectType::Type::Rfim, Constants::EmptyString)
@@ -792,14 +792,14 @@ DptfBuffer PolicyServicesPlatformConfigurationData::getRfimTable()
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getAggregateDisplayInformation()
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getEsifServices()->primitiveExecuteGet(
 		esif_primitive_type::GET_AGGREGATE_DISPLAY_INFORMATION, ESIF_DATA_BINARY);
 }
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getTpgaTable()
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getDptfManager()
 		->getDataManager()
 		->getTableObject(TableObjectType::Type::Tpga, Constants::EmptyString)
@@ -808,13 +808,13 @@ DptfBuffer PolicyServicesPlatformConfigurationData::getTpgaTable()
 
 void PolicyServicesPlatformConfigurationData::setTpgaTable(DptfBuffer data)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getDptfManager()->getDataManager()->setTableObjectForNoPersist(data, TableObjectType::Type::Tpga);
 }
 
 UInt32 PolicyServicesPlatformConfigurationData::getDynamicBoostState(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getEsifServices()->primitiveExecuteGetAsUInt32(
 			esif_primitive_type::GET_DYNAMIC_BOOST_STATE, participantIndex, domainIndex);
 }
@@ -824,27 +824,27 @@ void PolicyServicesPlatformConfigurationData::setDynamicBoostState(
 	UIntN domainIndex,
 	UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getEsifServices()->primitiveExecuteSetAsUInt32(
 		esif_primitive_type::SET_DYNAMIC_BOOST_STATE, value, participantIndex, domainIndex);
 }
 
 UInt32 PolicyServicesPlatformConfigurationData::getTpgPowerStateWithoutCache(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getEsifServices()->primitiveExecuteGetAsUInt32(
 		esif_primitive_type::GET_TPG_POWER_STATE, participantIndex, domainIndex);
 }
 
 EnvironmentProfile PolicyServicesPlatformConfigurationData::getEnvironmentProfile() const
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getDptfManager()->getEnvironmentProfile();
 }
 
 UInt32 PolicyServicesPlatformConfigurationData::getLogicalProcessorCount(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getEsifServices()->primitiveExecuteGetAsUInt32(
 		esif_primitive_type::GET_PROC_LOGICAL_PROCESSOR_COUNT, participantIndex, domainIndex);
 
@@ -852,7 +852,7 @@ UInt32 PolicyServicesPlatformConfigurationData::getLogicalProcessorCount(UIntN p
 
 UInt32 PolicyServicesPlatformConfigurationData::getPhysicalCoreCount(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	return getEsifServices()->primitiveExecuteGetAsUInt32(
 		esif_primitive_type::GET_PROC_PHYSICAL_CORE_COUNT, participantIndex, domainIndex);
 }
\ No newline at end of file
@@ -55,7 +55,7 @@ void PolicyServicesPlatformPowerState::setThermalEvent(
 
 void PolicyServicesPlatformPowerState::sleep(void)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 
 	esif_ccb_thread_join(&m_thread);
 	eEsifError rc = esif_ccb_thread_create(&m_thread, ThreadSleep, this);
@@ -75,7 +75,7 @@ void PolicyServicesPlatformPowerState::hibernate(
 	const Temperature& tripPointTemperature,
 	const std::string& participantName)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 
 	setThermalEvent(currentTemperature, tripPointTemperature, participantName);
 	esif_ccb_thread_join(&m_thread);
@@ -96,7 +96,7 @@ void PolicyServicesPlatformPowerState::shutDown(
 	const Temperature& tripPointTemperature,
 	const std::string& participantName)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 
 	setThermalEvent(currentTemperature, tripPointTemperature, participantName);
 	esif_ccb_thread_join(&m_thread);
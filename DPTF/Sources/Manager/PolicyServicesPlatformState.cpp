@@ -25,66 +25,79 @@ PolicyServicesPlatformState::PolicyServicesPlatformState(DptfManagerInterface* d
 
 OnOffToggle::Type PolicyServicesPlatformState::getMotion(void) const
 {
+	ManagerStateLockHolder managerStateLock(getManagerStateLock());
 	return getDptfManager()->getEventCache()->sensorMotion.get();
 }
 
 SensorOrientation::Type PolicyServicesPlatformState::getOrientation(void) const
 {
+	ManagerStateLockHolder managerStateLock(getManagerStateLock());
 	return getDptfManager()->getEventCache()->sensorOrientation.get();
 }
 
 SensorSpatialOrientation::Type PolicyServicesPlatformState::getSpatialOrientation(void) const
 {
+	ManagerStateLockHolder managerStateLock(getManagerStateLock());
 	return getDptfManager()->getEventCache()->sensorSpatialOrientation.get();
 }
 
 OsLidState::Type PolicyServicesPlatformState::getLidState(void) const
 {
+	ManagerStateLockHolder managerStateLock(getManagerStateLock());
 	return getDptfManager()->getEventCache()->lidState.get();
 }
 
 OsPowerSource::Type PolicyServicesPlatformState::getPowerSource(void) const
 {
+	ManagerStateLockHolder managerStateLock(getManagerStateLock());
 	return getDptfManager()->getEventCache()->powerSource.get();
 }
 
-const std::string& PolicyServicesPlatformState::getForegroundApplicationName(void) const
+std::string PolicyServicesPlatformState::getForegroundApplicationName(void) const
 {
+	ManagerStateLockHolder managerStateLock(getManagerStateLock());
 	return getDptfManager()->getEventCache()->foregroundApplication.get();
 }
 
 CoolingMode::Type PolicyServicesPlatformState::getCoolingMode(void) const
 {
+	ManagerStateLockHolder managerStateLock(getManagerStateLock());
 	return getDptfManager()->getEventCache()->coolingMode.get();
 }
 
 UIntN PolicyServicesPlatformState::getBatteryPercentage(void) const
 {
+	ManagerStateLockHolder managerStateLock(getManagerStateLock());
 	return getDptfManager()->getEventCache()->batteryPercentage.get();
 }
 
 OsPlatformType::Type PolicyServicesPlatformState::getPlatformType(void) const
 {
+	ManagerStateLockHolder managerStateLock(getManagerStateLock());
 	return getDptfManager()->getEventCache()->platformType.get();
 }
 
 OsDockMode::Type PolicyServicesPlatformState::getDockMode(void) const
 {
+	ManagerStateLockHolder managerStateLock(getManagerStateLock());
 	return getDptfManager()->getEventCache()->dockMode.get();
 }
 
 OsPowerSchemePersonality::Type PolicyServicesPlatformState::getPowerSchemePersonality(void) const
 {
+	ManagerStateLockHolder managerStateLock(getManagerStateLock());
 	return getDptfManager()->getEventCache()->powerSchemePersonality.get();
 }
 
 SystemMode::Type PolicyServicesPlatformState::getSystemMode(void) const
 {
+	ManagerStateLockHolder managerStateLock(getManagerStateLock());
 	return getDptfManager()->getEventCache()->systemMode.get();
 }
 
 UIntN PolicyServicesPlatformState::getMobileNotification(OsMobileNotificationType::Type notificationType) const
 {
+	ManagerStateLockHolder managerStateLock(getManagerStateLock());
 	switch (notificationType)
 	{
 	case OsMobileNotificationType::EmergencyCallMode:
@@ -102,55 +115,66 @@ UIntN PolicyServicesPlatformState::getMobileNotification(OsMobileNotificationTyp
 
 OnOffToggle::Type PolicyServicesPlatformState::getMixedRealityMode(void) const
 {
+	ManagerStateLockHolder managerStateLock(getManagerStateLock());
 	return getDptfManager()->getEventCache()->mixedRealityMode.get();
 }
 
 OnOffToggle::Type PolicyServicesPlatformState::getGameMode(void) const
 {
+	ManagerStateLockHolder managerStateLock(getManagerStateLock());
 	return getDptfManager()->getEventCache()->gameMode.get();
 }
 
 OsUserPresence::Type PolicyServicesPlatformState::getOsUserPresence(void) const
 {
+	ManagerStateLockHolder managerStateLock(getManagerStateLock());
 	return getDptfManager()->getEventCache()->osUserPresence.get();
 }
 
 OsSessionState::Type PolicyServicesPlatformState::getSessionState(void) const
 {
+	ManagerStateLockHolder managerStateLock(getManagerStateLock());
 	return getDptfManager()->getEventCache()->sessionState.get();
 }
 
 OnOffToggle::Type PolicyServicesPlatformState::getScreenState(void) const
 {
+	ManagerStateLockHolder managerStateLock(getManagerStateLock());
 	return getDptfManager()->getEventCache()->screenState.get();
 }
 
 UIntN PolicyServicesPlatformState::getBatteryCount(void) const
 {
+	ManagerStateLockHolder managerStateLock(getManagerStateLock());
 	return getDptfManager()->getEventCache()->batteryCount.get();
 }
 
 UIntN PolicyServicesPlatformState::getPowerSlider(void) const
 {
+	ManagerStateLockHolder managerStateLock(getManagerStateLock());
 	return getDptfManager()->getEventCache()->powerSlider.get();
 }
 
 SensorUserPresence::Type PolicyServicesPlatformState::getPlatformUserPresence(void) const
 {
+	ManagerStateLockHolder managerStateLock(getManagerStateLock());
 	return getDptfManager()->getEventCache()->platformUserPresence.get();
 }
 
 UserInteraction::Type PolicyServicesPlatformState::getUserInteraction(void) const
 {
+	ManagerStateLockHolder managerStateLock(getManagerStateLock());
 	return getDptfManager()->getEventCache()->userInteraction.get();
 }
 
 OnOffToggle::Type PolicyServicesPlatformState::getTpgPowerState(void) const
 {
+	ManagerStateLockHolder managerStateLock(getManagerStateLock());
 	return getDptfManager()->getEventCache()->tpgPowerState.get();
 }
 
 OnOffToggle::Type PolicyServicesPlatformState::getCollaborationMode(void) const
 {
+	ManagerStateLockHolder managerStateLock(getManagerStateLock());
 	return getDptfManager()->getEventCache()->collaborationMode.get();
 }
\ No newline at end of file
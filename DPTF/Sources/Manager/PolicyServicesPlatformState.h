@@ -31,7 +31,7 @@ public:
 	virtual SensorSpatialOrientation::Type getSpatialOrientation(void) const override;
 	virtual OsLidState::Type getLidState(void) const override;
 	virtual OsPowerSource::Type getPowerSource(void) const override;
-	virtual const std::string& getForegroundApplicationName(void) const override;
+	virtual std::string getForegroundApplicationName(void) const override;
 	virtual CoolingMode::Type getCoolingMode(void) const override;
 	virtual UIntN getBatteryPercentage(void) const override;
 	virtual OsPlatformType::Type getPlatformType(void) const override;
@@ -28,12 +28,12 @@ PolicyServicesPolicyEventRegistration::PolicyServicesPolicyEventRegistration(
 
 void PolicyServicesPolicyEventRegistration::registerEvent(PolicyEvent::Type policyEvent)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getPolicyManager()->registerEvent(getPolicyIndex(), policyEvent);
 }
 
 void PolicyServicesPolicyEventRegistration::unregisterEvent(PolicyEvent::Type policyEvent)
 {
-	throwIfNotWorkItemThread();
+	auto managerStateLock = lockManagerState();
 	getPolicyManager()->unregisterEvent(getPolicyIndex(), policyEvent);
 }
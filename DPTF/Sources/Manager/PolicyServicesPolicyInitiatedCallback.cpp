@@ -19,6 +19,7 @@
 #include "PolicyServicesPolicyInitiatedCallback.h"
 #include "WIPolicyInitiatedCallback.h"
 #include "WorkItemQueueManagerInterface.h"
+#include "Policy.h"
 
 PolicyServicesPolicyInitiatedCallback::PolicyServicesPolicyInitiatedCallback(
 	DptfManagerInterface* dptfManager,
@@ -65,5 +66,8 @@ Bool PolicyServicesPolicyInitiatedCallback::removePolicyInitiatedCallback(UInt64
 
 	UIntN numRemoved = getWorkItemQueueManager()->removeIfMatches(matchCriteria);
 
+	// the work item may already have run and queued the callback on the policy's executor
+	numRemoved += getPolicy()->cancelPolicyInitiatedCallback(callbackHandle);
+
 	return (numRemoved > 0);
 }
@@ -55,6 +55,20 @@ DptfRequestResult RequestDispatcher::dispatch(const PolicyRequest& policyRequest
 	return DptfRequestResult(false, "No handler for request.", request);
 }
 
+std::vector<EsifPrimitiveRequest> RequestDispatcher::getPrimitivesForRequest(const PolicyRequest& policyRequest)
+{
+	auto& request = policyRequest.getRequest();
+	auto handlers = m_handlers[request.getRequestType()];
+	for (auto handler = handlers.begin(); handler != handlers.end(); ++handler)
+	{
+		if ((*handler)->canProcessRequest(policyRequest))
+		{
+			return (*handler)->getPrimitivesForRequest(policyRequest);
+		}
+	}
+	return std::vector<EsifPrimitiveRequest>();
+}
+
 void RequestDispatcher::registerHandler(DptfRequestType::Enum requestType, RequestHandlerInterface* handler)
 {
 	m_handlers[requestType].insert(handler);
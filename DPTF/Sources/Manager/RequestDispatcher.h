@@ -30,6 +30,7 @@ public:
 
 	virtual DptfRequestResult dispatch(const PolicyRequest& policyRequest) = 0;
 	virtual void dispatchForAllControls(const PolicyRequest& policyRequest) = 0;
+	virtual std::vector<EsifPrimitiveRequest> getPrimitivesForRequest(const PolicyRequest& policyRequest) = 0;
 	virtual void registerHandler(DptfRequestType::Enum requestType, RequestHandlerInterface* handler) = 0;
 	virtual void unregisterHandler(DptfRequestType::Enum requestType, RequestHandlerInterface* handler) = 0;
 };
@@ -42,6 +43,7 @@ public:
 
 	virtual DptfRequestResult dispatch(const PolicyRequest& policyRequest) override;
 	virtual void dispatchForAllControls(const PolicyRequest& policyRequest) override;
+	virtual std::vector<EsifPrimitiveRequest> getPrimitivesForRequest(const PolicyRequest& policyRequest) override;
 	virtual void registerHandler(DptfRequestType::Enum requestType, RequestHandlerInterface* handler) override;
 	virtual void unregisterHandler(DptfRequestType::Enum requestType, RequestHandlerInterface* handler) override;
 
@@ -45,7 +45,7 @@ void WIPolicyInitiatedCallback::onExecute(void)
 	try
 	{
 		auto policy = getPolicyManager()->getPolicyPtr(m_policyIndex);
-		policy->executePolicyInitiatedCallback(m_policyDefinedEventCode, m_param1, m_param2);
+		policy->executePolicyInitiatedCallback(getUniqueId(), m_policyDefinedEventCode, m_param1, m_param2);
 	}
 	catch (policy_index_invalid&)
 	{
@@ -22,8 +22,11 @@
 #include "EsifThreadId.h"
 #include "XmlNode.h"
 #include "ManagerLogger.h"
+#include "PolicyExecutor.h"
 #include <memory>
 
+static const UIntN PolicyExecutorThreadCount = 4;
+
 WorkItemQueueManager::WorkItemQueueManager(DptfManagerInterface* dptfManager)
 	: m_dptfManager(dptfManager)
 	, m_enqueueingEnabled(true)
@@ -31,16 +34,25 @@ WorkItemQueueManager::WorkItemQueueManager(DptfManagerInterface* dptfManager)
 	, m_immediateQueue(nullptr)
 	, m_deferredQueue(nullptr)
 	, m_workItemQueueThread(nullptr)
+	, m_managerStateLock(nullptr)
+	, m_policyExecutorThreadPool(nullptr)
 	, m_workItemQueueSemaphore(nullptr)
 {
 	try
 	{
 		m_workItemStatistics = new WorkItemStatistics();
+		m_managerStateLock = new ManagerStateLock();
+		m_policyExecutorThreadPool = new PolicyExecutorThreadPool(PolicyExecutorThreadCount);
 		m_workItemQueueSemaphore = new EsifSemaphore();
 		m_immediateQueue = new ImmediateWorkItemQueue(m_workItemQueueSemaphore);
 		m_deferredQueue = new DeferredWorkItemQueue(m_workItemQueueSemaphore, m_immediateQueue);
 		m_workItemQueueThread = new WorkItemQueueThread(
-			m_dptfManager, m_immediateQueue, m_deferredQueue, m_workItemQueueSemaphore, m_workItemStatistics);
+			m_dptfManager,
+			m_immediateQueue,
+			m_deferredQueue,
+			m_workItemQueueSemaphore,
+			m_workItemStatistics,
+			m_managerStateLock);
 	}
 	catch (...)
 	{
@@ -64,9 +76,11 @@ void WorkItemQueueManager::deleteAllObjects(void)
 {
 	// Do not acquire mutex for this function.
 	DELETE_MEMORY_TC(m_workItemQueueThread);
+	DELETE_MEMORY_TC(m_policyExecutorThreadPool);
 	DELETE_MEMORY_TC(m_deferredQueue);
 	DELETE_MEMORY_TC(m_immediateQueue);
 	DELETE_MEMORY_TC(m_workItemQueueSemaphore);
+	DELETE_MEMORY_TC(m_managerStateLock);
 	DELETE_MEMORY_TC(m_workItemStatistics);
 }
 
@@ -125,7 +139,9 @@ void WorkItemQueueManager::enqueueImmediateWorkItemAndWait(std::shared_ptr<WorkI
 		// and waits for the return.  In that case we have an automatic deadlock without this special processing
 		// in place.  When this happens we just treat it like a function call and execute the work item directly
 		// and return.  Without this in place the work item would just sit in the queue and never execute since
-		// the thread is being held by the currently running work item.
+		// the thread is being held by the currently running work item.  Policies running on their executors get
+		// the same treatment since they can only get here from inside a policy services call.
+		ManagerStateLockHolder managerStateLock(m_managerStateLock);
 		workItem->execute();
 	}
 	else
@@ -203,8 +219,12 @@ Bool WorkItemQueueManager::isWorkItemThread()
 	try
 	{
 		EsifThreadId currentThreadId;
-		EsifThreadId workItemQueueThreadId = m_workItemQueueThread->getWorkItemQueueThreadId();
-		isWorkItemThread = (currentThreadId == workItemQueueThreadId);
+		isWorkItemThread = m_policyExecutorThreadPool->isPoolThread();
+		if (isWorkItemThread == false)
+		{
+			EsifThreadId workItemQueueThreadId = m_workItemQueueThread->getWorkItemQueueThreadId();
+			isWorkItemThread = (currentThreadId == workItemQueueThreadId);
+		}
 	}
 	catch (...)
 	{
@@ -213,6 +233,17 @@ Bool WorkItemQueueManager::isWorkItemThread()
 	return isWorkItemThread;
 }
 
+std::shared_ptr<PolicyExecutor> WorkItemQueueManager::createPolicyExecutor(UIntN policyIndex)
+{
+	return std::make_shared<PolicyExecutor>(
+		m_dptfManager, policyIndex, m_policyExecutorThreadPool, m_managerStateLock, m_workItemStatistics);
+}
+
+ManagerStateLock* WorkItemQueueManager::getManagerStateLock(void)
+{
+	return m_managerStateLock;
+}
+
 std::shared_ptr<XmlNode> WorkItemQueueManager::getStatusAsXml(void)
 {
 	EsifMutexHelper esifMutexHelper(&m_mutex);
@@ -22,6 +22,8 @@
 #include "WorkItemQueueThread.h"
 #include "ImmediateWorkItemQueue.h"
 #include "DeferredWorkItemQueue.h"
+#include "PolicyExecutorThreadPool.h"
+#include "ManagerStateLock.h"
 #include "EsifMutex.h"
 
 class WorkItemQueueManager : public WorkItemQueueManagerInterface
@@ -42,6 +44,9 @@ public:
 	virtual UIntN removeIfMatches(const WorkItemMatchCriteria& matchCriteria) override;
 	virtual Bool isWorkItemThread(void) override;
 
+	virtual std::shared_ptr<PolicyExecutor> createPolicyExecutor(UIntN policyIndex) override;
+	virtual ManagerStateLock* getManagerStateLock(void) override;
+
 	virtual void disableAndEmptyAllQueues(void) override;
 
 	virtual std::shared_ptr<XmlNode> getStatusAsXml(void) override;
@@ -60,6 +65,11 @@ private:
 	DeferredWorkItemQueue* m_deferredQueue;
 	WorkItemQueueThread* m_workItemQueueThread;
 
+	// Policies run on their own executors on these threads.  The work item thread and the policies share the
+	// manager state through m_managerStateLock.
+	ManagerStateLock* m_managerStateLock;
+	PolicyExecutorThreadPool* m_policyExecutorThreadPool;
+
 	// - The following semaphore is signaled when:
 	//    * an item is placed in the immediate or deferred queue
 	//    * the system is shutting down and the thread needs to exit
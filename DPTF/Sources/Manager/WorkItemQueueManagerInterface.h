@@ -22,6 +22,9 @@
 #include "WorkItem.h"
 #include <memory>
 
+class PolicyExecutor;
+class ManagerStateLock;
+
 class WorkItemQueueManagerInterface
 {
 public:
@@ -38,6 +41,9 @@ public:
 	virtual UIntN removeIfMatches(const WorkItemMatchCriteria& matchCriteria) = 0;
 	virtual Bool isWorkItemThread(void) = 0;
 
+	virtual std::shared_ptr<PolicyExecutor> createPolicyExecutor(UIntN policyIndex) = 0;
+	virtual ManagerStateLock* getManagerStateLock(void) = 0;
+
 	virtual void disableAndEmptyAllQueues(void) = 0;
 
 	virtual std::shared_ptr<XmlNode> getStatusAsXml(void) = 0;
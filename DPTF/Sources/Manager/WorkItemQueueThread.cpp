@@ -18,13 +18,15 @@
 
 #include "WorkItemQueueThread.h"
 #include "ParticipantManagerInterface.h"
+#include "PolicyExecutor.h"
 
 WorkItemQueueThread::WorkItemQueueThread(
 	DptfManagerInterface* dptfManager,
 	ImmediateWorkItemQueue* immediateQueue,
 	DeferredWorkItemQueue* deferredQueue,
 	EsifSemaphore* workItemQueueSemaphore,
-	WorkItemStatistics* workItemStatistics)
+	WorkItemStatistics* workItemStatistics,
+	ManagerStateLock* managerStateLock)
 	: m_dptfManager(dptfManager)
 	, m_participantManager(nullptr)
 	, m_destroyThread(false)
@@ -35,6 +37,7 @@ WorkItemQueueThread::WorkItemQueueThread(
 	, m_workItemQueueThreadId(nullptr)
 	, m_workItemQueueThreadExitSemaphore(nullptr)
 	, m_workItemStatistics(workItemStatistics)
+	, m_managerStateLock(managerStateLock)
 {
 	m_participantManager = m_dptfManager->getParticipantManager();
 	m_workItemQueueThreadExitSemaphore = new EsifSemaphore();
@@ -102,6 +105,13 @@ void WorkItemQueueThread::processImmediateQueue(void)
 		}
 #endif
 
+		// the policy tasks this work item fans out clear the participant caches once the last of them has run
+		auto eventDispatch = std::make_shared<PolicyEventDispatch>(m_dptfManager, m_managerStateLock);
+		PolicyExecutor::setEventDispatch(eventDispatch);
+
+		// policies running on their executors take the same lock for each policy services call
+		m_managerStateLock->lock();
+
 		try
 		{
 			immediateWorkItem->execute();
@@ -118,6 +128,11 @@ void WorkItemQueueThread::processImmediateQueue(void)
 		{
 		}
 
+		m_managerStateLock->unlock();
+
+		PolicyExecutor::setEventDispatch(nullptr);
+		eventDispatch.reset();
+
 #ifdef INCLUDE_WORK_ITEM_STATISTICS
 		try
 		{
@@ -24,6 +24,7 @@
 #include "EsifThread.h"
 #include "EsifThreadId.h"
 #include "WorkItemStatistics.h"
+#include "ManagerStateLock.h"
 
 class ParticipantManagerInterface;
 
@@ -35,7 +36,8 @@ public:
 		ImmediateWorkItemQueue* immediateQueue,
 		DeferredWorkItemQueue* deferredQueue,
 		EsifSemaphore* workItemQueueSemaphore,
-		WorkItemStatistics* workItemStatistics);
+		WorkItemStatistics* workItemStatistics,
+		ManagerStateLock* managerStateLock);
 	~WorkItemQueueThread(void);
 
 	EsifThreadId getWorkItemQueueThreadId(void) const;
@@ -56,6 +58,7 @@ private:
 	EsifThreadId* m_workItemQueueThreadId;
 	EsifSemaphore* m_workItemQueueThreadExitSemaphore;
 	WorkItemStatistics* m_workItemStatistics;
+	ManagerStateLock* m_managerStateLock;
 
 	friend void* ThreadStart(void* contextPtr);
 	void executeThread(void);
@@ -19,6 +19,7 @@
 #include "WorkItemStatistics.h"
 #include "XmlNode.h"
 #include "FrameworkEvent.h"
+#include "EsifMutexHelper.h"
 
 WorkItemStatistics::WorkItemStatistics(void)
 {
@@ -130,6 +131,58 @@ void WorkItemStatistics::incrementDeferredTotals(WorkItemInterface* workItem)
 	m_totalDeferredWorkItemsExecuted += 1;
 }
 
+void WorkItemStatistics::incrementPolicyTotals(
+	UIntN policyIndex,
+	const TimeSpan& queueTime,
+	const TimeSpan& executionTime)
+{
+	EsifMutexHelper esifMutexHelper(&m_policyStatisticsMutex);
+	esifMutexHelper.lock();
+
+	// a new row is value initialized, so totalExecuted starts at zero
+	auto& statistics = m_policyStatistics[policyIndex];
+	statistics.totalExecuted += 1;
+
+	if (statistics.totalExecuted == 1)
+	{
+		statistics.totalQueueTime = queueTime;
+		statistics.totalExecutionTime = executionTime;
+
+		statistics.minQueueTime = queueTime;
+		statistics.maxQueueTime = queueTime;
+
+		statistics.minExecutionTime = executionTime;
+		statistics.maxExecutionTime = executionTime;
+	}
+	else
+	{
+		statistics.totalQueueTime = statistics.totalQueueTime + queueTime;
+		statistics.totalExecutionTime = statistics.totalExecutionTime + executionTime;
+
+		if (queueTime < statistics.minQueueTime)
+		{
+			statistics.minQueueTime = queueTime;
+		}
+
+		if (queueTime > statistics.maxQueueTime)
+		{
+			statistics.maxQueueTime = queueTime;
+		}
+
+		if (executionTime < statistics.minExecutionTime)
+		{
+			statistics.minExecutionTime = executionTime;
+		}
+
+		if (executionTime > statistics.maxExecutionTime)
+		{
+			statistics.maxExecutionTime = executionTime;
+		}
+	}
+
+	esifMutexHelper.unlock();
+}
+
 std::shared_ptr<XmlNode> WorkItemStatistics::getXml(void)
 {
 	auto workItemStatistics = XmlNode::createWrapperElement("work_item_statistics");
@@ -180,5 +233,43 @@ std::shared_ptr<XmlNode> WorkItemStatistics::getXml(void)
 			"max_execution_time", m_immediateWorkItemStatistics[i].maxExecutionTime.toStringMilliseconds()));
 	}
 
+	workItemStatistics->addChild(getPolicyStatisticsXml());
+
 	return workItemStatistics;
 }
+
+std::shared_ptr<XmlNode> WorkItemStatistics::getPolicyStatisticsXml(void)
+{
+	EsifMutexHelper esifMutexHelper(&m_policyStatisticsMutex);
+	esifMutexHelper.lock();
+
+	auto policyStatistics = XmlNode::createWrapperElement("policy_executor_statistics");
+
+	for (auto row = m_policyStatistics.begin(); row != m_policyStatistics.end(); row++)
+	{
+		const WorkItemTypeExecutionStatistics& statistics = row->second;
+		auto averageQueueTime = statistics.totalQueueTime / statistics.totalExecuted;
+		auto averageExecutionTime = statistics.totalExecutionTime / statistics.totalExecuted;
+
+		auto policy = XmlNode::createWrapperElement("policy");
+		policyStatistics->addChild(policy);
+
+		policy->addChild(XmlNode::createDataElement("policy_index", std::to_string(row->first)));
+		policy->addChild(XmlNode::createDataElement("total_executed", std::to_string(statistics.totalExecuted)));
+
+		policy->addChild(XmlNode::createDataElement("average_queue_time", averageQueueTime.toStringMilliseconds()));
+		policy->addChild(XmlNode::createDataElement("min_queue_time", statistics.minQueueTime.toStringMilliseconds()));
+		policy->addChild(XmlNode::createDataElement("max_queue_time", statistics.maxQueueTime.toStringMilliseconds()));
+
+		policy->addChild(
+			XmlNode::createDataElement("average_execution_time", averageExecutionTime.toStringMilliseconds()));
+		policy->addChild(
+			XmlNode::createDataElement("min_execution_time", statistics.minExecutionTime.toStringMilliseconds()));
+		policy->addChild(
+			XmlNode::createDataElement("max_execution_time", statistics.maxExecutionTime.toStringMilliseconds()));
+	}
+
+	esifMutexHelper.unlock();
+
+	return policyStatistics;
+}
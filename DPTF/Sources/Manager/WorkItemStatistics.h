@@ -21,6 +21,8 @@
 #include "Dptf.h"
 #include "WorkItem.h"
 #include "FrameworkEvent.h"
+#include "EsifMutex.h"
+#include <map>
 
 class XmlNode;
 
@@ -47,6 +49,10 @@ public:
 	void incrementImmediateTotals(WorkItemInterface* workItem);
 	void incrementDeferredTotals(WorkItemInterface* workItem);
 
+	// Called from the policy executor threads after each policy task.  The queue time is the time the task waited
+	// behind earlier tasks for the same policy.
+	void incrementPolicyTotals(UIntN policyIndex, const TimeSpan& queueTime, const TimeSpan& executionTime);
+
 	std::shared_ptr<XmlNode> getXml(void);
 
 private:
@@ -61,4 +67,11 @@ private:
 	TimeSpan m_lastDptfGetStatusWorkItemExecutionStartTime;
 	TimeSpan m_lastDptfGetStatusWorkItemCompletionTime;
 	TimeSpan m_lastDptfGetStatusWorkItemExecutionTime;
+
+	// Contains one row for each policy that has run a task.  Guarded by m_policyStatisticsMutex since the rows are
+	// updated from the policy executor threads.
+	std::map<UIntN, WorkItemTypeExecutionStatistics> m_policyStatistics;
+	EsifMutex m_policyStatisticsMutex;
+
+	std::shared_ptr<XmlNode> getPolicyStatisticsXml(void);
 };
@@ -309,13 +309,14 @@ void ActivePolicy::onActiveRelationshipTableChanged(void)
 	associateAllParticipantsInArt();
 
 	auto targetIndexes = m_art->getAllTargets();
+	auto temperatures = getParticipantTracker()->getFirstDomainTemperatures(targetIndexes);
 	for (auto target = targetIndexes.begin(); target != targetIndexes.end(); target++)
 	{
 		// TODO: This may force a fan speed to be set multiple times.
 		// Need to fix it such that all requests are collected and applied once
 		if (getParticipantTracker()->remembers(*target))
 		{
-			updateThresholdsAndCoolTargetParticipant(getParticipantTracker()->getParticipant(*target));
+			updateThresholdsAndCoolTargetParticipant(getParticipantTracker()->getParticipant(*target), temperatures);
 		}
 	}
 }
@@ -353,12 +354,47 @@ void ActivePolicy::updateThresholdsAndCoolTargetParticipant(ParticipantProxyInte
 		if (participant->getDomainPropertiesSet().getDomainCount() > 0)
 		{
 			auto currentTemperature = getCurrentTemperature(participant);
+			updateThresholdsAndCoolTargetParticipant(participant, currentTemperature);
+		}
+	}
+}
+
+void ActivePolicy::updateThresholdsAndCoolTargetParticipant(
+	ParticipantProxyInterface* participant,
+	const Temperature& currentTemperature)
+{
+	if (participant->getActiveTripPointProperty().supportsProperty())
+	{
+		if (participant->getDomainPropertiesSet().getDomainCount() > 0)
+		{
 			setTripPointNotificationForTarget(participant, currentTemperature);
 			requestFanSpeedChangesForTarget(participant, currentTemperature);
 		}
 	}
 }
 
+void ActivePolicy::updateThresholdsAndCoolTargetParticipant(
+	ParticipantProxyInterface* participant,
+	const std::map<UIntN, Temperature>& temperatures)
+{
+	// use the temperature read in the batch, and fall back to a single read if that failed
+	auto temperature = temperatures.find(participant->getIndex());
+	if ((temperature != temperatures.end()) && temperature->second.isValid())
+	{
+		POLICY_LOG_MESSAGE_DEBUG({
+			std::stringstream message;
+			message << "Considering actions based on temperature of " << temperature->second.toString();
+			message << " for participant " << std::to_string(participant->getIndex());
+			return message.str();
+		});
+		updateThresholdsAndCoolTargetParticipant(participant, temperature->second);
+	}
+	else
+	{
+		updateThresholdsAndCoolTargetParticipant(participant);
+	}
+}
+
 void ActivePolicy::requestFanSpeedChangesForTarget(
 	ParticipantProxyInterface* target,
 	const Temperature& currentTemperature)
@@ -477,13 +513,14 @@ void ActivePolicy::reloadArt()
 void ActivePolicy::takeCoolingActionsForAllParticipants()
 {
 	vector<UIntN> targets = m_art->getAllTargets();
+	auto temperatures = getParticipantTracker()->getFirstDomainTemperatures(targets);
 	for (auto target = targets.begin(); target != targets.end(); target++)
 	{
 		if (getParticipantTracker()->remembers(*target))
 		{
 			auto targetParticipant = getParticipantTracker()->getParticipant(*target);
 			targetParticipant->getActiveTripPointProperty().refresh();
-			updateThresholdsAndCoolTargetParticipant(targetParticipant);
+			updateThresholdsAndCoolTargetParticipant(targetParticipant, temperatures);
 		}
 	}
 }
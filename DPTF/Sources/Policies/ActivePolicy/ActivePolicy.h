@@ -64,6 +64,12 @@ private:
 	Temperature getCurrentTemperature(ParticipantProxyInterface* participant);
 	void updateTargetRequest(ParticipantProxyInterface* participant);
 	void updateThresholdsAndCoolTargetParticipant(ParticipantProxyInterface* participant);
+	void updateThresholdsAndCoolTargetParticipant(
+		ParticipantProxyInterface* participant,
+		const Temperature& currentTemperature);
+	void updateThresholdsAndCoolTargetParticipant(
+		ParticipantProxyInterface* participant,
+		const std::map<UIntN, Temperature>& temperatures);
 	void requestFanSpeedChangesForTarget(ParticipantProxyInterface* target, const Temperature& currentTemperature);
 	void requestFanSpeedChange(
 		std::shared_ptr<ActiveRelationshipTableEntry> entry,
@@ -186,15 +186,13 @@ void ActiveRelationshipTable::throwIfOutOfRange(IntN bytesRemaining)
 std::vector<std::shared_ptr<ActiveRelationshipTableEntry>> ActiveRelationshipTable::getEntriesForTarget(UIntN target)
 {
 	std::vector<std::shared_ptr<ActiveRelationshipTableEntry>> entries;
-	for (auto entry = m_entries.begin(); entry != m_entries.end(); ++entry)
+	const auto& rows = findTableRowsWithTargetIndex(target);
+	for (auto row = rows.begin(); row != rows.end(); ++row)
 	{
-		if ((*entry)->getTargetDeviceIndex() == target)
+		auto artEntry = std::dynamic_pointer_cast<ActiveRelationshipTableEntry>(m_entries.at(*row));
+		if (artEntry)
 		{
-			auto artEntry = std::dynamic_pointer_cast<ActiveRelationshipTableEntry>(*entry);
-			if (artEntry)
-			{
-				entries.push_back(artEntry);
-			}
+			entries.push_back(artEntry);
 		}
 	}
 	return entries;
@@ -203,15 +201,13 @@ std::vector<std::shared_ptr<ActiveRelationshipTableEntry>> ActiveRelationshipTab
 std::vector<std::shared_ptr<ActiveRelationshipTableEntry>> ActiveRelationshipTable::getEntriesForSource(UIntN source)
 {
 	std::vector<std::shared_ptr<ActiveRelationshipTableEntry>> entries;
-	for (auto entry = m_entries.begin(); entry != m_entries.end(); ++entry)
+	const auto& rows = findTableRowsWithSourceIndex(source);
+	for (auto row = rows.begin(); row != rows.end(); ++row)
 	{
-		if ((*entry)->getSourceDeviceIndex() == source)
+		auto artEntry = std::dynamic_pointer_cast<ActiveRelationshipTableEntry>(m_entries.at(*row));
+		if (artEntry)
 		{
-			auto artEntry = std::dynamic_pointer_cast<ActiveRelationshipTableEntry>(*entry);
-			if (artEntry)
-			{
-				entries.push_back(artEntry);
-			}
+			entries.push_back(artEntry);
 		}
 	}
 	return entries;
@@ -219,27 +215,13 @@ std::vector<std::shared_ptr<ActiveRelationshipTableEntry>> ActiveRelationshipTab
 
 std::vector<UIntN> ActiveRelationshipTable::getAllSources(void) const
 {
-	std::set<UIntN> sources;
-	for (UIntN row = 0; row < m_entries.size(); ++row)
-	{
-		if (m_entries[row]->getSourceDeviceIndex() != Constants::Invalid)
-		{
-			sources.insert(m_entries[row]->getSourceDeviceIndex());
-		}
-	}
+	const auto sources = getAllSourceIndexes();
 	return std::vector<UIntN>(sources.begin(), sources.end());
 }
 
 std::vector<UIntN> ActiveRelationshipTable::getAllTargets(void) const
 {
-	std::set<UIntN> targets;
-	for (UIntN row = 0; row < m_entries.size(); ++row)
-	{
-		if (m_entries[row]->getTargetDeviceIndex() != Constants::Invalid)
-		{
-			targets.insert(m_entries[row]->getTargetDeviceIndex());
-		}
-	}
+	const auto targets = getAllTargetIndexes();
 	return std::vector<UIntN>(targets.begin(), targets.end());
 }
 
@@ -432,7 +432,11 @@ void PassivePolicy::onPolicyInitiatedCallback(UInt64 eventCode, UInt64 param1, v
 
 void PassivePolicy::onOverrideTimeObject(const std::shared_ptr<TimeInterface>& timeObject)
 {
-	m_callbackScheduler->setTimeObject(timeObject);
+	// the scheduler does not exist until onCreate(), where it picks up the overridden time object
+	if (m_callbackScheduler != nullptr)
+	{
+		m_callbackScheduler->setTimeObject(timeObject);
+	}
 }
 
 void PassivePolicy::takeThermalActionForTarget(UIntN target)
@@ -666,10 +670,38 @@ void PassivePolicy::associateAllParticipantsInTrt(std::shared_ptr<ThermalRelatio
 
 void PassivePolicy::takePossibleThermalActionForAllTargets()
 {
+	vector<UIntN> targetIndexes;
 	vector<UIntN> allIndicies = getParticipantTracker()->getAllTrackedIndexes();
 	for (auto index = allIndicies.begin(); index != allIndicies.end(); ++index)
 	{
-		takePossibleThermalActionForTarget(*index);
+		try
+		{
+			if (participantIsTargetDevice(*index)
+				&& getParticipantTracker()->getParticipant(*index)->supportsTemperatureInterface())
+			{
+				targetIndexes.push_back(*index);
+			}
+		}
+		catch (...)
+		{
+			// the single target path below will log the failure
+			targetIndexes.push_back(*index);
+		}
+	}
+
+	// read all target temperatures in one batch, then fall back to a single read for any that failed
+	auto temperatures = getParticipantTracker()->getFirstDomainTemperatures(targetIndexes);
+	for (auto index = targetIndexes.begin(); index != targetIndexes.end(); ++index)
+	{
+		auto temperature = temperatures.find(*index);
+		if ((temperature != temperatures.end()) && temperature->second.isValid())
+		{
+			takePossibleThermalActionForTarget(*index, temperature->second);
+		}
+		else
+		{
+			takePossibleThermalActionForTarget(*index);
+		}
 	}
 }
 
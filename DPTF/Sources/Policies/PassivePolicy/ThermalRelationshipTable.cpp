@@ -25,6 +25,11 @@ ThermalRelationshipTable::ThermalRelationshipTable(
 	const std::vector<std::shared_ptr<RelationshipTableEntryBase>>& entries)
 	: RelationshipTableBase(entries)
 {
+	// The base class indexed the rows before this class could aggregate them
+	for (auto entry = m_entries.begin(); entry != m_entries.end(); ++entry)
+	{
+		onTargetRowsChanged((*entry)->getTargetDeviceIndex());
+	}
 }
 
 ThermalRelationshipTable::ThermalRelationshipTable()
@@ -111,15 +116,13 @@ std::vector<std::shared_ptr<ThermalRelationshipTableEntry>> ThermalRelationshipT
 	UIntN targetIndex)
 {
 	std::vector<std::shared_ptr<ThermalRelationshipTableEntry>> entries;
-	for (auto entry = m_entries.begin(); entry != m_entries.end(); ++entry)
+	const auto& rows = findTableRowsWithTargetIndex(targetIndex);
+	for (auto row = rows.begin(); row != rows.end(); ++row)
 	{
-		if ((*entry)->getTargetDeviceIndex() == targetIndex)
+		auto trtEntry = std::dynamic_pointer_cast<ThermalRelationshipTableEntry>(m_entries.at(*row));
+		if (trtEntry)
 		{
-			auto trtEntry = std::dynamic_pointer_cast<ThermalRelationshipTableEntry>(*entry);
-			if (trtEntry)
-			{
-				entries.push_back(trtEntry);
-			}
+			entries.push_back(trtEntry);
 		}
 	}
 	return entries;
@@ -130,12 +133,13 @@ TimeSpan ThermalRelationshipTable::getMinimumActiveSamplePeriodForSource(
 	std::set<UIntN> activeTargets)
 {
 	auto minimumSamplePeriod = TimeSpan::createInvalid();
-	for (auto entry = m_entries.begin(); entry != m_entries.end(); ++entry)
+	const auto& rows = findTableRowsWithSourceIndex(sourceIndex);
+	for (auto row = rows.begin(); row != rows.end(); ++row)
 	{
-		if (((*entry)->getSourceDeviceIndex() == sourceIndex)
-			&& (activeTargets.find((*entry)->getTargetDeviceIndex()) != activeTargets.end()))
+		const auto& entry = m_entries.at(*row);
+		if (activeTargets.find(entry->getTargetDeviceIndex()) != activeTargets.end())
 		{
-			auto trtEntry = std::dynamic_pointer_cast<ThermalRelationshipTableEntry>(*entry);
+			auto trtEntry = std::dynamic_pointer_cast<ThermalRelationshipTableEntry>(entry);
 			if (trtEntry)
 			{
 				auto samplingPeriod = trtEntry->thermalSamplingPeriod();
@@ -151,40 +155,57 @@ TimeSpan ThermalRelationshipTable::getMinimumActiveSamplePeriodForSource(
 
 TimeSpan ThermalRelationshipTable::getShortestSamplePeriodForTarget(UIntN target)
 {
-	auto shortestSamplePeriod = TimeSpan::createInvalid();
-	for (auto entry = m_entries.begin(); entry != m_entries.end(); ++entry)
+	const auto shortestSamplePeriod = m_shortestSamplePeriodByTarget.find(target);
+	if (shortestSamplePeriod == m_shortestSamplePeriodByTarget.end())
 	{
-		if ((*entry)->getTargetDeviceIndex() == target)
+		return TimeSpan::createInvalid();
+	}
+	return shortestSamplePeriod->second;
+}
+
+TimeSpan ThermalRelationshipTable::getSampleTimeForRelationship(UIntN target, UIntN source) const
+{
+	const auto& rows = findTableRowsWithTargetIndex(target);
+	for (auto row = rows.begin(); row != rows.end(); ++row)
+	{
+		const auto& entry = m_entries.at(*row);
+		if (entry->getSourceDeviceIndex() == source)
 		{
-			auto trtEntry = std::dynamic_pointer_cast<ThermalRelationshipTableEntry>(*entry);
+			auto trtEntry = std::dynamic_pointer_cast<ThermalRelationshipTableEntry>(entry);
 			if (trtEntry)
 			{
-				auto samplingPeriod = trtEntry->thermalSamplingPeriod();
-				if (shortestSamplePeriod.isInvalid() || samplingPeriod < shortestSamplePeriod)
-				{
-					shortestSamplePeriod = samplingPeriod;
-				}
+				return trtEntry->thermalSamplingPeriod();
 			}
 		}
 	}
-
-	return shortestSamplePeriod;
+	throw dptf_exception("No match found for target and source in TRT.");
 }
 
-TimeSpan ThermalRelationshipTable::getSampleTimeForRelationship(UIntN target, UIntN source) const
+void ThermalRelationshipTable::onTargetRowsChanged(UIntN targetIndex)
 {
-	for (auto entry = m_entries.begin(); entry != m_entries.end(); ++entry)
+	auto shortestSamplePeriod = TimeSpan::createInvalid();
+	const auto& rows = findTableRowsWithTargetIndex(targetIndex);
+	for (auto row = rows.begin(); row != rows.end(); ++row)
 	{
-		if (((*entry)->getTargetDeviceIndex() == target) && ((*entry)->getSourceDeviceIndex() == source))
+		auto trtEntry = std::dynamic_pointer_cast<ThermalRelationshipTableEntry>(m_entries.at(*row));
+		if (trtEntry)
 		{
-			auto trtEntry = std::dynamic_pointer_cast<ThermalRelationshipTableEntry>(*entry);
-			if (trtEntry)
+			auto samplingPeriod = trtEntry->thermalSamplingPeriod();
+			if (shortestSamplePeriod.isInvalid() || samplingPeriod < shortestSamplePeriod)
 			{
-				return trtEntry->thermalSamplingPeriod();
+				shortestSamplePeriod = samplingPeriod;
 			}
 		}
 	}
-	throw dptf_exception("No match found for target and source in TRT.");
+
+	if (shortestSamplePeriod.isInvalid())
+	{
+		m_shortestSamplePeriodByTarget.erase(targetIndex);
+	}
+	else
+	{
+		m_shortestSamplePeriodByTarget[targetIndex] = shortestSamplePeriod;
+	}
 }
 
 std::shared_ptr<XmlNode> ThermalRelationshipTable::getXml()
@@ -42,7 +42,12 @@ public:
 	Bool operator==(const ThermalRelationshipTable& trt) const;
 	Bool operator!=(const ThermalRelationshipTable& trt) const;
 
+protected:
+	void onTargetRowsChanged(UIntN targetIndex) override;
+
 private:
+	std::map<UIntN, TimeSpan> m_shortestSamplePeriodByTarget;
+
 	static UIntN countTrtRows(UInt32 size, UInt8* data);
 	static void throwIfOutOfRange(IntN bytesRemaining);
 };
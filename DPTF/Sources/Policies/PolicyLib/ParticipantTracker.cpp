@@ -18,6 +18,7 @@
 
 #include "ParticipantTracker.h"
 #include "DptfTime.h"
+#include "TemperatureStatus.h"
 using namespace std;
 
 ParticipantTracker::ParticipantTracker()
@@ -66,6 +67,55 @@ vector<UIntN> ParticipantTracker::getAllTrackedIndexes() const
 	return allTrackedItems;
 }
 
+map<UIntN, Temperature> ParticipantTracker::getFirstDomainTemperatures(const vector<UIntN>& participantIndexes)
+{
+	map<UIntN, Temperature> temperatures;
+	vector<DptfRequest> requests;
+	requests.reserve(participantIndexes.size());
+	for (const auto& participantIndex : participantIndexes)
+	{
+		temperatures[participantIndex] = Temperature::createInvalid();
+		if (remembers(participantIndex) == false)
+		{
+			continue;
+		}
+
+		auto participant = getParticipant(participantIndex);
+		for (const auto& domainIndex : participant->getDomainIndexes())
+		{
+			if (participant->getDomain(domainIndex)->getTemperatureControl()->supportsTemperatureControls())
+			{
+				requests.emplace_back(
+					DptfRequestType::TemperatureControlGetTemperatureStatus, participantIndex, domainIndex);
+				break;
+			}
+		}
+	}
+
+	if (requests.empty())
+	{
+		return temperatures;
+	}
+
+	auto results = m_policyServices.serviceRequest->submitRequests(requests);
+	for (const auto& result : results)
+	{
+		if (result.isSuccessful())
+		{
+			try
+			{
+				temperatures[result.getRequest().getParticipantIndex()] =
+					TemperatureStatus::createFromDptfBuffer(result.getData()).getCurrentTemperature();
+			}
+			catch (...)
+			{
+				// leave the temperature invalid so the caller can fall back to a single read
+			}
+		}
+	}
+	return temperatures;
+}
+
 void ParticipantTracker::setPolicyServices(const PolicyServicesInterfaceContainer& policyServices)
 {
 	m_policyServices = policyServices;
@@ -36,6 +36,7 @@ public:
 	void forget(UIntN participantIndex) override;
 	ParticipantProxyInterface* getParticipant(UIntN participantIndex) override;
 	std::vector<UIntN> getAllTrackedIndexes() const override;
+	std::map<UIntN, Temperature> getFirstDomainTemperatures(const std::vector<UIntN>& participantIndexes) override;
 	void setPolicyServices(const PolicyServicesInterfaceContainer& policyServices) override;
 	void setTimeServiceObject(std::shared_ptr<TimeInterface> time) override;
 	std::shared_ptr<XmlNode> getXmlForTripPointStatistics() override;
@@ -35,6 +35,10 @@ public:
 	virtual std::shared_ptr<DomainProxyInterface> findDomain(DomainType::Type domainType) = 0;
 	virtual std::vector<std::shared_ptr<DomainProxyInterface>> getAllDomains() = 0;
 	virtual std::vector<UIntN> getAllTrackedIndexes() const = 0;
+
+	// reads the first temperature domain of each participant with a single batched request.
+	// participants without a temperature domain, or whose read failed, map to an invalid temperature.
+	virtual std::map<UIntN, Temperature> getFirstDomainTemperatures(const std::vector<UIntN>& participantIndexes) = 0;
 	virtual void setPolicyServices(const PolicyServicesInterfaceContainer& policyServices) = 0;
 	virtual void setTimeServiceObject(std::shared_ptr<TimeInterface> time) = 0;
 	virtual std::shared_ptr<XmlNode> getXmlForTripPointStatistics() = 0;
@@ -313,7 +313,7 @@ public:
 	void thirdPartyGraphicsTPPLimitChanged(OsPowerSource::Type) final;
 
 	// allows overriding the default time object with a different one
-	void overrideTimeObject(const std::shared_ptr<TimeInterface>& timeObject);
+	void overrideTimeObject(const std::shared_ptr<TimeInterface>& timeObject) final;
 
 	// trip point statistics
 	std::shared_ptr<XmlNode> getXmlForTripPointStatistics(const std::set<UIntN>& targetIndexes) const;
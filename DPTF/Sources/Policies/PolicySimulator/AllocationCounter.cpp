@@ -0,0 +1,103 @@
+/******************************************************************************
+** Copyright (c) 2013-2023 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "AllocationCounter.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+using namespace std;
+
+static atomic<UInt64> g_allocationCount(0);
+static atomic<UInt64> g_allocatedBytes(0);
+
+static void* countedAllocate(size_t size)
+{
+	g_allocationCount.fetch_add(1, memory_order_relaxed);
+	g_allocatedBytes.fetch_add(size, memory_order_relaxed);
+	return malloc(size == 0 ? 1 : size);
+}
+
+UInt64 AllocationCounter::getAllocationCount(void)
+{
+	return g_allocationCount.load(memory_order_relaxed);
+}
+
+UInt64 AllocationCounter::getAllocatedBytes(void)
+{
+	return g_allocatedBytes.load(memory_order_relaxed);
+}
+
+void* operator new(size_t size)
+{
+	void* memory = countedAllocate(size);
+	if (memory == nullptr)
+	{
+		throw bad_alloc();
+	}
+	return memory;
+}
+
+void* operator new[](size_t size)
+{
+	void* memory = countedAllocate(size);
+	if (memory == nullptr)
+	{
+		throw bad_alloc();
+	}
+	return memory;
+}
+
+void* operator new(size_t size, const nothrow_t&) noexcept
+{
+	return countedAllocate(size);
+}
+
+void* operator new[](size_t size, const nothrow_t&) noexcept
+{
+	return countedAllocate(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+	free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+	free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept
+{
+	free(memory);
+}
+
+void operator delete[](void* memory, size_t) noexcept
+{
+	free(memory);
+}
+
+void operator delete(void* memory, const nothrow_t&) noexcept
+{
+	free(memory);
+}
+
+void operator delete[](void* memory, const nothrow_t&) noexcept
+{
+	free(memory);
+}
@@ -0,0 +1,31 @@
+/******************************************************************************
+** Copyright (c) 2013-2023 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+
+// counts every call to the global operator new in the process.  the simulator replaces operator new, and
+// since the policy module is loaded into the simulator's process, allocations made by the policy are counted
+// as well.
+class AllocationCounter
+{
+public:
+	static UInt64 getAllocationCount(void);
+	static UInt64 getAllocatedBytes(void);
+};
@@ -0,0 +1,326 @@
+/******************************************************************************
+** Copyright (c) 2013-2023 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "PolicySimulator.h"
+#include "AllocationCounter.h"
+#include <chrono>
+#include <iomanip>
+using namespace std;
+
+static const string PolicyName = "Simulated";
+
+PolicySimulator::PolicySimulator(const PolicySimulatorSettings& settings)
+	: m_settings(settings)
+	, m_platform(settings.sensorCount)
+	, m_time(make_shared<SimulatedTime>())
+	, m_statistics(settings.echoDecisions)
+	, m_services(m_platform, *m_time, m_statistics)
+	, m_trace(createTrace(settings, m_platform))
+	, m_nextTraceEntry(0)
+	, m_peakTemperatures(m_platform.getParticipantCount(), Temperature::createInvalid())
+	, m_wallTimeInNanoseconds(0)
+	, m_policyLibrary(settings.policyFileName)
+	, m_policy(nullptr)
+	, m_destroyPolicyInstance(nullptr)
+{
+	if ((settings.stepSize.asMillisecondsInt() <= 0) || (settings.duration.asMillisecondsInt() <= 0))
+	{
+		throw dptf_exception("The simulation step size and duration must be positive.");
+	}
+}
+
+PolicySimulator::~PolicySimulator()
+{
+	unloadPolicy();
+}
+
+void PolicySimulator::run()
+{
+	const auto wallClockStart = chrono::steady_clock::now();
+	loadPolicy();
+
+	// inputs at time zero are applied before the policy first looks at the platform
+	applyTraceEntriesDueBy(m_time->getCurrentTime());
+	for (UIntN participantIndex = 0; participantIndex < m_platform.getParticipantCount(); participantIndex++)
+	{
+		dispatch("bindParticipant", [=]() { m_policy->bindParticipant(participantIndex); });
+		dispatch("bindDomain", [=]() { m_policy->bindDomain(participantIndex, 0); });
+	}
+
+	TimeSpan now = m_time->getCurrentTime();
+	while (now < m_settings.duration)
+	{
+		const TimeSpan stepEnd = now + m_settings.stepSize;
+		dispatchCallbacksDueBy(stepEnd);
+		m_time->advanceTo(stepEnd);
+		m_platform.advance(m_settings.stepSize);
+		applyTraceEntriesDueBy(stepEnd);
+		deliverThresholdCrossings();
+		recordPeakTemperatures();
+		now = stepEnd;
+	}
+
+	unloadPolicy();
+	m_wallTimeInNanoseconds =
+		chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - wallClockStart).count();
+}
+
+string PolicySimulator::getReport() const
+{
+	const UInt64 policyTime = m_statistics.getPolicyTimeInNanoseconds();
+	const UInt64 decisionCount = m_statistics.getDecisionCount();
+
+	stringstream report;
+	report << "Policy:              " << m_settings.policyFileName << endl;
+	report << "Participants:        " << m_platform.getParticipantCount() << endl;
+	report << fixed << setprecision(1);
+	report << "Simulated time:      " << m_time->getCurrentTime().asSeconds() << " s" << endl;
+	report << "Wall time:           " << m_wallTimeInNanoseconds / 1.0e6 << " ms" << endl;
+	report << "Time in policy:      " << policyTime / 1.0e6 << " ms over " << m_statistics.getCallCount()
+		   << " calls" << endl;
+	report << "Decisions:           " << decisionCount << endl;
+	report << m_statistics.getDecisionReport();
+	if (policyTime > 0)
+	{
+		report << "Decisions/policy s:  " << decisionCount / (policyTime / 1.0e9) << endl;
+	}
+	report << "Decision digest:     " << hex << setw(16) << setfill('0') << m_statistics.getDecisionDigest() << dec
+		   << setfill(' ') << endl;
+	report << endl << m_statistics.getCallReport();
+
+	report << endl << "Peak temperatures:" << endl;
+	for (UIntN participantIndex = 0; participantIndex < m_platform.getParticipantCount(); participantIndex++)
+	{
+		if (m_peakTemperatures[participantIndex].isValid())
+		{
+			report << "  " << left << setw(8) << m_platform.getParticipant(participantIndex).name << right
+				   << m_peakTemperatures[participantIndex].toString() << " C" << endl;
+		}
+	}
+
+	const auto unsimulatedServices = m_statistics.getUnsimulatedServiceReport();
+	if (unsimulatedServices.empty() == false)
+	{
+		report << endl << "Services requested by the policy that are not simulated:" << endl << unsimulatedServices;
+	}
+	return report.str();
+}
+
+void PolicySimulator::loadPolicy()
+{
+	m_policyLibrary.load();
+	auto createPolicyInstance =
+		(CreatePolicyInstanceFuncPtr)m_policyLibrary.getFunctionPtr("CreatePolicyInstance");
+	m_destroyPolicyInstance =
+		(DestroyPolicyInstanceFuncPtr)m_policyLibrary.getFunctionPtr("DestroyPolicyInstance");
+
+	m_policy = createPolicyInstance();
+	if (m_policy == nullptr)
+	{
+		throw dptf_exception("Policy " + m_settings.policyFileName + " failed to create an instance.");
+	}
+
+	// the clock has to be in place before create(), where policies set up their schedulers
+	m_policy->overrideTimeObject(m_time);
+	auto interfaces = m_services.getInterfaces();
+	dispatch("create", [&]() { m_policy->create(true, interfaces, 0, Constants::EmptyString, PolicyName); });
+}
+
+void PolicySimulator::unloadPolicy()
+{
+	if (m_policy != nullptr)
+	{
+		dispatch("destroy", [&]() { m_policy->destroy(); });
+		m_destroyPolicyInstance(m_policy);
+		m_policy = nullptr;
+		m_destroyPolicyInstance = nullptr;
+	}
+	m_policyLibrary.unload();
+}
+
+void PolicySimulator::dispatchCallbacksDueBy(const TimeSpan& time)
+{
+	SimulatedPolicyCallback callback;
+	while (m_services.takeNextCallbackDueBy(time, callback))
+	{
+		if (callback.dueTime > m_time->getCurrentTime())
+		{
+			m_time->advanceTo(callback.dueTime);
+		}
+		dispatchIfRegistered(PolicyEvent::PolicyInitiatedCallback, [&]() {
+			m_policy->policyInitiatedCallback(callback.policyDefinedEventCode, callback.param1, callback.param2);
+		});
+	}
+}
+
+void PolicySimulator::applyTraceEntriesDueBy(const TimeSpan& time)
+{
+	const auto& entries = m_trace.getEntries();
+	while ((m_nextTraceEntry < entries.size()) && (entries[m_nextTraceEntry].time <= time))
+	{
+		const auto& entry = entries[m_nextTraceEntry++];
+		switch (entry.type)
+		{
+		case SimulationTraceEntryType::Temperature:
+			m_platform.setRecordedTemperature(
+				m_platform.findParticipantIndex(entry.participantName), Temperature::fromCelsius(entry.value));
+			break;
+		case SimulationTraceEntryType::Power:
+			if (m_platform.findParticipantIndex(entry.participantName) != m_platform.getProcessorIndex())
+			{
+				throw dptf_exception("Power can only be demanded from the processor participant.");
+			}
+			m_platform.setPowerDemand(Power::createFromWatts(entry.value));
+			break;
+		case SimulationTraceEntryType::Event:
+			applyEvent(entry);
+			break;
+		default:
+			throw dptf_exception("Unknown simulation trace entry type.");
+		}
+	}
+}
+
+void PolicySimulator::applyEvent(const SimulationTraceEntry& entry)
+{
+	const auto& name = entry.eventName;
+	if (name == "thresholdcrossed")
+	{
+		const auto participantIndex = m_platform.findParticipantIndex(entry.participantName);
+		dispatchIfRegistered(PolicyEvent::DomainTemperatureThresholdCrossed, [=]() {
+			m_policy->domainTemperatureThresholdCrossed(participantIndex);
+		});
+	}
+	else if (name == "specificinfochanged")
+	{
+		const auto participantIndex = m_platform.findParticipantIndex(entry.participantName);
+		dispatchIfRegistered(PolicyEvent::ParticipantSpecificInfoChanged, [=]() {
+			m_policy->participantSpecificInfoChanged(participantIndex);
+		});
+	}
+	else if (name == "performancecapabilitychanged")
+	{
+		const auto participantIndex = m_platform.findParticipantIndex(entry.participantName);
+		dispatchIfRegistered(PolicyEvent::DomainPerformanceControlCapabilityChanged, [=]() {
+			m_policy->domainPerformanceControlCapabilityChanged(participantIndex);
+		});
+	}
+	else if (name == "fancapabilitychanged")
+	{
+		const auto participantIndex = m_platform.findParticipantIndex(entry.participantName);
+		dispatchIfRegistered(PolicyEvent::DomainFanCapabilityChanged, [=]() {
+			m_policy->domainFanCapabilityChanged(participantIndex);
+		});
+	}
+	else if (name == "trtchanged")
+	{
+		dispatchIfRegistered(PolicyEvent::PolicyThermalRelationshipTableChanged, [=]() {
+			m_policy->thermalRelationshipTableChanged();
+		});
+	}
+	else if (name == "artchanged")
+	{
+		dispatchIfRegistered(PolicyEvent::PolicyActiveRelationshipTableChanged, [=]() {
+			m_policy->activeRelationshipTableChanged();
+		});
+	}
+	else if (name == "suspend")
+	{
+		dispatchIfRegistered(PolicyEvent::DptfSuspend, [=]() { m_policy->suspend(); });
+	}
+	else if (name == "resume")
+	{
+		dispatchIfRegistered(PolicyEvent::DptfResume, [=]() { m_policy->resume(); });
+	}
+	else if (name == "connectedstandbyentry")
+	{
+		dispatchIfRegistered(PolicyEvent::DptfConnectedStandbyEntry, [=]() { m_policy->connectedStandbyEntry(); });
+	}
+	else if (name == "connectedstandbyexit")
+	{
+		dispatchIfRegistered(PolicyEvent::DptfConnectedStandbyExit, [=]() { m_policy->connectedStandbyExit(); });
+	}
+	else
+	{
+		throw dptf_exception("The simulator cannot deliver event \"" + name + "\".");
+	}
+}
+
+void PolicySimulator::deliverThresholdCrossings()
+{
+	for (auto participantIndex : m_platform.takeParticipantsOutsideThresholds())
+	{
+		dispatchIfRegistered(PolicyEvent::DomainTemperatureThresholdCrossed, [=]() {
+			m_policy->domainTemperatureThresholdCrossed(participantIndex);
+		});
+	}
+}
+
+void PolicySimulator::recordPeakTemperatures()
+{
+	for (UIntN participantIndex = 0; participantIndex < m_platform.getParticipantCount(); participantIndex++)
+	{
+		if (m_platform.getParticipant(participantIndex).functionality.temperatureVersion != 0)
+		{
+			const auto temperature = m_platform.getTemperature(participantIndex);
+			auto& peak = m_peakTemperatures[participantIndex];
+			if ((peak.isValid() == false) || (temperature > peak))
+			{
+				peak = temperature;
+			}
+		}
+	}
+}
+
+void PolicySimulator::dispatch(const string& callName, const function<void()>& call)
+{
+	const UInt64 allocationsBefore = AllocationCounter::getAllocationCount();
+	const auto start = chrono::steady_clock::now();
+	Bool failed = false;
+	try
+	{
+		call();
+	}
+	catch (...)
+	{
+		failed = true;
+	}
+	const auto latency = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count();
+	const UInt64 allocations = AllocationCounter::getAllocationCount() - allocationsBefore;
+	m_statistics.recordCall(callName, latency, allocations, failed);
+}
+
+void PolicySimulator::dispatchIfRegistered(PolicyEvent::Type policyEvent, const function<void()>& call)
+{
+	if (m_services.isEventRegistered(policyEvent))
+	{
+		dispatch(PolicyEvent::toString(policyEvent), call);
+	}
+}
+
+SimulationTrace PolicySimulator::createTrace(
+	const PolicySimulatorSettings& settings,
+	const SimulatedPlatform& platform)
+{
+	if (settings.traceFileName.empty())
+	{
+		return SimulationTrace::createSyntheticWorkload(
+			platform.getParticipant(platform.getProcessorIndex()).name, settings.duration, settings.seed);
+	}
+	return SimulationTrace::createFromFile(settings.traceFileName);
+}
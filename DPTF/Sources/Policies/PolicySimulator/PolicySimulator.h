@@ -0,0 +1,83 @@
+/******************************************************************************
+** Copyright (c) 2013-2023 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include "PolicyInterface.h"
+#include "EsifLibrary.h"
+#include "SimulatedPlatform.h"
+#include "SimulatedPolicyServices.h"
+#include "SimulatedTime.h"
+#include "SimulationStatistics.h"
+#include "SimulationTrace.h"
+#include <functional>
+
+struct PolicySimulatorSettings
+{
+	std::string policyFileName;
+	UIntN sensorCount;
+	TimeSpan duration;
+	TimeSpan stepSize;
+	std::string traceFileName; // empty for a synthetic workload generated from the seed
+	UInt32 seed;
+	Bool echoDecisions;
+};
+
+// Loads a policy module and drives it against a simulated platform on simulated time, so that a policy's
+// decisions and the cost of making them can be measured without hardware and repeated exactly.  Time only
+// moves when the simulator moves it: the thermal model advances in fixed steps and policy callbacks fire at
+// their due times, so a run over a given trace is deterministic regardless of how fast the host is.
+class PolicySimulator
+{
+public:
+	PolicySimulator(const PolicySimulatorSettings& settings);
+	~PolicySimulator();
+
+	void run();
+	std::string getReport() const;
+
+private:
+	PolicySimulator(const PolicySimulator& rhs);
+	PolicySimulator& operator=(const PolicySimulator& rhs);
+
+	PolicySimulatorSettings m_settings;
+	SimulatedPlatform m_platform;
+	std::shared_ptr<SimulatedTime> m_time;
+	SimulationStatistics m_statistics;
+	SimulatedPolicyServices m_services;
+	SimulationTrace m_trace;
+	size_t m_nextTraceEntry;
+	std::vector<Temperature> m_peakTemperatures;
+	UInt64 m_wallTimeInNanoseconds;
+
+	EsifLibrary m_policyLibrary;
+	PolicyInterface* m_policy;
+	DestroyPolicyInstanceFuncPtr m_destroyPolicyInstance;
+
+	void loadPolicy();
+	void unloadPolicy();
+	void dispatchCallbacksDueBy(const TimeSpan& time);
+	void applyTraceEntriesDueBy(const TimeSpan& time);
+	void applyEvent(const SimulationTraceEntry& entry);
+	void deliverThresholdCrossings();
+	void recordPeakTemperatures();
+	void dispatch(const std::string& callName, const std::function<void()>& call);
+	void dispatchIfRegistered(PolicyEvent::Type policyEvent, const std::function<void()>& call);
+	static SimulationTrace createTrace(const PolicySimulatorSettings& settings, const SimulatedPlatform& platform);
+};
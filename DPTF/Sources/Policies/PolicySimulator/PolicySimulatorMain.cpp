@@ -0,0 +1,123 @@
+/******************************************************************************
+** Copyright (c) 2013-2023 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "PolicySimulator.h"
+#include "StringConverter.h"
+#include <iostream>
+using namespace std;
+
+static const UIntN DefaultSensorCount = 4;
+static const Int64 DefaultDurationInSeconds = 3600;
+static const Int64 DefaultStepSizeInMilliseconds = 100;
+static const UInt32 DefaultSeed = 1;
+
+static void printUsage(const char* programName)
+{
+	cerr << "Usage: " << programName << " <policy library> [options]" << endl
+		 << "  -n <count>     number of temperature sensor participants (default " << DefaultSensorCount << ")" << endl
+		 << "  -d <seconds>   simulated duration (default " << DefaultDurationInSeconds << ")" << endl
+		 << "  -s <ms>        thermal model step size (default " << DefaultStepSizeInMilliseconds << ")" << endl
+		 << "  -t <file>      replay a recorded trace instead of a synthetic workload" << endl
+		 << "  -r <seed>      seed for the synthetic workload (default " << DefaultSeed << ")" << endl
+		 << "  -v             print every decision the policy makes" << endl;
+}
+
+static PolicySimulatorSettings parseArguments(int argc, char* argv[])
+{
+	if (argc < 2)
+	{
+		throw dptf_exception("No policy library given.");
+	}
+
+	PolicySimulatorSettings settings;
+	settings.policyFileName = argv[1];
+	settings.sensorCount = DefaultSensorCount;
+	settings.duration = TimeSpan::createFromSeconds(DefaultDurationInSeconds);
+	settings.stepSize = TimeSpan::createFromMilliseconds(DefaultStepSizeInMilliseconds);
+	settings.seed = DefaultSeed;
+	settings.echoDecisions = false;
+
+	for (int argument = 2; argument < argc; argument++)
+	{
+		const string option = argv[argument];
+		if (option == "-v")
+		{
+			settings.echoDecisions = true;
+			continue;
+		}
+		if (argument + 1 >= argc)
+		{
+			throw dptf_exception("Option " + option + " needs a value.");
+		}
+
+		const string value = argv[++argument];
+		if (option == "-n")
+		{
+			settings.sensorCount = StringConverter::toUInt32(value);
+		}
+		else if (option == "-d")
+		{
+			settings.duration = TimeSpan::createFromSeconds((Int64)StringConverter::toUInt64(value));
+		}
+		else if (option == "-s")
+		{
+			settings.stepSize = TimeSpan::createFromMilliseconds((Int64)StringConverter::toUInt64(value));
+		}
+		else if (option == "-t")
+		{
+			settings.traceFileName = value;
+		}
+		else if (option == "-r")
+		{
+			settings.seed = StringConverter::toUInt32(value);
+		}
+		else
+		{
+			throw dptf_exception("Unknown option " + option + ".");
+		}
+	}
+	return settings;
+}
+
+int main(int argc, char* argv[])
+{
+	PolicySimulatorSettings settings;
+	try
+	{
+		settings = parseArguments(argc, argv);
+	}
+	catch (const dptf_exception& ex)
+	{
+		cerr << ex.getDescription() << endl;
+		printUsage(argv[0]);
+		return 2;
+	}
+
+	try
+	{
+		PolicySimulator simulator(settings);
+		simulator.run();
+		cout << simulator.getReport();
+	}
+	catch (const dptf_exception& ex)
+	{
+		cerr << "Simulation failed: " << ex.getDescription() << endl;
+		return 1;
+	}
+	return 0;
+}
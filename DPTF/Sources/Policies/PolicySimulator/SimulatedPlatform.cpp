@@ -0,0 +1,426 @@
+/******************************************************************************
+** Copyright (c) 2013-2023 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "SimulatedPlatform.h"
+#include "ThermalRelationshipTable.h"
+#include "ActiveRelationshipTable.h"
+#include <cmath>
+using namespace std;
+
+static const double AmbientTemperatureInCelsius = 35.0;
+// hysteresis is carried as a temperature offset from 0 C, the way participants report it
+static const double HysteresisInCelsius = 2.0;
+
+static const UIntN PerformanceStateCount = 16;
+static const UInt32 MaxPerformanceStatePowerInMilliwatts = 45000;
+static const UInt32 MinPerformanceStatePowerInMilliwatts = 6000;
+static const UInt32 MaxPerformanceStateFrequencyInMhz = 4000;
+static const UInt32 MinPerformanceStateFrequencyInMhz = 800;
+
+static const UIntN FanSpeedStepPercent = 10;
+static const UIntN FanStepSizePercent = 2;
+
+static const UInt32 ProcessorThermalInfluence = 100;
+static const UInt32 SensorThermalInfluence = 50;
+static const Int64 ProcessorSamplePeriodInTenthSeconds = 10;
+static const Int64 SensorSamplePeriodInTenthSeconds = 20;
+static const UInt32 ActiveRelationshipWeight = 100;
+static const vector<UInt32> FanSpeedsForActiveTripPoints = {100, 75, 50, 30};
+
+static PerformanceControlSet createPerformanceControlSet()
+{
+	vector<PerformanceControl> performanceStates;
+	for (UIntN state = 0; state < PerformanceStateCount; state++)
+	{
+		const double fractionOfMax = 1.0 - ((double)state / (PerformanceStateCount - 1));
+		const UInt32 power = MinPerformanceStatePowerInMilliwatts
+			+ (UInt32)(fractionOfMax * (MaxPerformanceStatePowerInMilliwatts - MinPerformanceStatePowerInMilliwatts));
+		const UInt32 frequency = MinPerformanceStateFrequencyInMhz
+			+ (UInt32)(fractionOfMax * (MaxPerformanceStateFrequencyInMhz - MinPerformanceStateFrequencyInMhz));
+		performanceStates.push_back(PerformanceControl(
+			state,
+			PerformanceControlType::PerformanceState,
+			power,
+			Percentage((double)frequency / MaxPerformanceStateFrequencyInMhz),
+			10,
+			frequency,
+			"MHz"));
+	}
+	return PerformanceControlSet(performanceStates);
+}
+
+static ActiveControlSet createActiveControlSet()
+{
+	vector<ActiveControl> fanSpeeds;
+	for (UIntN speed = 0; speed <= 100; speed += FanSpeedStepPercent)
+	{
+		fanSpeeds.push_back(ActiveControl(speed / FanSpeedStepPercent, Constants::Invalid, speed, 0, 0));
+	}
+	return ActiveControlSet(fanSpeeds);
+}
+
+SimulatedPlatform::SimulatedPlatform(UIntN sensorCount)
+	: m_processorIndex(Constants::Invalid)
+	, m_fanIndex(Constants::Invalid)
+	, m_powerDemand(Power::createFromWatts(0.0))
+	, m_performanceControlSet(createPerformanceControlSet())
+	, m_performanceControlDynamicCaps(PerformanceStateCount - 1, 0)
+	, m_performanceControlIndex(0)
+	, m_activeControlSet(createActiveControlSet())
+	, m_activeControlDynamicCaps(Percentage::fromWholeNumber(0), Percentage::fromWholeNumber(100))
+	, m_fanSpeed(Percentage::fromWholeNumber(0))
+{
+	addProcessor();
+	for (UIntN sensorNumber = 0; sensorNumber < sensorCount; sensorNumber++)
+	{
+		addSensor(sensorNumber);
+	}
+	addFan();
+}
+
+UIntN SimulatedPlatform::getParticipantCount() const
+{
+	return (UIntN)m_participants.size();
+}
+
+UIntN SimulatedPlatform::getProcessorIndex() const
+{
+	return m_processorIndex;
+}
+
+UIntN SimulatedPlatform::getFanIndex() const
+{
+	return m_fanIndex;
+}
+
+UIntN SimulatedPlatform::findParticipantIndex(const string& name) const
+{
+	for (UIntN participantIndex = 0; participantIndex < m_participants.size(); participantIndex++)
+	{
+		if (m_participants[participantIndex].name == name)
+		{
+			return participantIndex;
+		}
+	}
+	throw dptf_exception("There is no simulated participant named " + name + ".");
+}
+
+const SimulatedParticipant& SimulatedPlatform::getParticipant(UIntN participantIndex) const
+{
+	throwIfInvalidParticipantIndex(participantIndex);
+	return m_participants[participantIndex];
+}
+
+SimulatedParticipant& SimulatedPlatform::getParticipant(UIntN participantIndex)
+{
+	throwIfInvalidParticipantIndex(participantIndex);
+	return m_participants[participantIndex];
+}
+
+ParticipantProperties SimulatedPlatform::getParticipantProperties(UIntN participantIndex) const
+{
+	const auto& participant = getParticipant(participantIndex);
+	return ParticipantProperties(
+		Guid(),
+		participant.name,
+		"Simulated " + participant.name,
+		BusType::Acpi,
+		PciInfo(),
+		AcpiInfo(participant.name, participant.acpiScope, Constants::EmptyString, 0));
+}
+
+DomainPropertiesSet SimulatedPlatform::getDomainPropertiesSet(UIntN participantIndex) const
+{
+	const auto& participant = getParticipant(participantIndex);
+	return DomainPropertiesSet(DomainProperties(
+		Guid(), 0, true, participant.domainType, "D0", "Simulated domain", participant.functionality));
+}
+
+DptfBuffer SimulatedPlatform::getThermalRelationshipTable() const
+{
+	const auto& processor = getParticipant(m_processorIndex);
+	vector<shared_ptr<RelationshipTableEntryBase>> entries;
+	for (const auto& participant : m_participants)
+	{
+		if (participant.specificInfo.count(ParticipantSpecificInfoKey::PSV) > 0)
+		{
+			const Bool isProcessor = (participant.name == processor.name);
+			entries.push_back(make_shared<ThermalRelationshipTableEntry>(
+				processor.acpiScope,
+				participant.acpiScope,
+				isProcessor ? ProcessorThermalInfluence : SensorThermalInfluence,
+				TimeSpan::createFromTenthSeconds(
+					isProcessor ? ProcessorSamplePeriodInTenthSeconds : SensorSamplePeriodInTenthSeconds)));
+		}
+	}
+	return ThermalRelationshipTable(entries).toTrtBinary();
+}
+
+DptfBuffer SimulatedPlatform::getActiveRelationshipTable() const
+{
+	const auto& fan = getParticipant(m_fanIndex);
+	vector<shared_ptr<RelationshipTableEntryBase>> entries;
+	for (const auto& participant : m_participants)
+	{
+		if (participant.specificInfo.count(ParticipantSpecificInfoKey::AC0) > 0)
+		{
+			vector<UInt32> fanSpeeds(10, Constants::Invalid);
+			copy(FanSpeedsForActiveTripPoints.begin(), FanSpeedsForActiveTripPoints.end(), fanSpeeds.begin());
+			entries.push_back(make_shared<ActiveRelationshipTableEntry>(
+				fan.acpiScope, participant.acpiScope, ActiveRelationshipWeight, fanSpeeds));
+		}
+	}
+	return ActiveRelationshipTable(entries).toArtBinary();
+}
+
+void SimulatedPlatform::setPowerDemand(const Power& powerDemand)
+{
+	m_powerDemand = powerDemand;
+}
+
+Power SimulatedPlatform::getPowerConsumption() const
+{
+	const auto& performanceState = m_performanceControlSet[m_performanceControlIndex];
+	const auto powerLimit = Power::createFromMilliwatts(performanceState.getTdpPower());
+	return (m_powerDemand < powerLimit) ? m_powerDemand : powerLimit;
+}
+
+Percentage SimulatedPlatform::getUtilization() const
+{
+	const double utilization = m_powerDemand.asMilliwatts() / MaxPerformanceStatePowerInMilliwatts;
+	return Percentage(utilization > 1.0 ? 1.0 : utilization);
+}
+
+void SimulatedPlatform::setRecordedTemperature(UIntN participantIndex, const Temperature& temperature)
+{
+	auto& participant = getParticipant(participantIndex);
+	participant.temperatureInCelsius = temperature.getTemperatureInCelsius();
+	participant.hasRecordedTemperature = true;
+}
+
+Temperature SimulatedPlatform::getTemperature(UIntN participantIndex) const
+{
+	return Temperature::fromCelsius(getParticipant(participantIndex).temperatureInCelsius);
+}
+
+void SimulatedPlatform::advance(const TimeSpan& elapsed)
+{
+	const double power = getPowerConsumption().asWatts();
+	const double fanFraction = m_fanSpeed.toWholeNumber() / 100.0;
+	for (auto& participant : m_participants)
+	{
+		if ((participant.timeConstantInSeconds > 0.0) && (participant.hasRecordedTemperature == false))
+		{
+			const double settlingTemperature = AmbientTemperatureInCelsius + (power * participant.thermalResistance)
+											   - (fanFraction * participant.fanCooling);
+			const double settledFraction = 1.0 - exp(-elapsed.asSeconds() / participant.timeConstantInSeconds);
+			participant.temperatureInCelsius += (settlingTemperature - participant.temperatureInCelsius) * settledFraction;
+		}
+	}
+}
+
+vector<UIntN> SimulatedPlatform::takeParticipantsOutsideThresholds()
+{
+	vector<UIntN> participantIndexes;
+	for (UIntN participantIndex = 0; participantIndex < m_participants.size(); participantIndex++)
+	{
+		auto& participant = m_participants[participantIndex];
+		if (participant.functionality.temperatureThresholdVersion == 0)
+		{
+			continue;
+		}
+
+		if (isOutsideThresholds(getTemperature(participantIndex), participant.thresholds))
+		{
+			if (participant.thresholdsCrossingSignaled == false)
+			{
+				participant.thresholdsCrossingSignaled = true;
+				participantIndexes.push_back(participantIndex);
+			}
+		}
+		else
+		{
+			participant.thresholdsCrossingSignaled = false;
+		}
+	}
+	return participantIndexes;
+}
+
+TemperatureThresholds SimulatedPlatform::getTemperatureThresholds(UIntN participantIndex) const
+{
+	return getParticipant(participantIndex).thresholds;
+}
+
+void SimulatedPlatform::setTemperatureThresholds(UIntN participantIndex, const TemperatureThresholds& thresholds)
+{
+	auto& participant = getParticipant(participantIndex);
+	participant.thresholds = TemperatureThresholds(
+		thresholds.getAux0(), thresholds.getAux1(), participant.thresholds.getHysteresis());
+	participant.thresholdsCrossingSignaled = false;
+}
+
+const PerformanceControlSet& SimulatedPlatform::getPerformanceControlSet() const
+{
+	return m_performanceControlSet;
+}
+
+PerformanceControlDynamicCaps SimulatedPlatform::getPerformanceControlDynamicCaps() const
+{
+	return m_performanceControlDynamicCaps;
+}
+
+void SimulatedPlatform::setPerformanceControlDynamicCaps(const PerformanceControlDynamicCaps& capabilities)
+{
+	m_performanceControlDynamicCaps = capabilities;
+}
+
+UIntN SimulatedPlatform::getPerformanceControlIndex() const
+{
+	return m_performanceControlIndex;
+}
+
+void SimulatedPlatform::setPerformanceControlIndex(UIntN performanceControlIndex)
+{
+	if (performanceControlIndex >= m_performanceControlSet.getCount())
+	{
+		throw dptf_exception("Performance control index is out of range.");
+	}
+	m_performanceControlIndex = performanceControlIndex;
+}
+
+const ActiveControlSet& SimulatedPlatform::getActiveControlSet() const
+{
+	return m_activeControlSet;
+}
+
+ActiveControlStaticCaps SimulatedPlatform::getActiveControlStaticCaps() const
+{
+	return ActiveControlStaticCaps(true, false, FanStepSizePercent);
+}
+
+ActiveControlDynamicCaps SimulatedPlatform::getActiveControlDynamicCaps() const
+{
+	return m_activeControlDynamicCaps;
+}
+
+void SimulatedPlatform::setActiveControlDynamicCaps(const ActiveControlDynamicCaps& capabilities)
+{
+	m_activeControlDynamicCaps = capabilities;
+}
+
+Percentage SimulatedPlatform::getFanSpeed() const
+{
+	return m_fanSpeed;
+}
+
+void SimulatedPlatform::setFanSpeed(const Percentage& fanSpeed)
+{
+	m_fanSpeed = fanSpeed;
+}
+
+void SimulatedPlatform::addProcessor()
+{
+	SimulatedParticipant processor;
+	processor.name = "TCPU";
+	processor.acpiScope = "\\_SB_.TCPU";
+	processor.domainType = DomainType::Processor;
+	processor.functionality.temperatureVersion = 1;
+	processor.functionality.temperatureThresholdVersion = 1;
+	processor.functionality.performanceControlVersion = 1;
+	processor.functionality.powerStatusVersion = 1;
+	processor.functionality.utilizationVersion = 1;
+	processor.functionality.domainPriorityVersion = 1;
+	processor.specificInfo[ParticipantSpecificInfoKey::PSV] = Temperature::fromCelsius(85.0);
+	processor.specificInfo[ParticipantSpecificInfoKey::AC0] = Temperature::fromCelsius(80.0);
+	processor.specificInfo[ParticipantSpecificInfoKey::AC1] = Temperature::fromCelsius(70.0);
+	processor.specificInfo[ParticipantSpecificInfoKey::AC2] = Temperature::fromCelsius(60.0);
+	processor.specificInfo[ParticipantSpecificInfoKey::AC3] = Temperature::fromCelsius(50.0);
+	processor.specificInfo[ParticipantSpecificInfoKey::Hot] = Temperature::fromCelsius(100.0);
+	processor.specificInfo[ParticipantSpecificInfoKey::Critical] = Temperature::fromCelsius(105.0);
+	processor.thermalResistance = 1.6;
+	processor.fanCooling = 25.0;
+	processor.timeConstantInSeconds = 8.0;
+	processor.temperatureInCelsius = AmbientTemperatureInCelsius;
+	processor.hasRecordedTemperature = false;
+	processor.thresholds = TemperatureThresholds(
+		Temperature::createInvalid(), Temperature::createInvalid(), Temperature::fromCelsius(HysteresisInCelsius));
+	processor.thresholdsCrossingSignaled = false;
+
+	m_processorIndex = (UIntN)m_participants.size();
+	m_participants.push_back(processor);
+}
+
+void SimulatedPlatform::addSensor(UIntN sensorNumber)
+{
+	SimulatedParticipant sensor;
+	sensor.name = "TSN" + to_string(sensorNumber);
+	sensor.acpiScope = "\\_SB_." + sensor.name;
+	sensor.domainType = DomainType::Temperature;
+	sensor.functionality.temperatureVersion = 1;
+	sensor.functionality.temperatureThresholdVersion = 1;
+	sensor.specificInfo[ParticipantSpecificInfoKey::PSV] = Temperature::fromCelsius(52.0 + 2.0 * (sensorNumber % 4));
+	sensor.specificInfo[ParticipantSpecificInfoKey::AC0] = Temperature::fromCelsius(55.0);
+	sensor.specificInfo[ParticipantSpecificInfoKey::AC1] = Temperature::fromCelsius(50.0);
+	sensor.specificInfo[ParticipantSpecificInfoKey::AC2] = Temperature::fromCelsius(45.0);
+	sensor.specificInfo[ParticipantSpecificInfoKey::AC3] = Temperature::fromCelsius(40.0);
+	sensor.specificInfo[ParticipantSpecificInfoKey::Hot] = Temperature::fromCelsius(80.0);
+	sensor.specificInfo[ParticipantSpecificInfoKey::Critical] = Temperature::fromCelsius(90.0);
+	sensor.thermalResistance = 0.5 + 0.1 * (sensorNumber % 4);
+	sensor.fanCooling = 10.0;
+	sensor.timeConstantInSeconds = 20.0 + 10.0 * (sensorNumber % 3);
+	sensor.temperatureInCelsius = AmbientTemperatureInCelsius;
+	sensor.hasRecordedTemperature = false;
+	sensor.thresholds = TemperatureThresholds(
+		Temperature::createInvalid(), Temperature::createInvalid(), Temperature::fromCelsius(HysteresisInCelsius));
+	sensor.thresholdsCrossingSignaled = false;
+	m_participants.push_back(sensor);
+}
+
+void SimulatedPlatform::addFan()
+{
+	SimulatedParticipant fan;
+	fan.name = "TFN1";
+	fan.acpiScope = "\\_SB_.TFN1";
+	fan.domainType = DomainType::Fan;
+	fan.functionality.activeControlVersion = 1;
+	fan.thermalResistance = 0.0;
+	fan.fanCooling = 0.0;
+	fan.timeConstantInSeconds = 0.0;
+	fan.temperatureInCelsius = AmbientTemperatureInCelsius;
+	fan.hasRecordedTemperature = false;
+	fan.thresholds = TemperatureThresholds::createInvalid();
+	fan.thresholdsCrossingSignaled = false;
+
+	m_fanIndex = (UIntN)m_participants.size();
+	m_participants.push_back(fan);
+}
+
+void SimulatedPlatform::throwIfInvalidParticipantIndex(UIntN participantIndex) const
+{
+	if (participantIndex >= m_participants.size())
+	{
+		throw dptf_exception("Participant index " + to_string(participantIndex) + " is not simulated.");
+	}
+}
+
+Bool SimulatedPlatform::isOutsideThresholds(const Temperature& temperature, const TemperatureThresholds& thresholds)
+{
+	const auto aux0 = thresholds.getAux0();
+	const auto aux1 = thresholds.getAux1();
+	return (aux1.isValid() && (temperature >= aux1)) || (aux0.isValid() && (temperature <= aux0));
+}
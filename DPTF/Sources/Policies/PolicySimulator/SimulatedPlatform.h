@@ -0,0 +1,119 @@
+/******************************************************************************
+** Copyright (c) 2013-2023 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include "ParticipantProperties.h"
+#include "DomainPropertiesSet.h"
+#include "ParticipantSpecificInfoKey.h"
+#include "TemperatureThresholds.h"
+#include "PerformanceControlSet.h"
+#include "PerformanceControlDynamicCaps.h"
+#include "ActiveControlSet.h"
+#include "ActiveControlStaticCaps.h"
+#include "ActiveControlDynamicCaps.h"
+
+struct SimulatedParticipant
+{
+	std::string name;
+	std::string acpiScope;
+	DomainType::Type domainType;
+	DomainFunctionalityVersions functionality;
+	std::map<ParticipantSpecificInfoKey::Type, Temperature> specificInfo;
+
+	// thermal model: the temperature settles at ambient + (source power * thermal resistance) - (fan speed *
+	// fan cooling), approaching it with the given time constant.  recorded temperatures replace the model.
+	double thermalResistance;
+	double fanCooling;
+	double timeConstantInSeconds;
+	double temperatureInCelsius;
+	Bool hasRecordedTemperature;
+
+	TemperatureThresholds thresholds;
+	Bool thresholdsCrossingSignaled;
+};
+
+// A small platform with one processor participant (TCPU) that is the passive source for every target,
+// a number of temperature sensor participants (TSN0, TSN1, ...) and one fan participant (TFN1) that is
+// the active source for every target.  The processor exposes performance states and its power
+// consumption drives a first order thermal model for every participant with a temperature.
+class SimulatedPlatform
+{
+public:
+	SimulatedPlatform(UIntN sensorCount);
+
+	UIntN getParticipantCount() const;
+	UIntN getProcessorIndex() const;
+	UIntN getFanIndex() const;
+	UIntN findParticipantIndex(const std::string& name) const;
+	const SimulatedParticipant& getParticipant(UIntN participantIndex) const;
+	SimulatedParticipant& getParticipant(UIntN participantIndex);
+	ParticipantProperties getParticipantProperties(UIntN participantIndex) const;
+	DomainPropertiesSet getDomainPropertiesSet(UIntN participantIndex) const;
+
+	DptfBuffer getThermalRelationshipTable() const;
+	DptfBuffer getActiveRelationshipTable() const;
+
+	// thermal model
+	void setPowerDemand(const Power& powerDemand);
+	Power getPowerConsumption() const;
+	Percentage getUtilization() const;
+	void setRecordedTemperature(UIntN participantIndex, const Temperature& temperature);
+	Temperature getTemperature(UIntN participantIndex) const;
+	void advance(const TimeSpan& elapsed);
+	std::vector<UIntN> takeParticipantsOutsideThresholds();
+
+	// temperature thresholds
+	TemperatureThresholds getTemperatureThresholds(UIntN participantIndex) const;
+	void setTemperatureThresholds(UIntN participantIndex, const TemperatureThresholds& thresholds);
+
+	// processor performance states
+	const PerformanceControlSet& getPerformanceControlSet() const;
+	PerformanceControlDynamicCaps getPerformanceControlDynamicCaps() const;
+	void setPerformanceControlDynamicCaps(const PerformanceControlDynamicCaps& capabilities);
+	UIntN getPerformanceControlIndex() const;
+	void setPerformanceControlIndex(UIntN performanceControlIndex);
+
+	// fan
+	const ActiveControlSet& getActiveControlSet() const;
+	ActiveControlStaticCaps getActiveControlStaticCaps() const;
+	ActiveControlDynamicCaps getActiveControlDynamicCaps() const;
+	void setActiveControlDynamicCaps(const ActiveControlDynamicCaps& capabilities);
+	Percentage getFanSpeed() const;
+	void setFanSpeed(const Percentage& fanSpeed);
+
+private:
+	std::vector<SimulatedParticipant> m_participants;
+	UIntN m_processorIndex;
+	UIntN m_fanIndex;
+
+	Power m_powerDemand;
+	PerformanceControlSet m_performanceControlSet;
+	PerformanceControlDynamicCaps m_performanceControlDynamicCaps;
+	UIntN m_performanceControlIndex;
+	ActiveControlSet m_activeControlSet;
+	ActiveControlDynamicCaps m_activeControlDynamicCaps;
+	Percentage m_fanSpeed;
+
+	void addProcessor();
+	void addSensor(UIntN sensorNumber);
+	void addFan();
+	void throwIfInvalidParticipantIndex(UIntN participantIndex) const;
+	static Bool isOutsideThresholds(const Temperature& temperature, const TemperatureThresholds& thresholds);
+};
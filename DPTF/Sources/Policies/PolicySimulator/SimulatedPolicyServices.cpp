@@ -0,0 +1,1605 @@
+/******************************************************************************
+** Copyright (c) 2013-2023 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "SimulatedPolicyServices.h"
+#include "ActiveControlStatus.h"
+#include "TemperatureStatus.h"
+using namespace std;
+
+static const TimeSpan MinimumAllowableSamplePeriod = TimeSpan::createFromMilliseconds(100);
+static const UIntN FanRpmPerPercent = 50;
+
+SimulatedPolicyServices::SimulatedPolicyServices(
+	SimulatedPlatform& platform,
+	SimulatedTime& time,
+	SimulationStatistics& statistics)
+	: m_platform(platform)
+	, m_time(time)
+	, m_statistics(statistics)
+	, m_registeredEvents()
+	, m_callbacks()
+	, m_nextCallbackHandle(1)
+{
+}
+
+PolicyServicesInterfaceContainer SimulatedPolicyServices::getInterfaces()
+{
+	PolicyServicesInterfaceContainer interfaces;
+	interfaces.domainActivityStatus = this;
+	interfaces.domainCoreControl = this;
+	interfaces.domainDisplayControl = this;
+	interfaces.domainEnergyControl = this;
+	interfaces.domainPeakPowerControl = this;
+	interfaces.domainPerformanceControl = this;
+	interfaces.domainPowerControl = this;
+	interfaces.domainPowerStatus = this;
+	interfaces.domainSystemPowerControl = this;
+	interfaces.domainPlatformPowerStatus = this;
+	interfaces.domainPriority = this;
+	interfaces.domainRfProfileControl = this;
+	interfaces.domainRfProfileStatus = this;
+	interfaces.domainUtilization = this;
+	interfaces.participantGetSpecificInfo = this;
+	interfaces.participantProperties = this;
+	interfaces.participantSetSpecificInfo = this;
+	interfaces.platformConfigurationData = this;
+	interfaces.platformPowerState = this;
+	interfaces.policyEventRegistration = this;
+	interfaces.policyInitiatedCallback = this;
+	interfaces.messageLogging = this;
+	interfaces.workloadHintConfiguration = this;
+	interfaces.platformState = this;
+	interfaces.serviceRequest = this;
+	return interfaces;
+}
+
+Bool SimulatedPolicyServices::isEventRegistered(PolicyEvent::Type policyEvent) const
+{
+	return m_registeredEvents.find(policyEvent) != m_registeredEvents.end();
+}
+
+Bool SimulatedPolicyServices::takeNextCallbackDueBy(const TimeSpan& time, SimulatedPolicyCallback& callback)
+{
+	auto next = m_callbacks.end();
+	for (auto candidate = m_callbacks.begin(); candidate != m_callbacks.end(); ++candidate)
+	{
+		if ((candidate->second.dueTime <= time)
+			&& ((next == m_callbacks.end()) || (candidate->second.dueTime < next->second.dueTime)))
+		{
+			next = candidate;
+		}
+	}
+
+	if (next == m_callbacks.end())
+	{
+		return false;
+	}
+	callback = next->second;
+	m_callbacks.erase(next);
+	return true;
+}
+
+Percentage SimulatedPolicyServices::getUtilizationThreshold(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+Percentage SimulatedPolicyServices::getResidencyUtilization(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+UInt64 SimulatedPolicyServices::getCoreActivityCounter(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+UInt32 SimulatedPolicyServices::getCoreActivityCounterWidth(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+UInt64 SimulatedPolicyServices::getTimestampCounter(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+UInt32 SimulatedPolicyServices::getTimestampCounterWidth(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+CoreActivityInfo SimulatedPolicyServices::getCoreActivityInfo(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+UInt32 SimulatedPolicyServices::getSocDgpuPerformanceHintPoints(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+CoreControlStaticCaps SimulatedPolicyServices::getCoreControlStaticCaps(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+CoreControlDynamicCaps SimulatedPolicyServices::getCoreControlDynamicCaps(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+CoreControlLpoPreference SimulatedPolicyServices::getCoreControlLpoPreference(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+CoreControlStatus SimulatedPolicyServices::getCoreControlStatus(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setActiveCoreControl(
+	UIntN participantIndex,
+	UIntN domainIndex,
+	const CoreControlStatus& coreControlStatus)
+{
+	throw notSimulated(__func__);
+}
+
+DisplayControlDynamicCaps SimulatedPolicyServices::getDisplayControlDynamicCaps(
+	UIntN participantIndex,
+	UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+DisplayControlStatus SimulatedPolicyServices::getDisplayControlStatus(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+UIntN SimulatedPolicyServices::getUserPreferredDisplayIndex(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+UIntN SimulatedPolicyServices::getUserPreferredSoftBrightnessIndex(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+Bool SimulatedPolicyServices::isUserPreferredIndexModified(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+UIntN SimulatedPolicyServices::getSoftBrightnessIndex(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+DisplayControlSet SimulatedPolicyServices::getDisplayControlSet(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setDisplayControl(UIntN participantIndex, UIntN domainIndex, UIntN displayControlIndex)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setSoftBrightness(UIntN participantIndex, UIntN domainIndex, UIntN displayControlIndex)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::updateUserPreferredSoftBrightnessIndex(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::restoreUserPreferredSoftBrightness(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setDisplayControlDynamicCaps(
+	UIntN participantIndex,
+	UIntN domainIndex,
+	DisplayControlDynamicCaps newCapabilities)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setDisplayCapsLock(UIntN participantIndex, UIntN domainIndex, Bool lock)
+{
+	throw notSimulated(__func__);
+}
+
+UInt32 SimulatedPolicyServices::getRaplEnergyCounter(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+EnergyCounterInfo SimulatedPolicyServices::getRaplEnergyCounterInfo(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+double SimulatedPolicyServices::getRaplEnergyUnit(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+UInt32 SimulatedPolicyServices::getRaplEnergyCounterWidth(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+Power SimulatedPolicyServices::getInstantaneousPower(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+UInt32 SimulatedPolicyServices::getEnergyThreshold(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setEnergyThreshold(UIntN participantIndex, UIntN domainIndex, UInt32 energyThreshold)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setEnergyThresholdInterruptDisable(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+Power SimulatedPolicyServices::getACPeakPower(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setACPeakPower(UIntN participantIndex, UIntN domainIndex, const Power& acPeakPower)
+{
+	throw notSimulated(__func__);
+}
+
+Power SimulatedPolicyServices::getDCPeakPower(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setDCPeakPower(UIntN participantIndex, UIntN domainIndex, const Power& dcPeakPower)
+{
+	throw notSimulated(__func__);
+}
+
+PerformanceControlStaticCaps SimulatedPolicyServices::getPerformanceControlStaticCaps(
+	UIntN participantIndex,
+	UIntN domainIndex)
+{
+	throwIfNotProcessor(participantIndex, __func__);
+	return PerformanceControlStaticCaps(false);
+}
+
+PerformanceControlDynamicCaps SimulatedPolicyServices::getPerformanceControlDynamicCaps(
+	UIntN participantIndex,
+	UIntN domainIndex)
+{
+	throwIfNotProcessor(participantIndex, __func__);
+	return m_platform.getPerformanceControlDynamicCaps();
+}
+
+PerformanceControlStatus SimulatedPolicyServices::getPerformanceControlStatus(UIntN participantIndex, UIntN domainIndex)
+{
+	throwIfNotProcessor(participantIndex, __func__);
+	return PerformanceControlStatus(m_platform.getPerformanceControlIndex());
+}
+
+PerformanceControlSet SimulatedPolicyServices::getPerformanceControlSet(UIntN participantIndex, UIntN domainIndex)
+{
+	throwIfNotProcessor(participantIndex, __func__);
+	return m_platform.getPerformanceControlSet();
+}
+
+void SimulatedPolicyServices::setPerformanceControl(
+	UIntN participantIndex,
+	UIntN domainIndex,
+	UIntN performanceControlIndex)
+{
+	throwIfNotProcessor(participantIndex, __func__);
+	m_platform.setPerformanceControlIndex(performanceControlIndex);
+	recordDecision(
+		participantIndex, SimulationDecisionType::PerformanceControl, "P" + to_string(performanceControlIndex));
+}
+
+void SimulatedPolicyServices::setPerformanceControlDynamicCaps(
+	UIntN participantIndex,
+	UIntN domainIndex,
+	PerformanceControlDynamicCaps newCapabilities)
+{
+	throwIfNotProcessor(participantIndex, __func__);
+	m_platform.setPerformanceControlDynamicCaps(newCapabilities);
+}
+
+void SimulatedPolicyServices::setPerformanceCapsLock(UIntN participantIndex, UIntN domainIndex, Bool lock)
+{
+	throwIfNotProcessor(participantIndex, __func__);
+}
+
+Bool SimulatedPolicyServices::isPowerLimitEnabled(
+	UIntN participantIndex,
+	UIntN domainIndex,
+	PowerControlType::Type controlType)
+{
+	throw notSimulated(__func__);
+}
+
+Power SimulatedPolicyServices::getPowerLimit(
+	UIntN participantIndex,
+	UIntN domainIndex,
+	PowerControlType::Type controlType)
+{
+	throw notSimulated(__func__);
+}
+
+Power SimulatedPolicyServices::getPowerLimitWithoutCache(
+	UIntN participantIndex,
+	UIntN domainIndex,
+	PowerControlType::Type controlType)
+{
+	throw notSimulated(__func__);
+}
+
+Bool SimulatedPolicyServices::isSocPowerFloorEnabled(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+Bool SimulatedPolicyServices::isSocPowerFloorSupported(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+UInt32 SimulatedPolicyServices::getSocPowerFloorState(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setPowerLimitMin(
+	UIntN participantIndex,
+	UIntN domainIndex,
+	PowerControlType::Type controlType,
+	const Power& powerLimit)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setPowerLimit(
+	UIntN participantIndex,
+	UIntN domainIndex,
+	PowerControlType::Type controlType,
+	const Power& powerLimit)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setPowerLimitWithoutUpdatingEnabled(
+	UIntN participantIndex,
+	UIntN domainIndex,
+	PowerControlType::Type controlType,
+	const Power& powerLimit)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setPowerLimitIgnoringCaps(
+	UIntN participantIndex,
+	UIntN domainIndex,
+	PowerControlType::Type controlType,
+	const Power& powerLimit)
+{
+	throw notSimulated(__func__);
+}
+
+TimeSpan SimulatedPolicyServices::getPowerLimitTimeWindow(
+	UIntN participantIndex,
+	UIntN domainIndex,
+	PowerControlType::Type controlType)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setPowerLimitTimeWindow(
+	UIntN participantIndex,
+	UIntN domainIndex,
+	PowerControlType::Type controlType,
+	const TimeSpan& timeWindow)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setPowerLimitTimeWindowWithoutUpdatingEnabled(
+	UIntN participantIndex,
+	UIntN domainIndex,
+	PowerControlType::Type controlType,
+	const TimeSpan& timeWindow)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setPowerLimitTimeWindowIgnoringCaps(
+	UIntN participantIndex,
+	UIntN domainIndex,
+	PowerControlType::Type controlType,
+	const TimeSpan& timeWindow)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::clearPowerLimitMin(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::clearPowerLimit(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+Percentage SimulatedPolicyServices::getPowerLimitDutyCycle(
+	UIntN participantIndex,
+	UIntN domainIndex,
+	PowerControlType::Type controlType)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setPowerLimitDutyCycle(
+	UIntN participantIndex,
+	UIntN domainIndex,
+	PowerControlType::Type controlType,
+	const Percentage& dutyCycle)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setSocPowerFloorState(UIntN participantIndex, UIntN domainIndex, Bool socPowerFloorState)
+{
+	throw notSimulated(__func__);
+}
+
+PowerControlDynamicCapsSet SimulatedPolicyServices::getPowerControlDynamicCapsSet(
+	UIntN participantIndex,
+	UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setPowerControlDynamicCapsSet(
+	UIntN participantIndex,
+	UIntN domainIndex,
+	PowerControlDynamicCapsSet capsSet)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setPowerCapsLock(UIntN participantIndex, UIntN domainIndex, Bool lock)
+{
+	throw notSimulated(__func__);
+}
+
+TimeSpan SimulatedPolicyServices::getPowerSharePowerLimitTimeWindow(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+Bool SimulatedPolicyServices::isPowerShareControl(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+double SimulatedPolicyServices::getPidKpTerm(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+double SimulatedPolicyServices::getPidKiTerm(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+TimeSpan SimulatedPolicyServices::getAlpha(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+TimeSpan SimulatedPolicyServices::getFastPollTime(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+TimeSpan SimulatedPolicyServices::getSlowPollTime(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+TimeSpan SimulatedPolicyServices::getWeightedSlowPollAvgConstant(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+Power SimulatedPolicyServices::getSlowPollPowerThreshold(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+Power SimulatedPolicyServices::getThermalDesignPower(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::removePowerLimitPolicyRequest(
+	UIntN participantIndex,
+	UIntN domainIndex,
+	PowerControlType::Type controlType)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setPowerSharePolicyPower(
+	UIntN participantIndex,
+	UIntN domainIndex,
+	const Power& powerSharePolicyPower)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setPowerShareEffectiveBias(
+	UIntN participantIndex,
+	UIntN domainIndex,
+	UInt32 powerShareEffectiveBias)
+{
+	throw notSimulated(__func__);
+}
+
+PowerStatus SimulatedPolicyServices::getPowerStatus(UIntN participantIndex, UIntN domainIndex)
+{
+	throwIfNotProcessor(participantIndex, __func__);
+	return PowerStatus(m_platform.getPowerConsumption());
+}
+
+Power SimulatedPolicyServices::getAveragePower(
+	UIntN participantIndex,
+	UIntN domainIndex,
+	const PowerControlDynamicCaps& capabilities)
+{
+	throw notSimulated(__func__);
+}
+
+Power SimulatedPolicyServices::getPowerValue(UIntN participantIndex, UIntN domainIndex)
+{
+	throwIfNotProcessor(participantIndex, __func__);
+	return m_platform.getPowerConsumption();
+}
+
+void SimulatedPolicyServices::setCalculatedAveragePower(UIntN participantIndex, UIntN domainIndex, Power powerValue)
+{
+	throw notSimulated(__func__);
+}
+
+Bool SimulatedPolicyServices::isSystemPowerLimitEnabled(
+	UIntN participantIndex,
+	UIntN domainIndex,
+	PsysPowerLimitType::Type limitType)
+{
+	throw notSimulated(__func__);
+}
+
+Power SimulatedPolicyServices::getSystemPowerLimit(
+	UIntN participantIndex,
+	UIntN domainIndex,
+	PsysPowerLimitType::Type limitType)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setSystemPowerLimit(
+	UIntN participantIndex,
+	UIntN domainIndex,
+	PsysPowerLimitType::Type limitType,
+	const Power& powerLimit)
+{
+	throw notSimulated(__func__);
+}
+
+TimeSpan SimulatedPolicyServices::getSystemPowerLimitTimeWindow(
+	UIntN participantIndex,
+	UIntN domainIndex,
+	PsysPowerLimitType::Type limitType)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setSystemPowerLimitTimeWindow(
+	UIntN participantIndex,
+	UIntN domainIndex,
+	PsysPowerLimitType::Type limitType,
+	const TimeSpan& timeWindow)
+{
+	throw notSimulated(__func__);
+}
+
+Percentage SimulatedPolicyServices::getSystemPowerLimitDutyCycle(
+	UIntN participantIndex,
+	UIntN domainIndex,
+	PsysPowerLimitType::Type limitType)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setSystemPowerLimitDutyCycle(
+	UIntN participantIndex,
+	UIntN domainIndex,
+	PsysPowerLimitType::Type limitType,
+	const Percentage& dutyCycle)
+{
+	throw notSimulated(__func__);
+}
+
+Power SimulatedPolicyServices::getPlatformRestOfPower(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+Power SimulatedPolicyServices::getAdapterPowerRating(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+PlatformPowerSource::Type SimulatedPolicyServices::getPlatformPowerSource(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+UInt32 SimulatedPolicyServices::getACNominalVoltage(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+UInt32 SimulatedPolicyServices::getACOperationalCurrent(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+Percentage SimulatedPolicyServices::getAC1msPercentageOverload(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+Percentage SimulatedPolicyServices::getAC2msPercentageOverload(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+Percentage SimulatedPolicyServices::getAC10msPercentageOverload(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::notifyForProcHotDeAssertion(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+DomainPriority SimulatedPolicyServices::getDomainPriority(UIntN participantIndex, UIntN domainIndex)
+{
+	return DomainPriority();
+}
+
+RfProfileCapabilities SimulatedPolicyServices::getRfProfileCapabilities(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setRfProfileCenterFrequency(
+	UIntN participantIndex,
+	UIntN domainIndex,
+	const Frequency& centerFrequency)
+{
+	throw notSimulated(__func__);
+}
+
+Percentage SimulatedPolicyServices::getSscBaselineSpreadValue(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+Percentage SimulatedPolicyServices::getSscBaselineThreshold(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+Percentage SimulatedPolicyServices::getSscBaselineGuardBand(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+RfProfileDataSet SimulatedPolicyServices::getRfProfileDataSet(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+UInt32 SimulatedPolicyServices::getWifiCapabilities(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+UInt32 SimulatedPolicyServices::getRfiDisable(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+UInt64 SimulatedPolicyServices::getDvfsPoints(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+UInt32 SimulatedPolicyServices::getDlvrSsc(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+Frequency SimulatedPolicyServices::getDlvrCenterFrequency(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setDdrRfiTable(
+	UIntN participantIndex,
+	UIntN domainIndex,
+	const DdrfChannelBandPackage::WifiRfiDdr& ddrRfiStruct)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::sendMasterControlStatus(
+	UIntN participantIndex,
+	UIntN domainIndex,
+	UInt32 masterControlStatus)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setProtectRequest(UIntN participantIndex, UIntN domainIndex, UInt64 frequencyRate)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setRfProfileOverride(
+	UIntN participantIndex,
+	UIntN domainIndex,
+	const DptfBuffer& rfProfileBufferData)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setDlvrCenterFrequency(UIntN participantIndex, UIntN domainIndex, Frequency frequency)
+{
+	throw notSimulated(__func__);
+}
+
+UtilizationStatus SimulatedPolicyServices::getUtilizationStatus(UIntN participantIndex, UIntN domainIndex)
+{
+	throwIfNotProcessor(participantIndex, __func__);
+	return UtilizationStatus(m_platform.getUtilization());
+}
+
+Percentage SimulatedPolicyServices::getMaxCoreUtilization(UIntN participantIndex, UIntN domainIndex)
+{
+	throwIfNotProcessor(participantIndex, __func__);
+	return m_platform.getUtilization();
+}
+
+std::map<ParticipantSpecificInfoKey::Type, Temperature> SimulatedPolicyServices::getParticipantSpecificInfo(
+	UIntN participantIndex,
+	const std::vector<ParticipantSpecificInfoKey::Type>& requestedInfo)
+{
+	// like a real participant, every requested key is returned and the ones the participant does not have
+	// are reported with a temperature no policy will act on
+	const auto& participant = m_platform.getParticipant(participantIndex);
+	std::map<ParticipantSpecificInfoKey::Type, Temperature> specificInfo;
+	for (auto key : requestedInfo)
+	{
+		auto info = participant.specificInfo.find(key);
+		if (info != participant.specificInfo.end())
+		{
+			specificInfo[key] = info->second;
+		}
+		else
+		{
+			specificInfo[key] = Temperature(Constants::MaxUInt32);
+		}
+	}
+	return specificInfo;
+}
+
+ParticipantProperties SimulatedPolicyServices::getParticipantProperties(UIntN participantIndex) const
+{
+	return m_platform.getParticipantProperties(participantIndex);
+}
+
+DomainPropertiesSet SimulatedPolicyServices::getDomainPropertiesSet(UIntN participantIndex) const
+{
+	return m_platform.getDomainPropertiesSet(participantIndex);
+}
+
+void SimulatedPolicyServices::setParticipantDeviceTemperatureIndication(
+	UIntN participantIndex,
+	const Temperature& temperature)
+{
+	m_platform.getParticipant(participantIndex);
+}
+
+void SimulatedPolicyServices::setParticipantSpecificInfo(
+	UIntN participantIndex,
+	ParticipantSpecificInfoKey::Type tripPoint,
+	const Temperature& tripValue)
+{
+	m_platform.getParticipant(participantIndex).specificInfo[tripPoint] = tripValue;
+}
+
+UInt32 SimulatedPolicyServices::readConfigurationUInt32(const std::string& key)
+{
+	throw dptf_exception("Configuration key " + key + " is not set.");
+}
+
+UInt32 SimulatedPolicyServices::readConfigurationUInt32(const std::string& nameSpace, const std::string& key)
+{
+	throw dptf_exception("Configuration key " + key + " is not set.");
+}
+
+void SimulatedPolicyServices::writeConfigurationUInt32(const std::string& key, UInt32 data)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::writeConfigurationString(const std::string& key, const std::string& data)
+{
+	throw notSimulated(__func__);
+}
+
+std::string SimulatedPolicyServices::readConfigurationString(const std::string& nameSpace, const std::string& key)
+{
+	throw dptf_exception("Configuration key " + key + " is not set.");
+}
+
+DptfBuffer SimulatedPolicyServices::readConfigurationBinary(const std::string& nameSpace, const std::string& key)
+{
+	throw dptf_exception("Configuration key " + key + " is not set.");
+}
+
+void SimulatedPolicyServices::writeConfigurationBinary(
+	void* bufferPtr,
+	UInt32 bufferLength,
+	UInt32 dataLength,
+	const std::string&,
+	const std::string&)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::deleteConfigurationBinary(const std::string& nameSpace, const std::string& elementPath)
+{
+	throw notSimulated(__func__);
+}
+
+eEsifError SimulatedPolicyServices::sendCommand(UInt32 argc, const std::string& argv)
+{
+	throw notSimulated(__func__);
+}
+
+TimeSpan SimulatedPolicyServices::getMinimumAllowableSamplePeriod()
+{
+	return MinimumAllowableSamplePeriod;
+}
+
+DptfBuffer SimulatedPolicyServices::getActiveRelationshipTable()
+{
+	return m_platform.getActiveRelationshipTable();
+}
+
+void SimulatedPolicyServices::setActiveRelationshipTable(DptfBuffer data)
+{
+	throw notSimulated(__func__);
+}
+
+DptfBuffer SimulatedPolicyServices::getThermalRelationshipTable()
+{
+	return m_platform.getThermalRelationshipTable();
+}
+
+void SimulatedPolicyServices::setThermalRelationshipTable(DptfBuffer data)
+{
+	throw notSimulated(__func__);
+}
+
+DptfBuffer SimulatedPolicyServices::getPassiveTable()
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setPassiveTable(DptfBuffer data)
+{
+	throw notSimulated(__func__);
+}
+
+DptfBuffer SimulatedPolicyServices::getAdaptivePerformanceActionsTable(std::string uuid)
+{
+	throw notSimulated(__func__);
+}
+
+DptfBuffer SimulatedPolicyServices::getAdaptivePerformanceConditionsTable(std::string uuid)
+{
+	throw notSimulated(__func__);
+}
+
+DptfBuffer SimulatedPolicyServices::getOemVariables()
+{
+	throw notSimulated(__func__);
+}
+
+DptfBuffer SimulatedPolicyServices::getSwOemVariables()
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setSwOemVariables(const DptfBuffer& swOemVariablesData)
+{
+	throw notSimulated(__func__);
+}
+
+UInt64 SimulatedPolicyServices::getHwpfState(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+UInt32 SimulatedPolicyServices::getProcessorConfigTdpControl(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+Power SimulatedPolicyServices::getProcessorConfigTdpLevel(
+	UIntN participantIndex,
+	UIntN domainIndex,
+	UIntN configTdpControl)
+{
+	throw notSimulated(__func__);
+}
+
+UInt32 SimulatedPolicyServices::getProcessorConfigTdpLock(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+Power SimulatedPolicyServices::getProcessorTdp(UIntN participantIndex, UIntN domainIndex) const
+{
+	throw notSimulated(__func__);
+}
+
+Temperature SimulatedPolicyServices::getProcessorTjMax(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+DptfBuffer SimulatedPolicyServices::getPowerBossConditionsTable()
+{
+	throw notSimulated(__func__);
+}
+
+DptfBuffer SimulatedPolicyServices::getPowerBossActionsTable()
+{
+	throw notSimulated(__func__);
+}
+
+DptfBuffer SimulatedPolicyServices::getPowerBossMathTable()
+{
+	throw notSimulated(__func__);
+}
+
+DptfBuffer SimulatedPolicyServices::getVoltageThresholdMathTable()
+{
+	throw notSimulated(__func__);
+}
+
+DptfBuffer SimulatedPolicyServices::getEmergencyCallModeTable()
+{
+	throw notSimulated(__func__);
+}
+
+DptfBuffer SimulatedPolicyServices::getPidAlgorithmTable()
+{
+	throw notSimulated(__func__);
+}
+
+Bool SimulatedPolicyServices::getDisplayRequired()
+{
+	throw notSimulated(__func__);
+}
+
+TimeSpan SimulatedPolicyServices::getExpectedBatteryLife()
+{
+	throw notSimulated(__func__);
+}
+
+UInt32 SimulatedPolicyServices::getAggressivenessLevel()
+{
+	throw notSimulated(__func__);
+}
+
+DptfBuffer SimulatedPolicyServices::getDdrfTable()
+{
+	throw notSimulated(__func__);
+}
+
+DptfBuffer SimulatedPolicyServices::getRfimTable()
+{
+	throw notSimulated(__func__);
+}
+
+DptfBuffer SimulatedPolicyServices::getAggregateDisplayInformation()
+{
+	throw notSimulated(__func__);
+}
+
+DptfBuffer SimulatedPolicyServices::getEnergyPerformanceOptimizerTable()
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setEnergyPerformanceOptimizerTable(DptfBuffer data)
+{
+	throw notSimulated(__func__);
+}
+
+DptfBuffer SimulatedPolicyServices::getTpgaTable()
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setTpgaTable(DptfBuffer data)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setPidAlgorithmTable(DptfBuffer data)
+{
+	throw notSimulated(__func__);
+}
+
+DptfBuffer SimulatedPolicyServices::getActiveControlPointRelationshipTable()
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setActiveControlPointRelationshipTable(DptfBuffer data)
+{
+	throw notSimulated(__func__);
+}
+
+DptfBuffer SimulatedPolicyServices::getPowerShareAlgorithmTable()
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setPowerShareAlgorithmTable(DptfBuffer data)
+{
+	throw notSimulated(__func__);
+}
+
+DptfBuffer SimulatedPolicyServices::getPowerShareAlgorithmTable2()
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setPowerShareAlgorithmTable2(DptfBuffer data)
+{
+	throw notSimulated(__func__);
+}
+
+DptfBuffer SimulatedPolicyServices::getIntelligentThermalManagementTable()
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setIntelligentThermalManagementTable(DptfBuffer data)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setPpmPackage(DptfBuffer package)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setPpmPackageForNonBalancedSchemePersonality(DptfBuffer package)
+{
+	throw notSimulated(__func__);
+}
+
+DptfBuffer SimulatedPolicyServices::getPpmPackage(DptfBuffer package)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setActivePowerScheme()
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setPowerSchemeEpp(UInt32 value)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setForegroundAppRatioPeriod(UInt32 value)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setProcessAffinityMask(const std::string& processName, UInt32 maskValue)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setApplicationCompatibility(const DptfBuffer& processData)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::deleteApplicationCompatibility()
+{
+	throw notSimulated(__func__);
+}
+
+UInt32 SimulatedPolicyServices::getDynamicBoostState(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::setDynamicBoostState(UIntN participantIndex, UIntN domainIndex, UInt32 value)
+{
+	throw notSimulated(__func__);
+}
+
+UInt32 SimulatedPolicyServices::getTpgPowerStateWithoutCache(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+EnvironmentProfile SimulatedPolicyServices::getEnvironmentProfile() const
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::clearPpmPackageSettings()
+{
+	throw notSimulated(__func__);
+}
+
+UInt32 SimulatedPolicyServices::getLogicalProcessorCount(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+UInt32 SimulatedPolicyServices::getPhysicalCoreCount(UIntN participantIndex, UIntN domainIndex)
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::sleep(void)
+{
+	m_statistics.recordDecision(
+		m_time.getCurrentTime(), Constants::EmptyString, SimulationDecisionType::PlatformPowerState, "sleep");
+}
+
+void SimulatedPolicyServices::hibernate(
+	const Temperature& currentTemperature,
+	const Temperature& tripPointTemperature,
+	const std::string& participantName)
+{
+	m_statistics.recordDecision(
+		m_time.getCurrentTime(), participantName, SimulationDecisionType::PlatformPowerState, "hibernate");
+}
+
+void SimulatedPolicyServices::shutDown(
+	const Temperature& currentTemperature,
+	const Temperature& tripPointTemperature,
+	const std::string& participantName)
+{
+	m_statistics.recordDecision(
+		m_time.getCurrentTime(), participantName, SimulationDecisionType::PlatformPowerState, "shut down");
+}
+
+void SimulatedPolicyServices::registerEvent(PolicyEvent::Type policyEvent)
+{
+	m_registeredEvents.insert(policyEvent);
+}
+
+void SimulatedPolicyServices::unregisterEvent(PolicyEvent::Type policyEvent)
+{
+	m_registeredEvents.erase(policyEvent);
+}
+
+UInt64 SimulatedPolicyServices::createPolicyInitiatedImmediateCallback(
+	UInt64 policyDefinedEventCode,
+	UInt64 param1,
+	void* param2)
+{
+	return addCallback(policyDefinedEventCode, param1, param2, m_time.getCurrentTime());
+}
+
+UInt64 SimulatedPolicyServices::createPolicyInitiatedDeferredCallback(
+	UInt64 policyDefinedEventCode,
+	UInt64 param1,
+	void* param2,
+	const TimeSpan& timeDelta)
+{
+	return addCallback(policyDefinedEventCode, param1, param2, m_time.getCurrentTime() + timeDelta);
+}
+
+Bool SimulatedPolicyServices::removePolicyInitiatedCallback(UInt64 callbackHandle)
+{
+	return m_callbacks.erase(callbackHandle) > 0;
+}
+
+void SimulatedPolicyServices::writeMessageFatal(const DptfMessage& message)
+{
+	// messages are discarded so that logging does not distort the measurements
+}
+
+void SimulatedPolicyServices::writeMessageError(const DptfMessage& message)
+{
+}
+
+void SimulatedPolicyServices::writeMessageWarning(const DptfMessage& message)
+{
+}
+
+void SimulatedPolicyServices::writeMessageInfo(const DptfMessage& message)
+{
+}
+
+void SimulatedPolicyServices::writeMessageDebug(const DptfMessage& message)
+{
+}
+
+eLogType SimulatedPolicyServices::getLoggingLevel()
+{
+	return eLogType::eLogTypeFatal;
+}
+
+void SimulatedPolicyServices::add(const PolicyWorkloadGroup& workloadGroup)
+{
+	throw notSimulated(__func__);
+}
+
+UInt32 SimulatedPolicyServices::getHintForApplication(const std::string& application)
+{
+	throw notSimulated(__func__);
+}
+
+std::shared_ptr<XmlNode> SimulatedPolicyServices::getXml() const
+{
+	throw notSimulated(__func__);
+}
+
+void SimulatedPolicyServices::reloadConfiguration()
+{
+	throw notSimulated(__func__);
+}
+
+OnOffToggle::Type SimulatedPolicyServices::getMotion(void) const
+{
+	throw notSimulated(__func__);
+}
+
+SensorOrientation::Type SimulatedPolicyServices::getOrientation(void) const
+{
+	throw notSimulated(__func__);
+}
+
+SensorSpatialOrientation::Type SimulatedPolicyServices::getSpatialOrientation(void) const
+{
+	throw notSimulated(__func__);
+}
+
+OsLidState::Type SimulatedPolicyServices::getLidState(void) const
+{
+	throw notSimulated(__func__);
+}
+
+OsPowerSource::Type SimulatedPolicyServices::getPowerSource(void) const
+{
+	throw notSimulated(__func__);
+}
+
+std::string SimulatedPolicyServices::getForegroundApplicationName(void) const
+{
+	throw notSimulated(__func__);
+}
+
+CoolingMode::Type SimulatedPolicyServices::getCoolingMode(void) const
+{
+	throw notSimulated(__func__);
+}
+
+UIntN SimulatedPolicyServices::getBatteryPercentage(void) const
+{
+	throw notSimulated(__func__);
+}
+
+OsPlatformType::Type SimulatedPolicyServices::getPlatformType(void) const
+{
+	throw notSimulated(__func__);
+}
+
+OsDockMode::Type SimulatedPolicyServices::getDockMode(void) const
+{
+	throw notSimulated(__func__);
+}
+
+OsPowerSchemePersonality::Type SimulatedPolicyServices::getPowerSchemePersonality(void) const
+{
+	throw notSimulated(__func__);
+}
+
+UIntN SimulatedPolicyServices::getMobileNotification(OsMobileNotificationType::Type notificationType) const
+{
+	throw notSimulated(__func__);
+}
+
+OnOffToggle::Type SimulatedPolicyServices::getMixedRealityMode(void) const
+{
+	throw notSimulated(__func__);
+}
+
+OsUserPresence::Type SimulatedPolicyServices::getOsUserPresence(void) const
+{
+	throw notSimulated(__func__);
+}
+
+OsSessionState::Type SimulatedPolicyServices::getSessionState(void) const
+{
+	throw notSimulated(__func__);
+}
+
+OnOffToggle::Type SimulatedPolicyServices::getScreenState(void) const
+{
+	throw notSimulated(__func__);
+}
+
+UIntN SimulatedPolicyServices::getBatteryCount(void) const
+{
+	throw notSimulated(__func__);
+}
+
+UIntN SimulatedPolicyServices::getPowerSlider(void) const
+{
+	throw notSimulated(__func__);
+}
+
+SensorUserPresence::Type SimulatedPolicyServices::getPlatformUserPresence(void) const
+{
+	throw notSimulated(__func__);
+}
+
+OnOffToggle::Type SimulatedPolicyServices::getGameMode(void) const
+{
+	throw notSimulated(__func__);
+}
+
+UserInteraction::Type SimulatedPolicyServices::getUserInteraction(void) const
+{
+	throw notSimulated(__func__);
+}
+
+SystemMode::Type SimulatedPolicyServices::getSystemMode(void) const
+{
+	throw notSimulated(__func__);
+}
+
+OnOffToggle::Type SimulatedPolicyServices::getTpgPowerState(void) const
+{
+	throw notSimulated(__func__);
+}
+
+OnOffToggle::Type SimulatedPolicyServices::getCollaborationMode(void) const
+{
+	throw notSimulated(__func__);
+}
+
+DptfRequestResult SimulatedPolicyServices::submitRequest(DptfRequest request)
+{
+	return handleRequest(request);
+}
+
+std::vector<DptfRequestResult> SimulatedPolicyServices::submitRequests(const std::vector<DptfRequest>& requests)
+{
+	std::vector<DptfRequestResult> results;
+	for (const auto& request : requests)
+	{
+		results.push_back(handleRequest(request));
+	}
+	return results;
+}
+
+DptfRequestResult SimulatedPolicyServices::handleRequest(const DptfRequest& request)
+{
+	try
+	{
+		switch (request.getRequestType())
+		{
+		case DptfRequestType::TemperatureControlGetTemperatureStatus:
+		case DptfRequestType::TemperatureControlGetTemperatureThresholds:
+		case DptfRequestType::TemperatureControlSetTemperatureThresholds:
+		case DptfRequestType::TemperatureControlIsVirtualTemperatureControl:
+			return handleTemperatureRequest(request);
+		case DptfRequestType::ActiveControlGetStaticCaps:
+		case DptfRequestType::ActiveControlGetDynamicCaps:
+		case DptfRequestType::ActiveControlGetStatus:
+		case DptfRequestType::ActiveControlGetControlSet:
+		case DptfRequestType::ActiveControlSetFanSpeed:
+		case DptfRequestType::ActiveControlSetDynamicCaps:
+		case DptfRequestType::ActiveControlSetFanCapsLock:
+			return handleActiveControlRequest(request);
+		case DptfRequestType::PlatformNotificationSetOsc:
+		case DptfRequestType::ClearPolicyRequestsForAllControls:
+			return DptfRequestResult(true, "Request accepted.", request);
+		default:
+			m_statistics.recordUnsimulatedService(DptfRequestType::ToString(request.getRequestType()));
+			return DptfRequestResult(false, "Request type is not simulated.", request);
+		}
+	}
+	catch (const dptf_exception& ex)
+	{
+		return DptfRequestResult(false, ex.getDescription(), request);
+	}
+}
+
+DptfRequestResult SimulatedPolicyServices::handleTemperatureRequest(const DptfRequest& request)
+{
+	const auto participantIndex = request.getParticipantIndex();
+	if (m_platform.getParticipant(participantIndex).functionality.temperatureVersion == 0)
+	{
+		return DptfRequestResult(false, "Participant has no temperature control.", request);
+	}
+
+	DptfRequestResult result(true, "Request handled.", request);
+	switch (request.getRequestType())
+	{
+	case DptfRequestType::TemperatureControlGetTemperatureStatus:
+		result.setData(TemperatureStatus(m_platform.getTemperature(participantIndex)).toDptfBuffer());
+		break;
+	case DptfRequestType::TemperatureControlGetTemperatureThresholds:
+		result.setData(m_platform.getTemperatureThresholds(participantIndex).toDptfBuffer());
+		break;
+	case DptfRequestType::TemperatureControlSetTemperatureThresholds:
+	{
+		auto thresholds = TemperatureThresholds::createFromDptfBuffer(request.getData());
+		m_platform.setTemperatureThresholds(participantIndex, thresholds);
+		recordDecision(
+			participantIndex,
+			SimulationDecisionType::TemperatureThresholds,
+			thresholds.getAux0().toString() + "/" + thresholds.getAux1().toString());
+		break;
+	}
+	case DptfRequestType::TemperatureControlIsVirtualTemperatureControl:
+		result.setDataFromBool(false);
+		break;
+	default:
+		throw dptf_exception("Unexpected temperature control request.");
+	}
+	return result;
+}
+
+DptfRequestResult SimulatedPolicyServices::handleActiveControlRequest(const DptfRequest& request)
+{
+	const auto participantIndex = request.getParticipantIndex();
+	if (participantIndex != m_platform.getFanIndex())
+	{
+		return DptfRequestResult(false, "Participant has no active control.", request);
+	}
+
+	DptfRequestResult result(true, "Request handled.", request);
+	switch (request.getRequestType())
+	{
+	case DptfRequestType::ActiveControlGetStaticCaps:
+		result.setData(m_platform.getActiveControlStaticCaps().toDptfBuffer());
+		break;
+	case DptfRequestType::ActiveControlGetDynamicCaps:
+		result.setData(m_platform.getActiveControlDynamicCaps().toFcdcBinary());
+		break;
+	case DptfRequestType::ActiveControlGetStatus:
+	{
+		const auto fanSpeed = m_platform.getFanSpeed().toWholeNumber();
+		result.setData(ActiveControlStatus(fanSpeed, fanSpeed * FanRpmPerPercent).toFstBinary());
+		break;
+	}
+	case DptfRequestType::ActiveControlGetControlSet:
+		result.setData(m_platform.getActiveControlSet().toFpsBinary());
+		break;
+	case DptfRequestType::ActiveControlSetFanSpeed:
+	{
+		auto fanSpeed = Percentage::createFromDptfBuffer(request.getData());
+		m_platform.setFanSpeed(fanSpeed);
+		recordDecision(participantIndex, SimulationDecisionType::FanSpeed, fanSpeed.toString());
+		break;
+	}
+	case DptfRequestType::ActiveControlSetDynamicCaps:
+		m_platform.setActiveControlDynamicCaps(ActiveControlDynamicCaps::createFromFcdc(request.getData()));
+		break;
+	case DptfRequestType::ActiveControlSetFanCapsLock:
+		break;
+	default:
+		throw dptf_exception("Unexpected active control request.");
+	}
+	return result;
+}
+
+UInt64 SimulatedPolicyServices::addCallback(
+	UInt64 policyDefinedEventCode,
+	UInt64 param1,
+	void* param2,
+	const TimeSpan& dueTime)
+{
+	SimulatedPolicyCallback callback;
+	callback.handle = m_nextCallbackHandle++;
+	callback.dueTime = dueTime;
+	callback.policyDefinedEventCode = policyDefinedEventCode;
+	callback.param1 = param1;
+	callback.param2 = param2;
+	m_callbacks[callback.handle] = callback;
+	return callback.handle;
+}
+
+void SimulatedPolicyServices::recordDecision(
+	UIntN participantIndex,
+	SimulationDecisionType::Type type,
+	const string& value)
+{
+	m_statistics.recordDecision(
+		m_time.getCurrentTime(), m_platform.getParticipant(participantIndex).name, type, value);
+}
+
+void SimulatedPolicyServices::throwIfNotProcessor(UIntN participantIndex, const char* serviceName) const
+{
+	if (participantIndex != m_platform.getProcessorIndex())
+	{
+		throw dptf_exception(string(serviceName) + " is only supported by the processor participant.");
+	}
+}
+
+dptf_exception SimulatedPolicyServices::notSimulated(const char* serviceName) const
+{
+	m_statistics.recordUnsimulatedService(serviceName);
+	return dptf_exception(string(serviceName) + " is not simulated.");
+}
@@ -0,0 +1,490 @@
+/******************************************************************************
+** Copyright (c) 2013-2023 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include "PolicyServicesInterfaceContainer.h"
+#include "SimulatedPlatform.h"
+#include "SimulatedTime.h"
+#include "SimulationStatistics.h"
+#include <set>
+
+struct SimulatedPolicyCallback
+{
+	UInt64 handle;
+	TimeSpan dueTime;
+	UInt64 policyDefinedEventCode;
+	UInt64 param1;
+	void* param2;
+};
+
+// Stands in for the DPTF manager behind every policy services interface.  The services a policy needs to
+// read temperatures and drive performance states, fans and trip points are answered from the simulated
+// platform; control writes are recorded as decisions.  Everything else throws and is reported as a
+// service the simulation does not cover.
+class SimulatedPolicyServices : public DomainActivityStatusInterface,
+								public DomainCoreControlInterface,
+								public DomainDisplayControlInterface,
+								public DomainEnergyControlInterface,
+								public DomainPeakPowerControlInterface,
+								public DomainPerformanceControlInterface,
+								public DomainPowerControlInterface,
+								public DomainPowerStatusInterface,
+								public DomainSystemPowerControlInterface,
+								public DomainPlatformPowerStatusInterface,
+								public DomainPriorityInterface,
+								public DomainRfProfileControlInterface,
+								public DomainRfProfileStatusInterface,
+								public DomainUtilizationInterface,
+								public ParticipantGetSpecificInfoInterface,
+								public ParticipantPropertiesInterface,
+								public ParticipantSetSpecificInfoInterface,
+								public PlatformConfigurationDataInterface,
+								public PlatformPowerStateInterface,
+								public PolicyEventRegistrationInterface,
+								public PolicyInitiatedCallbackInterface,
+								public MessageLoggingInterface,
+								public PolicyWorkloadHintConfigurationInterface,
+								public PlatformStateInterface,
+								public DptfServiceRequestInterface
+{
+public:
+	SimulatedPolicyServices(SimulatedPlatform& platform, SimulatedTime& time, SimulationStatistics& statistics);
+
+	PolicyServicesInterfaceContainer getInterfaces();
+	Bool isEventRegistered(PolicyEvent::Type policyEvent) const;
+
+	// removes the earliest callback due at or before the given time, ordered by due time and then by the
+	// order the callbacks were created
+	Bool takeNextCallbackDueBy(const TimeSpan& time, SimulatedPolicyCallback& callback);
+
+	// DomainActivityStatusInterface
+	Percentage getUtilizationThreshold(UIntN participantIndex, UIntN domainIndex) override;
+	Percentage getResidencyUtilization(UIntN participantIndex, UIntN domainIndex) override;
+	UInt64 getCoreActivityCounter(UIntN participantIndex, UIntN domainIndex) override;
+	UInt32 getCoreActivityCounterWidth(UIntN participantIndex, UIntN domainIndex) override;
+	UInt64 getTimestampCounter(UIntN participantIndex, UIntN domainIndex) override;
+	UInt32 getTimestampCounterWidth(UIntN participantIndex, UIntN domainIndex) override;
+	CoreActivityInfo getCoreActivityInfo(UIntN participantIndex, UIntN domainIndex) override;
+	UInt32 getSocDgpuPerformanceHintPoints(UIntN participantIndex, UIntN domainIndex) override;
+
+	// DomainCoreControlInterface
+	CoreControlStaticCaps getCoreControlStaticCaps(UIntN participantIndex, UIntN domainIndex) override;
+	CoreControlDynamicCaps getCoreControlDynamicCaps(UIntN participantIndex, UIntN domainIndex) override;
+	CoreControlLpoPreference getCoreControlLpoPreference(UIntN participantIndex, UIntN domainIndex) override;
+	CoreControlStatus getCoreControlStatus(UIntN participantIndex, UIntN domainIndex) override;
+	void setActiveCoreControl(
+		UIntN participantIndex,
+		UIntN domainIndex,
+		const CoreControlStatus& coreControlStatus) override;
+
+	// DomainDisplayControlInterface
+	DisplayControlDynamicCaps getDisplayControlDynamicCaps(UIntN participantIndex, UIntN domainIndex) override;
+	DisplayControlStatus getDisplayControlStatus(UIntN participantIndex, UIntN domainIndex) override;
+	UIntN getUserPreferredDisplayIndex(UIntN participantIndex, UIntN domainIndex) override;
+	UIntN getUserPreferredSoftBrightnessIndex(UIntN participantIndex, UIntN domainIndex) override;
+	Bool isUserPreferredIndexModified(UIntN participantIndex, UIntN domainIndex) override;
+	UIntN getSoftBrightnessIndex(UIntN participantIndex, UIntN domainIndex) override;
+	DisplayControlSet getDisplayControlSet(UIntN participantIndex, UIntN domainIndex) override;
+	void setDisplayControl(UIntN participantIndex, UIntN domainIndex, UIntN displayControlIndex) override;
+	void setSoftBrightness(UIntN participantIndex, UIntN domainIndex, UIntN displayControlIndex) override;
+	void updateUserPreferredSoftBrightnessIndex(UIntN participantIndex, UIntN domainIndex) override;
+	void restoreUserPreferredSoftBrightness(UIntN participantIndex, UIntN domainIndex) override;
+	void setDisplayControlDynamicCaps(
+		UIntN participantIndex,
+		UIntN domainIndex,
+		DisplayControlDynamicCaps newCapabilities) override;
+	void setDisplayCapsLock(UIntN participantIndex, UIntN domainIndex, Bool lock) override;
+
+	// DomainEnergyControlInterface
+	UInt32 getRaplEnergyCounter(UIntN participantIndex, UIntN domainIndex) override;
+	EnergyCounterInfo getRaplEnergyCounterInfo(UIntN participantIndex, UIntN domainIndex) override;
+	double getRaplEnergyUnit(UIntN participantIndex, UIntN domainIndex) override;
+	UInt32 getRaplEnergyCounterWidth(UIntN participantIndex, UIntN domainIndex) override;
+	Power getInstantaneousPower(UIntN participantIndex, UIntN domainIndex) override;
+	UInt32 getEnergyThreshold(UIntN participantIndex, UIntN domainIndex) override;
+	void setEnergyThreshold(UIntN participantIndex, UIntN domainIndex, UInt32 energyThreshold) override;
+	void setEnergyThresholdInterruptDisable(UIntN participantIndex, UIntN domainIndex) override;
+
+	// DomainPeakPowerControlInterface
+	Power getACPeakPower(UIntN participantIndex, UIntN domainIndex) override;
+	void setACPeakPower(UIntN participantIndex, UIntN domainIndex, const Power& acPeakPower) override;
+	Power getDCPeakPower(UIntN participantIndex, UIntN domainIndex) override;
+	void setDCPeakPower(UIntN participantIndex, UIntN domainIndex, const Power& dcPeakPower) override;
+
+	// DomainPerformanceControlInterface
+	PerformanceControlStaticCaps getPerformanceControlStaticCaps(UIntN participantIndex, UIntN domainIndex) override;
+	PerformanceControlDynamicCaps getPerformanceControlDynamicCaps(UIntN participantIndex, UIntN domainIndex) override;
+	PerformanceControlStatus getPerformanceControlStatus(UIntN participantIndex, UIntN domainIndex) override;
+	PerformanceControlSet getPerformanceControlSet(UIntN participantIndex, UIntN domainIndex) override;
+	void setPerformanceControl(UIntN participantIndex, UIntN domainIndex, UIntN performanceControlIndex) override;
+	void setPerformanceControlDynamicCaps(
+		UIntN participantIndex,
+		UIntN domainIndex,
+		PerformanceControlDynamicCaps newCapabilities) override;
+	void setPerformanceCapsLock(UIntN participantIndex, UIntN domainIndex, Bool lock) override;
+
+	// DomainPowerControlInterface
+	Bool isPowerLimitEnabled(UIntN participantIndex, UIntN domainIndex, PowerControlType::Type controlType) override;
+	Power getPowerLimit(UIntN participantIndex, UIntN domainIndex, PowerControlType::Type controlType) override;
+	Power getPowerLimitWithoutCache(
+		UIntN participantIndex,
+		UIntN domainIndex,
+		PowerControlType::Type controlType) override;
+	Bool isSocPowerFloorEnabled(UIntN participantIndex, UIntN domainIndex) override;
+	Bool isSocPowerFloorSupported(UIntN participantIndex, UIntN domainIndex) override;
+	UInt32 getSocPowerFloorState(UIntN participantIndex, UIntN domainIndex) override;
+	void setPowerLimitMin(
+		UIntN participantIndex,
+		UIntN domainIndex,
+		PowerControlType::Type controlType,
+		const Power& powerLimit) override;
+	void setPowerLimit(
+		UIntN participantIndex,
+		UIntN domainIndex,
+		PowerControlType::Type controlType,
+		const Power& powerLimit) override;
+	void setPowerLimitWithoutUpdatingEnabled(
+		UIntN participantIndex,
+		UIntN domainIndex,
+		PowerControlType::Type controlType,
+		const Power& powerLimit) override;
+	void setPowerLimitIgnoringCaps(
+		UIntN participantIndex,
+		UIntN domainIndex,
+		PowerControlType::Type controlType,
+		const Power& powerLimit) override;
+	TimeSpan getPowerLimitTimeWindow(
+		UIntN participantIndex,
+		UIntN domainIndex,
+		PowerControlType::Type controlType) override;
+	void setPowerLimitTimeWindow(
+		UIntN participantIndex,
+		UIntN domainIndex,
+		PowerControlType::Type controlType,
+		const TimeSpan& timeWindow) override;
+	void setPowerLimitTimeWindowWithoutUpdatingEnabled(
+		UIntN participantIndex,
+		UIntN domainIndex,
+		PowerControlType::Type controlType,
+		const TimeSpan& timeWindow) override;
+	void setPowerLimitTimeWindowIgnoringCaps(
+		UIntN participantIndex,
+		UIntN domainIndex,
+		PowerControlType::Type controlType,
+		const TimeSpan& timeWindow) override;
+	void clearPowerLimitMin(UIntN participantIndex, UIntN domainIndex) override;
+	void clearPowerLimit(UIntN participantIndex, UIntN domainIndex) override;
+	Percentage getPowerLimitDutyCycle(
+		UIntN participantIndex,
+		UIntN domainIndex,
+		PowerControlType::Type controlType) override;
+	void setPowerLimitDutyCycle(
+		UIntN participantIndex,
+		UIntN domainIndex,
+		PowerControlType::Type controlType,
+		const Percentage& dutyCycle) override;
+	void setSocPowerFloorState(UIntN participantIndex, UIntN domainIndex, Bool socPowerFloorState) override;
+	PowerControlDynamicCapsSet getPowerControlDynamicCapsSet(UIntN participantIndex, UIntN domainIndex) override;
+	void setPowerControlDynamicCapsSet(
+		UIntN participantIndex,
+		UIntN domainIndex,
+		PowerControlDynamicCapsSet capsSet) override;
+	void setPowerCapsLock(UIntN participantIndex, UIntN domainIndex, Bool lock) override;
+	TimeSpan getPowerSharePowerLimitTimeWindow(UIntN participantIndex, UIntN domainIndex) override;
+	Bool isPowerShareControl(UIntN participantIndex, UIntN domainIndex) override;
+	double getPidKpTerm(UIntN participantIndex, UIntN domainIndex) override;
+	double getPidKiTerm(UIntN participantIndex, UIntN domainIndex) override;
+	TimeSpan getAlpha(UIntN participantIndex, UIntN domainIndex) override;
+	TimeSpan getFastPollTime(UIntN participantIndex, UIntN domainIndex) override;
+	TimeSpan getSlowPollTime(UIntN participantIndex, UIntN domainIndex) override;
+	TimeSpan getWeightedSlowPollAvgConstant(UIntN participantIndex, UIntN domainIndex) override;
+	Power getSlowPollPowerThreshold(UIntN participantIndex, UIntN domainIndex) override;
+	Power getThermalDesignPower(UIntN participantIndex, UIntN domainIndex) override;
+	void removePowerLimitPolicyRequest(
+		UIntN participantIndex,
+		UIntN domainIndex,
+		PowerControlType::Type controlType) override;
+	void setPowerSharePolicyPower(
+		UIntN participantIndex,
+		UIntN domainIndex,
+		const Power& powerSharePolicyPower) override;
+	void setPowerShareEffectiveBias(UIntN participantIndex, UIntN domainIndex, UInt32 powerShareEffectiveBias) override;
+
+	// DomainPowerStatusInterface
+	PowerStatus getPowerStatus(UIntN participantIndex, UIntN domainIndex) override;
+	Power getAveragePower(
+		UIntN participantIndex,
+		UIntN domainIndex,
+		const PowerControlDynamicCaps& capabilities) override;
+	Power getPowerValue(UIntN participantIndex, UIntN domainIndex) override;
+	void setCalculatedAveragePower(UIntN participantIndex, UIntN domainIndex, Power powerValue) override;
+
+	// DomainSystemPowerControlInterface
+	Bool isSystemPowerLimitEnabled(
+		UIntN participantIndex,
+		UIntN domainIndex,
+		PsysPowerLimitType::Type limitType) override;
+	Power getSystemPowerLimit(UIntN participantIndex, UIntN domainIndex, PsysPowerLimitType::Type limitType) override;
+	void setSystemPowerLimit(
+		UIntN participantIndex,
+		UIntN domainIndex,
+		PsysPowerLimitType::Type limitType,
+		const Power& powerLimit) override;
+	TimeSpan getSystemPowerLimitTimeWindow(
+		UIntN participantIndex,
+		UIntN domainIndex,
+		PsysPowerLimitType::Type limitType) override;
+	void setSystemPowerLimitTimeWindow(
+		UIntN participantIndex,
+		UIntN domainIndex,
+		PsysPowerLimitType::Type limitType,
+		const TimeSpan& timeWindow) override;
+	Percentage getSystemPowerLimitDutyCycle(
+		UIntN participantIndex,
+		UIntN domainIndex,
+		PsysPowerLimitType::Type limitType) override;
+	void setSystemPowerLimitDutyCycle(
+		UIntN participantIndex,
+		UIntN domainIndex,
+		PsysPowerLimitType::Type limitType,
+		const Percentage& dutyCycle) override;
+
+	// DomainPlatformPowerStatusInterface
+	Power getPlatformRestOfPower(UIntN participantIndex, UIntN domainIndex) override;
+	Power getAdapterPowerRating(UIntN participantIndex, UIntN domainIndex) override;
+	PlatformPowerSource::Type getPlatformPowerSource(UIntN participantIndex, UIntN domainIndex) override;
+	UInt32 getACNominalVoltage(UIntN participantIndex, UIntN domainIndex) override;
+	UInt32 getACOperationalCurrent(UIntN participantIndex, UIntN domainIndex) override;
+	Percentage getAC1msPercentageOverload(UIntN participantIndex, UIntN domainIndex) override;
+	Percentage getAC2msPercentageOverload(UIntN participantIndex, UIntN domainIndex) override;
+	Percentage getAC10msPercentageOverload(UIntN participantIndex, UIntN domainIndex) override;
+	void notifyForProcHotDeAssertion(UIntN participantIndex, UIntN domainIndex) override;
+
+	// DomainPriorityInterface
+	DomainPriority getDomainPriority(UIntN participantIndex, UIntN domainIndex) override;
+
+	// DomainRfProfileControlInterface
+	RfProfileCapabilities getRfProfileCapabilities(UIntN participantIndex, UIntN domainIndex) override;
+	void setRfProfileCenterFrequency(
+		UIntN participantIndex,
+		UIntN domainIndex,
+		const Frequency& centerFrequency) override;
+	Percentage getSscBaselineSpreadValue(UIntN participantIndex, UIntN domainIndex) override;
+	Percentage getSscBaselineThreshold(UIntN participantIndex, UIntN domainIndex) override;
+	Percentage getSscBaselineGuardBand(UIntN participantIndex, UIntN domainIndex) override;
+
+	// DomainRfProfileStatusInterface
+	RfProfileDataSet getRfProfileDataSet(UIntN participantIndex, UIntN domainIndex) override;
+	UInt32 getWifiCapabilities(UIntN participantIndex, UIntN domainIndex) override;
+	UInt32 getRfiDisable(UIntN participantIndex, UIntN domainIndex) override;
+	UInt64 getDvfsPoints(UIntN participantIndex, UIntN domainIndex) override;
+	UInt32 getDlvrSsc(UIntN participantIndex, UIntN domainIndex) override;
+	Frequency getDlvrCenterFrequency(UIntN participantIndex, UIntN domainIndex) override;
+	void setDdrRfiTable(
+		UIntN participantIndex,
+		UIntN domainIndex,
+		const DdrfChannelBandPackage::WifiRfiDdr& ddrRfiStruct) override;
+	void sendMasterControlStatus(UIntN participantIndex, UIntN domainIndex, UInt32 masterControlStatus) override;
+	void setProtectRequest(UIntN participantIndex, UIntN domainIndex, UInt64 frequencyRate) override;
+	void setRfProfileOverride(
+		UIntN participantIndex,
+		UIntN domainIndex,
+		const DptfBuffer& rfProfileBufferData) override;
+	void setDlvrCenterFrequency(UIntN participantIndex, UIntN domainIndex, Frequency frequency) override;
+
+	// DomainUtilizationInterface
+	UtilizationStatus getUtilizationStatus(UIntN participantIndex, UIntN domainIndex) override;
+	Percentage getMaxCoreUtilization(UIntN participantIndex, UIntN domainIndex) override;
+
+	// ParticipantGetSpecificInfoInterface
+	std::map<ParticipantSpecificInfoKey::Type, Temperature> getParticipantSpecificInfo(
+		UIntN participantIndex,
+		const std::vector<ParticipantSpecificInfoKey::Type>& requestedInfo) override;
+
+	// ParticipantPropertiesInterface
+	ParticipantProperties getParticipantProperties(UIntN participantIndex) const override;
+	DomainPropertiesSet getDomainPropertiesSet(UIntN participantIndex) const override;
+
+	// ParticipantSetSpecificInfoInterface
+	void setParticipantDeviceTemperatureIndication(UIntN participantIndex, const Temperature& temperature) override;
+	void setParticipantSpecificInfo(
+		UIntN participantIndex,
+		ParticipantSpecificInfoKey::Type tripPoint,
+		const Temperature& tripValue) override;
+
+	// PlatformConfigurationDataInterface
+	UInt32 readConfigurationUInt32(const std::string& key) override;
+	UInt32 readConfigurationUInt32(const std::string& nameSpace, const std::string& key) override;
+	void writeConfigurationUInt32(const std::string& key, UInt32 data) override;
+	void writeConfigurationString(const std::string& key, const std::string& data) override;
+	std::string readConfigurationString(const std::string& nameSpace, const std::string& key) override;
+	DptfBuffer readConfigurationBinary(const std::string& nameSpace, const std::string& key) override;
+	void writeConfigurationBinary(
+		void* bufferPtr,
+		UInt32 bufferLength,
+		UInt32 dataLength,
+		const std::string&,
+		const std::string&) override;
+	void deleteConfigurationBinary(const std::string& nameSpace, const std::string& elementPath) override;
+	eEsifError sendCommand(UInt32 argc, const std::string& argv) override;
+	TimeSpan getMinimumAllowableSamplePeriod() override;
+	DptfBuffer getActiveRelationshipTable() override;
+	void setActiveRelationshipTable(DptfBuffer data) override;
+	DptfBuffer getThermalRelationshipTable() override;
+	void setThermalRelationshipTable(DptfBuffer data) override;
+	DptfBuffer getPassiveTable() override;
+	void setPassiveTable(DptfBuffer data) override;
+	DptfBuffer getAdaptivePerformanceActionsTable(std::string uuid) override;
+	DptfBuffer getAdaptivePerformanceConditionsTable(std::string uuid) override;
+	DptfBuffer getOemVariables() override;
+	DptfBuffer getSwOemVariables() override;
+	void setSwOemVariables(const DptfBuffer& swOemVariablesData) override;
+	UInt64 getHwpfState(UIntN participantIndex, UIntN domainIndex) override;
+	UInt32 getProcessorConfigTdpControl(UIntN participantIndex, UIntN domainIndex) override;
+	Power getProcessorConfigTdpLevel(UIntN participantIndex, UIntN domainIndex, UIntN configTdpControl) override;
+	UInt32 getProcessorConfigTdpLock(UIntN participantIndex, UIntN domainIndex) override;
+	Power getProcessorTdp(UIntN participantIndex, UIntN domainIndex) const override;
+	Temperature getProcessorTjMax(UIntN participantIndex, UIntN domainIndex) override;
+	DptfBuffer getPowerBossConditionsTable() override;
+	DptfBuffer getPowerBossActionsTable() override;
+	DptfBuffer getPowerBossMathTable() override;
+	DptfBuffer getVoltageThresholdMathTable() override;
+	DptfBuffer getEmergencyCallModeTable() override;
+	DptfBuffer getPidAlgorithmTable() override;
+	Bool getDisplayRequired() override;
+	TimeSpan getExpectedBatteryLife() override;
+	UInt32 getAggressivenessLevel() override;
+	DptfBuffer getDdrfTable() override;
+	DptfBuffer getRfimTable() override;
+	DptfBuffer getAggregateDisplayInformation() override;
+	DptfBuffer getEnergyPerformanceOptimizerTable() override;
+	void setEnergyPerformanceOptimizerTable(DptfBuffer data) override;
+	DptfBuffer getTpgaTable() override;
+	void setTpgaTable(DptfBuffer data) override;
+	void setPidAlgorithmTable(DptfBuffer data) override;
+	DptfBuffer getActiveControlPointRelationshipTable() override;
+	void setActiveControlPointRelationshipTable(DptfBuffer data) override;
+	DptfBuffer getPowerShareAlgorithmTable() override;
+	void setPowerShareAlgorithmTable(DptfBuffer data) override;
+	DptfBuffer getPowerShareAlgorithmTable2() override;
+	void setPowerShareAlgorithmTable2(DptfBuffer data) override;
+	DptfBuffer getIntelligentThermalManagementTable() override;
+	void setIntelligentThermalManagementTable(DptfBuffer data) override;
+	void setPpmPackage(DptfBuffer package) override;
+	void setPpmPackageForNonBalancedSchemePersonality(DptfBuffer package) override;
+	DptfBuffer getPpmPackage(DptfBuffer package) override;
+	void setActivePowerScheme() override;
+	void setPowerSchemeEpp(UInt32 value) override;
+	void setForegroundAppRatioPeriod(UInt32 value) override;
+	void setProcessAffinityMask(const std::string& processName, UInt32 maskValue) override;
+	void setApplicationCompatibility(const DptfBuffer& processData) override;
+	void deleteApplicationCompatibility() override;
+	UInt32 getDynamicBoostState(UIntN participantIndex, UIntN domainIndex) override;
+	void setDynamicBoostState(UIntN participantIndex, UIntN domainIndex, UInt32 value) override;
+	UInt32 getTpgPowerStateWithoutCache(UIntN participantIndex, UIntN domainIndex) override;
+	EnvironmentProfile getEnvironmentProfile() const override;
+	void clearPpmPackageSettings() override;
+	UInt32 getLogicalProcessorCount(UIntN participantIndex, UIntN domainIndex) override;
+	UInt32 getPhysicalCoreCount(UIntN participantIndex, UIntN domainIndex) override;
+
+	// PlatformPowerStateInterface
+	void sleep(void) override;
+	void hibernate(
+		const Temperature& currentTemperature,
+		const Temperature& tripPointTemperature,
+		const std::string& participantName) override;
+	void shutDown(
+		const Temperature& currentTemperature,
+		const Temperature& tripPointTemperature,
+		const std::string& participantName) override;
+
+	// PolicyEventRegistrationInterface
+	void registerEvent(PolicyEvent::Type policyEvent) override;
+	void unregisterEvent(PolicyEvent::Type policyEvent) override;
+
+	// PolicyInitiatedCallbackInterface
+	UInt64 createPolicyInitiatedImmediateCallback(UInt64 policyDefinedEventCode, UInt64 param1, void* param2) override;
+	UInt64 createPolicyInitiatedDeferredCallback(
+		UInt64 policyDefinedEventCode,
+		UInt64 param1,
+		void* param2,
+		const TimeSpan& timeDelta) override;
+	Bool removePolicyInitiatedCallback(UInt64 callbackHandle) override;
+
+	// MessageLoggingInterface
+	void writeMessageFatal(const DptfMessage& message) override;
+	void writeMessageError(const DptfMessage& message) override;
+	void writeMessageWarning(const DptfMessage& message) override;
+	void writeMessageInfo(const DptfMessage& message) override;
+	void writeMessageDebug(const DptfMessage& message) override;
+	eLogType getLoggingLevel() override;
+
+	// PolicyWorkloadHintConfigurationInterface
+	void add(const PolicyWorkloadGroup& workloadGroup) override;
+	UInt32 getHintForApplication(const std::string& application) override;
+	std::shared_ptr<XmlNode> getXml() const override;
+	void reloadConfiguration() override;
+
+	// PlatformStateInterface
+	OnOffToggle::Type getMotion(void) const override;
+	SensorOrientation::Type getOrientation(void) const override;
+	SensorSpatialOrientation::Type getSpatialOrientation(void) const override;
+	OsLidState::Type getLidState(void) const override;
+	OsPowerSource::Type getPowerSource(void) const override;
+	std::string getForegroundApplicationName(void) const override;
+	CoolingMode::Type getCoolingMode(void) const override;
+	UIntN getBatteryPercentage(void) const override;
+	OsPlatformType::Type getPlatformType(void) const override;
+	OsDockMode::Type getDockMode(void) const override;
+	OsPowerSchemePersonality::Type getPowerSchemePersonality(void) const override;
+	UIntN getMobileNotification(OsMobileNotificationType::Type notificationType) const override;
+	OnOffToggle::Type getMixedRealityMode(void) const override;
+	OsUserPresence::Type getOsUserPresence(void) const override;
+	OsSessionState::Type getSessionState(void) const override;
+	OnOffToggle::Type getScreenState(void) const override;
+	UIntN getBatteryCount(void) const override;
+	UIntN getPowerSlider(void) const override;
+	SensorUserPresence::Type getPlatformUserPresence(void) const override;
+	OnOffToggle::Type getGameMode(void) const override;
+	UserInteraction::Type getUserInteraction(void) const override;
+	SystemMode::Type getSystemMode(void) const override;
+	OnOffToggle::Type getTpgPowerState(void) const override;
+	OnOffToggle::Type getCollaborationMode(void) const override;
+
+	// DptfServiceRequestInterface
+	DptfRequestResult submitRequest(DptfRequest request) override;
+	std::vector<DptfRequestResult> submitRequests(const std::vector<DptfRequest>& requests) override;
+
+private:
+	SimulatedPlatform& m_platform;
+	SimulatedTime& m_time;
+	SimulationStatistics& m_statistics;
+	std::set<PolicyEvent::Type> m_registeredEvents;
+	std::map<UInt64, SimulatedPolicyCallback> m_callbacks;
+	UInt64 m_nextCallbackHandle;
+
+	DptfRequestResult handleRequest(const DptfRequest& request);
+	DptfRequestResult handleTemperatureRequest(const DptfRequest& request);
+	DptfRequestResult handleActiveControlRequest(const DptfRequest& request);
+	UInt64 addCallback(UInt64 policyDefinedEventCode, UInt64 param1, void* param2, const TimeSpan& dueTime);
+	void recordDecision(UIntN participantIndex, SimulationDecisionType::Type type, const std::string& value);
+	void throwIfNotProcessor(UIntN participantIndex, const char* serviceName) const;
+	dptf_exception notSimulated(const char* serviceName) const;
+};
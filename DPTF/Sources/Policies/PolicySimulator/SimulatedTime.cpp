@@ -0,0 +1,39 @@
+/******************************************************************************
+** Copyright (c) 2013-2023 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "SimulatedTime.h"
+using namespace std;
+
+SimulatedTime::SimulatedTime(void)
+	: m_currentTime(TimeSpan::createFromMilliseconds(0))
+{
+}
+
+TimeSpan SimulatedTime::getCurrentTime(void)
+{
+	return m_currentTime;
+}
+
+void SimulatedTime::advanceTo(const TimeSpan& time)
+{
+	if (time < m_currentTime)
+	{
+		throw dptf_exception("Simulated time cannot move backwards.");
+	}
+	m_currentTime = time;
+}
@@ -0,0 +1,36 @@
+/******************************************************************************
+** Copyright (c) 2013-2023 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include "TimeInterface.h"
+
+// an implementation of the time interface that only moves when the simulator advances it.  every policy
+// decision made during a simulation is timed against this clock, which makes runs repeatable.
+class SimulatedTime : public TimeInterface
+{
+public:
+	SimulatedTime(void);
+
+	virtual TimeSpan getCurrentTime(void) override;
+	void advanceTo(const TimeSpan& time);
+
+private:
+	TimeSpan m_currentTime;
+};
@@ -0,0 +1,205 @@
+/******************************************************************************
+** Copyright (c) 2013-2023 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "SimulationStatistics.h"
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+using namespace std;
+
+static const UInt64 DigestOffsetBasis = 0xcbf29ce484222325ULL;
+static const UInt64 DigestPrime = 0x100000001b3ULL;
+
+namespace SimulationDecisionType
+{
+	std::string ToString(SimulationDecisionType::Type type)
+	{
+		switch (type)
+		{
+		case PerformanceControl:
+			return "performance control";
+		case FanSpeed:
+			return "fan speed";
+		case TemperatureThresholds:
+			return "temperature thresholds";
+		case PlatformPowerState:
+			return "platform power state";
+		default:
+			return Constants::InvalidString;
+		}
+	}
+}
+
+static double toMicroseconds(UInt64 nanoseconds)
+{
+	return nanoseconds / 1000.0;
+}
+
+static UInt64 percentile(const vector<UInt64>& sortedSamples, UIntN percent)
+{
+	if (sortedSamples.empty())
+	{
+		return 0;
+	}
+	return sortedSamples[((sortedSamples.size() - 1) * percent) / 100];
+}
+
+SimulationStatistics::SimulationStatistics(Bool echoDecisions)
+	: m_echoDecisions(echoDecisions)
+	, m_decisionDigest(DigestOffsetBasis)
+{
+	fill(begin(m_decisionCounts), end(m_decisionCounts), 0);
+}
+
+void SimulationStatistics::recordCall(
+	const string& callName,
+	UInt64 latencyInNanoseconds,
+	UInt64 allocations,
+	Bool failed)
+{
+	auto& samples = m_calls[callName];
+	samples.latenciesInNanoseconds.push_back(latencyInNanoseconds);
+	samples.allocations += allocations;
+	samples.failures += failed ? 1 : 0;
+}
+
+void SimulationStatistics::recordDecision(
+	const TimeSpan& time,
+	const string& participantName,
+	SimulationDecisionType::Type type,
+	const string& value)
+{
+	m_decisionCounts[type]++;
+	addToDigest(time.asMillisecondsInt());
+	addToDigest(participantName);
+	addToDigest(type);
+	addToDigest(value);
+
+	if (m_echoDecisions)
+	{
+		cout << fixed << setprecision(1) << setw(10) << time.asSeconds() << "s  " << setw(6) << participantName << "  "
+			 << SimulationDecisionType::ToString(type) << " = " << value << endl;
+	}
+}
+
+void SimulationStatistics::recordUnsimulatedService(const string& serviceName)
+{
+	m_unsimulatedServices[serviceName]++;
+}
+
+UInt64 SimulationStatistics::getCallCount() const
+{
+	UInt64 callCount = 0;
+	for (const auto& call : m_calls)
+	{
+		callCount += call.second.latenciesInNanoseconds.size();
+	}
+	return callCount;
+}
+
+UInt64 SimulationStatistics::getPolicyTimeInNanoseconds() const
+{
+	UInt64 policyTime = 0;
+	for (const auto& call : m_calls)
+	{
+		for (auto latency : call.second.latenciesInNanoseconds)
+		{
+			policyTime += latency;
+		}
+	}
+	return policyTime;
+}
+
+UInt64 SimulationStatistics::getDecisionCount() const
+{
+	UInt64 decisionCount = 0;
+	for (auto count : m_decisionCounts)
+	{
+		decisionCount += count;
+	}
+	return decisionCount;
+}
+
+UInt64 SimulationStatistics::getDecisionDigest() const
+{
+	return m_decisionDigest;
+}
+
+string SimulationStatistics::getCallReport() const
+{
+	stringstream report;
+	report << left << setw(42) << "Call" << right << setw(9) << "Count" << setw(10) << "Mean us" << setw(10)
+		   << "P50 us" << setw(10) << "P99 us" << setw(10) << "Max us" << setw(12) << "Allocs/call" << setw(9)
+		   << "Failed" << endl;
+	for (const auto& call : m_calls)
+	{
+		auto samples = call.second.latenciesInNanoseconds;
+		sort(samples.begin(), samples.end());
+		UInt64 total = 0;
+		for (auto latency : samples)
+		{
+			total += latency;
+		}
+		const double count = (double)samples.size();
+		report << left << setw(42) << call.first << right << setw(9) << samples.size() << fixed << setprecision(2)
+			   << setw(10) << toMicroseconds(total) / count << setw(10) << toMicroseconds(percentile(samples, 50))
+			   << setw(10) << toMicroseconds(percentile(samples, 99)) << setw(10)
+			   << toMicroseconds(samples.back()) << setprecision(1) << setw(12) << call.second.allocations / count
+			   << setw(9) << call.second.failures << endl;
+	}
+	return report.str();
+}
+
+string SimulationStatistics::getDecisionReport() const
+{
+	stringstream report;
+	for (UIntN type = 0; type < SimulationDecisionType::Max; type++)
+	{
+		report << "  " << left << setw(24) << SimulationDecisionType::ToString((SimulationDecisionType::Type)type)
+			   << right << setw(10) << m_decisionCounts[type] << endl;
+	}
+	return report.str();
+}
+
+string SimulationStatistics::getUnsimulatedServiceReport() const
+{
+	stringstream report;
+	for (const auto& service : m_unsimulatedServices)
+	{
+		report << "  " << left << setw(56) << service.first << right << setw(10) << service.second << endl;
+	}
+	return report.str();
+}
+
+void SimulationStatistics::addToDigest(Int64 value)
+{
+	for (UIntN byte = 0; byte < sizeof(value); byte++)
+	{
+		m_decisionDigest ^= (UInt64)((value >> (byte * 8)) & 0xFF);
+		m_decisionDigest *= DigestPrime;
+	}
+}
+
+void SimulationStatistics::addToDigest(const string& value)
+{
+	for (auto character : value)
+	{
+		addToDigest(character);
+	}
+	addToDigest(value.size());
+}
@@ -0,0 +1,78 @@
+/******************************************************************************
+** Copyright (c) 2013-2023 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+
+namespace SimulationDecisionType
+{
+	enum Type
+	{
+		PerformanceControl,
+		FanSpeed,
+		TemperatureThresholds,
+		PlatformPowerState,
+		Max
+	};
+
+	std::string ToString(SimulationDecisionType::Type type);
+}
+
+// Collects what a simulation run measured: the latency and allocation count of every call into the policy,
+// every control decision the policy made, and the services the policy asked for that are not simulated.
+// Decisions are folded into a digest in the order they are made, so two runs of the same policy over the
+// same trace can be compared with a single number.
+class SimulationStatistics
+{
+public:
+	SimulationStatistics(Bool echoDecisions);
+
+	void recordCall(const std::string& callName, UInt64 latencyInNanoseconds, UInt64 allocations, Bool failed);
+	void recordDecision(
+		const TimeSpan& time,
+		const std::string& participantName,
+		SimulationDecisionType::Type type,
+		const std::string& value);
+	void recordUnsimulatedService(const std::string& serviceName);
+
+	UInt64 getCallCount() const;
+	UInt64 getPolicyTimeInNanoseconds() const;
+	UInt64 getDecisionCount() const;
+	UInt64 getDecisionDigest() const;
+	std::string getCallReport() const;
+	std::string getDecisionReport() const;
+	std::string getUnsimulatedServiceReport() const;
+
+private:
+	struct CallSamples
+	{
+		std::vector<UInt64> latenciesInNanoseconds;
+		UInt64 allocations;
+		UInt64 failures;
+	};
+
+	Bool m_echoDecisions;
+	std::map<std::string, CallSamples> m_calls;
+	UInt64 m_decisionCounts[SimulationDecisionType::Max];
+	UInt64 m_decisionDigest;
+	std::map<std::string, UInt64> m_unsimulatedServices;
+
+	void addToDigest(Int64 value);
+	void addToDigest(const std::string& value);
+};
@@ -0,0 +1,164 @@
+/******************************************************************************
+** Copyright (c) 2013-2023 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "SimulationTrace.h"
+#include "StringConverter.h"
+#include "StringParser.h"
+#include <algorithm>
+#include <fstream>
+#include <random>
+using namespace std;
+
+// synthetic workload phases, in seconds and tenths of a Watt.  std::mt19937 produces the same sequence
+// for a given seed on every platform, so only its raw output is used to pick phases.
+static const UInt32 MinPhaseSeconds = 2;
+static const UInt32 MaxPhaseSeconds = 60;
+static const UInt32 IdlePhasePercent = 40;
+static const UInt32 SustainedPhasePercent = 35;
+static const UInt32 IdleMinTenthWatts = 20;
+static const UInt32 IdleMaxTenthWatts = 60;
+static const UInt32 SustainedMinTenthWatts = 100;
+static const UInt32 SustainedMaxTenthWatts = 250;
+static const UInt32 BurstMinTenthWatts = 300;
+static const UInt32 BurstMaxTenthWatts = 450;
+
+static UInt32 pickInRange(mt19937& generator, UInt32 minValue, UInt32 maxValue)
+{
+	return minValue + (generator() % (maxValue - minValue + 1));
+}
+
+SimulationTrace::SimulationTrace(const vector<SimulationTraceEntry>& entries)
+	: m_entries(entries)
+{
+	stable_sort(m_entries.begin(), m_entries.end(), [](const SimulationTraceEntry& a, const SimulationTraceEntry& b) {
+		return a.time < b.time;
+	});
+}
+
+SimulationTrace SimulationTrace::createFromFile(const string& fileName)
+{
+	ifstream file(fileName);
+	if (!file.is_open())
+	{
+		throw dptf_exception("Failed to open trace file " + fileName + ".");
+	}
+
+	vector<SimulationTraceEntry> entries;
+	string line;
+	UIntN lineNumber = 0;
+	while (getline(file, line))
+	{
+		lineNumber++;
+		line = StringParser::trimWhitespace(line);
+		if (line.empty() || line[0] == '#')
+		{
+			continue;
+		}
+		entries.push_back(parseEntry(line, lineNumber));
+	}
+	return SimulationTrace(entries);
+}
+
+SimulationTrace SimulationTrace::createSyntheticWorkload(
+	const string& participantName,
+	const TimeSpan& duration,
+	UInt32 seed)
+{
+	mt19937 generator(seed);
+	vector<SimulationTraceEntry> entries;
+	TimeSpan phaseStart = TimeSpan::createFromMilliseconds(0);
+	while (phaseStart < duration)
+	{
+		UInt32 tenthWatts;
+		const UInt32 phaseKind = generator() % 100;
+		if (phaseKind < IdlePhasePercent)
+		{
+			tenthWatts = pickInRange(generator, IdleMinTenthWatts, IdleMaxTenthWatts);
+		}
+		else if (phaseKind < IdlePhasePercent + SustainedPhasePercent)
+		{
+			tenthWatts = pickInRange(generator, SustainedMinTenthWatts, SustainedMaxTenthWatts);
+		}
+		else
+		{
+			tenthWatts = pickInRange(generator, BurstMinTenthWatts, BurstMaxTenthWatts);
+		}
+
+		SimulationTraceEntry entry;
+		entry.time = phaseStart;
+		entry.type = SimulationTraceEntryType::Power;
+		entry.participantName = participantName;
+		entry.value = tenthWatts / 10.0;
+		entries.push_back(entry);
+
+		phaseStart = phaseStart + TimeSpan::createFromSeconds(pickInRange(generator, MinPhaseSeconds, MaxPhaseSeconds));
+	}
+	return SimulationTrace(entries);
+}
+
+const vector<SimulationTraceEntry>& SimulationTrace::getEntries() const
+{
+	return m_entries;
+}
+
+SimulationTraceEntry SimulationTrace::parseEntry(const string& line, UIntN lineNumber)
+{
+	try
+	{
+		auto fields = StringParser::split(line, ',');
+		if (fields.size() != 4)
+		{
+			throw dptf_exception("expected <milliseconds>,<type>,<participant>,<value>");
+		}
+		for (auto& field : fields)
+		{
+			field = StringParser::trimWhitespace(field);
+		}
+
+		SimulationTraceEntry entry;
+		entry.time = TimeSpan::createFromMilliseconds(StringConverter::toUInt64(fields[0]));
+		entry.participantName = fields[2];
+		entry.value = 0.0;
+
+		const auto type = StringConverter::toLower(fields[1]);
+		if (type == "temperature")
+		{
+			entry.type = SimulationTraceEntryType::Temperature;
+			entry.value = StringConverter::toDouble(fields[3]);
+		}
+		else if (type == "power")
+		{
+			entry.type = SimulationTraceEntryType::Power;
+			entry.value = StringConverter::toDouble(fields[3]);
+		}
+		else if (type == "event")
+		{
+			entry.type = SimulationTraceEntryType::Event;
+			entry.eventName = StringConverter::toLower(fields[3]);
+		}
+		else
+		{
+			throw dptf_exception("unknown entry type \"" + fields[1] + "\"");
+		}
+		return entry;
+	}
+	catch (const dptf_exception& ex)
+	{
+		throw dptf_exception("Trace line " + to_string(lineNumber) + ": " + ex.getDescription());
+	}
+}
@@ -0,0 +1,62 @@
+/******************************************************************************
+** Copyright (c) 2013-2023 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+
+namespace SimulationTraceEntryType
+{
+	enum Type
+	{
+		Temperature, // pins a participant's temperature to a recorded value (Celsius)
+		Power, // sets the power demanded from a participant (Watts)
+		Event // delivers a platform event to the policy
+	};
+}
+
+struct SimulationTraceEntry
+{
+	TimeSpan time;
+	SimulationTraceEntryType::Type type;
+	std::string participantName;
+	double value;
+	std::string eventName;
+};
+
+// A time-ordered list of platform inputs that drives a simulation.  Traces are either recorded and read
+// from a file, one "<milliseconds>,<temperature|power|event>,<participant>,<value>" entry per line, or
+// generated from a seed as a synthetic workload of idle, sustained and burst power phases.
+class SimulationTrace
+{
+public:
+	SimulationTrace(const std::vector<SimulationTraceEntry>& entries);
+
+	static SimulationTrace createFromFile(const std::string& fileName);
+	static SimulationTrace createSyntheticWorkload(
+		const std::string& participantName,
+		const TimeSpan& duration,
+		UInt32 seed);
+
+	const std::vector<SimulationTraceEntry>& getEntries() const;
+
+private:
+	std::vector<SimulationTraceEntry> m_entries;
+
+	static SimulationTraceEntry parseEntry(const std::string& line, UIntN lineNumber);
+};
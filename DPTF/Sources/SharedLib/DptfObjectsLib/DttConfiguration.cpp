@@ -17,6 +17,8 @@
 ******************************************************************************/
 
 #include "DttConfiguration.h"
+#include <algorithm>
+#include <numeric>
 using namespace std;
 
 #define CONFIGDB_ENTRY_DELIMITER ","
@@ -25,11 +27,13 @@ constexpr auto INDENT_WIDTH = 4;
 DttConfiguration::DttConfiguration(const DttConfigurationSegment& configSegment)
 {
 	m_segments.emplace_back(configSegment);
+	buildSegmentIndexes();
 }
 
 DttConfiguration::DttConfiguration(const std::vector<DttConfigurationSegment>& segments)
 {
 	m_segments = segments;
+	buildSegmentIndexes();
 }
 
 DttConfiguration::DttConfiguration(const ConfigurationFileContent& configurationFileContent)
@@ -39,6 +43,7 @@ DttConfiguration::DttConfiguration(const ConfigurationFileContent& configuration
 		const auto configSegment = DttConfigurationSegment::createFromBson(segment);
 		m_segments.emplace_back(configSegment);
 	}
+	buildSegmentIndexes();
 }
 
 DttConfiguration::DttConfiguration(const std::shared_ptr<ConfigurationFileContentInterface>& configurationFileContent)
@@ -48,6 +53,7 @@ DttConfiguration::DttConfiguration(const std::shared_ptr<ConfigurationFileConten
 		const auto configSegment = DttConfigurationSegment::createFromBson(segment);
 		m_segments.emplace_back(configSegment);
 	}
+	buildSegmentIndexes();
 }
 
 vector<DttConfigurationSegment> DttConfiguration::getSegmentsWithValue(const string& value) const
@@ -120,6 +126,14 @@ vector<DttConfigurationSegment> DttConfiguration::getSegmentsWithAllProperties(
 vector<DttConfigurationSegment> DttConfiguration::getSegmentsWithEnvironmentProfile(
 	const EnvironmentProfile& environmentProfile) const
 {
+	const auto profileKey =
+		environmentProfile.cpuIdWithoutStepping + "/"s + environmentProfile.socBasePower.toStringAsWatts(0);
+	const auto cachedSegments = m_segmentsByEnvironmentProfile.find(profileKey);
+	if (cachedSegments != m_segmentsByEnvironmentProfile.end())
+	{
+		return cachedSegments->second;
+	}
+
 	auto segments = getSegmentsWithExactEnvironmentProfile(environmentProfile);
 	auto segmentsWithCpuId = getSegmentsWithMatchedCpuIdInEpoSegments(environmentProfile.cpuIdWithoutStepping);
 	auto segmentsWithEmpties = getSegmentsWithEnvironmentProfileIncludingEmpty(environmentProfile);
@@ -129,6 +143,7 @@ vector<DttConfigurationSegment> DttConfiguration::getSegmentsWithEnvironmentProf
 	addUniqueSegments(segments, segmentsWithEmpties);
 	combineWithDefaultSegments(segments, segmentsWithDefaultLabel);
 
+	m_segmentsByEnvironmentProfile[profileKey] = segments;
 	return segments;
 }
 
@@ -136,8 +151,9 @@ vector<DttConfigurationSegment> DttConfiguration::getSegmentsWithExactEnvironmen
 	const EnvironmentProfile& environmentProfile) const
 {
 	vector<DttConfigurationSegment> segments;
-	for (const auto& segment : m_segments)
+	for (const auto segmentIndex : findCandidateSegments(m_segmentsByCpuId, environmentProfile.cpuIdWithoutStepping))
 	{
+		const auto& segment = m_segments[segmentIndex];
 		if (segment.matchesEnvironmentProfile(environmentProfile))
 		{
 			segments.emplace_back(segment);
@@ -150,8 +166,9 @@ vector<DttConfigurationSegment> DttConfiguration::getSegmentsWithEnvironmentProf
 	const EnvironmentProfile& environmentProfile) const
 {
 	vector<DttConfigurationSegment> segments;
-	for (const auto& segment : m_segments)
+	for (const auto segmentIndex : findCandidateSegmentsIncludingEmpty(environmentProfile.cpuIdWithoutStepping))
 	{
+		const auto& segment = m_segments[segmentIndex];
 		if (segment.matchesEnvironmentProfileIncludingEmptyValue(environmentProfile))
 		{
 			segments.emplace_back(segment);
@@ -164,8 +181,9 @@ vector<DttConfigurationSegment> DttConfiguration::getSegmentsWithMatchedCpuIdInE
 	const string& cpuId) const
 {
 	vector<DttConfigurationSegment> segments;
-	for (const auto& segment : m_segments)
+	for (const auto segmentIndex : findCandidateSegments(m_segmentsByEpoCpuId, cpuId))
 	{
+		const auto& segment = m_segments[segmentIndex];
 		if (segment.matchesCpuIdInEpoSegment(cpuId))
 		{
 			segments.emplace_back(segment);
@@ -179,8 +197,9 @@ vector<DttConfigurationSegment> DttConfiguration::getSegmentsWithEnvironmentProf
 	const string& label) const
 {
 	vector<DttConfigurationSegment> segments;
-	for (const auto& segment : m_segments)
+	for (const auto segmentIndex : findCandidateSegments(m_segmentsByLabel, label))
 	{
+		const auto& segment = m_segments[segmentIndex];
 		if (segment.hasLabel(label)
 			&& segment.matchesEnvironmentProfileIncludingEmptyValue(environmentProfile))
 		{
@@ -249,4 +268,70 @@ void DttConfiguration::combineWithDefaultSegments(
 			segment = defaultSuperSet + segment;
 		}
 	}
-}
\ No newline at end of file
+}
+
+void DttConfiguration::buildSegmentIndexes()
+{
+	for (size_t segmentIndex = 0; segmentIndex < m_segments.size(); segmentIndex++)
+	{
+		const auto& segment = m_segments[segmentIndex];
+		const auto cpuIds = segment.getEnvironmentCpuIds();
+		for (const auto& cpuId : cpuIds)
+		{
+			m_segmentsByCpuId[cpuId].emplace_back(segmentIndex);
+		}
+		if (cpuIds.empty() || (cpuIds.find(string()) != cpuIds.end()))
+		{
+			m_segmentsWithAnyCpuId.emplace_back(segmentIndex);
+		}
+
+		for (const auto& cpuId : segment.getEpoCpuIds())
+		{
+			m_segmentsByEpoCpuId[cpuId].emplace_back(segmentIndex);
+		}
+
+		for (const auto& label : segment.getLabels())
+		{
+			m_segmentsByLabel[label].emplace_back(segmentIndex);
+		}
+	}
+}
+
+// Returns the segments, in order, that have the value in the index. A value that is not a literal
+// query may match any indexed value, so every segment is returned to be tested.
+vector<size_t> DttConfiguration::findCandidateSegments(
+	const unordered_map<string, vector<size_t>>& segmentIndex,
+	const string& value) const
+{
+	if (!DttConfigurationQuery(value).isLiteral())
+	{
+		return allSegments();
+	}
+
+	const auto segments = segmentIndex.find(value);
+	if (segments == segmentIndex.end())
+	{
+		return {};
+	}
+	return segments->second;
+}
+
+vector<size_t> DttConfiguration::findCandidateSegmentsIncludingEmpty(const string& cpuId) const
+{
+	const auto segmentsWithCpuId = findCandidateSegments(m_segmentsByCpuId, cpuId);
+	vector<size_t> segments;
+	set_union(
+		segmentsWithCpuId.begin(),
+		segmentsWithCpuId.end(),
+		m_segmentsWithAnyCpuId.begin(),
+		m_segmentsWithAnyCpuId.end(),
+		back_inserter(segments));
+	return segments;
+}
+
+vector<size_t> DttConfiguration::allSegments() const
+{
+	vector<size_t> segments(m_segments.size());
+	iota(segments.begin(), segments.end(), 0);
+	return segments;
+}
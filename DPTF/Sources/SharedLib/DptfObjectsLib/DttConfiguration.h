@@ -22,7 +22,13 @@
 #include "DttConfigurationProperty.h"
 #include "DttConfigurationSegment.h"
 #include "EnvironmentProfile.h"
+#include <map>
+#include <unordered_map>
 
+// Segments are indexed by the values of their CPU ID and label keys when the configuration is
+// created, so that selecting segments by environment profile only tests the segments that can
+// match. Selections are cached per environment profile; a DttConfiguration is not shared between
+// threads.
 class dptf_export DttConfiguration
 {
 public:
@@ -63,6 +69,17 @@ private:
 	void combineWithDefaultSegments(
 		std::vector<DttConfigurationSegment>& existingSegments,
 		std::vector<DttConfigurationSegment>& defaultSegments) const;
+	void buildSegmentIndexes();
+	std::vector<size_t> findCandidateSegments(
+		const std::unordered_map<std::string, std::vector<size_t>>& segmentIndex,
+		const std::string& value) const;
+	std::vector<size_t> findCandidateSegmentsIncludingEmpty(const std::string& cpuId) const;
+	std::vector<size_t> allSegments() const;
 
 	std::vector<DttConfigurationSegment> m_segments;
+	std::unordered_map<std::string, std::vector<size_t>> m_segmentsByCpuId;
+	std::unordered_map<std::string, std::vector<size_t>> m_segmentsByEpoCpuId;
+	std::unordered_map<std::string, std::vector<size_t>> m_segmentsByLabel;
+	std::vector<size_t> m_segmentsWithAnyCpuId;
+	mutable std::map<std::string, std::vector<DttConfigurationSegment>> m_segmentsByEnvironmentProfile;
 };
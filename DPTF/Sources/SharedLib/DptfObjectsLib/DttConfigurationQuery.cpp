@@ -18,14 +18,25 @@
 
 #include "DttConfigurationQuery.h"
 #include <sstream>
+#include <cstring>
 using namespace std;
 
+// Not std::string, since queries may be constructed during static initialization of other files
+static constexpr const char* RegexSpecialCharacters = "\\^$.|?*+()[]{}";
+static constexpr const char* RegexOptionalQuantifiers = "*?{";
+static constexpr const char* WildcardSuffix = ".*";
+static constexpr const char* LineTerminators = "\r\n";
+static constexpr const char* RegexGroupingCharacters = "\\|()[]{}";
+
 DttConfigurationQuery::DttConfigurationQuery(const string& regexString)
 	: m_regularExpression(regexString)
+	, m_matchType(MatchType::Regex)
 {
+	compile();
 }
 
 DttConfigurationQuery::DttConfigurationQuery(const list<string>& regexCollection)
+	: m_matchType(MatchType::Regex)
 {
 	stringstream stream;
 	for (const auto& r : regexCollection)
@@ -33,13 +44,53 @@ DttConfigurationQuery::DttConfigurationQuery(const list<string>& regexCollection
 		stream << r;
 	}
 	m_regularExpression = stream.str();
+	compile();
 }
 
 regex DttConfigurationQuery::toRegex() const
 {
+	if (m_regex)
+	{
+		return *m_regex;
+	}
 	return regex(m_regularExpression);
 }
 
+bool DttConfigurationQuery::matches(const string& text) const
+{
+	switch (m_matchType)
+	{
+	case MatchType::Literal:
+		return text == m_literalPrefix;
+	case MatchType::Prefix:
+		// ".*" does not match line terminators
+		return (text.compare(0, m_literalPrefix.size(), m_literalPrefix) == 0)
+			   && (text.find_first_of(LineTerminators, m_literalPrefix.size()) == string::npos);
+	default:
+		if (!m_regex)
+		{
+			// An invalid expression was not compiled; toRegex() throws the same error the caller always got
+			return regex_match(text, toRegex());
+		}
+		if (!m_requiredLiteral.empty() && (text.find(m_requiredLiteral) == string::npos))
+		{
+			return false;
+		}
+		return regex_match(text, *m_regex);
+	}
+}
+
+bool DttConfigurationQuery::isLiteral() const
+{
+	return m_matchType == MatchType::Literal;
+}
+
+// All strings matched by this query start with this prefix (which may be empty)
+const string& DttConfigurationQuery::getLiteralPrefix() const
+{
+	return m_literalPrefix;
+}
+
 bool DttConfigurationQuery::operator==(const DttConfigurationQuery& other) const
 {
 	return m_regularExpression == other.m_regularExpression;
@@ -53,4 +104,86 @@ bool DttConfigurationQuery::operator<(const DttConfigurationQuery& other) const
 const 	string& DttConfigurationQuery::toString() const
 {
 	return m_regularExpression;
-}
\ No newline at end of file
+}
+
+void DttConfigurationQuery::compile()
+{
+	const auto firstSpecialCharacter = m_regularExpression.find_first_of(RegexSpecialCharacters);
+	if (firstSpecialCharacter == string::npos)
+	{
+		m_matchType = MatchType::Literal;
+		m_literalPrefix = m_regularExpression;
+		return;
+	}
+
+	if (m_regularExpression.compare(firstSpecialCharacter, string::npos, WildcardSuffix) == 0)
+	{
+		m_matchType = MatchType::Prefix;
+		m_literalPrefix = m_regularExpression.substr(0, firstSpecialCharacter);
+		return;
+	}
+
+	m_matchType = MatchType::Regex;
+	m_literalPrefix = findRegexLiteralPrefix(firstSpecialCharacter);
+	m_requiredLiteral = findRegexRequiredLiteral();
+	try
+	{
+		m_regex = make_shared<const regex>(m_regularExpression);
+	}
+	catch (const regex_error&)
+	{
+		// Leave it to matches() to throw for every string, as toRegex() always did
+		m_regex.reset();
+		m_literalPrefix.clear();
+		m_requiredLiteral.clear();
+	}
+}
+
+string DttConfigurationQuery::findRegexLiteralPrefix(size_t firstSpecialCharacter) const
+{
+	// An alternation may not share the prefix of its first branch
+	if (m_regularExpression.find('|') != string::npos)
+	{
+		return string();
+	}
+
+	auto prefixLength = firstSpecialCharacter;
+	if ((prefixLength > 0)
+		&& (strchr(RegexOptionalQuantifiers, m_regularExpression[firstSpecialCharacter]) != nullptr))
+	{
+		// The quantifier applies to the last literal character, which may not be present
+		prefixLength--;
+	}
+	return m_regularExpression.substr(0, prefixLength);
+}
+
+// Returns the longest run of literal characters that every matching string must contain, so that
+// strings without it can be rejected before running the regex. Only expressions made of literals,
+// '.', anchors and the '*', '+' and '?' quantifiers are considered.
+string DttConfigurationQuery::findRegexRequiredLiteral() const
+{
+	if (m_regularExpression.find_first_of(RegexGroupingCharacters) != string::npos)
+	{
+		return string();
+	}
+
+	string longestLiteral;
+	size_t literalStart = 0;
+	while (literalStart < m_regularExpression.size())
+	{
+		const auto literalEnd =
+			min(m_regularExpression.find_first_of(RegexSpecialCharacters, literalStart), m_regularExpression.size());
+		auto literalLength = literalEnd - literalStart;
+		if ((literalLength > 0) && (literalEnd < m_regularExpression.size())
+			&& (strchr(RegexOptionalQuantifiers, m_regularExpression[literalEnd]) != nullptr))
+		{
+			literalLength--;
+		}
+		if (literalLength > longestLiteral.size())
+		{
+			longestLiteral = m_regularExpression.substr(literalStart, literalLength);
+		}
+		literalStart = literalEnd + 1;
+	}
+	return longestLiteral;
+}
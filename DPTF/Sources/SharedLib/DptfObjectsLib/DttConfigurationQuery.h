@@ -21,17 +21,40 @@
 #include <regex>
 #include <string>
 #include <list>
+#include <memory>
 
+// Queries are analyzed once when constructed. A query with no regex special characters matches
+// a single literal string and one of the form "literal.*" matches all strings with that prefix,
+// so neither needs a regex. Any other query is compiled once and shared by all of its copies,
+// and is only run against strings that contain the literal text the expression requires.
 class dptf_export DttConfigurationQuery
 {
 public:
 	explicit DttConfigurationQuery(const std::string& regexString);
 	explicit DttConfigurationQuery(const std::list<std::string>& regexCollection);
 	std::regex toRegex() const;
+	bool matches(const std::string& text) const;
+	bool isLiteral() const;
+	const std::string& getLiteralPrefix() const;
 	bool operator==(const DttConfigurationQuery& other) const;
 	bool operator<(const DttConfigurationQuery& other) const;
 	const std::string& toString() const;
 
 private:
+	enum class MatchType
+	{
+		Literal,
+		Prefix,
+		Regex
+	};
+
 	std::string m_regularExpression;
+	MatchType m_matchType;
+	std::string m_literalPrefix;
+	std::string m_requiredLiteral;
+	std::shared_ptr<const std::regex> m_regex;
+
+	void compile();
+	std::string findRegexLiteralPrefix(std::size_t firstSpecialCharacter) const;
+	std::string findRegexRequiredLiteral() const;
 };
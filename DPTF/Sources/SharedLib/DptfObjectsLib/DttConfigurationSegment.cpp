@@ -17,17 +17,16 @@
 ******************************************************************************/
 
 #include "DttConfigurationSegment.h"
-#include <regex>
 #include "MapOps.h"
 #include "StringConverter.h"
 #include "ThirdParty/nlohmann_json/json.hpp"
 using namespace std;
 using json = nlohmann::json; 
 
-const string environmentCpuIdKeyPattern = "/ApplicableEnvironment/PlatformCpuIds/.*"s;
-const string environmentSocBasePowerKeyPattern = "/ApplicableEnvironment/SocBasePower/.*"s;
-const string environmentLabelKeyPattern = "/ApplicableEnvironment/Label/.*"s;
-const string environmentEpoCpuIdKeyPattern = ".*Platform.*cpuid.*"s;
+const DttConfigurationQuery environmentCpuIdKeyQuery{"/ApplicableEnvironment/PlatformCpuIds/.*"s};
+const DttConfigurationQuery environmentSocBasePowerKeyQuery{"/ApplicableEnvironment/SocBasePower/.*"s};
+const DttConfigurationQuery environmentLabelKeyQuery{"/ApplicableEnvironment/Label/.*"s};
+const DttConfigurationQuery environmentEpoCpuIdKeyQuery{".*Platform.*cpuid.*"s};
 constexpr auto INDENT_WIDTH = 4;
 
 map<string, string> generateKeysAndValues(const nlohmann::basic_json<>& jsonObject)
@@ -92,13 +91,13 @@ set<string> DttConfigurationSegment::getKeys() const
 set<string> DttConfigurationSegment::getKeysThatMatch(const DttConfigurationQuery& query) const
 {
 	set<string> result;
-	for (const auto& kv : m_keyValues)
-	{
-		if (regex_match(kv.first, query.toRegex()))
+	findKeyValueThatMatches(
+		query,
+		[&result](const pair<const string, string>& kv)
 		{
-			result.emplace(kv.first);
-		}
-	}
+			result.emplace_hint(result.end(), kv.first);
+			return false;
+		});
 	return result;
 }
 
@@ -124,13 +123,13 @@ bool DttConfigurationSegment::hasProperties(const std::set<DttConfigurationPrope
 {
 	for (const auto& property : properties)
 	{
-		const auto keys = getKeysThatMatch(property.key);
-		if (none_of(keys.begin(), keys.end(),
-			[property, this](const string& key)
+		const auto valueMatched = findKeyValueThatMatches(
+			property.key,
+			[&property](const pair<const string, string>& kv)
 			{
-				const auto value = StringConverter::trimQuotes(this->m_keyValues.at(key));
-				return regex_match(value, property.value.toRegex());
-			}))
+				return property.value.matches(StringConverter::trimQuotes(kv.second));
+			});
+		if (!valueMatched)
 		{
 			return false;
 		}
@@ -143,19 +142,16 @@ bool DttConfigurationSegment::hasPropertiesIncludingEmptyValue(
 {
 	for (const auto& property : properties)
 	{
-		const auto keys = getKeysThatMatch(property.key);
-		if (!keys.empty() && none_of(
-				keys.begin(),
-				keys.end(),
-				[property, this](const string& key)
-				{
-					const auto value = StringConverter::trimQuotes(this->m_keyValues.at(key));
-					if (value.empty())
-					{
-						return true;
-					}
-					return regex_match(value, property.value.toRegex());
-				}))
+		bool keyMatched = false;
+		const auto valueMatched = findKeyValueThatMatches(
+			property.key,
+			[&property, &keyMatched](const pair<const string, string>& kv)
+			{
+				keyMatched = true;
+				const auto value = StringConverter::trimQuotes(kv.second);
+				return value.empty() || property.value.matches(value);
+			});
+		if (keyMatched && !valueMatched)
 		{
 			return false;
 		}
@@ -167,14 +163,14 @@ bool DttConfigurationSegment::matchesEnvironmentProfile(const EnvironmentProfile
 {
 	set<DttConfigurationProperty> properties{};
 	const auto cpuProperty = DttConfigurationProperty(
-		DttConfigurationQuery(environmentCpuIdKeyPattern),
+		environmentCpuIdKeyQuery,
 		DttConfigurationQuery(environmentProfile.cpuIdWithoutStepping));
 	properties.insert(cpuProperty);
 
 	if (environmentProfile.socBasePower.isValid())
 	{
 		const auto socBasePowerProperty = DttConfigurationProperty(
-			DttConfigurationQuery(environmentSocBasePowerKeyPattern),
+			environmentSocBasePowerKeyQuery,
 			DttConfigurationQuery(environmentProfile.socBasePower.toStringAsWatts(0)));
 		properties.insert(socBasePowerProperty);
 	}
@@ -186,7 +182,7 @@ bool DttConfigurationSegment::matchesCpuIdInEpoSegment(const string& cpuId) cons
 {
 	set<DttConfigurationProperty> properties{};
 	const auto cpuProperty = DttConfigurationProperty(
-		DttConfigurationQuery(environmentEpoCpuIdKeyPattern), DttConfigurationQuery(cpuId));
+		environmentEpoCpuIdKeyQuery, DttConfigurationQuery(cpuId));
 	properties.insert(cpuProperty);
 
 	return hasProperties(properties);
@@ -197,14 +193,14 @@ bool DttConfigurationSegment::matchesEnvironmentProfileIncludingEmptyValue(
 {
 	set<DttConfigurationProperty> properties{};
 	const auto cpuProperty = DttConfigurationProperty(
-		DttConfigurationQuery(environmentCpuIdKeyPattern),
+		environmentCpuIdKeyQuery,
 		DttConfigurationQuery(environmentProfile.cpuIdWithoutStepping));
 	properties.insert(cpuProperty);
 	
 	if (environmentProfile.socBasePower.isValid())
 	{
 		const auto socBasePowerProperty = DttConfigurationProperty(
-			DttConfigurationQuery(environmentSocBasePowerKeyPattern),
+			environmentSocBasePowerKeyQuery,
 			DttConfigurationQuery(environmentProfile.socBasePower.toStringAsWatts(0)));
 		properties.insert(socBasePowerProperty);
 	}
@@ -215,12 +211,28 @@ bool DttConfigurationSegment::matchesEnvironmentProfileIncludingEmptyValue(
 bool DttConfigurationSegment::hasLabel(const string& label) const
 {
 	set<DttConfigurationProperty> properties{};
-	const auto labelProperty = DttConfigurationProperty(DttConfigurationQuery(environmentLabelKeyPattern), DttConfigurationQuery(label));
+	const auto labelProperty = DttConfigurationProperty(environmentLabelKeyQuery, DttConfigurationQuery(label));
 	properties.insert(labelProperty);
 
 	return hasProperties(properties);
 }
 
+// Values are returned without quotes, as they are compared by the environment profile queries
+set<string> DttConfigurationSegment::getEnvironmentCpuIds() const
+{
+	return getValuesOfKeysThatMatch(environmentCpuIdKeyQuery);
+}
+
+set<string> DttConfigurationSegment::getEpoCpuIds() const
+{
+	return getValuesOfKeysThatMatch(environmentEpoCpuIdKeyQuery);
+}
+
+set<string> DttConfigurationSegment::getLabels() const
+{
+	return getValuesOfKeysThatMatch(environmentLabelKeyQuery);
+}
+
 set<string> DttConfigurationSegment::getKeysWithValue(const string& value) const
 {
 	set<string> result;
@@ -242,31 +254,30 @@ bool DttConfigurationSegment::empty() const
 void DttConfigurationSegment::keepOnlyKeysThatMatch(const DttConfigurationQuery& query)
 {
 	map<string, string> result;
-	for (const auto& kv : m_keyValues)
-	{
-		if (regex_match(kv.first, query.toRegex()))
+	findKeyValueThatMatches(
+		query,
+		[&result](const pair<const string, string>& kv)
 		{
-			result.insert(kv);
-		}
-	}
-	m_keyValues = result;
+			result.insert(result.end(), kv);
+			return false;
+		});
+	m_keyValues = move(result);
 }
 
 void DttConfigurationSegment::keepOnlyKeysThatMatch(const std::set<DttConfigurationQuery>& regexPatterns)
 {
 	map<string,string> result;
-	for (const auto& kv : m_keyValues)
+	for (const auto& pattern : regexPatterns)
 	{
-		if (any_of(regexPatterns.begin(), regexPatterns.end(),
-			[kv](const DttConfigurationQuery& pattern)
+		findKeyValueThatMatches(
+			pattern,
+			[&result](const pair<const string, string>& kv)
 			{
-				return regex_match(kv.first, pattern.toRegex());
-			}))
-		{
-			result.insert(kv);
-		}
+				result.insert(kv);
+				return false;
+			});
 	}
-	m_keyValues = result;
+	m_keyValues = move(result);
 }
 
 std::string DttConfigurationSegment::toString() const
@@ -281,6 +292,44 @@ std::string DttConfigurationSegment::toString() const
 	return jsonObj.dump(INDENT_WIDTH);
 }
 
+set<string> DttConfigurationSegment::getValuesOfKeysThatMatch(const DttConfigurationQuery& query) const
+{
+	set<string> result;
+	findKeyValueThatMatches(
+		query,
+		[&result](const pair<const string, string>& kv)
+		{
+			result.emplace(StringConverter::trimQuotes(kv.second));
+			return false;
+		});
+	return result;
+}
+
+// Calls predicate for each key/value whose key matches the query, in key order, until it returns true.
+// Only the range of keys starting with the query's literal prefix is visited, or the single key for a
+// literal query, so the query only needs to be evaluated for the keys in that range.
+template <typename Predicate>
+bool DttConfigurationSegment::findKeyValueThatMatches(const DttConfigurationQuery& query, Predicate predicate) const
+{
+	const auto& prefix = query.getLiteralPrefix();
+	if (query.isLiteral())
+	{
+		const auto kv = m_keyValues.find(prefix);
+		return (kv != m_keyValues.end()) && predicate(*kv);
+	}
+
+	for (auto kv = m_keyValues.lower_bound(prefix);
+		 (kv != m_keyValues.end()) && (kv->first.compare(0, prefix.size(), prefix) == 0);
+		 ++kv)
+	{
+		if (query.matches(kv->first) && predicate(*kv))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
 void DttConfigurationSegment::throwIfKeyDoesNotExist(const string& key) const
 {
 	const auto result = m_keyValues.find(key);
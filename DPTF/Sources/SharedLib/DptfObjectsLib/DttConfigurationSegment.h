@@ -50,6 +50,9 @@ public:
 	bool matchesCpuIdInEpoSegment(const std::string& environmentProfile) const;
 	bool matchesEnvironmentProfileIncludingEmptyValue(const EnvironmentProfile& environmentProfile) const;
 	bool hasLabel(const std::string& label) const;
+	std::set<std::string> getEnvironmentCpuIds() const;
+	std::set<std::string> getEpoCpuIds() const;
+	std::set<std::string> getLabels() const;
 	std::set<std::string> getKeysWithValue(const std::string& value) const;
 	bool empty() const;
 	void keepOnlyKeysThatMatch(const DttConfigurationQuery& query);
@@ -61,4 +64,7 @@ private:
 	std::map<std::string, std::string> m_keyValues;
 	void throwIfKeyDoesNotExist(const std::string& key) const;
 	bool hasPropertiesIncludingEmptyValue(const std::set<DttConfigurationProperty>& properties) const;
+	std::set<std::string> getValuesOfKeysThatMatch(const DttConfigurationQuery& query) const;
+	template <typename Predicate>
+	bool findKeyValueThatMatches(const DttConfigurationQuery& query, Predicate predicate) const;
 };
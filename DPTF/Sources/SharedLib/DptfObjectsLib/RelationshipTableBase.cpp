@@ -17,10 +17,13 @@
 ******************************************************************************/
 
 #include "RelationshipTableBase.h"
+#include <algorithm>
+#include <iterator>
 
 RelationshipTableBase::RelationshipTableBase(const std::vector<std::shared_ptr<RelationshipTableEntryBase>>& entries)
 	: m_entries(entries)
 {
+	indexRows();
 }
 
 void RelationshipTableBase::associateParticipant(
@@ -31,7 +34,9 @@ void RelationshipTableBase::associateParticipant(
 	auto tableRows = findTableRowsWithParticipantScope(participantScope);
 	for (auto tableRow = tableRows.begin(); tableRow != tableRows.end(); ++tableRow)
 	{
+		unindexRow(*tableRow);
 		m_entries.at(*tableRow)->associateParticipant(participantScope, participantIndex, participantName);
+		indexRow(*tableRow);
 	}
 }
 
@@ -40,7 +45,9 @@ void RelationshipTableBase::disassociateParticipant(UIntN participantIndex)
 	auto tableRows = findTableRowsWithParticipantIndex(participantIndex);
 	for (auto tableRow = tableRows.begin(); tableRow != tableRows.end(); ++tableRow)
 	{
+		unindexRow(*tableRow);
 		m_entries.at(*tableRow)->disassociateParticipant(participantIndex);
+		indexRow(*tableRow);
 	}
 }
 
@@ -76,28 +83,12 @@ void RelationshipTableBase::disassociateDomain(UIntN participantIndex, UIntN dom
 
 Bool RelationshipTableBase::isParticipantSourceDevice(UIntN participantIndex) const
 {
-	auto tableRows = findTableRowsWithParticipantIndex(participantIndex);
-	for (auto tableRow = tableRows.begin(); tableRow != tableRows.end(); ++tableRow)
-	{
-		if (m_entries.at(*tableRow)->getSourceDeviceIndex() == participantIndex)
-		{
-			return true;
-		}
-	}
-	return false;
+	return m_rowsBySourceIndex.find(participantIndex) != m_rowsBySourceIndex.end();
 }
 
 Bool RelationshipTableBase::isParticipantTargetDevice(UIntN participantIndex) const
 {
-	auto tableRows = findTableRowsWithParticipantIndex(participantIndex);
-	for (auto tableRow = tableRows.begin(); tableRow != tableRows.end(); ++tableRow)
-	{
-		if (m_entries.at(*tableRow)->getTargetDeviceIndex() == participantIndex)
-		{
-			return true;
-		}
-	}
-	return false;
+	return m_rowsByTargetIndex.find(participantIndex) != m_rowsByTargetIndex.end();
 }
 
 UIntN RelationshipTableBase::getNumberOfEntries(void) const
@@ -107,40 +98,48 @@ UIntN RelationshipTableBase::getNumberOfEntries(void) const
 
 std::vector<UIntN> RelationshipTableBase::findTableRowsWithParticipantScope(const std::string& participantScope) const
 {
-	std::vector<UIntN> rows;
-	for (UIntN row = 0; row < getNumberOfEntries(); ++row)
+	const auto rows = m_rowsByScope.find(participantScope);
+	if (rows == m_rowsByScope.end())
 	{
-		const auto entry = m_entries.at(row);
-		if ((entry->getSourceDeviceScope() == participantScope) || (entry->getTargetDeviceScope() == participantScope))
-		{
-			rows.push_back(row);
-		}
+		return std::vector<UIntN>();
 	}
-	return rows;
+	return rows->second;
 }
 
 std::vector<UIntN> RelationshipTableBase::findTableRowsWithParticipantIndex(UIntN participantIndex) const
 {
+	const auto& sourceRows = findTableRowsWithSourceIndex(participantIndex);
+	const auto& targetRows = findTableRowsWithTargetIndex(participantIndex);
 	std::vector<UIntN> rows;
-	for (UIntN row = 0; row < getNumberOfEntries(); ++row)
-	{
-		const auto entry = m_entries.at(row);
-		if ((entry->getSourceDeviceIndex() == participantIndex) || (entry->getTargetDeviceIndex() == participantIndex))
-		{
-			rows.push_back(row);
-		}
-	}
+	std::set_union(
+		sourceRows.begin(), sourceRows.end(), targetRows.begin(), targetRows.end(), std::back_inserter(rows));
 	return rows;
 }
 
+// Rows are returned in table order
+const std::vector<UIntN>& RelationshipTableBase::findTableRowsWithSourceIndex(UIntN sourceIndex) const
+{
+	return findRows(m_rowsBySourceIndex, sourceIndex);
+}
+
+const std::vector<UIntN>& RelationshipTableBase::findTableRowsWithTargetIndex(UIntN targetIndex) const
+{
+	return findRows(m_rowsByTargetIndex, targetIndex);
+}
+
+// Called whenever a row is added to or removed from the rows for a target index
+void RelationshipTableBase::onTargetRowsChanged(UIntN targetIndex)
+{
+}
+
 std::set<UIntN> RelationshipTableBase::getAllTargetIndexes() const
 {
 	std::set<UIntN> targetIndexes;
-	for (auto entry = m_entries.begin(); entry < m_entries.end(); ++entry)
+	for (auto rows = m_rowsByTargetIndex.begin(); rows != m_rowsByTargetIndex.end(); ++rows)
 	{
-		if ((*entry)->targetDeviceIndexValid())
+		if (rows->first != Constants::Invalid)
 		{
-			targetIndexes.insert((*entry)->getTargetDeviceIndex());
+			targetIndexes.insert(targetIndexes.end(), rows->first);
 		}
 	}
 	return targetIndexes;
@@ -149,12 +148,74 @@ std::set<UIntN> RelationshipTableBase::getAllTargetIndexes() const
 std::set<UIntN> RelationshipTableBase::getAllSourceIndexes() const
 {
 	std::set<UIntN> sourceIndexes;
-	for (auto entry = m_entries.begin(); entry < m_entries.end(); ++entry)
+	for (auto rows = m_rowsBySourceIndex.begin(); rows != m_rowsBySourceIndex.end(); ++rows)
 	{
-		if ((*entry)->sourceDeviceIndexValid())
+		if (rows->first != Constants::Invalid)
 		{
-			sourceIndexes.insert((*entry)->getSourceDeviceIndex());
+			sourceIndexes.insert(sourceIndexes.end(), rows->first);
 		}
 	}
 	return sourceIndexes;
 }
+
+void RelationshipTableBase::indexRows()
+{
+	for (UIntN row = 0; row < getNumberOfEntries(); ++row)
+	{
+		const auto& entry = m_entries.at(row);
+		m_rowsByScope[entry->getSourceDeviceScope()].push_back(row);
+		if (entry->getTargetDeviceScope() != entry->getSourceDeviceScope())
+		{
+			m_rowsByScope[entry->getTargetDeviceScope()].push_back(row);
+		}
+		indexRow(row);
+	}
+}
+
+void RelationshipTableBase::indexRow(UIntN row)
+{
+	const auto& entry = m_entries.at(row);
+	insertRow(m_rowsBySourceIndex, entry->getSourceDeviceIndex(), row);
+	insertRow(m_rowsByTargetIndex, entry->getTargetDeviceIndex(), row);
+	onTargetRowsChanged(entry->getTargetDeviceIndex());
+}
+
+void RelationshipTableBase::unindexRow(UIntN row)
+{
+	const auto& entry = m_entries.at(row);
+	eraseRow(m_rowsBySourceIndex, entry->getSourceDeviceIndex(), row);
+	eraseRow(m_rowsByTargetIndex, entry->getTargetDeviceIndex(), row);
+	onTargetRowsChanged(entry->getTargetDeviceIndex());
+}
+
+const std::vector<UIntN>& RelationshipTableBase::findRows(
+	const std::map<UIntN, std::vector<UIntN>>& rowIndex,
+	UIntN key)
+{
+	static const std::vector<UIntN> noRows;
+	const auto rows = rowIndex.find(key);
+	if (rows == rowIndex.end())
+	{
+		return noRows;
+	}
+	return rows->second;
+}
+
+void RelationshipTableBase::insertRow(std::map<UIntN, std::vector<UIntN>>& rowIndex, UIntN key, UIntN row)
+{
+	auto& rows = rowIndex[key];
+	rows.insert(std::lower_bound(rows.begin(), rows.end(), row), row);
+}
+
+void RelationshipTableBase::eraseRow(std::map<UIntN, std::vector<UIntN>>& rowIndex, UIntN key, UIntN row)
+{
+	const auto rows = rowIndex.find(key);
+	if (rows != rowIndex.end())
+	{
+		rows->second.erase(std::remove(rows->second.begin(), rows->second.end(), row), rows->second.end());
+		if (rows->second.empty())
+		{
+			rowIndex.erase(rows);
+		}
+	}
+}
@@ -21,7 +21,11 @@
 #include "Dptf.h"
 #include "RelationshipTableInterface.h"
 #include "RelationshipTableEntryBase.h"
+#include <map>
 
+// Rows are indexed by participant scope when the table is created, and by source and target
+// participant index as participants are associated and disassociated, so that looking up the
+// rows for a participant does not scan the table.
 class dptf_export RelationshipTableBase : public RelationshipTableInterface
 {
 public:
@@ -49,6 +53,21 @@ public:
 protected:
 	std::vector<UIntN> findTableRowsWithParticipantScope(const std::string& participantScope) const;
 	std::vector<UIntN> findTableRowsWithParticipantIndex(UIntN participantIndex) const;
+	const std::vector<UIntN>& findTableRowsWithSourceIndex(UIntN sourceIndex) const;
+	const std::vector<UIntN>& findTableRowsWithTargetIndex(UIntN targetIndex) const;
+	virtual void onTargetRowsChanged(UIntN targetIndex);
 
 	std::vector<std::shared_ptr<RelationshipTableEntryBase>> m_entries;
+
+private:
+	void indexRows();
+	void indexRow(UIntN row);
+	void unindexRow(UIntN row);
+	static const std::vector<UIntN>& findRows(const std::map<UIntN, std::vector<UIntN>>& rowIndex, UIntN key);
+	static void insertRow(std::map<UIntN, std::vector<UIntN>>& rowIndex, UIntN key, UIntN row);
+	static void eraseRow(std::map<UIntN, std::vector<UIntN>>& rowIndex, UIntN key, UIntN row);
+
+	std::map<std::string, std::vector<UIntN>> m_rowsByScope;
+	std::map<UIntN, std::vector<UIntN>> m_rowsBySourceIndex;
+	std::map<UIntN, std::vector<UIntN>> m_rowsByTargetIndex;
 };
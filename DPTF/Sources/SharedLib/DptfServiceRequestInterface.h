@@ -19,10 +19,15 @@
 #pragma once
 #include "DptfRequest.h"
 #include "DptfRequestResult.h"
+#include <vector>
 
 class dptf_export DptfServiceRequestInterface
 {
 public:
 	virtual ~DptfServiceRequestInterface(){};
 	virtual DptfRequestResult submitRequest(DptfRequest request) = 0;
+
+	// submits all requests in one call and returns one result per request, in the same order.
+	// a failed request does not stop the rest of the batch from being processed.
+	virtual std::vector<DptfRequestResult> submitRequests(const std::vector<DptfRequest>& requests) = 0;
 };
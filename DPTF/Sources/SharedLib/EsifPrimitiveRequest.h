@@ -0,0 +1,51 @@
+/******************************************************************************
+** Copyright (c) 2013-2023 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include "esif_sdk_data_type.h"
+#include "esif_sdk_primitive_type.h"
+
+//
+// Describes a get primitive that a request handler executes while it processes a request.  This allows the
+// primitives for a batch of requests to be executed together before the requests are processed.
+//
+
+struct EsifPrimitiveRequest final
+{
+	EsifPrimitiveRequest(
+		esif_primitive_type primitive,
+		esif_data_type dataType,
+		UIntN participantIndex,
+		UIntN domainIndex,
+		UInt8 instance)
+		: primitive(primitive)
+		, dataType(dataType)
+		, participantIndex(participantIndex)
+		, domainIndex(domainIndex)
+		, instance(instance)
+	{
+	}
+
+	esif_primitive_type primitive;
+	esif_data_type dataType;
+	UIntN participantIndex;
+	UIntN domainIndex;
+	UInt8 instance;
+};
@@ -45,7 +45,7 @@ public:
 	virtual SensorSpatialOrientation::Type getSpatialOrientation(void) const = 0;
 	virtual OsLidState::Type getLidState(void) const = 0;
 	virtual OsPowerSource::Type getPowerSource(void) const = 0;
-	virtual const std::string& getForegroundApplicationName(void) const = 0;
+	virtual std::string getForegroundApplicationName(void) const = 0;
 	virtual CoolingMode::Type getCoolingMode(void) const = 0;
 	virtual UIntN getBatteryPercentage(void) const = 0;
 	virtual OsPlatformType::Type getPlatformType(void) const = 0;
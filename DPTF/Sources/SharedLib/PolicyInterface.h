@@ -43,6 +43,8 @@
 #include "FanOperatingMode.h"
 #include "SocPowerFloor.h"
 
+class TimeInterface;
+
 class dptf_export PolicyInterface
 {
 public:
@@ -227,6 +229,12 @@ public:
 	virtual void collaborationModeChanged(OnOffToggle::Type collaborationModeState) = 0;
 	virtual void thirdPartyGraphicsPowerStateChanged(UInt32 tpgPowerStateOff) = 0;
 	virtual void thirdPartyGraphicsTPPLimitChanged(OsPowerSource::Type powerSourceForTPP) = 0;
+
+	//
+	// Replaces the clock the policy uses for all of its timing decisions.  Hosts that drive a policy
+	// on simulated time (such as the policy simulator) call this before create().
+	//
+	virtual void overrideTimeObject(const std::shared_ptr<TimeInterface>& timeObject) = 0;
 };
 
 //
@@ -19,6 +19,7 @@
 #pragma once
 #include "PolicyRequest.h"
 #include "DptfRequestResult.h"
+#include "EsifPrimitiveRequest.h"
 
 class dptf_export RequestHandlerInterface
 {
@@ -26,4 +27,10 @@ public:
 	virtual ~RequestHandlerInterface(){};
 	virtual DptfRequestResult processRequest(const PolicyRequest& policyRequest) = 0;
 	virtual Bool canProcessRequest(const PolicyRequest& policyRequest) = 0;
+
+	// returns the get primitives that processRequest() will execute for the request, if they are known
+	virtual std::vector<EsifPrimitiveRequest> getPrimitivesForRequest(const PolicyRequest& policyRequest)
+	{
+		return std::vector<EsifPrimitiveRequest>();
+	}
 };
@@ -473,6 +473,22 @@ void DomainTemperatureBase::onClearCachedData(void)
 	// do nothing.
 }
 
+std::vector<EsifPrimitiveRequest> DomainTemperatureBase::getPrimitivesForRequest(const PolicyRequest& policyRequest)
+{
+	auto& request = policyRequest.getRequest();
+	if ((request.getRequestType() == DptfRequestType::TemperatureControlGetTemperatureStatus)
+		&& canProcessRequest(policyRequest) && (requestResultIsCached(request) == false))
+	{
+		return getTemperatureStatusPrimitives();
+	}
+	return std::vector<EsifPrimitiveRequest>();
+}
+
+std::vector<EsifPrimitiveRequest> DomainTemperatureBase::getTemperatureStatusPrimitives()
+{
+	return std::vector<EsifPrimitiveRequest>();
+}
+
 Temperature DomainTemperatureBase::getAuxTemperatureThreshold(UIntN domainIndex, UInt8 auxNumber)
 {
 	try
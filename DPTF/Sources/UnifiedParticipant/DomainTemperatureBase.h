@@ -49,7 +49,13 @@ public:
 	virtual void onClearCachedData(void) override;
 	virtual std::shared_ptr<XmlNode> getArbitratorXml(UIntN policyIndex) const override;
 
+	// RequestHandlerInterface
+	virtual std::vector<EsifPrimitiveRequest> getPrimitivesForRequest(const PolicyRequest& policyRequest) override;
+
 protected:
+	// returns the get primitives that getTemperatureStatus() executes
+	virtual std::vector<EsifPrimitiveRequest> getTemperatureStatusPrimitives();
+
 	Bool m_areTemperatureThresholdsSupported;
 	ArbitratorTemperatureThresholds m_arbitratorTemperatureThresholds;
 
@@ -63,6 +63,16 @@ TemperatureStatus DomainTemperature_001::getTemperatureStatus()
 	}
 }
 
+std::vector<EsifPrimitiveRequest> DomainTemperature_001::getTemperatureStatusPrimitives()
+{
+	return {EsifPrimitiveRequest(
+		esif_primitive_type::GET_TEMPERATURE,
+		esif_data_type::ESIF_DATA_TEMPERATURE,
+		getParticipantIndex(),
+		getDomainIndex(),
+		Constants::Esif::NoInstance)};
+}
+
 Temperature DomainTemperature_001::getPowerShareTemperatureThreshold()
 {
 	auto powerShareTemperatureThreshold = Temperature::createInvalid();
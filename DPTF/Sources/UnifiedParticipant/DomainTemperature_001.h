@@ -43,6 +43,9 @@ public:
 	virtual std::string getName(void) override;
 	virtual std::shared_ptr<XmlNode> getXml(UIntN domainIndex) override;
 
+protected:
+	virtual std::vector<EsifPrimitiveRequest> getTemperatureStatusPrimitives() override;
+
 private:
 	// hide the copy constructor and = operator
 	DomainTemperature_001(const DomainTemperature_001& rhs);
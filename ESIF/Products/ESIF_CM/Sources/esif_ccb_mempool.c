@@ -0,0 +1,775 @@
+/*******************************************************************************
+** This file is provided under a dual BSD/GPLv2 license.  When using or
+** redistributing this file, you may do so under either license.
+**
+** GPL LICENSE SUMMARY
+**
+** Copyright (c) 2013-2023 Intel Corporation All Rights Reserved
+**
+** This program is free software; you can redistribute it and/or modify it under
+** the terms of version 2 of the GNU General Public License as published by the
+** Free Software Foundation.
+**
+** This program is distributed in the hope that it will be useful, but WITHOUT
+** ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+** FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+** details.
+**
+** You should have received a copy of the GNU General Public License along with
+** this program; if not, write to the Free Software  Foundation, Inc.,
+** 51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+** The full GNU General Public License is included in this distribution in the
+** file called LICENSE.GPL.
+**
+** BSD LICENSE
+**
+** Copyright (c) 2013-2023 Intel Corporation All Rights Reserved
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** * Redistributions of source code must retain the above copyright notice, this
+**   list of conditions and the following disclaimer.
+** * Redistributions in binary form must reproduce the above copyright notice,
+**   this list of conditions and the following disclaimer in the documentation
+**   and/or other materials provided with the distribution.
+** * Neither the name of Intel Corporation nor the names of its contributors may
+**   be used to endorse or promote products derived from this software without
+**   specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+**
+*******************************************************************************/
+# define ESIF_TRACE_ID	ESIF_TRACEMODULE_UF
+
+#include "esif.h"
+#include <pthread.h>
+
+/* Object Slots are aligned to two pointers so any free object can hold both free list links */
+#define ESIF_MEMPOOL_ALIGN		(2 * sizeof(void *))
+#define ESIF_MEMPOOL_ROUNDUP(size)	(((size) + ESIF_MEMPOOL_ALIGN - 1) & ~(ESIF_MEMPOOL_ALIGN - 1))
+
+/*
+ * Free objects are linked through their first pointer. The first object of
+ * each chain on the shared free list also links to the next chain through
+ * its second pointer, so whole magazines move to and from the list at once.
+ */
+#define MEMPOOL_NEXT_OBJECT(obj_ptr)	(((void **)(obj_ptr))[0])
+#define MEMPOOL_NEXT_CHAIN(obj_ptr)	(((void **)(obj_ptr))[1])
+
+/* Slab Page Header; Object Slots follow the header */
+struct esif_ccb_mempool_slab {
+	struct esif_ccb_mempool_slab *next_ptr;
+	size_t objects_len;
+};
+
+#define ESIF_MEMPOOL_SLAB_HEADER_LEN	ESIF_MEMPOOL_ROUNDUP(sizeof(struct esif_ccb_mempool_slab))
+
+/*
+ * Slab Table: open-addressed hash of the Slabs, keyed by address bucket.
+ * A bucket is the smallest power of two that holds a whole Slab, so each Slab
+ * lies in at most two buckets and is entered once for each. Entries are never
+ * removed and a table that fills up is replaced by a larger copy, so lookups
+ * need no lock. Replaced tables are kept until the pool is destroyed.
+ */
+struct esif_ccb_mempool_slab_table {
+	struct esif_ccb_mempool_slab_table *retired_ptr;	/* Replaced Table */
+	UInt32 capacity;	/* Number of Entries (Power of Two) */
+	UInt32 count;		/* Entries In Use */
+	struct esif_ccb_mempool_slab *entries[1];
+};
+
+#define ESIF_MEMPOOL_SLAB_TABLE_MIN	16
+
+/* Per-Thread cache of free objects for one pool */
+struct esif_ccb_mempool_magazine {
+	void *head_ptr;
+	UInt32 count;
+	UInt32 generation;
+};
+
+static ESIF_THREAD_LOCAL struct esif_ccb_mempool_magazine g_mempool_magazine[ESIF_MEMPOOL_TYPE_UF_MAX];
+static pthread_key_t g_mempool_thread_key;
+static Bool g_mempool_thread_key_valid = ESIF_FALSE;
+static atomic_t g_mempool_generation = ATOMIC_INIT(0);
+
+
+static void esif_ccb_mempool_poison(
+	struct esif_ccb_mempool *pool_ptr,
+	void *mem_ptr
+	)
+{
+#ifdef ESIF_MEMPOOL_POISON
+	/* The first two pointers hold free list links */
+	if (pool_ptr->object_size > ESIF_MEMPOOL_ALIGN) {
+		esif_ccb_memset((u8 *)mem_ptr + ESIF_MEMPOOL_ALIGN,
+			ESIF_MEMPOOL_POISON_BYTE,
+			pool_ptr->object_size - ESIF_MEMPOOL_ALIGN);
+	}
+#else
+	UNREFERENCED_PARAMETER(pool_ptr);
+	UNREFERENCED_PARAMETER(mem_ptr);
+#endif
+}
+
+
+static void esif_ccb_mempool_check_poison(
+	struct esif_ccb_mempool *pool_ptr,
+	void *mem_ptr
+	)
+{
+#ifdef ESIF_MEMPOOL_POISON
+	u8 *byte_ptr = (u8 *)mem_ptr + ESIF_MEMPOOL_ALIGN;
+	u8 *end_ptr = (u8 *)mem_ptr + pool_ptr->object_size;
+
+	for (; byte_ptr < end_ptr; byte_ptr++) {
+		if (*byte_ptr != ESIF_MEMPOOL_POISON_BYTE) {
+			atomic_inc(&pool_ptr->poison_errors);
+			ESIF_TRACE_ERROR("Memory Pool %s object %p modified after free at offset %u\n",
+				pool_ptr->name_ptr,
+				mem_ptr,
+				(u32)(byte_ptr - (u8 *)mem_ptr));
+			break;
+		}
+	}
+#else
+	UNREFERENCED_PARAMETER(pool_ptr);
+	UNREFERENCED_PARAMETER(mem_ptr);
+#endif
+}
+
+
+/* Push a chain of free objects onto the shared free list */
+static void esif_ccb_mempool_push_chain(
+	struct esif_ccb_mempool *pool_ptr,
+	void *chain_ptr
+	)
+{
+	void *head_ptr = NULL;
+
+	do {
+		head_ptr = atomic_read(&pool_ptr->free_head);
+		MEMPOOL_NEXT_CHAIN(chain_ptr) = head_ptr;
+	} while (atomic_cmpxchg(&pool_ptr->free_head, head_ptr, chain_ptr) != head_ptr);
+}
+
+
+/*
+ * Pop one chain of free objects from the shared free list.
+ * Pops are serialized by the slab lock, so the head chain cannot be popped
+ * and pushed back between reading its link and the compare-and-swap (ABA).
+ * Pushes do not take the lock. Called with the slab lock held.
+ */
+static void *esif_ccb_mempool_pop_chain(
+	struct esif_ccb_mempool *pool_ptr
+	)
+{
+	void *chain_ptr = NULL;
+
+	do {
+		chain_ptr = atomic_read(&pool_ptr->free_head);
+		if (NULL == chain_ptr)
+			goto exit;
+	} while (atomic_cmpxchg(&pool_ptr->free_head, chain_ptr, MEMPOOL_NEXT_CHAIN(chain_ptr)) != chain_ptr);
+
+	MEMPOOL_NEXT_CHAIN(chain_ptr) = NULL;
+exit:
+	return chain_ptr;
+}
+
+
+/* Slab Table index of an address bucket */
+static ESIF_INLINE UInt32 esif_ccb_mempool_slab_index(
+	struct esif_ccb_mempool_slab_table *table_ptr,
+	size_t bucket
+	)
+{
+	return (UInt32)(((UInt64)bucket * 0x9E3779B97F4A7C15ULL) >> 32) & (table_ptr->capacity - 1);
+}
+
+
+/* Enter a Slab into a Slab Table under each bucket it lies in; the caller guarantees there is room */
+static void esif_ccb_mempool_slab_table_add(
+	struct esif_ccb_mempool_slab_table *table_ptr,
+	UInt32 slab_shift,
+	struct esif_ccb_mempool_slab *slab_ptr
+	)
+{
+	size_t first_bucket = (size_t)slab_ptr >> slab_shift;
+	size_t last_bucket = ((size_t)slab_ptr + ESIF_MEMPOOL_SLAB_HEADER_LEN + slab_ptr->objects_len - 1) >> slab_shift;
+	size_t bucket = 0;
+	UInt32 index = 0;
+
+	for (bucket = first_bucket; bucket <= last_bucket; bucket++) {
+		index = esif_ccb_mempool_slab_index(table_ptr, bucket);
+		while (table_ptr->entries[index] != NULL) {
+			index = (index + 1) & (table_ptr->capacity - 1);
+		}
+		/* Published with a full barrier so lock-free readers see an initialized Slab */
+		atomic_set(&table_ptr->entries[index], slab_ptr);
+		table_ptr->count++;
+	}
+}
+
+
+/*
+ * Enter a new Slab into the pool's Slab Table. A table that would become more
+ * than half full is replaced by one twice the size, built from the Slab list.
+ * Called with the slab lock held, before the Slab is put on the Slab list.
+ */
+static enum esif_rc esif_ccb_mempool_slab_table_insert(
+	struct esif_ccb_mempool *pool_ptr,
+	struct esif_ccb_mempool_slab *slab_ptr
+	)
+{
+	enum esif_rc rc = ESIF_OK;
+	struct esif_ccb_mempool_slab_table *table_ptr = pool_ptr->slab_table;
+	struct esif_ccb_mempool_slab_table *new_table_ptr = NULL;
+	struct esif_ccb_mempool_slab *list_ptr = NULL;
+	UInt32 capacity = ESIF_MEMPOOL_SLAB_TABLE_MIN;
+
+	/* Each Slab takes up to two entries */
+	if ((table_ptr != NULL) && (2 * (table_ptr->count + 2) <= table_ptr->capacity))
+		goto add;
+
+	if (table_ptr != NULL) {
+		capacity = 2 * table_ptr->capacity;
+	}
+	new_table_ptr = (struct esif_ccb_mempool_slab_table *)esif_ccb_malloc(
+		sizeof(*new_table_ptr) + ((size_t)capacity - 1) * sizeof(new_table_ptr->entries[0]));
+	if (NULL == new_table_ptr) {
+		rc = ESIF_E_NO_MEMORY;
+		goto exit;
+	}
+	new_table_ptr->retired_ptr = table_ptr;
+	new_table_ptr->capacity = capacity;
+
+	for (list_ptr = pool_ptr->slab_list; list_ptr != NULL; list_ptr = list_ptr->next_ptr) {
+		esif_ccb_mempool_slab_table_add(new_table_ptr, pool_ptr->slab_shift, list_ptr);
+	}
+	atomic_set(&pool_ptr->slab_table, new_table_ptr);
+	table_ptr = new_table_ptr;
+add:
+	esif_ccb_mempool_slab_table_add(table_ptr, pool_ptr->slab_shift, slab_ptr);
+exit:
+	return rc;
+}
+
+
+/* Carve a new Slab Page into chains of free objects on the shared free list; called with the slab lock held */
+static enum esif_rc esif_ccb_mempool_grow(
+	struct esif_ccb_mempool *pool_ptr
+	)
+{
+	enum esif_rc rc = ESIF_OK;
+	struct esif_ccb_mempool_slab *slab_ptr = NULL;
+	u8 *obj_ptr = NULL;
+	void *chain_ptr = NULL;
+	UInt32 chain_len = 0;
+	UInt32 i = 0;
+
+	slab_ptr = (struct esif_ccb_mempool_slab *)esif_ccb_malloc(
+		ESIF_MEMPOOL_SLAB_HEADER_LEN + ((size_t)pool_ptr->slot_size * pool_ptr->slab_objects));
+	if (NULL == slab_ptr) {
+		rc = ESIF_E_NO_MEMORY;
+		goto exit;
+	}
+	slab_ptr->objects_len = (size_t)pool_ptr->slot_size * pool_ptr->slab_objects;
+
+	/*
+	 * Publish the Slab before any of its objects can be allocated, so that
+	 * esif_ccb_mempool_owns finds it without taking the slab lock.
+	 */
+	rc = esif_ccb_mempool_slab_table_insert(pool_ptr, slab_ptr);
+	if (rc != ESIF_OK) {
+		esif_ccb_free(slab_ptr);
+		goto exit;
+	}
+	slab_ptr->next_ptr = pool_ptr->slab_list;
+	pool_ptr->slab_list = slab_ptr;
+
+	/* Build chains back to front so objects are handed out in address order */
+	obj_ptr = (u8 *)slab_ptr + ESIF_MEMPOOL_SLAB_HEADER_LEN + slab_ptr->objects_len;
+	for (i = 0; i < pool_ptr->slab_objects; i++) {
+		obj_ptr -= pool_ptr->slot_size;
+		esif_ccb_mempool_poison(pool_ptr, obj_ptr);
+		MEMPOOL_NEXT_OBJECT(obj_ptr) = chain_ptr;
+		chain_ptr = obj_ptr;
+		if (++chain_len == ESIF_MEMPOOL_MAGAZINE_SIZE) {
+			esif_ccb_mempool_push_chain(pool_ptr, chain_ptr);
+			chain_ptr = NULL;
+			chain_len = 0;
+		}
+	}
+	if (chain_ptr != NULL) {
+		esif_ccb_mempool_push_chain(pool_ptr, chain_ptr);
+	}
+
+	atomic_inc(&pool_ptr->slab_count);
+
+	MEMPOOL_DEBUG("Memory Pool %s Slab %p Created (%u objects)\n",
+		pool_ptr->name_ptr,
+		slab_ptr,
+		pool_ptr->slab_objects);
+exit:
+	return rc;
+}
+
+
+/*
+ * Take a chain of free objects for a Magazine, carving a new Slab when the
+ * shared free list is empty. Holding the slab lock for both keeps allocators
+ * that find the list empty at the same time from each carving a Slab.
+ */
+static void *esif_ccb_mempool_refill(
+	struct esif_ccb_mempool *pool_ptr
+	)
+{
+	void *chain_ptr = NULL;
+
+	esif_ccb_write_lock(&pool_ptr->slab_lock);
+	chain_ptr = esif_ccb_mempool_pop_chain(pool_ptr);
+	if ((NULL == chain_ptr) && (esif_ccb_mempool_grow(pool_ptr) == ESIF_OK)) {
+		chain_ptr = esif_ccb_mempool_pop_chain(pool_ptr);
+	}
+	esif_ccb_write_unlock(&pool_ptr->slab_lock);
+	return chain_ptr;
+}
+
+
+/*
+ * Is the object carved from one of the pool's Slabs? Only the Slabs entered
+ * under the object's address bucket are checked. Slabs are entered before
+ * their objects are handed out, so the table may be read without the slab lock.
+ */
+static Bool esif_ccb_mempool_owns(
+	struct esif_ccb_mempool *pool_ptr,
+	void *mem_ptr
+	)
+{
+	struct esif_ccb_mempool_slab_table *table_ptr = NULL;
+	struct esif_ccb_mempool_slab *slab_ptr = NULL;
+	u8 *start_ptr = NULL;
+	UInt32 index = 0;
+
+	table_ptr = (struct esif_ccb_mempool_slab_table *)atomic_read(&pool_ptr->slab_table);
+	if (NULL == table_ptr)
+		return ESIF_FALSE;
+
+	index = esif_ccb_mempool_slab_index(table_ptr, (size_t)mem_ptr >> pool_ptr->slab_shift);
+	for (; (slab_ptr = table_ptr->entries[index]) != NULL; index = (index + 1) & (table_ptr->capacity - 1)) {
+		start_ptr = (u8 *)slab_ptr + ESIF_MEMPOOL_SLAB_HEADER_LEN;
+		if (((u8 *)mem_ptr >= start_ptr) && ((u8 *)mem_ptr < start_ptr + slab_ptr->objects_len)) {
+			return ESIF_TRUE;
+		}
+	}
+	return ESIF_FALSE;
+}
+
+
+/* Return this thread's Magazine for the given pool, discarding it if it belongs to an older pool */
+static struct esif_ccb_mempool_magazine *esif_ccb_mempool_get_magazine(
+	enum esif_mempool_type pool_type,
+	struct esif_ccb_mempool *pool_ptr
+	)
+{
+	struct esif_ccb_mempool_magazine *mag_ptr = &g_mempool_magazine[pool_type];
+
+	if (mag_ptr->generation != pool_ptr->generation) {
+		mag_ptr->head_ptr = NULL;
+		mag_ptr->count = 0;
+		mag_ptr->generation = pool_ptr->generation;
+
+		/* Register the thread so its Magazines are returned when it exits */
+		if (g_mempool_thread_key_valid) {
+			pthread_setspecific(g_mempool_thread_key, g_mempool_magazine);
+		}
+	}
+	return mag_ptr;
+}
+
+
+/* Move all but keep objects from a Magazine to the shared free list */
+static void esif_ccb_mempool_flush_magazine(
+	struct esif_ccb_mempool *pool_ptr,
+	struct esif_ccb_mempool_magazine *mag_ptr,
+	UInt32 keep
+	)
+{
+	void *chain_ptr = NULL;
+	void *last_ptr = NULL;
+	UInt32 count = 0;
+
+	if (mag_ptr->count <= keep)
+		goto exit;
+
+	chain_ptr = mag_ptr->head_ptr;
+	for (last_ptr = chain_ptr, count = 1; count < mag_ptr->count - keep; count++) {
+		last_ptr = MEMPOOL_NEXT_OBJECT(last_ptr);
+	}
+	mag_ptr->head_ptr = MEMPOOL_NEXT_OBJECT(last_ptr);
+	mag_ptr->count = keep;
+	MEMPOOL_NEXT_OBJECT(last_ptr) = NULL;
+
+	esif_ccb_mempool_push_chain(pool_ptr, chain_ptr);
+exit:
+	return;
+}
+
+
+/* Thread Exit Callback: return the exiting thread's cached objects to their pools */
+static void esif_ccb_mempool_thread_exit(void *ctx_ptr)
+{
+	struct esif_ccb_mempool_magazine *mag_ptr = (struct esif_ccb_mempool_magazine *)ctx_ptr;
+	struct esif_ccb_mempool *pool_ptr = NULL;
+	u32 type_tag = 0;
+
+	esif_ccb_read_lock(&g_mempool_lock);
+	for (type_tag = 0; type_tag < ESIF_MEMPOOL_TYPE_UF_MAX; type_tag++) {
+		pool_ptr = g_mempool[type_tag];
+		if ((pool_ptr != NULL) && (mag_ptr[type_tag].generation == pool_ptr->generation)) {
+			esif_ccb_mempool_flush_magazine(pool_ptr, &mag_ptr[type_tag], 0);
+		}
+		mag_ptr[type_tag].generation = 0;
+	}
+	esif_ccb_read_unlock(&g_mempool_lock);
+}
+
+
+/* Memory Pool Create */
+struct esif_ccb_mempool *esif_ccb_mempool_create(
+	enum esif_mempool_type pool_type,
+	UInt32 pool_tag,
+	UInt32 object_size
+	)
+{
+	struct esif_ccb_mempool *pool_ptr = NULL;
+
+	/* Free objects must be able to hold both free list links */
+	if ((pool_type >= ESIF_MEMPOOL_TYPE_UF_MAX) || (object_size < ESIF_MEMPOOL_ALIGN))
+		goto exit;
+
+	pool_ptr = (struct esif_ccb_mempool *)
+			esif_ccb_malloc(sizeof(*pool_ptr));
+
+	if (NULL == pool_ptr)
+		return NULL;
+
+	pool_ptr->name_ptr     = esif_mempool_str(pool_tag);
+	pool_ptr->pool_tag     = pool_tag;
+	pool_ptr->object_size  = object_size;
+	pool_ptr->slot_size    = (UInt32)ESIF_MEMPOOL_ROUNDUP((size_t)object_size);
+	pool_ptr->slab_objects = esif_ccb_max(ESIF_MEMPOOL_SLAB_MIN_OBJECTS,
+		(UInt32)((ESIF_MEMPOOL_SLAB_SIZE - ESIF_MEMPOOL_SLAB_HEADER_LEN) / pool_ptr->slot_size));
+	pool_ptr->generation   = (UInt32)atomic_inc(&g_mempool_generation);
+	while (((size_t)1 << pool_ptr->slab_shift) <
+		ESIF_MEMPOOL_SLAB_HEADER_LEN + ((size_t)pool_ptr->slot_size * pool_ptr->slab_objects)) {
+		pool_ptr->slab_shift++;
+	}
+	esif_ccb_lock_init(&pool_ptr->slab_lock);
+
+	esif_ccb_write_lock(&g_mempool_lock);
+
+	if (g_mempool[pool_type] != NULL) {
+		esif_ccb_write_unlock(&g_mempool_lock);
+		esif_ccb_lock_uninit(&pool_ptr->slab_lock);
+		esif_ccb_free(pool_ptr);
+		pool_ptr = NULL;
+		goto exit;
+	}
+
+	g_mempool[pool_type] = pool_ptr;
+
+	MEMPOOL_DEBUG("Memory Pool %s Create Object Size=%d Slab Objects=%d\n",
+		pool_ptr->name_ptr,
+		pool_ptr->object_size,
+		pool_ptr->slab_objects);
+
+	esif_ccb_write_unlock(&g_mempool_lock);
+exit:
+	return pool_ptr;
+}
+
+
+/*
+ * Memory Pool Destroy
+ * All threads other than the caller must have returned their objects (or exited).
+ * A pool that still has objects in use is left in place so later frees remain valid.
+ * Alloc and Free hold the global pool lock for reading while they use a pool,
+ * so taking it for writing waits for those calls to drain before the pool is
+ * retired and released.
+ */
+void esif_ccb_mempool_destroy(
+	enum esif_mempool_type pool_type
+	)
+{
+	struct esif_ccb_mempool *pool_ptr = NULL;
+	struct esif_ccb_mempool_slab *slab_ptr = NULL;
+	struct esif_ccb_mempool_slab_table *table_ptr = NULL;
+	atomic_basetype remain = 0;
+
+	if (pool_type >= ESIF_MEMPOOL_TYPE_UF_MAX)
+		goto exit;
+
+	esif_ccb_write_lock(&g_mempool_lock);
+
+	pool_ptr = g_mempool[pool_type];
+
+	if (NULL == pool_ptr) {
+		esif_ccb_write_unlock(&g_mempool_lock);
+		goto exit;
+	}
+
+	if (g_mempool_magazine[pool_type].generation == pool_ptr->generation) {
+		esif_ccb_mempool_flush_magazine(pool_ptr, &g_mempool_magazine[pool_type], 0);
+		g_mempool_magazine[pool_type].generation = 0;
+	}
+
+	remain = atomic_read(&pool_ptr->live);
+	MEMPOOL_DEBUG("Memory Pool %s Destroy alloc=" ATOMIC_FMT " free=" ATOMIC_FMT " remain=" ATOMIC_FMT " slabs=" ATOMIC_FMT "\n",
+		pool_ptr->name_ptr,
+		atomic_read(&pool_ptr->alloc_count),
+		atomic_read(&pool_ptr->free_count),
+		remain,
+		atomic_read(&pool_ptr->slab_count));
+
+	if (remain > 0) {
+		ESIF_TRACE_WARN("Memory Pool %s not destroyed: " ATOMIC_FMT " objects in use\n",
+			pool_ptr->name_ptr,
+			remain);
+		esif_ccb_write_unlock(&g_mempool_lock);
+		goto exit;
+	}
+
+	g_mempool[pool_type] = NULL;
+
+	esif_ccb_write_unlock(&g_mempool_lock);
+
+	/* Every free object lives in a Slab, so releasing the Slabs releases them all */
+	atomic_set(&pool_ptr->free_head, NULL);
+
+	while (pool_ptr->slab_list != NULL) {
+		slab_ptr = pool_ptr->slab_list;
+		pool_ptr->slab_list = slab_ptr->next_ptr;
+		esif_ccb_free(slab_ptr);
+	}
+
+	while (pool_ptr->slab_table != NULL) {
+		table_ptr = pool_ptr->slab_table;
+		pool_ptr->slab_table = table_ptr->retired_ptr;
+		esif_ccb_free(table_ptr);
+	}
+
+	esif_ccb_lock_uninit(&pool_ptr->slab_lock);
+	esif_ccb_free(pool_ptr);
+exit:
+	;
+}
+
+
+/* Memory Pool Alloc */
+void *esif_ccb_mempool_alloc(
+	enum esif_mempool_type pool_type
+	)
+{
+	struct esif_ccb_mempool *pool_ptr = NULL;
+	struct esif_ccb_mempool_magazine *mag_ptr = NULL;
+	void *mem_ptr = NULL;
+	atomic_basetype live = 0;
+	atomic_basetype peak = 0;
+
+	if (pool_type >= ESIF_MEMPOOL_TYPE_UF_MAX)
+		goto exit;
+
+	esif_ccb_read_lock(&g_mempool_lock);
+	pool_ptr = g_mempool[pool_type];
+	if (NULL == pool_ptr)
+		goto unlock;
+
+	mag_ptr = esif_ccb_mempool_get_magazine(pool_type, pool_ptr);
+	if (0 == mag_ptr->count) {
+		mag_ptr->head_ptr = esif_ccb_mempool_refill(pool_ptr);
+		if (NULL == mag_ptr->head_ptr)
+			goto unlock;
+
+		for (mem_ptr = mag_ptr->head_ptr; mem_ptr != NULL; mem_ptr = MEMPOOL_NEXT_OBJECT(mem_ptr)) {
+			mag_ptr->count++;
+		}
+	}
+
+	mem_ptr = mag_ptr->head_ptr;
+	mag_ptr->head_ptr = MEMPOOL_NEXT_OBJECT(mem_ptr);
+	mag_ptr->count--;
+
+	esif_ccb_mempool_check_poison(pool_ptr, mem_ptr);
+	esif_ccb_memset(mem_ptr, 0, pool_ptr->object_size);
+
+	atomic_inc(&pool_ptr->alloc_count);
+	live = atomic_inc(&pool_ptr->live);
+	for (peak = atomic_read(&pool_ptr->peak); live > peak; peak = atomic_read(&pool_ptr->peak)) {
+		if (atomic_cmpxchg(&pool_ptr->peak, peak, live) == peak)
+			break;
+	}
+
+	MEMPOOL_DEBUG("MP Entry Allocated(" ATOMIC_FMT ")=%p From Mempool %s\n",
+		live,
+		mem_ptr,
+		pool_ptr->name_ptr);
+unlock:
+	esif_ccb_read_unlock(&g_mempool_lock);
+exit:
+	return mem_ptr;
+}
+
+
+/* Memory Pool ZERO Alloc */
+void *esif_ccb_mempool_zalloc(
+	enum esif_mempool_type pool_type
+	)
+{
+	/* Pool objects are always zeroed when allocated */
+	return esif_ccb_mempool_alloc(pool_type);
+}
+
+
+/* Memory Pool Free */
+void esif_ccb_mempool_free(
+	enum esif_mempool_type pool_type,
+	void *mem_ptr
+	)
+{
+	struct esif_ccb_mempool *pool_ptr = NULL;
+	struct esif_ccb_mempool_magazine *mag_ptr = NULL;
+	Bool is_owned = ESIF_FALSE;
+
+	if (NULL == mem_ptr)
+		goto exit;
+
+	/*
+	 * Callers fall back to esif_ccb_malloc when the pool does not exist yet or
+	 * cannot grow, so release any object that was not carved from this pool's
+	 * Slabs to the heap. Only pool objects are counted as live.
+	 */
+	if (pool_type < ESIF_MEMPOOL_TYPE_UF_MAX) {
+		esif_ccb_read_lock(&g_mempool_lock);
+		pool_ptr = g_mempool[pool_type];
+		is_owned = ((pool_ptr != NULL) && esif_ccb_mempool_owns(pool_ptr, mem_ptr));
+		if (!is_owned) {
+			esif_ccb_read_unlock(&g_mempool_lock);
+		}
+	}
+	if (!is_owned) {
+		esif_ccb_free(mem_ptr);
+		goto exit;
+	}
+
+	esif_ccb_mempool_poison(pool_ptr, mem_ptr);
+
+	mag_ptr = esif_ccb_mempool_get_magazine(pool_type, pool_ptr);
+	MEMPOOL_NEXT_OBJECT(mem_ptr) = mag_ptr->head_ptr;
+	mag_ptr->head_ptr = mem_ptr;
+	mag_ptr->count++;
+
+	/* Keep half a Magazine so alternating alloc/free does not bounce objects through the shared list */
+	if (mag_ptr->count >= 2 * ESIF_MEMPOOL_MAGAZINE_SIZE) {
+		esif_ccb_mempool_flush_magazine(pool_ptr, mag_ptr, ESIF_MEMPOOL_MAGAZINE_SIZE / 2);
+	}
+
+	atomic_inc(&pool_ptr->free_count);
+	atomic_dec(&pool_ptr->live);
+
+	MEMPOOL_DEBUG("Freeing MP entry (" ATOMIC_FMT ")=%p From Mempool %s\n",
+		atomic_read(&pool_ptr->free_count),
+		mem_ptr,
+		pool_ptr->name_ptr);
+	esif_ccb_read_unlock(&g_mempool_lock);
+exit:
+	return;
+}
+
+
+/* Memory Pool Statistics */
+enum esif_rc esif_ccb_mempool_get_stats(
+	enum esif_mempool_type pool_type,
+	struct esif_ccb_mempool_stats *stats_ptr
+	)
+{
+	enum esif_rc rc = ESIF_OK;
+	struct esif_ccb_mempool *pool_ptr = NULL;
+
+	if (NULL == stats_ptr) {
+		rc = ESIF_E_PARAMETER_IS_NULL;
+		goto exit;
+	}
+	if (pool_type >= ESIF_MEMPOOL_TYPE_UF_MAX) {
+		rc = ESIF_E_PARAMETER_IS_OUT_OF_BOUNDS;
+		goto exit;
+	}
+
+	esif_ccb_read_lock(&g_mempool_lock);
+	pool_ptr = g_mempool[pool_type];
+	if (NULL == pool_ptr) {
+		esif_ccb_read_unlock(&g_mempool_lock);
+		rc = ESIF_E_NOT_FOUND;
+		goto exit;
+	}
+
+	stats_ptr->name_ptr      = pool_ptr->name_ptr;
+	stats_ptr->pool_tag      = pool_ptr->pool_tag;
+	stats_ptr->object_size   = pool_ptr->object_size;
+	stats_ptr->alloc_count   = (UInt64)atomic_read(&pool_ptr->alloc_count);
+	stats_ptr->free_count    = (UInt64)atomic_read(&pool_ptr->free_count);
+	stats_ptr->live          = (UInt64)atomic_read(&pool_ptr->live);
+	stats_ptr->peak          = (UInt64)atomic_read(&pool_ptr->peak);
+	stats_ptr->slab_count    = (UInt64)atomic_read(&pool_ptr->slab_count);
+	stats_ptr->poison_errors = (UInt64)atomic_read(&pool_ptr->poison_errors);
+	esif_ccb_read_unlock(&g_mempool_lock);
+exit:
+	return rc;
+}
+
+
+/* NOTE:  This function is common to user and kernel mode */
+enum esif_rc esif_ccb_mempool_init_tracking(void)
+{
+	esif_ccb_lock_init(&g_mempool_lock);
+	if (pthread_key_create(&g_mempool_thread_key, esif_ccb_mempool_thread_exit) == 0) {
+		g_mempool_thread_key_valid = ESIF_TRUE;
+	}
+	return ESIF_OK;
+}
+
+
+/* NOTE:  This function is common to user and kernel mode */
+/* WARNING:  This function may not be in paged code in kernel */
+void esif_ccb_mempool_uninit_tracking(void)
+{
+	u32 type_tag;
+
+	/*
+	 * Destroy the pools for all supported types.
+	 */
+	for (type_tag = 0; type_tag < ESIF_MEMPOOL_TYPE_UF_MAX; type_tag++)
+		esif_ccb_mempool_destroy((enum esif_mempool_type)type_tag);
+
+	if (g_mempool_thread_key_valid) {
+		g_mempool_thread_key_valid = ESIF_FALSE;
+		pthread_key_delete(g_mempool_thread_key);
+	}
+	esif_ccb_lock_uninit(&g_mempool_lock);
+}
+
+
+/******************************************************************************/
+/******************************************************************************/
+/******************************************************************************/
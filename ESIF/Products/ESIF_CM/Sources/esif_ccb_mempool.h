@@ -56,6 +56,7 @@
 
 #include "esif_mempool.h"
 #include "esif_ccb_memory.h"
+#include "esif_ccb_atomic.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -79,232 +80,114 @@ extern esif_ccb_lock_t g_mempool_lock;
 		##__VA_ARGS__ \
 		)
 
-#pragma pack(push,1)
+/*
+ * Memory Pools are fixed-size object allocators, one per esif_mempool_type.
+ *
+ * Objects are carved from Slab pages and recycled through a lock-free list
+ * of free objects shared by all threads. Each thread also keeps a small
+ * Magazine of free objects per pool, so most allocations and frees touch
+ * no shared state other than the pool statistics.
+ *
+ * Objects must be at least two pointers in size. Objects allocated with
+ * esif_ccb_malloc when the pool did not exist or could not grow may be
+ * passed to esif_ccb_mempool_free, which releases them with esif_ccb_free
+ * since they do not lie in any of the pool's Slabs. Freed objects are
+ * poisoned in debug builds (or when ESIF_MEMPOOL_POISON is defined), and any object
+ * modified after it was freed is reported when it is allocated again.
+ */
+#define ESIF_MEMPOOL_SLAB_SIZE		(16 * 1024)	/* Target Slab Page Size         */
+#define ESIF_MEMPOOL_SLAB_MIN_OBJECTS	16		/* Min Objects per Slab Page     */
+#define ESIF_MEMPOOL_MAGAZINE_SIZE	32		/* Objects per Thread Magazine   */
+#define ESIF_MEMPOOL_POISON_BYTE	0x6B		/* Fill Byte for Freed Objects   */
+
+#if defined(ESIF_ATTR_DEBUG) && !defined(ESIF_MEMPOOL_POISON)
+#define ESIF_MEMPOOL_POISON
+#endif
+
+struct esif_ccb_mempool_slab;
+struct esif_ccb_mempool_slab_table;
 
 struct esif_ccb_mempool {
 	esif_string  name_ptr;		/* Name                         */
 	UInt32       pool_tag;		/* Pool Tag                     */
 	UInt32       object_size;	/* Size Of Pool Object In Bytes */
-	UInt32       alloc_count;	/* Object Allocation Count      */
-	UInt32       free_count;	/* Object Free Count            */
+	UInt32       slot_size;		/* Object Size Rounded Up For Alignment */
+	UInt32       slab_objects;	/* Objects Per Slab Page        */
+	UInt32       slab_shift;	/* Log2 of Slab Table Bucket Size */
+	UInt32       generation;	/* Unique ID for Thread Magazines */
+	atomic_t     alloc_count;	/* Object Allocation Count      */
+	atomic_t     free_count;	/* Object Free Count            */
+	atomic_t     live;		/* Objects In Use               */
+	atomic_t     peak;		/* Peak Objects In Use          */
+	atomic_t     slab_count;	/* Slab Pages Allocated         */
+	atomic_t     poison_errors;	/* Freed Objects Modified After Free */
+	void         *free_head;	/* Shared Lock-Free List of Free Object Chains */
+	esif_ccb_lock_t slab_lock;	/* Slab List and Free List Pop Lock */
+	struct esif_ccb_mempool_slab *slab_list;	/* Slab Pages   */
+	struct esif_ccb_mempool_slab_table *slab_table;	/* Slab Lookup by Address */
 };
 
-#pragma pack(pop)
+/* Memory Pool Statistics */
+struct esif_ccb_mempool_stats {
+	esif_string  name_ptr;		/* Name                         */
+	UInt32       pool_tag;		/* Pool Tag                     */
+	UInt32       object_size;	/* Size Of Pool Object In Bytes */
+	UInt64       alloc_count;	/* Object Allocation Count      */
+	UInt64       free_count;	/* Object Free Count            */
+	UInt64       live;		/* Objects In Use               */
+	UInt64       peak;		/* Peak Objects In Use          */
+	UInt64       slab_count;	/* Slab Pages Allocated         */
+	UInt64       poison_errors;	/* Freed Objects Modified After Free */
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
 
 /* Memory Pool Create */
-static ESIF_INLINE struct esif_ccb_mempool *esif_ccb_mempool_create(
+struct esif_ccb_mempool *esif_ccb_mempool_create(
 	enum esif_mempool_type pool_type,
 	UInt32 pool_tag,
 	UInt32 object_size
-	)
-{
-	struct esif_ccb_mempool *pool_ptr = NULL;
-
-	if (pool_type >= ESIF_MEMPOOL_TYPE_MAX)
-		goto exit;
-
-	pool_ptr = (struct esif_ccb_mempool *)
-			esif_ccb_malloc(sizeof(*pool_ptr));
-
-	if (NULL == pool_ptr)
-		return NULL;
-
-	pool_ptr->name_ptr    = esif_mempool_str(pool_tag);
-	pool_ptr->pool_tag    = pool_tag;
-	pool_ptr->alloc_count = 0;
-	pool_ptr->free_count  = 0;
-	pool_ptr->object_size = object_size;
-
-	esif_ccb_write_lock(&g_mempool_lock);
-
-	g_mempool[pool_type] = pool_ptr;
-
-	MEMPOOL_DEBUG("Memory Pool %s Create Object Size=%d\n",
-		pool_ptr->name_ptr,
-		pool_ptr->object_size);
-
-	esif_ccb_write_unlock(&g_mempool_lock);
-exit:
-	return pool_ptr;
-}
+	);
 
 /* Memory Pool Destroy */
-static ESIF_INLINE void esif_ccb_mempool_destroy(
+void esif_ccb_mempool_destroy(
 	enum esif_mempool_type pool_type
-	)
-{
-	struct esif_ccb_mempool *pool_ptr = NULL;
-	int remain = 0;
-
-	if (pool_type >= ESIF_MEMPOOL_TYPE_MAX)
-		goto exit;
-
-	esif_ccb_write_lock(&g_mempool_lock);
-
-	pool_ptr = g_mempool[pool_type];
-
-	if (NULL == pool_ptr) {
-		esif_ccb_write_unlock(&g_mempool_lock);
-		goto exit;
-	}
+	);
 
-	remain = pool_ptr->alloc_count - pool_ptr->free_count;
-	MEMPOOL_DEBUG("Memory Pool %s Destroy alloc=%d free=%d remain=%d\n",
-		pool_ptr->name_ptr,
-		pool_ptr->alloc_count,
-		pool_ptr->free_count,
-		remain);
-
-	g_mempool[pool_type] = NULL;
-
-	esif_ccb_write_unlock(&g_mempool_lock);
-
-	esif_ccb_free(pool_ptr);
-exit:
-	;
-}
-
-
-/* Memory Pool Alloc */
-static ESIF_INLINE void *esif_ccb_mempool_alloc(
+/* Memory Pool Alloc (returns a zeroed object or NULL if the pool does not exist) */
+void *esif_ccb_mempool_alloc(
 	enum esif_mempool_type pool_type
-	)
-{
-	struct esif_ccb_mempool *pool_ptr = NULL;
-	void *mem_ptr = NULL;
-
-	if (pool_type >= ESIF_MEMPOOL_TYPE_MAX)
-		goto exit;
-
-	esif_ccb_write_lock(&g_mempool_lock);
-
-	pool_ptr = g_mempool[pool_type];
-	if (NULL == pool_ptr) {
-		esif_ccb_write_unlock(&g_mempool_lock);
-		goto exit;
-	}
-
-	mem_ptr = esif_ccb_malloc(pool_ptr->object_size);
-	if (NULL == mem_ptr) {
-		esif_ccb_write_unlock(&g_mempool_lock);
-		goto exit;
-	}
-
-	pool_ptr->alloc_count++;
-
-	MEMPOOL_DEBUG("MP Entry Allocated(%d)=%p From Mempool %s\n",
-		pool_ptr->alloc_count,
-		mem_ptr,
-		pool_ptr->name_ptr);
-
-	esif_ccb_write_unlock(&g_mempool_lock);
-
-exit:
-	return mem_ptr;
-}
-
-
-/* Memory Pool Free */
-static ESIF_INLINE void esif_ccb_mempool_free(
-	enum esif_mempool_type pool_type,
-	void *mem_ptr
-	)
-{
-	struct esif_ccb_mempool *pool_ptr = NULL;
-
-	if (NULL == mem_ptr)
-		goto exit;
-
-	if (pool_type >= ESIF_MEMPOOL_TYPE_MAX)
-		goto exit;
-
-	esif_ccb_write_lock(&g_mempool_lock);
-
-	pool_ptr = g_mempool[pool_type];
-
-	if (NULL == pool_ptr) {
-		esif_ccb_write_unlock(&g_mempool_lock);
-		goto exit;
-	}
-
-	pool_ptr->free_count++;
-
-	MEMPOOL_DEBUG("Freeing MP entry (%d)=%p From Mempool %s\n",
-		pool_ptr->free_count,
-		mem_ptr,
-		pool_ptr->name_ptr);
-
-	esif_ccb_write_unlock(&g_mempool_lock);
-exit:
-	esif_ccb_free(mem_ptr);
-	return;
-}
-
-
-
-
-/* NOTE:  This function is common to user and kernel mode */
-static ESIF_INLINE enum esif_rc esif_ccb_mempool_init_tracking(void)
-{
-	esif_ccb_lock_init(&g_mempool_lock);
-	return ESIF_OK;
-}
-
-
-/* NOTE:  This function is common to user and kernel mode */
-/* WARNING:  This function may not be in paged code in kernel */
-static ESIF_INLINE void esif_ccb_mempool_uninit_tracking(void)
-{
-	u32 type_tag;
-
-	/*
-	 * Create the tracking array for all supported types.
-	 */
-	for (type_tag = 0; type_tag < ESIF_MEMPOOL_TYPE_MAX; type_tag++)
-		esif_ccb_mempool_destroy((enum esif_mempool_type)type_tag);
-
-	esif_ccb_lock_uninit(&g_mempool_lock);
-}
+	);
 
 /* Memory Pool ZERO Alloc */
-/* NOTE:  This function is common to user and kernel mode */
-/* WARNING:  This function may not be called from paged code in kernel */
-static ESIF_INLINE void *esif_ccb_mempool_zalloc(
+void *esif_ccb_mempool_zalloc(
 	enum esif_mempool_type pool_type
-	)
-{
-	struct esif_ccb_mempool *pool_ptr = NULL;
-	void *mem_ptr = NULL;
-
-	mem_ptr = esif_ccb_mempool_alloc(pool_type);
+	);
 
-	if (NULL == mem_ptr)
-		goto exit;
-
-	/*
-	 * If the allocation above is successful, we know the pool_type is in
-	 * bounds, so no check required in this function.
-	 */
-	esif_ccb_read_lock(&g_mempool_lock);
+/* Memory Pool Free (objects are released with esif_ccb_free if the pool does not exist) */
+void esif_ccb_mempool_free(
+	enum esif_mempool_type pool_type,
+	void *mem_ptr
+	);
 
-	pool_ptr = g_mempool[pool_type];
+/* Memory Pool Statistics */
+enum esif_rc esif_ccb_mempool_get_stats(
+	enum esif_mempool_type pool_type,
+	struct esif_ccb_mempool_stats *stats_ptr
+	);
 
-	if (NULL == pool_ptr) {
-		esif_ccb_read_unlock(&g_mempool_lock);
-		esif_ccb_mempool_free(pool_type, mem_ptr);
-		mem_ptr = NULL;
-		goto exit;
-	}
+enum esif_rc esif_ccb_mempool_init_tracking(void);
+void esif_ccb_mempool_uninit_tracking(void);
 
-	esif_ccb_memset(mem_ptr, 0, pool_ptr->object_size);
-	esif_ccb_read_unlock(&g_mempool_lock);
-exit:
-	return mem_ptr;
+#ifdef __cplusplus
 }
-
+#endif
 
 #endif /* _ESIF_CCB_MEMPOOL_H_ */
 
+
 /*****************************************************************************/
 /*****************************************************************************/
 /*****************************************************************************/
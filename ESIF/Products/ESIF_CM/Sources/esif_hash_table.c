@@ -58,10 +58,23 @@
 #define ESIF_DEBUG_MODULE ESIF_DEBUG_MOD_HASH
 
 /*
- * follows the FNV-1a method of hash creation
- * http://www.isthe.com/chongo/tech/comp/fnv/index.html#FNV-1a
+ * Keys are hashed a 64-bit word at a time and finished with the MurmurHash3
+ * 64-bit finalizer, which mixes every key bit into the low-order bits used
+ * to select a slot. A hash value of 0 is reserved to mark empty slots.
  */
-static const u32 FNV_PRIME = 16777619;
+#define ESIF_HT_HASH_MULT	0x9E3779B97F4A7C15ULL
+#define ESIF_HT_HASH_MIX1	0xFF51AFD7ED558CCDULL
+#define ESIF_HT_HASH_MIX2	0xC4CEB9FE1A85EC53ULL
+
+#define ESIF_HT_EMPTY_HASH	0
+
+/* Grow when more than 3/4 of the slots would be in use */
+#define ESIF_HT_IS_OVERLOADED(count, size) \
+	((u64)(count) * 4 > (u64)(size) * 3)
+
+#define ESIF_HT_SLOT_KEY(slot_ptr) \
+	((slot_ptr)->key_length <= ESIF_HT_INLINE_KEY_LEN ? \
+	 (slot_ptr)->key.data : (slot_ptr)->key.ptr)
 
 /* Function Declarations */
 
@@ -70,42 +83,26 @@ static u32 esif_compute_hash(
 	u32 data_length
 	);
 
-static struct esif_link_list *esif_ht_get_ll(
+static u32 esif_ht_find_slot(
 	struct esif_ht *self,
-	u8 *key_ptr,
-	u32 key_length
-	);
-
-static struct esif_ht_node *esif_alloc_ht_node(
 	u8 *key_ptr,
 	u32 key_length,
-	void *item_ptr
-	);
-
-static struct esif_link_list_node *esif_find_node_in_ht_ll(
-	struct esif_link_list *ll_ptr,
-	u8 *key_ptr,
-	u32 key_length
+	u32 hash
 	);
 
-static u8 esif_cmp_keys(
-	u8 *key1_ptr,
-	u32 key1_length,
-	u8 *key2_ptr,
-	u32 key2_length
+static void esif_ht_place_slot(
+	struct esif_ht *self,
+	struct esif_ht_slot *slot_ptr
 	);
 
-static void esif_destroy_ht_node(struct esif_ht_node *ht_node);
-
-static void esif_destroy_ht_nodes(
-	struct esif_link_list *ll_ptr,
-	item_destroy_func item_destroy_fptr
+static enum esif_rc esif_ht_resize(
+	struct esif_ht *self,
+	u32 new_size
 	);
 
-static struct esif_ht_node *esif_ht_get_ht_node(
+static void esif_ht_remove_slot(
 	struct esif_ht *self,
-	u8 *key_ptr,
-	u32 key_length
+	u32 index
 	);
 
 /* Function Definitions */
@@ -116,211 +113,157 @@ static u32 esif_compute_hash(
 	u32 data_length
 	)
 {
-	u32 hash_value = 0;
-	u32 offset     = 0;
+	u64 hash_value = ESIF_HT_HASH_MULT ^ ((u64)data_length * ESIF_HT_HASH_MIX1);
+	u64 word = 0;
 
 	ESIF_ASSERT(data_ptr != NULL);
 
-	for (offset = 0; offset < data_length; ++offset) {
-		hash_value = hash_value ^ data_ptr[offset];
-		hash_value = hash_value * FNV_PRIME;
+	while (data_length >= sizeof(word)) {
+		esif_ccb_memcpy(&word, data_ptr, sizeof(word));
+		word *= ESIF_HT_HASH_MULT;
+		word ^= word >> 32;
+		hash_value = (hash_value ^ word) * ESIF_HT_HASH_MIX2;
+		data_ptr += sizeof(word);
+		data_length -= sizeof(word);
 	}
-
-	return hash_value;
-}
-
-u8 esif_cmp_keys(
-	u8 *key1_ptr,
-	u32 key1_length,
-	u8 *key2_ptr,
-	u32 key2_length
-	)
-{
-	u8 keys_equal = ESIF_FALSE;
-
-	if ((key1_ptr == NULL) || (key2_ptr == NULL)) {
-		goto exit;
-	}
-	if (key1_length != key2_length) {
-		goto exit;
+	if (data_length > 0) {
+		word = 0;
+		esif_ccb_memcpy(&word, data_ptr, data_length);
+		word *= ESIF_HT_HASH_MULT;
+		word ^= word >> 32;
+		hash_value = (hash_value ^ word) * ESIF_HT_HASH_MIX2;
 	}
 
-	if (memcmp((void *)key1_ptr, (void *)key2_ptr, key1_length) == 0) {
-		keys_equal = ESIF_TRUE;
+	hash_value ^= hash_value >> 33;
+	hash_value *= ESIF_HT_HASH_MIX1;
+	hash_value ^= hash_value >> 33;
+	hash_value *= ESIF_HT_HASH_MIX2;
+	hash_value ^= hash_value >> 33;
+
+	if ((u32)hash_value == ESIF_HT_EMPTY_HASH) {
+		hash_value = 1;
 	}
-exit:
-	return keys_equal;
+	return (u32)hash_value;
 }
 
-static struct esif_ht_node *esif_ht_get_ht_node(
+/* Returns the index of the oldest slot matching the key, or self->size if none */
+static u32 esif_ht_find_slot(
 	struct esif_ht *self,
 	u8 *key_ptr,
-	u32 key_length
+	u32 key_length,
+	u32 hash
 	)
 {
-	struct esif_link_list *ll_ptr = NULL;
-	struct esif_link_list_node *ll_node = NULL;
-	struct esif_ht_node *ht_node = NULL;
-
-	ESIF_ASSERT(key_ptr != NULL);
-	ESIF_ASSERT(self != NULL);
-
-	ll_ptr = esif_ht_get_ll(self, key_ptr, key_length);
-	if (ll_ptr == NULL) {
-		ESIF_ASSERT(ESIF_FALSE); /* Should never happen */
-		goto exit;
-	}
-
-	ll_node = esif_find_node_in_ht_ll(ll_ptr, key_ptr, key_length);
-	if (ll_node == NULL) {
-		goto exit;
+	u32 mask = self->size - 1;
+	u32 index = hash & mask;
+	struct esif_ht_slot *slot_ptr = NULL;
+
+	/* The table is never full, so there is always an empty slot to stop at */
+	for (;;) {
+		slot_ptr = &self->table[index];
+		if (slot_ptr->hash == ESIF_HT_EMPTY_HASH) {
+			break;
+		}
+		if ((slot_ptr->hash == hash) &&
+			(slot_ptr->key_length == key_length) &&
+			(memcmp(ESIF_HT_SLOT_KEY(slot_ptr), key_ptr, key_length) == 0)) {
+			return index;
+		}
+		index = (index + 1) & mask;
 	}
-
-	ht_node = (struct esif_ht_node *)ll_node->data_ptr;
-exit:
-	return ht_node;
+	return self->size;
 }
 
-/* Get link list corresponding to the hash index */
-struct esif_link_list * esif_ht_get_ll(
+/* Moves a populated slot into the first free slot of its probe sequence */
+static void esif_ht_place_slot(
 	struct esif_ht *self,
-	u8 *key_ptr,
-	u32 key_length
+	struct esif_ht_slot *slot_ptr
 	)
 {
-	struct esif_link_list *ll_ptr = NULL;
-	u32 hash_index;
-	
-	ESIF_ASSERT(key_ptr != NULL);
-	ESIF_ASSERT(self != NULL);
-
-	hash_index = esif_compute_hash(key_ptr, key_length) % self->size;
+	u32 mask = self->size - 1;
+	u32 index = slot_ptr->hash & mask;
 
-	ll_ptr = self->table[hash_index];
-
-	return ll_ptr;
-}
-
-static struct esif_link_list_node * esif_find_node_in_ht_ll(
-	struct esif_link_list *ll_ptr,
-	u8 *key_ptr,
-	u32 key_length
-	)
-{
-	struct esif_link_list_node *cur_ptr = NULL;
-	struct esif_ht_node *ht_node = NULL;
-
-	ESIF_ASSERT(ll_ptr != NULL);
-	ESIF_ASSERT(key_ptr != NULL);
-
-	cur_ptr = ll_ptr->head_ptr;
-	while (cur_ptr) {
-		ht_node = (struct esif_ht_node *)cur_ptr->data_ptr;
-		if (ht_node != NULL) {
-			if (esif_cmp_keys(key_ptr, key_length,
-				ht_node->key_ptr, ht_node->key_length)) {
-				break;
-			}
-		}
-		cur_ptr = cur_ptr->next_ptr;
+	while (self->table[index].hash != ESIF_HT_EMPTY_HASH) {
+		index = (index + 1) & mask;
 	}
-	return cur_ptr;
+	self->table[index] = *slot_ptr;
+	self->count++;
 }
 
-static struct esif_ht_node *esif_alloc_ht_node(
-	u8 *key_ptr,
-	u32 key_length,
-	void *item_ptr
+static enum esif_rc esif_ht_resize(
+	struct esif_ht *self,
+	u32 new_size
 	)
 {
 	enum esif_rc rc = ESIF_OK;
-	struct esif_ht_node *ht_node_ptr = NULL;
-	
-	ESIF_ASSERT(key_ptr != NULL);
-	
-	ht_node_ptr =
-		(struct esif_ht_node *)esif_ccb_malloc(sizeof(*ht_node_ptr));
-	if (ht_node_ptr == NULL) {
+	struct esif_ht_slot *old_table = self->table;
+	u32 old_size = self->size;
+	u32 start = 0;
+	u32 offset = 0;
+	u32 index = 0;
+
+	self->table = (struct esif_ht_slot *)
+		esif_ccb_malloc(sizeof(*self->table) * new_size);
+	if (self->table == NULL) {
+		self->table = old_table;
 		rc = ESIF_E_NO_MEMORY;
 		goto exit;
 	}
+	self->size = new_size;
+	self->count = 0;
 
-	ht_node_ptr->key_ptr = esif_ccb_malloc(key_length);
-	if (ht_node_ptr->key_ptr == NULL) {
-		rc = ESIF_E_NO_MEMORY;
+	if (old_table == NULL) {
 		goto exit;
 	}
 
-	esif_ccb_memcpy(ht_node_ptr->key_ptr, key_ptr, key_length);
-	ht_node_ptr->key_length = key_length;
-	ht_node_ptr->item_ptr = item_ptr;
-exit:
-	if (rc != ESIF_OK) {
-		if (ht_node_ptr) {
-			if (ht_node_ptr->key_ptr)
-				esif_ccb_free(ht_node_ptr->key_ptr);
-
-			esif_ccb_free(ht_node_ptr);
-			ht_node_ptr = NULL;
+	/*
+	 * Start rehashing just after an empty slot so that no probe sequence
+	 * wraps around the start, which keeps duplicate keys in insertion order.
+	 */
+	while ((start < old_size) && (old_table[start].hash != ESIF_HT_EMPTY_HASH)) {
+		start++;
+	}
+	for (offset = 1; offset <= old_size; offset++) {
+		index = (start + offset) & (old_size - 1);
+		if (old_table[index].hash != ESIF_HT_EMPTY_HASH) {
+			esif_ht_place_slot(self, &old_table[index]);
 		}
 	}
-
-	return ht_node_ptr;
-}
-
-/* This does not delete the item_ptr */
-static void esif_destroy_ht_node(
-	struct esif_ht_node *ht_node
-	)
-{
-	ESIF_ASSERT(ht_node != NULL);
-
-	if (ht_node->key_ptr)
-		esif_ccb_free(ht_node->key_ptr);
-
-	/* TODO: If needed */
-	/* We can call the callback destroy func here so that
-	 * the caller does not have to destroy the item. Right 
-	 * now this is done before coming into this function 
-	 * for HT destroy only.
-	 */
-	esif_ccb_free(ht_node);
-
-	return;
+	esif_ccb_free(old_table);
+exit:
+	return rc;
 }
 
-/* Destroys ht_node's in the Hash Table LL */
-void esif_destroy_ht_nodes(
-	struct esif_link_list *ll_ptr,
-	item_destroy_func item_destroy_fptr
+/* Empties a slot and shifts any displaced slots that follow it backward */
+static void esif_ht_remove_slot(
+	struct esif_ht *self,
+	u32 index
 	)
 {
-	struct esif_link_list_node *cur_ptr = NULL;
-	struct esif_ht_node *ht_node = NULL;
-	void *item_ptr = NULL;
+	u32 mask = self->size - 1;
+	u32 next = index;
+	u32 home = 0;
 
-	if (ll_ptr == NULL) {
-		goto exit;
+	if (self->table[index].key_length > ESIF_HT_INLINE_KEY_LEN) {
+		esif_ccb_free(self->table[index].key.ptr);
 	}
 
-	cur_ptr = ll_ptr->head_ptr;
-	while (cur_ptr) {
-		ht_node = (struct esif_ht_node *)cur_ptr->data_ptr;
-		if (ht_node != NULL) {
-			if (item_destroy_fptr) {
-				item_ptr = ht_node->item_ptr;
-				ht_node->item_ptr = NULL;
-				item_destroy_fptr(item_ptr);
-			}
-
-			esif_destroy_ht_node(ht_node);
-			cur_ptr->data_ptr = NULL;
+	for (;;) {
+		next = (next + 1) & mask;
+		if (self->table[next].hash == ESIF_HT_EMPTY_HASH) {
+			break;
 		}
 
-		cur_ptr = cur_ptr->next_ptr;
+		/* Only move the slot if the hole lies between its home and itself */
+		home = self->table[next].hash & mask;
+		if (((next - home) & mask) >= ((next - index) & mask)) {
+			self->table[index] = self->table[next];
+			index = next;
+		}
 	}
-exit:
-	return;
+
+	esif_ccb_memset(&self->table[index], 0, sizeof(self->table[index]));
+	self->count--;
 }
 
 enum esif_rc esif_ht_add_item(
@@ -331,38 +274,42 @@ enum esif_rc esif_ht_add_item(
 	)
 {
 	enum esif_rc rc = ESIF_OK;
-	struct esif_link_list *ll_ptr = NULL;
-	struct esif_ht_node *ht_node = NULL;
+	struct esif_ht_slot slot = {0};
 
 	if ((key_ptr == NULL) || (self == NULL)) {
 		rc = ESIF_E_PARAMETER_IS_NULL;
 		goto exit;
 	}
 
-	ll_ptr = esif_ht_get_ll(self, key_ptr, key_length);
-	if (ll_ptr == NULL) {
-		ESIF_ASSERT(ESIF_FALSE); /* Should never happen */
-		rc = ESIF_E_NOT_FOUND;
-		goto exit;
+	if (ESIF_HT_IS_OVERLOADED(self->count + 1, self->size)) {
+		/* Doubling again would overflow the u32 slot count */
+		if (self->size >= ESIF_HT_MAX_SIZE) {
+			rc = ESIF_E_MAXIMUM_CAPACITY_REACHED;
+			goto exit;
+		}
+		rc = esif_ht_resize(self, self->size * 2);
+		if (rc != ESIF_OK) {
+			goto exit;
+		}
 	}
 
-	ht_node = esif_alloc_ht_node(key_ptr, key_length, item_ptr);
-	if (ht_node == NULL) {
-		rc = ESIF_E_NO_MEMORY;
-		goto exit;
+	slot.hash = esif_compute_hash(key_ptr, key_length);
+	slot.key_length = key_length;
+	slot.item_ptr = item_ptr;
+	if (key_length <= ESIF_HT_INLINE_KEY_LEN) {
+		esif_ccb_memcpy(slot.key.data, key_ptr, key_length);
 	}
-
-	rc = esif_link_list_add_at_back(ll_ptr, (void *)ht_node);
-	if (rc != ESIF_OK) {
-		goto exit;
+	else {
+		slot.key.ptr = (u8 *)esif_ccb_malloc(key_length);
+		if (slot.key.ptr == NULL) {
+			rc = ESIF_E_NO_MEMORY;
+			goto exit;
+		}
+		esif_ccb_memcpy(slot.key.ptr, key_ptr, key_length);
 	}
 
+	esif_ht_place_slot(self, &slot);
 exit:
-	if (rc != ESIF_OK) {
-		if (ht_node != NULL)
-			esif_destroy_ht_node(ht_node);
-	}
-
 	return rc;
 }
 
@@ -373,37 +320,21 @@ enum esif_rc esif_ht_remove_item(
 	)
 {
 	enum esif_rc rc = ESIF_OK;
-	struct esif_link_list *ll_ptr = NULL;
-	struct esif_link_list_node *ll_node = NULL;
-	struct esif_ht_node *ht_node = NULL;
+	u32 index = 0;
 
 	if ((key_ptr == NULL) || (self == NULL)) {
 		rc = ESIF_E_PARAMETER_IS_NULL;
 		goto exit;
 	}
 
-	ll_ptr = esif_ht_get_ll(self, key_ptr, key_length);
-	if (ll_ptr == NULL) {
-		ESIF_ASSERT(ESIF_FALSE); /* Should never happen */
+	index = esif_ht_find_slot(self, key_ptr, key_length,
+		esif_compute_hash(key_ptr, key_length));
+	if (index >= self->size) {
 		rc = ESIF_E_NOT_FOUND;
 		goto exit;
 	}
 
-	ll_node = esif_find_node_in_ht_ll(ll_ptr, key_ptr, key_length);
-	if (ll_node == NULL) {
-		rc = ESIF_E_NOT_FOUND;
-		goto exit;
-	}
-
-	ht_node = (struct esif_ht_node *)ll_node->data_ptr;
-	if (ht_node == NULL) {
-		ESIF_ASSERT(ESIF_FALSE);
-		rc = ESIF_E_PARAMETER_IS_NULL;
-		goto exit;
-	}
-
-	esif_destroy_ht_node(ht_node);
-	esif_link_list_node_remove(ll_ptr, ll_node);
+	esif_ht_remove_slot(self, index);
 exit:
 	return rc;
 }
@@ -414,32 +345,96 @@ void * esif_ht_get_item(
 	u32 key_length
 	)
 {
-	struct esif_ht_node *ht_node = NULL;
 	void *item_ptr = NULL;
+	u32 index = 0;
 
 	if ((key_ptr == NULL) || (self == NULL)) {
 		goto exit;
 	}
 
-	ht_node = esif_ht_get_ht_node(self,
-		key_ptr,
-		key_length);
-	if (ht_node == NULL) {
+	index = esif_ht_find_slot(self, key_ptr, key_length,
+		esif_compute_hash(key_ptr, key_length));
+	if (index >= self->size) {
 		goto exit;
 	}
 
-	item_ptr = ht_node->item_ptr;
+	item_ptr = self->table[index].item_ptr;
 exit:
 	return item_ptr;
 }
 
+u32 esif_ht_get_count(
+	struct esif_ht *self
+	)
+{
+	return (self != NULL ? self->count : 0);
+}
+
+enum esif_rc esif_ht_init_iterator(
+	struct esif_ht *self,
+	struct esif_ht_iterator *iter_ptr
+	)
+{
+	enum esif_rc rc = ESIF_OK;
+
+	if ((self == NULL) || (iter_ptr == NULL)) {
+		rc = ESIF_E_PARAMETER_IS_NULL;
+		goto exit;
+	}
+
+	iter_ptr->marker = ESIF_HT_ITERATOR_MARKER;
+	iter_ptr->ht_ptr = self;
+	iter_ptr->index = 0;
+exit:
+	return rc;
+}
+
+enum esif_rc esif_ht_get_next_item(
+	struct esif_ht_iterator *iter_ptr,
+	u8 **key_ptr,
+	u32 *key_length,
+	void **item_ptr
+	)
+{
+	enum esif_rc rc = ESIF_E_ITERATION_DONE;
+	struct esif_ht *self = NULL;
+	struct esif_ht_slot *slot_ptr = NULL;
+
+	if ((iter_ptr == NULL) || (item_ptr == NULL)) {
+		rc = ESIF_E_PARAMETER_IS_NULL;
+		goto exit;
+	}
+	if (iter_ptr->marker != ESIF_HT_ITERATOR_MARKER) {
+		rc = ESIF_E_INVALID_HANDLE;
+		goto exit;
+	}
+
+	self = iter_ptr->ht_ptr;
+	while (iter_ptr->index < self->size) {
+		slot_ptr = &self->table[iter_ptr->index++];
+		if (slot_ptr->hash != ESIF_HT_EMPTY_HASH) {
+			if (key_ptr != NULL) {
+				*key_ptr = ESIF_HT_SLOT_KEY(slot_ptr);
+			}
+			if (key_length != NULL) {
+				*key_length = slot_ptr->key_length;
+			}
+			*item_ptr = slot_ptr->item_ptr;
+			rc = ESIF_OK;
+			break;
+		}
+	}
+exit:
+	return rc;
+}
+
 /* Create Hash Table */
 struct esif_ht * esif_ht_create(
 	u32 size
 	)
 {
-	u32 index = 0;
 	struct esif_ht *new_ht_ptr = NULL;
+	u32 slots = ESIF_HT_MIN_SIZE;
 
 	new_ht_ptr = (struct esif_ht *) esif_ccb_malloc(sizeof(struct esif_ht));
 
@@ -448,24 +443,16 @@ struct esif_ht * esif_ht_create(
 		goto exit;
 	}
 
-	new_ht_ptr->size = size;
-	new_ht_ptr->table = (struct esif_link_list **)
-		esif_ccb_malloc(sizeof(*new_ht_ptr->table) * size);
+	/* Size the table so the expected number of items does not force a resize */
+	while ((slots < ESIF_HT_MAX_SIZE) && ESIF_HT_IS_OVERLOADED(size, slots)) {
+		slots *= 2;
+	}
 
-	if (new_ht_ptr->table == NULL) {
+	if (esif_ht_resize(new_ht_ptr, slots) != ESIF_OK) {
 		esif_ccb_free(new_ht_ptr);
 		new_ht_ptr = NULL;
 		goto exit;
 	}
-
-	for (index = 0; index < size; ++index) {
-		new_ht_ptr->table[index] = esif_link_list_create();
-		if (new_ht_ptr->table[index] == NULL) {
-			esif_ht_destroy(new_ht_ptr, NULL);
-			new_ht_ptr = NULL;
-			goto exit;
-		}
-	}
 exit:
 	return new_ht_ptr;
 }
@@ -476,6 +463,7 @@ void esif_ht_destroy(
 	item_destroy_func item_destroy_fptr
 	)
 {
+	struct esif_ht_slot *slot_ptr = NULL;
 	u32 index = 0;
 
 	if ((self == NULL) || (self->table == NULL)) {
@@ -483,12 +471,16 @@ void esif_ht_destroy(
 	}
 
 	for (index = 0; index < self->size; ++index) {
-		if (self->table[index] == NULL)
+		slot_ptr = &self->table[index];
+		if (slot_ptr->hash == ESIF_HT_EMPTY_HASH)
 			continue;
 
-		esif_destroy_ht_nodes(self->table[index], item_destroy_fptr);
-		esif_link_list_destroy(self->table[index]);
-		self->table[index] = NULL;
+		if (item_destroy_fptr) {
+			item_destroy_fptr(slot_ptr->item_ptr);
+		}
+		if (slot_ptr->key_length > ESIF_HT_INLINE_KEY_LEN) {
+			esif_ccb_free(slot_ptr->key.ptr);
+		}
 	}
 
 	esif_ccb_free(self->table);
@@ -56,23 +56,63 @@
 #include "esif.h"
 #include "esif_link_list.h"
 
+/*
+ * Open Addressing Hash Table
+ *
+ * Items are stored in a single power-of-two array of slots using linear
+ * probing, so a lookup touches one contiguous run of memory instead of
+ * walking a heap allocated link list per bucket. The table doubles in size
+ * whenever it becomes 3/4 full, so the size passed to esif_ht_create is
+ * only a hint for the expected number of items.
+ *
+ * Keys up to ESIF_HT_INLINE_KEY_LEN bytes (such as Primitive Tuples) are
+ * stored in the slot itself; longer keys are copied to the heap. Removed
+ * items are deleted with backward shifting, so there are no tombstones.
+ *
+ * Duplicate keys are permitted for compatibility with the original chained
+ * implementation: esif_ht_get_item and esif_ht_remove_item always operate on
+ * the oldest item added with a given key.
+ *
+ * The table is not thread safe; callers must provide their own locking. Since
+ * an add may reallocate the slot array, a get must not run concurrently with
+ * an add, so a table shared by threads needs at least a read/write lock.
+ * Adding an item to a table of ESIF_HT_MAX_SIZE slots that is 3/4 full fails
+ * with ESIF_E_MAXIMUM_CAPACITY_REACHED.
+ */
+#define ESIF_HT_INLINE_KEY_LEN	24	/* Max Key Length stored in a Slot */
+#define ESIF_HT_MIN_SIZE	8	/* Min Number of Slots */
+#define ESIF_HT_MAX_SIZE	0x40000000	/* Max Number of Slots */
+#define ESIF_HT_ITERATOR_MARKER	'HTIT'
+
 typedef void (*item_destroy_func) (void *item_ptr);
 
+struct esif_ht_slot {
+	u32 hash;	/* Key Hash or 0 if Slot is Empty */
+	u32 key_length;
+	union {
+		u8 data[ESIF_HT_INLINE_KEY_LEN];	/* key_length <= ESIF_HT_INLINE_KEY_LEN */
+		u8 *ptr;	/* key_length > ESIF_HT_INLINE_KEY_LEN */
+	} key;
+	void *item_ptr; /* points to the actual item */
+};
+
 struct esif_ht {
-	u32 size;
-	struct esif_link_list **table;
+	u32 size;	/* Number of Slots (Power of 2) */
+	u32 count;	/* Number of Items */
+	struct esif_ht_slot *table;
 };
 
-struct esif_ht_node {
-	u8 *key_ptr;
-	u32 key_length;
-	void *item_ptr; /* points to the actual item */
+struct esif_ht_iterator {
+	u32 marker;
+	struct esif_ht *ht_ptr;
+	u32 index;	/* Next Slot to visit */
 };
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/* size is the expected number of items; the table grows as needed */
 struct esif_ht *esif_ht_create(
 	u32 size
 	);
@@ -101,6 +141,31 @@ void *esif_ht_get_item(
 	u32 key_length
 	);
 
+/* Returns the number of items in the Hash Table */
+u32 esif_ht_get_count(
+	struct esif_ht *self
+	);
+
+/*
+ * Used to iterate through all items in the Hash Table in no particular order.
+ * First call esif_ht_init_iterator to initialize the iterator, then call
+ * esif_ht_get_next_item until ESIF_E_ITERATION_DONE is returned. The returned
+ * key_ptr points into the table and is only valid until the table is modified.
+ * Adding or removing items during iteration invalidates the iterator.
+ */
+enum esif_rc esif_ht_init_iterator(
+	struct esif_ht *self,
+	struct esif_ht_iterator *iter_ptr
+	);
+
+/* See esif_ht_init_iterator for usage; key_ptr and key_length are optional */
+enum esif_rc esif_ht_get_next_item(
+	struct esif_ht_iterator *iter_ptr,
+	u8 **key_ptr,
+	u32 *key_length,
+	void **item_ptr
+	);
+
 
 /* Init */
 enum esif_rc esif_ht_init(void);
@@ -62,7 +62,13 @@ enum esif_mempool_type {
 	ESIF_MEMPOOL_TYPE_HASH,		/* Hash Table             */
 	ESIF_MEMPOOL_TYPE_HASH2,	/* Hash Table2 TODO: This is temp   */
 	ESIF_MEMPOOL_TYPE_PM,		/* Participant Manager    */
-	ESIF_MEMPOOL_TYPE_MAX		/* Max                    */
+	ESIF_MEMPOOL_TYPE_MAX,		/* Max (Driver Memory Stats) */
+
+	/* Upper Framework Object Pools (not reported by the driver) */
+	ESIF_MEMPOOL_TYPE_LIST_NODE = ESIF_MEMPOOL_TYPE_MAX,	/* Link List Node */
+	ESIF_MEMPOOL_TYPE_ESIFDATA,	/* EsifData Object        */
+	ESIF_MEMPOOL_TYPE_EVENT,	/* Event Queue Item       */
+	ESIF_MEMPOOL_TYPE_UF_MAX	/* Max                    */
 };
 
 /*
@@ -87,7 +93,7 @@ enum esif_mempool_type {
 
 /* ESIF Framework */
 #define ESIF_MEMPOOL_FW_PM            ('fisE')	/* Bit 1000 Participant */
-#define ESIF_MEMPOOL_FW_AVAIL         ('FisE')	/* Bit 1001 Available for use */
+#define ESIF_MEMPOOL_FW_DATA          ('FisE')	/* Bit 1001 EsifData */
 #define ESIF_MEMPOOL_FW_DSP           ('fIsE')	/* Bit 1010 Dsp */
 #define ESIF_MEMPOOL_FW_HASH          ('FIsE')	/* Bit 1011 Hash */
 #define ESIF_MEMPOOL_FW_QUEUE         ('fiSE')	/* Bit 1100 Queue */
@@ -106,7 +112,7 @@ static ESIF_INLINE char *esif_mempool_str(u32 pool_tag)
 	ESIF_CASE(ESIF_MEMPOOL_DRIVER_RESERVED1, "@esif_rsv1_driver");
 	ESIF_CASE(ESIF_MEMPOOL_FW_HASH, "@esif_hash_table_cache");
 	ESIF_CASE(ESIF_MEMPOOL_FW_PM, "@esif_pm_cache");
-	ESIF_CASE(ESIF_MEMPOOL_FW_AVAIL, "@esif_available");
+	ESIF_CASE(ESIF_MEMPOOL_FW_DATA, "@esif_data_cache");
 	ESIF_CASE(ESIF_MEMPOOL_FW_DSP, "@esif_dsp_cache");
 	ESIF_CASE(ESIF_MEMPOOL_FW_QUEUE, "@esif_queue_cache");
 	ESIF_CASE(ESIF_MEMPOOL_FW_LIST, "@esif_list_cache");
@@ -121,7 +127,7 @@ static ESIF_INLINE char *esif_mempool_str(u32 pool_tag)
 extern "C" {
 #endif
 
-extern struct esif_ccb_mempool *g_mempool[ESIF_MEMPOOL_TYPE_MAX];
+extern struct esif_ccb_mempool *g_mempool[ESIF_MEMPOOL_TYPE_UF_MAX];
 
 #ifdef __cplusplus
 }
@@ -90,6 +90,7 @@ static void DataBank_Destroy(DataBankPtr self)
 	UInt32 index;
 	if (self) {
 		for (index = 0; self->elements != NULL && index < self->size; index++) {
+			DataVault_FinishCompaction(self->elements[index]);
 			DataVault_PutRef(self->elements[index]);
 			self->elements[index] = NULL;
 		}
@@ -19,8 +19,15 @@
 
 #define _DATACACHE_CLASS
 #include "esif_lib_datacache.h"
+#include "esif_ccb_sort.h"
 
 
+#define DATACACHE_MIN_CAPACITY		16			// Minimum Allocated DataCacheEntry's
+#define DATACACHE_ARENA_BLOCK_SIZE	(16 * 1024)	// Minimum Key Arena Block Size
+#define DATACACHE_MAX_KEYLEN		0x7ffffffe	// Same as ESIFDV_MAX_KEYLEN
+
+static atomic_t g_DataCacheGeneration = ATOMIC_INIT(0);
+
 ///////////////////////////////////////////////////////
 // DataCache Class
 
@@ -29,11 +36,21 @@ static DataCacheEntryPtr DataCache_GetList(DataCachePtr self);
 static int DataCache_Search(DataCachePtr self, esif_string key);
 static int DataCache_FindInsertionPoint(DataCachePtr self, esif_string key);
 static EsifDataPtr CloneCacheData(EsifDataPtr dataPtr);
+static eEsifError DataCache_Reserve(DataCachePtr self, UInt32 count);
+static void DataCache_Shrink(DataCachePtr self);
+static esif_string DataCache_AllocKey(DataCachePtr self, esif_string key, UInt32 *lenPtr);
+static void DataCache_FreeKey(DataCachePtr self, DataCacheEntryPtr entry);
+static void DataCache_DestroyArena(DataCacheArenaPtr arena);
+static void DataCache_Modified(DataCachePtr self);
 
 // constructor
 DataCachePtr DataCache_Create ()
 {
 	DataCachePtr self = (DataCachePtr)esif_ccb_malloc(sizeof(*self));
+	if (self) {
+		self->isSorted = ESIF_TRUE;
+		DataCache_Modified(self);
+	}
 	return self;
 }
 
@@ -51,6 +68,7 @@ void DataCache_Destroy (DataCachePtr self)
 		EsifData_dtor(&self->elements[i].value);
 	}
 	esif_ccb_free(self->elements);
+	DataCache_DestroyArena(self->arena);
 	WIPEPTR(self);
 	esif_ccb_free(self);
 }
@@ -81,7 +99,7 @@ DataCacheEntryPtr DataCache_GetValue (
 // member indicates the buf_ptr represents a file offset; not whether the EsifData
 // items owns the associated buffer.
 // Notes: The pair is inserted even if a key with the same name already exists.
-// The cache array will be re-allocated to fit the new member and old members
+// The cache array grows geometrically to fit the new member and old members
 // will be copied down if needed to allow insertion
 //
 eEsifError DataCache_InsertValue(
@@ -92,15 +110,17 @@ eEsifError DataCache_InsertValue(
 	)
 {
 	eEsifError rc = ESIF_OK;
-	DataCacheEntryPtr old_elements = NULL;
 	EsifData keydata;
 	EsifDataPtr valueClonePtr = NULL;
+	esif_string keyPtr = NULL;
+	UInt32 keyLen = 0;
 	int node = 0;
 
-	if ((NULL == self) || (NULL == valuePtr)) {
+	if ((NULL == self) || (NULL == key) || (NULL == valuePtr)) {
 		rc = ESIF_E_PARAMETER_IS_NULL;
 		goto exit;
 	}
+	ESIF_ASSERT(self->isSorted);
 
 	valueClonePtr = CloneCacheData(valuePtr);
 	if (NULL == valueClonePtr) {
@@ -108,32 +128,41 @@ eEsifError DataCache_InsertValue(
 		goto exit;
 	}
 
-	node = DataCache_FindInsertionPoint(self, key);
+	// Grow the elements to fit the new pair
+	rc = DataCache_Reserve(self, self->size + 1);
+	if (rc != ESIF_OK) {
+		goto exit;
+	}
 
-	// Reallocate the elements to fit the new pair
-	old_elements = self->elements;
-	self->elements = (DataCacheEntryPtr)esif_ccb_realloc(self->elements, (self->size + 1) * sizeof(*self->elements));
-	if (NULL == self->elements) {
-		self->elements = old_elements;
+	keyPtr = DataCache_AllocKey(self, key, &keyLen);
+	if (NULL == keyPtr) {
 		rc = ESIF_E_NO_MEMORY;
 		goto exit;
 	}
-	
+
+	node = DataCache_FindInsertionPoint(self, key);
+
 	// Move old pairs down to fit the new pair
 	if (node < (int)self->size) {
 		esif_ccb_memmove(&self->elements[node + 1], &self->elements[node], (self->size - node) * sizeof(*self->elements));
 	}
 
-	// Insert the new pair
+	// Insert the new pair; Arena keys are not owned by the EsifData
 	EsifData_ctor(&keydata);
-	EsifData_Set(&keydata, ESIF_DATA_STRING, esif_ccb_strdup(key), ESIFAUTOLEN, ESIFAUTOLEN);
+	EsifData_Set(&keydata, ESIF_DATA_STRING, keyPtr, 0, keyLen);
 	self->elements[node].key   = keydata;
 	self->elements[node].value = *valueClonePtr;
 	self->elements[node].flags = flags;
 	self->size++;
+	DataCache_Modified(self);
 exit:
 	if (rc == ESIF_OK) {
-		esif_ccb_free(valueClonePtr); // Free pointer but don't destroy as the element owns buffer now
+		// Release the object but not its buffer, which the element owns now
+#ifdef ESIF_FEAT_OPT_MEMPOOL
+		esif_ccb_mempool_free(ESIF_MEMPOOL_TYPE_ESIFDATA, valueClonePtr);
+#else
+		esif_ccb_free(valueClonePtr);
+#endif
 	} else {
 		EsifData_Destroy(valueClonePtr);
 	}
@@ -153,34 +182,158 @@ eEsifError DataCache_DeleteValue(
 		rc = ESIF_E_PARAMETER_IS_NULL;
 		goto exit;
 	}
+	ESIF_ASSERT(self->isSorted);
 
 	node = DataCache_Search(self, key);
 	if (node == EOF) {
 		rc = ESIF_E_NOT_FOUND;
 		goto exit;
 	}
-	EsifData_dtor(&self->elements[node].key);
+	DataCache_FreeKey(self, &self->elements[node]);
 	EsifData_dtor(&self->elements[node].value);
 
 	if (node < self->size - 1) {
 		esif_ccb_memmove(&self->elements[node], &self->elements[node + 1], (self->size - node - 1) * sizeof(*self->elements));
-		esif_ccb_memset(&self->elements[self->size - 1], 0, sizeof(self->elements[0]));
 	}
+	esif_ccb_memset(&self->elements[self->size - 1], 0, sizeof(self->elements[0]));
+	self->size--;
+	DataCache_Modified(self);
 
-	if (self->size > 1) {
-		DataCacheEntryPtr old_elements = self->elements;
-		self->elements = (DataCacheEntryPtr)esif_ccb_realloc(self->elements, (self->size - 1) * sizeof(*self->elements));
-		if (NULL == self->elements) {
-			self->elements = old_elements;
-			rc = ESIF_E_NO_MEMORY;
-			goto exit;
+	DataCache_Shrink(self);
+exit:
+	return rc;
+}
+
+
+//
+// Appends a key value pair to the end of the cache for Bulk Loading, taking ownership
+// of any allocated value buffer. The cache is unsorted until DataCache_Sort is called.
+//
+eEsifError DataCache_AppendValue(
+	DataCachePtr self,
+	esif_string key,
+	EsifDataPtr valuePtr,
+	esif_flags_t flags
+	)
+{
+	eEsifError rc = ESIF_OK;
+	esif_string keyPtr = NULL;
+	UInt32 keyLen = 0;
+	DataCacheEntryPtr entry = NULL;
+
+	if ((NULL == self) || (NULL == key) || (NULL == valuePtr)) {
+		rc = ESIF_E_PARAMETER_IS_NULL;
+		goto exit;
+	}
+
+	rc = DataCache_Reserve(self, self->size + 1);
+	if (rc != ESIF_OK) {
+		goto exit;
+	}
+
+	keyPtr = DataCache_AllocKey(self, key, &keyLen);
+	if (NULL == keyPtr) {
+		rc = ESIF_E_NO_MEMORY;
+		goto exit;
+	}
+
+	entry = &self->elements[self->size];
+	EsifData_ctor(&entry->key);
+	EsifData_Set(&entry->key, ESIF_DATA_STRING, keyPtr, 0, keyLen);
+	entry->value = *valuePtr;
+	entry->flags = flags;
+	self->size++;
+	self->isSorted = ESIF_FALSE;
+	DataCache_Modified(self);
+
+	// Value buffer now owned by the cache
+	esif_ccb_memset(valuePtr, 0, sizeof(*valuePtr));
+exit:
+	return rc;
+}
+
+
+// Sort Callback for DataCache_Sort: Order by Key, then by Append order so duplicates are stable
+static int ESIF_CALLCONV DataCache_SortCompare(
+	const void *arg1,
+	const void *arg2,
+	void *context
+	)
+{
+	DataCachePtr self = (DataCachePtr)context;
+	UInt32 index1 = *(const UInt32 *)arg1;
+	UInt32 index2 = *(const UInt32 *)arg2;
+	int comp = esif_ccb_stricmp((esif_string)self->elements[index1].key.buf_ptr, (esif_string)self->elements[index2].key.buf_ptr);
+
+	if (comp == 0) {
+		comp = (index1 < index2 ? -1 : (index1 > index2 ? 1 : 0));
+	}
+	return comp;
+}
+
+
+//
+// Sorts a Bulk Loaded cache and removes duplicate keys in a single O(n log n) pass,
+// rather than the O(n^2) cost of inserting each key into its sorted position.
+//
+eEsifError DataCache_Sort(
+	DataCachePtr self,
+	Bool keepFirst
+	)
+{
+	eEsifError rc = ESIF_OK;
+	UInt32 *order = NULL;
+	DataCacheEntryPtr sorted = NULL;
+	UInt32 count = 0;
+	UInt32 idx = 0;
+
+	if (NULL == self) {
+		rc = ESIF_E_PARAMETER_IS_NULL;
+		goto exit;
+	}
+	if (self->isSorted) {
+		goto exit;
+	}
+
+	order = (UInt32 *)esif_ccb_malloc(self->size * sizeof(*order));
+	sorted = (DataCacheEntryPtr)esif_ccb_malloc(self->capacity * sizeof(*sorted));
+	if (NULL == order || NULL == sorted) {
+		rc = ESIF_E_NO_MEMORY;
+		goto exit;
+	}
+
+	for (idx = 0; idx < self->size; idx++) {
+		order[idx] = idx;
+	}
+	esif_ccb_qsort(order, self->size, sizeof(*order), DataCache_SortCompare, self);
+
+	for (idx = 0; idx < self->size; idx++) {
+		DataCacheEntryPtr entry = &self->elements[order[idx]];
+
+		if (count > 0 && esif_ccb_stricmp((esif_string)sorted[count - 1].key.buf_ptr, (esif_string)entry->key.buf_ptr) == 0) {
+			if (keepFirst) {
+				DataCache_FreeKey(self, entry);
+				EsifData_dtor(&entry->value);
+				continue;
+			}
+			DataCache_FreeKey(self, &sorted[count - 1]);
+			EsifData_dtor(&sorted[count - 1].value);
+			count--;
 		}
-	} else {
-		esif_ccb_free(self->elements);
-		self->elements = NULL;
+		sorted[count++] = *entry;
 	}
-	self->size--;
+
+	esif_ccb_free(self->elements);
+	self->elements = sorted;
+	self->size = count;
+	self->isSorted = ESIF_TRUE;
+	sorted = NULL;
+	DataCache_Modified(self);
+
+	DataCache_Shrink(self);
 exit:
+	esif_ccb_free(order);
+	esif_ccb_free(sorted);
 	return rc;
 }
 
@@ -191,6 +344,42 @@ UInt32 DataCache_GetCount (DataCachePtr self)
 }
 
 
+UInt32 DataCache_GetGeneration(DataCachePtr self)
+{
+	return (self ? self->generation : 0);
+}
+
+
+UInt32 DataCache_GetLowerBound(
+	DataCachePtr self,
+	esif_string key,
+	Bool afterKey
+	)
+{
+	UInt32 start = 0;
+	UInt32 end = 0;
+
+	if (NULL == self || NULL == key) {
+		return 0;
+	}
+	ESIF_ASSERT(self->isSorted);
+
+	// Binary search for the first key that sorts after (or at) the given key
+	end = self->size;
+	while (start < end) {
+		UInt32 node = start + (end - start) / 2;
+		int comp = esif_ccb_stricmp((esif_string)self->elements[node].key.buf_ptr, key);
+		if (comp < 0 || (comp == 0 && afterKey)) {
+			start = node + 1;
+		}
+		else {
+			end = node;
+		}
+	}
+	return start;
+}
+
+
 // Private Members
 DataCacheEntryPtr DataCache_GetList (DataCachePtr self)
 {
@@ -329,6 +518,153 @@ eEsifError DataCache_RestoreOffsets(
 	return rc;
 }
 
+// Grow the elements array geometrically so repeated Inserts are amortized O(1) allocations
+static eEsifError DataCache_Reserve(
+	DataCachePtr self,
+	UInt32 count
+	)
+{
+	eEsifError rc = ESIF_OK;
+	DataCacheEntryPtr new_elements = NULL;
+	UInt32 new_capacity = 0;
+
+	ESIF_ASSERT(self != NULL);
+
+	if (count <= self->capacity) {
+		goto exit;
+	}
+
+	new_capacity = esif_ccb_max(self->capacity, DATACACHE_MIN_CAPACITY);
+	while (new_capacity < count) {
+		new_capacity *= 2;
+	}
+
+	new_elements = (DataCacheEntryPtr)esif_ccb_realloc(self->elements, new_capacity * sizeof(*self->elements));
+	if (NULL == new_elements) {
+		rc = ESIF_E_NO_MEMORY;
+		goto exit;
+	}
+	esif_ccb_memset(&new_elements[self->capacity], 0, (new_capacity - self->capacity) * sizeof(*new_elements));
+	self->elements = new_elements;
+	self->capacity = new_capacity;
+exit:
+	return rc;
+}
+
+
+// Release the elements array and Key Arena when empty, or halve it when mostly unused
+static void DataCache_Shrink(DataCachePtr self)
+{
+	ESIF_ASSERT(self != NULL);
+
+	if (self->size == 0) {
+		esif_ccb_free(self->elements);
+		self->elements = NULL;
+		self->capacity = 0;
+		DataCache_DestroyArena(self->arena);
+		self->arena = NULL;
+		self->arenaLive = 0;
+	}
+	else if (self->capacity > DATACACHE_MIN_CAPACITY && self->size < self->capacity / 4) {
+		UInt32 new_capacity = self->capacity / 2;
+		DataCacheEntryPtr new_elements = (DataCacheEntryPtr)esif_ccb_realloc(self->elements, new_capacity * sizeof(*self->elements));
+		if (new_elements) {
+			self->elements = new_elements;
+			self->capacity = new_capacity;
+		}
+	}
+}
+
+
+// Copy a Key String into the Key Arena, adding a new Arena Block if necessary
+static esif_string DataCache_AllocKey(
+	DataCachePtr self,
+	esif_string key,
+	UInt32 *lenPtr
+	)
+{
+	esif_string keyPtr = NULL;
+	DataCacheArenaPtr block = self->arena;
+	size_t len = esif_ccb_strlen(key, DATACACHE_MAX_KEYLEN) + 1;
+
+	if (NULL == block || block->size - block->used < len) {
+		size_t block_size = esif_ccb_max(DATACACHE_ARENA_BLOCK_SIZE, len);
+		block = (DataCacheArenaPtr)esif_ccb_malloc(sizeof(*block) + block_size);
+		if (NULL == block) {
+			goto exit;
+		}
+		block->data = (char *)(block + 1);
+		block->size = block_size;
+		block->used = 0;
+		block->live = 0;
+		block->next = self->arena;
+		self->arena = block;
+	}
+
+	keyPtr = block->data + block->used;
+	esif_ccb_memcpy(keyPtr, key, len - 1);
+	keyPtr[len - 1] = 0;
+	block->used += len;
+	block->live += len;
+	self->arenaLive += len;
+	*lenPtr = (UInt32)len;
+exit:
+	return keyPtr;
+}
+
+
+// Release an Entry's Key. An Arena Block is freed once all of its Keys are deleted, or
+// reused if it is the current Block, so Keys that are still in the cache never move.
+static void DataCache_FreeKey(
+	DataCachePtr self,
+	DataCacheEntryPtr entry
+	)
+{
+	DataCacheArenaPtr *linkPtr = &self->arena;
+	DataCacheArenaPtr block = NULL;
+	char *keyPtr = (char *)entry->key.buf_ptr;
+
+	if (entry->key.buf_len == 0 && keyPtr != NULL) {
+		for (block = self->arena; block != NULL; linkPtr = &block->next, block = block->next) {
+			if (keyPtr >= block->data && keyPtr < block->data + block->used) {
+				break;
+			}
+		}
+		if (block != NULL) {
+			block->live -= esif_ccb_min(block->live, entry->key.data_len);
+			self->arenaLive -= esif_ccb_min(self->arenaLive, entry->key.data_len);
+			if (block->live == 0) {
+				if (block == self->arena) {
+					block->used = 0;
+				}
+				else {
+					*linkPtr = block->next;
+					esif_ccb_free(block);
+				}
+			}
+		}
+	}
+	EsifData_dtor(&entry->key);
+}
+
+
+// Assign a new Generation whenever Keys are added or removed so Iterators can detect changes
+static void DataCache_Modified(DataCachePtr self)
+{
+	self->generation = (UInt32)atomic_inc(&g_DataCacheGeneration);
+}
+
+
+static void DataCache_DestroyArena(DataCacheArenaPtr arena)
+{
+	while (arena) {
+		DataCacheArenaPtr next = arena->next;
+		esif_ccb_free(arena);
+		arena = next;
+	}
+}
+
+
 EsifDataPtr CloneCacheData(
 	EsifDataPtr dataPtr
 	)
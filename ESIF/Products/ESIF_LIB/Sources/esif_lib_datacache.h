@@ -46,9 +46,30 @@ struct DataCache_s;
 typedef struct DataCache_s DataCache, *DataCachePtr, **DataCachePtrLocation;
 
 #ifdef _DATACACHE_CLASS
+
+// Key Strings are packed into a chain of Arena Blocks rather than allocated individually.
+// Arena Keys are stored as EsifData with buf_len=0 so they are never freed by EsifData_dtor.
+// Keys never move once allocated, so Key pointers remain valid until the Key is deleted;
+// a Block is only freed once every Key in it has been deleted.
+struct DataCacheArena_s;
+typedef struct DataCacheArena_s DataCacheArena, *DataCacheArenaPtr;
+
+struct DataCacheArena_s {
+	DataCacheArenaPtr	next;		// Next (Older) Arena Block
+	size_t				size;		// Usable Bytes in this Block
+	size_t				used;		// Bytes Allocated from this Block
+	size_t				live;		// Bytes used by current Keys in this Block
+	char				*data;		// Block Data (follows header)
+};
+
 struct DataCache_s {
 	UInt32				size; // Number of DataCacheEntry's
+	UInt32				capacity; // Number of DataCacheEntry's allocated
 	DataCacheEntryPtr	elements; // Array of entry pointers
+	DataCacheArenaPtr	arena; // Key String Arena (most recent block first)
+	size_t				arenaLive; // Arena Bytes used by current Keys
+	Bool				isSorted; // FALSE while Bulk Loading with DataCache_AppendValue
+	UInt32				generation; // Changed whenever Keys are added or removed; unique across all caches
 };
 
 #endif	// _DATACACHE_CLASS
@@ -73,7 +94,20 @@ DataCacheEntryPtr DataCache_GetValue(DataCachePtr self, esif_string key);
 //
 eEsifError DataCache_InsertValue(DataCachePtr self, esif_string key, EsifDataPtr valuePtr, esif_flags_t flags);
 eEsifError DataCache_DeleteValue(DataCachePtr self, esif_string key);
+
+//
+// Bulk Loading: Appends a key value pair to the end of the cache without sorting.
+// Ownership of any allocated valuePtr buffer is transferred to the cache.
+// DataCache_Sort must be called after the last Append and before any other access.
+// keepFirst=ESIF_TRUE keeps the first of any duplicate keys, otherwise the last.
+//
+eEsifError DataCache_AppendValue(DataCachePtr self, esif_string key, EsifDataPtr valuePtr, esif_flags_t flags);
+eEsifError DataCache_Sort(DataCachePtr self, Bool keepFirst);
 UInt32 DataCache_GetCount(DataCachePtr self);
+UInt32 DataCache_GetGeneration(DataCachePtr self);
+
+// Return index of the first key >= key, or > key if afterKey is set, or the count if none
+UInt32 DataCache_GetLowerBound(DataCachePtr self, esif_string key, Bool afterKey);
 
 DataCachePtr DataCache_CloneOffsets(DataCachePtr self);
 eEsifError DataCache_RestoreOffsets(DataCachePtr self, DataCachePtr backup);
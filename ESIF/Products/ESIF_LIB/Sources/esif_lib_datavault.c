@@ -45,6 +45,8 @@
 #define ESIFDV_HEADER_SIGNATURE			0x1FE5	// [E5 1F] = DataVault Header Signature
 #define ESIFDV_ITEM_KEYS_REV0_SIGNATURE	0xA0D8	// [D8 A0] = DV 2.0 Key-Value Pair Item Signature (Revision 0)
 #define ESIFDV_ITEM_KEYS_REV1_SIGNATURE	0xA1D8	// [D8 A1] = Reserved for Future Expansion (Revision 1)
+#define ESIFDV_JOURNAL_SIGNATURE		0x4AE5	// [E5 4A] = DataVault Journal Header Signature
+#define ESIFDV_JOURNAL_RECORD_SIGNATURE	0xA0D9	// [D9 A0] = DataVault Journal Record Signature
 
 // Default Version Number for new DV files
 #define ESIFDV_MAJOR_VERSION        2			// 1-99:    DV Header Major Version [2.1 can read 2.0-2.1 but not 3.0]
@@ -63,6 +65,12 @@
 #define ESIFDV_MAX_DATALEN			0x7ffffffe
 #define ESIFDV_IO_BUFFER_SIZE		(4 * 1024)
 
+// Journal Compaction Thresholds: Compact when the Journal exceeds MAX_SIZE, or exceeds MIN_SIZE and RATIO times the Primary Repo Payload
+#define ESIFDV_JOURNAL_MIN_SIZE			(16 * 1024)
+#define ESIFDV_JOURNAL_MAX_SIZE			(256 * 1024)
+#define ESIFDV_JOURNAL_COMPACT_RATIO	2
+#define ESIFDV_JOURNAL_COMPACT_DELAY	1000		// Background Compaction Delay (msec)
+
 // Define valid bit flags for each DV version so we can validate header and item flags
 // v1  = Unknown bit flags will fail with ESIF_E_NOT_SUPPORTED (since Item Signature is unavailable)
 // v2+ = Unknown bit flags are allowed if major version matches so they can be used by future minor versions or revisions
@@ -103,6 +111,26 @@ typedef struct DataVaultHeaderV2_s {
 	UInt32	payload_class;					// Payload Class (default=KEYS)
 } DataVaultHeaderV2, *DataVaultHeaderV2Ptr;
 
+// DV Journal Header [name.dv.jnl]
+typedef struct DataVaultJournalHeader_s {
+	UInt16	signature;						// Journal Signature [E5 4A]
+	UInt16	headersize;						// Header Size, including signature & headersize
+	UInt32	version;						// Primary Repo File Format Version
+	UInt8	base_hash[SHA256_HASH_BYTES];	// Payload Hash of the Primary Repo this Journal applies to
+} DataVaultJournalHeader, *DataVaultJournalHeaderPtr;
+
+// DV Journal Record Operations
+#define ESIFDV_JOURNAL_OP_SET		1		// Set (Replace) Key/Value Pair
+#define ESIFDV_JOURNAL_OP_DELETE	2		// Delete Key
+
+// DV Journal Record Header, followed by a single DV 2.0 Key/Value Pair Item
+typedef struct DataVaultJournalRecord_s {
+	UInt16	signature;						// Record Signature [D9 A0]
+	UInt16	operation;						// Record Operation (ESIFDV_JOURNAL_OP_*)
+	UInt32	payload_size;					// Key/Value Pair Item Size
+	UInt8	payload_hash[SHA256_HASH_BYTES];// SHA-256 Hash of Key/Value Pair Item
+} DataVaultJournalRecord, *DataVaultJournalRecordPtr;
+
 // DV File Header Union (all versions)
 // DataVaultHeader typedef in esif_lib_datarepo.h for clang compliance
 union DataVaultHeader_u {
@@ -171,6 +199,22 @@ static Bool DataVault_IsPrimary(
 	DataVaultHeaderPtr header
 	);
 
+static void DataVault_JournalReset(
+	DataVaultPtr self,
+	UInt8 *base_hash,
+	size_t base_size
+	);
+
+static esif_error_t DataVault_JournalWrite(
+	DataVaultPtr self,
+	esif_string key
+	);
+
+static esif_error_t DataVault_ReplayJournal(
+	DataVaultPtr self,
+	DataVaultHeaderPtr header
+	);
+
 // Friend Class Static Members
 
 static esif_error_t DataRepo_ReadHeader(
@@ -218,8 +262,18 @@ static void DataVault_ctor(DataVaultPtr self)
 static void DataVault_dtor(DataVaultPtr self)
 {
 	if (self) {
+		UInt32 j = 0;
 		DataCache_Destroy(self->cache);
 		IOStream_Destroy(self->stream);
+		for (j = 0; j < self->numMappings; j++) {
+			IOStreamMapping_PutRef(self->mappings[j]);
+		}
+		esif_ccb_free(self->mappings);
+
+		// A pending Compaction holds a Reference, so the Timer is idle unless this is its final Callback
+		if (self->compactTimerInit) {
+			esif_ccb_timer_kill(&self->compactTimer);
+		}
 		esif_ccb_lock_uninit(&self->lock);
 		WIPEPTR(self);
 	}
@@ -317,6 +371,7 @@ static esif_error_t DataVault_RepoFlush(
 	BytePtr buffer = NULL;
 	Bool payload_compressed = ESIF_FALSE;
 	Bool flush_changes = ESIF_TRUE;
+	Bool flushed = ESIF_FALSE;
 
 	// Cannot flush Static or ReadOnly Repos
 	if (FLAGS_TEST(self->flags, ESIF_SERVICE_CONFIG_STATIC|ESIF_SERVICE_CONFIG_READONLY) ||
@@ -527,6 +582,7 @@ exit:
 	esif_ccb_free(buffer);
 
 	// Replace existing File if successful
+	flushed = (rc == ESIF_OK && !flush_changes);
 	if (rc == ESIF_OK && flush_changes) {
 		char rollbackName[MAX_PATH] = { 0 };
 		esif_ccb_sprintf(sizeof(rollbackName), rollbackName, "%s%s", self->stream->file.name, ESIFDV_ROLLBACKEXT);
@@ -539,9 +595,17 @@ exit:
 			}
 			if (rc == ESIF_OK) {
 				IGNORE_RESULT(esif_ccb_rename(rollbackName, self->stream->file.name));
+				flushed = ESIF_TRUE;
 			}
 		}
 	}
+
+	// The Primary Repo now contains every Persisted Key, so discard the Journal and bind the next one to the new Payload
+	if (flushed && payload == NULL) {
+		Bool isJournaled = (ESIFHDR_GET_MAJOR(header.common.version) == ESIFDV_V2 && self->dataclass == ESIFDV_PAYLOAD_CLASS_KEYS);
+		DataVault_JournalReset(self, (isJournaled ? header.v2.payload_hash : NULL), header.v2.payload_size);
+		self->delayedWrites = ESIF_FALSE;
+	}
 	if (esif_ccb_file_exists(tempName)) {
 		IGNORE_RESULT(esif_ccb_unlink(tempName));
 	}
@@ -696,6 +760,367 @@ exit:
 	return rc;
 }
 
+// Build the Journal File Name for the Primary Repo [name.dv.jnl]
+static Bool DataVault_GetJournalName(
+	DataVaultPtr self,
+	esif_string journalName,
+	size_t journalName_len
+	)
+{
+	if (self->stream == NULL || self->stream->type != StreamFile || self->stream->file.name == NULL) {
+		return ESIF_FALSE;
+	}
+	esif_ccb_sprintf(journalName_len, journalName, "%s%s", self->stream->file.name, ESIFDV_JOURNALEXT);
+	return ESIF_TRUE;
+}
+
+// Discard the Journal and bind the next one to the given Primary Repo Payload Hash, or disable Journaling if none
+static void DataVault_JournalReset(
+	DataVaultPtr self,
+	UInt8 *base_hash,
+	size_t base_size
+	)
+{
+	char journalName[MAX_PATH] = { 0 };
+
+	if (DataVault_GetJournalName(self, journalName, sizeof(journalName)) && esif_ccb_file_exists(journalName)) {
+		IGNORE_RESULT(esif_ccb_unlink(journalName));
+	}
+	self->journalSize = 0;
+	self->journalRecords = 0;
+	self->journalBaseValid = (base_hash != NULL);
+	self->journalBaseSize = (base_hash != NULL ? base_size : 0);
+	if (base_hash != NULL) {
+		esif_ccb_memcpy(self->journalBase, base_hash, sizeof(self->journalBase));
+	}
+}
+
+// Compact the Journal into the Primary Repo by rewriting it. Caller must hold the DataVault lock.
+static void DataVault_Compact(DataVaultPtr self)
+{
+	// Make a clone of NOCACHE offsets so they can be restored in the event of failure
+	DataCachePtr nocacheClone = DataCache_CloneOffsets(self->cache);
+	if (nocacheClone) {
+		if (DataVault_RepoFlush(self, NULL, ESIF_FALSE) != ESIF_OK) {
+			DataCache_RestoreOffsets(self->cache, nocacheClone);
+		}
+		DataCache_Destroy(nocacheClone);
+	}
+}
+
+// Background Compaction Timer Callback. The Timer holds a DataVault Reference until it fires.
+static void DataVault_CompactCallback(void *context)
+{
+	DataVaultPtr self = (DataVaultPtr)context;
+
+	if (self) {
+		esif_ccb_write_lock(&self->lock);
+		if (self->compactPending) {
+			self->compactPending = ESIF_FALSE;
+			DataVault_Compact(self);
+		}
+		esif_ccb_write_unlock(&self->lock);
+		DataVault_PutRef(self);
+	}
+}
+
+// Schedule a Background Compaction of the Journal, or Compact it now if no Timer is available
+static void DataVault_ScheduleCompaction(DataVaultPtr self)
+{
+	if (self->compactPending) {
+		return;
+	}
+	if (!self->compactTimerInit && esif_ccb_timer_init(&self->compactTimer, (esif_ccb_timer_cb)DataVault_CompactCallback, self) == ESIF_OK) {
+		self->compactTimerInit = ESIF_TRUE;
+	}
+
+	// The Timer Callback blocks on the DataVault lock held by the caller, so it cannot release this Reference first
+	if (self->compactTimerInit && esif_ccb_timer_set_msec(&self->compactTimer, ESIFDV_JOURNAL_COMPACT_DELAY) == ESIF_OK) {
+		DataVault_GetRef(self);
+		self->compactPending = ESIF_TRUE;
+	}
+	else {
+		DataVault_Compact(self);
+	}
+}
+
+// Cancel the Background Compaction Timer, completing any pending Compaction now (i.e., before closing the DataVault)
+void DataVault_FinishCompaction(DataVaultPtr self)
+{
+	if (self && self->compactTimerInit) {
+		Bool wasPending = ESIF_FALSE;
+
+		// Wait for any active Callback to complete before killing the Timer
+		esif_ccb_timer_kill_w_wait(&self->compactTimer);
+
+		esif_ccb_write_lock(&self->lock);
+		self->compactTimerInit = ESIF_FALSE;
+		if (self->compactPending) {
+			self->compactPending = ESIF_FALSE;
+			wasPending = ESIF_TRUE;
+			DataVault_Compact(self);
+		}
+		esif_ccb_write_unlock(&self->lock);
+
+		// Release the Reference held by the cancelled Timer
+		if (wasPending) {
+			DataVault_PutRef(self);
+		}
+	}
+}
+
+// Append a Set or Delete Record for a single Persisted Key to the Journal instead of rewriting the Primary Repo
+// Returns an error if the Key cannot be Journaled, in which case the caller must Flush the entire Primary Repo
+static esif_error_t DataVault_JournalWrite(
+	DataVaultPtr self,
+	esif_string key
+	)
+{
+	esif_error_t rc = ESIF_OK;
+	char journalName[MAX_PATH] = { 0 };
+	IOStreamPtr journal = NULL;
+	IOStreamPtr item = NULL;
+	DataCacheEntryPtr keyPair = NULL;
+	DataCacheEntry deletePair = { 0 };
+	DataVaultJournalRecord record = { 0 };
+	esif_sha256_t currentDigest = { 0 };
+	size_t bytes = 0;
+
+	// Journals are only supported for writable DV 2.0 KEYS Primary Repos whose Persisted Keys are all on disk
+	if (!self->journalBaseValid ||
+		self->delayedWrites ||
+		self->dataclass != ESIFDV_PAYLOAD_CLASS_KEYS ||
+		ESIFHDR_GET_MAJOR(self->version) != ESIFDV_V2 ||
+		FLAGS_TEST(self->flags, ESIF_SERVICE_CONFIG_STATIC | ESIF_SERVICE_CONFIG_READONLY | ESIF_SERVICE_CONFIG_COMPRESSED) ||
+		!DataVault_GetJournalName(self, journalName, sizeof(journalName)) ||
+		self->stream->base.store != StoreReadWrite ||
+		!esif_ccb_file_exists(self->stream->file.name)) {
+		rc = ESIF_E_NOT_SUPPORTED;
+		goto exit;
+	}
+
+	// Write a Set Record for Persisted Keys, otherwise a Delete Record. NOCACHE Values must be rewritten to the Primary Repo.
+	keyPair = DataCache_GetValue(self->cache, key);
+	if (keyPair && FLAGS_TEST(keyPair->flags, ESIF_SERVICE_CONFIG_NOCACHE)) {
+		rc = ESIF_E_NOT_SUPPORTED;
+		goto exit;
+	}
+	if (keyPair && FLAGS_TEST(keyPair->flags, ESIF_SERVICE_CONFIG_PERSIST)) {
+		record.operation = ESIFDV_JOURNAL_OP_SET;
+	}
+	else {
+		record.operation = ESIFDV_JOURNAL_OP_DELETE;
+		deletePair.key.type = ESIF_DATA_STRING;
+		deletePair.key.buf_ptr = key;
+		deletePair.key.data_len = (u32)esif_ccb_strlen(key, ESIFDV_MAX_KEYLEN) + 1;
+		deletePair.value.type = ESIF_DATA_VOID;
+		keyPair = &deletePair;
+	}
+
+	// Build the Key/Value Pair Item and its SHA256 Hash without disturbing the Primary Repo Digest
+	journal = IOStream_Create();
+	item = IOStream_Create();
+	if (journal == NULL || item == NULL || IOStream_SetMemory(item, StoreReadWrite, NULL, 0) != EOK) {
+		rc = ESIF_E_NO_MEMORY;
+		goto exit;
+	}
+	esif_ccb_memcpy(&currentDigest, &self->digest, sizeof(currentDigest));
+	esif_sha256_init(&self->digest);
+	rc = DataVault_WriteKeyValuePair(self, item, keyPair);
+	esif_sha256_finish(&self->digest);
+	esif_ccb_memcpy(record.payload_hash, self->digest.hash, esif_ccb_min(sizeof(record.payload_hash), self->digest.hashsize));
+	esif_ccb_memcpy(&self->digest, &currentDigest, sizeof(currentDigest));
+	if (rc != ESIF_OK) {
+		goto exit;
+	}
+	record.signature = ESIFDV_JOURNAL_RECORD_SIGNATURE;
+	record.payload_size = (UInt32)IOStream_GetSize(item);
+
+	// Start a new Journal bound to the current Primary Repo Payload, replacing any stale one, or Append to the existing one
+	if (IOStream_OpenFile(journal, StoreReadWrite, journalName, (self->journalSize == 0 ? "wb" : "ab")) != EOK) {
+		rc = ESIF_E_IO_OPEN_FAILED;
+		goto exit;
+	}
+	if (self->journalSize == 0) {
+		DataVaultJournalHeader header = { 0 };
+		header.signature = ESIFDV_JOURNAL_SIGNATURE;
+		header.headersize = (UInt16)sizeof(header);
+		header.version = self->version;
+		esif_ccb_memcpy(header.base_hash, self->journalBase, sizeof(header.base_hash));
+
+		if (IOStream_Write(journal, &header, sizeof(header)) != sizeof(header)) {
+			rc = ESIF_E_IO_ERROR;
+		}
+		bytes += sizeof(header);
+	}
+	if (rc == ESIF_OK &&
+		((IOStream_Write(journal, &record, sizeof(record)) != sizeof(record)) ||
+		 (IOStream_Write(journal, IOStream_GetMemoryBuffer(item), record.payload_size) != record.payload_size))) {
+		rc = ESIF_E_IO_ERROR;
+	}
+	bytes += sizeof(record) + record.payload_size;
+	if (IOStream_Close(journal) != EOK && rc == ESIF_OK) {
+		rc = ESIF_E_IO_ERROR;
+	}
+
+	// Stop Journaling after a failed write, since any Records appended after a torn Record would be ignored
+	if (rc != ESIF_OK) {
+		self->journalBaseValid = ESIF_FALSE;
+		goto exit;
+	}
+	self->journalSize += bytes;
+	self->journalRecords++;
+
+	if (self->journalSize >= ESIFDV_JOURNAL_MAX_SIZE ||
+		(self->journalSize >= ESIFDV_JOURNAL_MIN_SIZE && self->journalSize > self->journalBaseSize * ESIFDV_JOURNAL_COMPACT_RATIO)) {
+		DataVault_ScheduleCompaction(self);
+	}
+
+exit:
+	IOStream_Destroy(journal);
+	IOStream_Destroy(item);
+	return rc;
+}
+
+// Replay the Journal of a Primary Repo into the Cache after loading the Primary Repo with the given Header
+// Records are applied in order up to the first incomplete or corrupted Record, which is discarded by Compaction
+static esif_error_t DataVault_ReplayJournal(
+	DataVaultPtr self,
+	DataVaultHeaderPtr header
+	)
+{
+	esif_error_t rc = ESIF_OK;
+	char journalName[MAX_PATH] = { 0 };
+	IOStreamPtr journal = NULL;
+	IOStreamPtr item = NULL;
+	DataVaultJournalHeader journalHeader = { 0 };
+	DataVaultJournalRecord record = { 0 };
+	DataVaultHeader itemHeader = { 0 };
+	esif_sha256_t currentDigest = { 0 };
+	esif_sha256_t recordDigest = { 0 };
+	BytePtr buffer = NULL;
+	size_t buf_len = 0;
+	size_t journal_size = 0;
+	size_t offset = 0;
+	Bool tornRecord = ESIF_FALSE;
+
+	self->journalBaseValid = ESIF_FALSE;
+	self->journalSize = 0;
+	self->journalRecords = 0;
+
+	// Journals only apply to writable DV 2.0 KEYS Primary Repos
+	if (header == NULL ||
+		ESIFHDR_GET_MAJOR(header->common.version) != ESIFDV_V2 ||
+		header->v2.payload_class != ESIFDV_PAYLOAD_CLASS_KEYS ||
+		FLAGS_TEST(header->v2.flags, ESIF_SERVICE_CONFIG_COMPRESSED) ||
+		!DataVault_GetJournalName(self, journalName, sizeof(journalName)) ||
+		self->stream->base.store != StoreReadWrite) {
+		goto exit;
+	}
+	self->journalBaseValid = ESIF_TRUE;
+	self->journalBaseSize = header->v2.payload_size;
+	esif_ccb_memcpy(self->journalBase, header->v2.payload_hash, sizeof(self->journalBase));
+
+	if ((journal_size = IOStream_GetFileSize(journalName)) == 0) {
+		goto exit;
+	}
+	journal = IOStream_Create();
+	item = IOStream_Create();
+	if (journal == NULL || item == NULL) {
+		rc = ESIF_E_NO_MEMORY;
+		goto exit;
+	}
+	if (IOStream_OpenFile(journal, StoreReadOnly, journalName, "rb") != EOK) {
+		rc = ESIF_E_IO_OPEN_FAILED;
+		goto exit;
+	}
+
+	// Ignore Journals bound to a different Primary Repo Payload; they are replaced by the next Journal Record
+	if (IOStream_Read(journal, &journalHeader, sizeof(journalHeader)) != sizeof(journalHeader) ||
+		journalHeader.signature != ESIFDV_JOURNAL_SIGNATURE ||
+		journalHeader.headersize != sizeof(journalHeader) ||
+		memcmp(journalHeader.base_hash, header->v2.payload_hash, sizeof(journalHeader.base_hash)) != 0) {
+		goto exit;
+	}
+	offset = sizeof(journalHeader);
+	esif_ccb_memcpy(&itemHeader, header, sizeof(itemHeader));
+	esif_ccb_memcpy(&currentDigest, &self->digest, sizeof(currentDigest));
+
+	while (rc == ESIF_OK && offset < journal_size) {
+		EsifData key = { ESIF_DATA_STRING };
+		EsifData value = { ESIF_DATA_VOID };
+		esif_flags_t item_flags = ESIF_SERVICE_CONFIG_NOCACHE; // Item Flags banned for Journaled Values, which are always cached
+
+		// Validate Record Header, Size, and SHA256 Hash
+		tornRecord = ESIF_TRUE;
+		if (IOStream_Read(journal, &record, sizeof(record)) != sizeof(record) ||
+			record.signature != ESIFDV_JOURNAL_RECORD_SIGNATURE ||
+			(record.operation != ESIFDV_JOURNAL_OP_SET && record.operation != ESIFDV_JOURNAL_OP_DELETE) ||
+			record.payload_size > journal_size - offset - sizeof(record)) {
+			break;
+		}
+		if (record.payload_size > buf_len) {
+			BytePtr new_buffer = (BytePtr)esif_ccb_realloc(buffer, record.payload_size);
+			if (new_buffer == NULL) {
+				rc = ESIF_E_NO_MEMORY;
+				break;
+			}
+			buffer = new_buffer;
+			buf_len = record.payload_size;
+		}
+		if (IOStream_Read(journal, buffer, record.payload_size) != record.payload_size) {
+			break;
+		}
+		esif_sha256_init(&recordDigest);
+		esif_sha256_update(&recordDigest, buffer, record.payload_size);
+		esif_sha256_finish(&recordDigest);
+		if (memcmp(record.payload_hash, recordDigest.hash, sizeof(record.payload_hash)) != 0) {
+			break;
+		}
+
+		// Read the Key/Value Pair Item, limited to this Record's Payload, and apply it using ImportCopy semantics
+		itemHeader.v2.payload_size = record.payload_size;
+		IOStream_SetMemory(item, StoreStatic, buffer, record.payload_size);
+		IOStream_Open(item);
+		esif_sha256_init(&self->digest);
+
+		rc = DataVault_ReadKeyValuePair(self, item, &itemHeader, ImportCopy, &item_flags, &key, &value);
+		if (rc == ESIF_OK && DataCache_GetValue(self->cache, (esif_string)key.buf_ptr) != NULL) {
+			rc = DataCache_DeleteValue(self->cache, (esif_string)key.buf_ptr);
+		}
+		if (rc == ESIF_OK && record.operation == ESIFDV_JOURNAL_OP_SET) {
+			rc = DataCache_InsertValue(self->cache, (esif_string)key.buf_ptr, &value, item_flags);
+		}
+		EsifData_dtor(&key);
+		EsifData_dtor(&value);
+
+		if (rc == ESIF_OK) {
+			tornRecord = ESIF_FALSE;
+			offset += sizeof(record) + record.payload_size;
+			self->journalRecords++;
+		}
+	}
+	esif_ccb_memcpy(&self->digest, &currentDigest, sizeof(currentDigest));
+	self->journalSize = offset;
+
+	if (tornRecord) {
+		ESIF_TRACE_ERROR("Discarding Invalid DV Journal Record (%s) at offset %u\n", journalName, (UInt32)offset);
+	}
+
+exit:
+	IOStream_Destroy(journal);
+	IOStream_Destroy(item);
+	esif_ccb_free(buffer);
+
+	// Compact Journals with a torn Record or that exceed the Threshold, since further Records would be appended after it
+	if (self->journalSize > 0 && (tornRecord || rc != ESIF_OK || self->journalSize >= ESIFDV_JOURNAL_MAX_SIZE ||
+		(self->journalSize >= ESIFDV_JOURNAL_MIN_SIZE && self->journalSize > self->journalBaseSize * ESIFDV_JOURNAL_COMPACT_RATIO))) {
+		self->journalBaseValid = ESIF_FALSE;
+		DataVault_ScheduleCompaction(self);
+	}
+	return rc;
+}
+
 // True if the optional segmentid in the Segment header matches the DataVault name
 static Bool DataVault_IsSegmentMatch(
 	DataVaultPtr self,
@@ -911,6 +1336,7 @@ esif_error_t DataVault_ImportStream(DataVaultPtr self)
 {
 	esif_error_t rc = ESIF_OK;
 	DataVaultHeader header = { 0 };
+	DataVaultHeader primaryHeader = { 0 };
 	DataRepo repo = { 0 };
 	char filename[MAX_PATH] = { 0 };
 
@@ -933,6 +1359,7 @@ esif_error_t DataVault_ImportStream(DataVaultPtr self)
 	// Copy only the first Segment from the Repo into this DataVault, ignoring Segment Name in Header
 	rc = DataRepo_ReadHeader(&repo, &header);
 	if (rc == ESIF_OK) {
+		esif_ccb_memcpy(&primaryHeader, &header, sizeof(primaryHeader));
 		rc = DataVault_ReadSegment(self, &repo, &header, ImportCopy);
 
 		// Mark DataVault Stream as Read-Only if this Repo has more than one segment
@@ -942,6 +1369,12 @@ esif_error_t DataVault_ImportStream(DataVaultPtr self)
 			}
 		}
 	}
+	IOStream_Close(repo.stream);
+
+	// Apply any Journaled changes made since the Primary Repo was last written
+	if (rc == ESIF_OK) {
+		rc = DataVault_ReplayJournal(self, &primaryHeader);
+	}
 
 exit:
 	IOStream_Close(repo.stream);
@@ -949,6 +1382,47 @@ exit:
 	return rc;
 }
 
+// Can cached Keys and Values reference the stream's memory directly rather than being copied?
+static Bool DataVault_IsZeroCopy(
+	DataVaultPtr self,
+	IOStreamPtr stream
+	)
+{
+	return (IOStream_GetType(stream) == StreamMemory &&
+		(FLAGS_TEST(self->flags, ESIF_SERVICE_CONFIG_STATIC) || IOStream_IsMapped(stream)) ? ESIF_TRUE : ESIF_FALSE);
+}
+
+// Keep a Mapped Stream's File Mapping for the lifetime of this DataVault, since cached Values and Views reference it
+static esif_error_t DataVault_PinMapping(
+	DataVaultPtr self,
+	IOStreamPtr stream
+	)
+{
+	esif_error_t rc = ESIF_OK;
+	IOStreamMappingPtr mapping = IOStream_GetMapping(stream);
+	IOStreamMappingPtr *mappings = NULL;
+	UInt32 j = 0;
+
+	if (mapping == NULL) {
+		goto exit;
+	}
+	for (j = 0; j < self->numMappings; j++) {
+		if (self->mappings[j] == mapping) {
+			goto exit;
+		}
+	}
+	mappings = (IOStreamMappingPtr *)esif_ccb_realloc(self->mappings, (self->numMappings + 1) * sizeof(*mappings));
+	if (mappings == NULL) {
+		rc = ESIF_E_NO_MEMORY;
+		goto exit;
+	}
+	IOStreamMapping_GetRef(mapping);
+	mappings[self->numMappings++] = mapping;
+	self->mappings = mappings;
+exit:
+	return rc;
+}
+
 // Read and Process the Segment Payload
 static esif_error_t DataVault_ReadPayload(
 	DataVaultPtr self,
@@ -1030,6 +1504,12 @@ static esif_error_t DataVault_ReadPayload(
 		EsifData key = { ESIF_DATA_STRING };
 		EsifData value = { ESIF_DATA_VOID };
 
+		// Bulk Load into an empty cache by appending all pairs and sorting once afterwards
+		Bool bulkLoad = (DataCache_GetCount(self->cache) == 0);
+
+		// Values from a Mapped File are referenced in place
+		rc = DataVault_PinMapping(self, stream);
+
 		esif_sha256_init(&self->digest);
 
 		// Read Key/Value Pair Payload into DataVault Cache
@@ -1058,7 +1538,13 @@ static esif_error_t DataVault_ReadPayload(
 			fileOffset = curFileOffset;
 
 			// Add value (including allocated buf_ptr) to cache
-			if (importMode == ImportMerge) {
+			if (bulkLoad) {
+				if (importMode == ImportMerge) {
+					FLAGS_CLEAR(item_flags, ESIF_SERVICE_CONFIG_PERSIST | ESIF_SERVICE_CONFIG_NOCACHE | ESIF_SERVICE_CONFIG_SCRAMBLE);
+				}
+				rc = DataCache_AppendValue(self->cache, (esif_string)key.buf_ptr, &value, item_flags);
+			}
+			else if (importMode == ImportMerge) {
 				if (DataCache_GetValue(self->cache, (esif_string)key.buf_ptr) == NULL) {
 					FLAGS_CLEAR(item_flags, ESIF_SERVICE_CONFIG_PERSIST | ESIF_SERVICE_CONFIG_NOCACHE | ESIF_SERVICE_CONFIG_SCRAMBLE);
 					rc = DataCache_InsertValue(self->cache, (esif_string)key.buf_ptr, &value, item_flags);
@@ -1076,6 +1562,14 @@ static esif_error_t DataVault_ReadPayload(
 			EsifData_dtor(&value);
 		}
 
+		// Sort and remove duplicates: Merge keeps the first instance of a key, Copy keeps the last
+		if (bulkLoad) {
+			esif_error_t sortRc = DataCache_Sort(self->cache, (importMode == ImportMerge));
+			if (rc == ESIF_OK) {
+				rc = sortRc;
+			}
+		}
+
 		// Re-Validate SHA256 Hash after loading Payload
 		// TODO: Cannot undo Cache changes if this fails unless DataVault Transaction support is added
 		esif_sha256_finish(&self->digest);
@@ -1266,8 +1760,8 @@ static esif_error_t DataVault_ReadKeyValuePair(
 		goto exit;
 	}
 
-	// Use Memory Pointers for Static DataVaults, otherwise allocate memory
-	if ((IOStream_GetType(stream) == StreamMemory) && FLAGS_TEST(self->flags, ESIF_SERVICE_CONFIG_STATIC)) {
+	// Use Memory Pointers for Static DataVaults and Mapped Files, otherwise allocate memory
+	if (DataVault_IsZeroCopy(self, stream)) {
 		keyPtr->buf_len = 0;
 		keyPtr->buf_ptr = IOStream_GetMemoryBuffer(stream) + IOStream_GetOffset(stream);
 		if (IOStream_Seek(stream, keyPtr->data_len, SEEK_CUR) != EOK) {
@@ -1339,8 +1833,8 @@ static esif_error_t DataVault_ReadKeyValuePair(
 		valuePtr->buf_len = 0;	// buf_len == 0 so we don't release buffer as not allocated; data_len = original length
 	} 
 	else {
-		// Use static pointer for static data vaults (unless scrambled), otherwise make a dynamic copy
-		if ((IOStream_GetType(stream) == StreamMemory) && FLAGS_TEST(self->flags, ESIF_SERVICE_CONFIG_STATIC) && !FLAGS_TEST(*flagsPtr, ESIF_SERVICE_CONFIG_SCRAMBLE)) {
+		// Use static pointer for static data vaults and mapped files (unless scrambled), otherwise make a dynamic copy
+		if (DataVault_IsZeroCopy(self, stream) && !FLAGS_TEST(*flagsPtr, ESIF_SERVICE_CONFIG_SCRAMBLE)) {
 			valuePtr->buf_len = 0;	// static
 			valuePtr->buf_ptr = IOStream_GetMemoryBuffer(stream) + IOStream_GetOffset(stream);
 			if (valuePtr->buf_ptr == NULL || IOStream_Seek(stream, valuePtr->data_len, SEEK_CUR) != EOK) {
@@ -1487,27 +1981,19 @@ exit:
 }
 
 
-// Retrieve a single value from a DataVault
-static esif_error_t DataVault_GetValue(
+// Copy a cached value from a DataVault into a caller's buffer. DataVault must be locked by caller.
+static esif_error_t DataVault_CopyValue(
 	DataVaultPtr self,
-	esif_string key,
+	DataCacheEntryPtr keypair,
 	EsifDataPtr value,
 	esif_flags_t *flagsPtr
 	)
 {
 	esif_error_t rc = ESIF_E_NOT_FOUND;
-	DataCacheEntryPtr keypair = NULL;
-
-	if (!self)
-		return ESIF_E_PARAMETER_IS_NULL;
-
-	esif_ccb_read_lock(&self->lock);
 
 	if (flagsPtr)
 		*flagsPtr = 0;
 
-	keypair = DataCache_GetValue(self->cache, key);
-	
 	if (NULL != keypair) {
 		UInt32 data_len = keypair->value.data_len;
 		void *buf_ptr   = keypair->value.buf_ptr;
@@ -1575,6 +2061,71 @@ static esif_error_t DataVault_GetValue(
 	}
 
 exit:
+	return rc;
+}
+
+// Retrieve a single value from a DataVault
+static esif_error_t DataVault_GetValue(
+	DataVaultPtr self,
+	esif_string key,
+	EsifDataPtr value,
+	esif_flags_t *flagsPtr
+	)
+{
+	esif_error_t rc = ESIF_E_NOT_FOUND;
+
+	if (!self)
+		return ESIF_E_PARAMETER_IS_NULL;
+
+	esif_ccb_read_lock(&self->lock);
+	rc = DataVault_CopyValue(self, DataCache_GetValue(self->cache, key), value, flagsPtr);
+	esif_ccb_read_unlock(&self->lock);
+	return rc;
+}
+
+// Retrieve a Read-Only View of a single value from a DataVault, or an allocated copy if it cannot be viewed in place
+esif_error_t DataVault_GetView(
+	DataVaultPtr self,
+	esif_string key,
+	EsifDataPtr value,
+	esif_flags_t *flagsPtr
+	)
+{
+	esif_error_t rc = ESIF_E_NOT_FOUND;
+	DataCacheEntryPtr keypair = NULL;
+	UInt32 j = 0;
+
+	if (!self || !key || !value)
+		return ESIF_E_PARAMETER_IS_NULL;
+
+	esif_ccb_read_lock(&self->lock);
+
+	keypair = DataCache_GetValue(self->cache, key);
+	if (NULL != keypair && value->type != keypair->value.type && value->type != ESIF_DATA_AUTO) {
+		rc = ESIF_E_UNSUPPORTED_RESULT_DATA_TYPE;
+	}
+	// Static and Mapped values are never freed while the DataVault exists, even if the key is changed or deleted
+	else if (NULL != keypair && keypair->value.buf_len == 0 && !FLAGS_TEST(keypair->flags, ESIF_SERVICE_CONFIG_NOCACHE)) {
+		Bool isPinned = FLAGS_TEST(self->flags, ESIF_SERVICE_CONFIG_STATIC);
+		for (j = 0; !isPinned && j < self->numMappings; j++) {
+			isPinned = IOStreamMapping_Contains(self->mappings[j], keypair->value.buf_ptr);
+		}
+		if (isPinned) {
+			value->type = keypair->value.type;
+			value->buf_ptr = keypair->value.buf_ptr;
+			value->buf_len = 0;	// Caller MUST NOT Free!
+			value->data_len = keypair->value.data_len;
+			if (flagsPtr)
+				*flagsPtr = keypair->flags;
+			rc = ESIF_OK;
+		}
+	}
+
+	if (NULL != keypair && rc == ESIF_E_NOT_FOUND) {
+		value->buf_ptr = NULL;
+		value->buf_len = ESIF_DATA_ALLOCATE;
+		rc = DataVault_CopyValue(self, keypair, value, flagsPtr);
+	}
 	esif_ccb_read_unlock(&self->lock);
 	return rc;
 }
@@ -1658,6 +2209,7 @@ esif_error_t DataVault_SetValue(
 	esif_error_t rc = ESIF_OK;
 	DataCacheEntryPtr keypair;
 	DataCachePtr nocacheClone = NULL;
+	esif_string journalKey = NULL;
 
 	if (!self)
 		return ESIF_E_PARAMETER_IS_NULL;
@@ -1757,6 +2309,7 @@ esif_error_t DataVault_SetValue(
 	}
 
 	// Get the Data Row or create it if it does not exist
+	journalKey = key;
 	keypair = DataCache_GetValue(self->cache, key);
 
 	if (keypair) {	// Match Found
@@ -1825,11 +2378,16 @@ esif_error_t DataVault_SetValue(
 	}
 
 exit:
-	// If Persisted, Flush to disk
+	// If Persisted, Append single Key changes to the Journal or Flush the entire Repo to disk
 	if (rc == ESIF_OK && FLAGS_TEST(flags, ESIF_SERVICE_CONFIG_PERSIST)) {
 		if (nocacheClone) {
 			if (!FLAGS_TEST(flags, ESIF_SERVICE_CONFIG_DELAYWRITE)) {
-				rc = DataVault_RepoFlush(self, NULL, ESIF_FALSE);
+				if (journalKey == NULL || DataVault_JournalWrite(self, journalKey) != ESIF_OK) {
+					rc = DataVault_RepoFlush(self, NULL, ESIF_FALSE);
+				}
+			}
+			else {
+				self->delayedWrites = ESIF_TRUE;
 			}
 
 			// Restore NOCACHE Offsets on Failure
@@ -1858,14 +2416,15 @@ static Bool DataVault_IsPrimary(
 	 * (i.e., static in-memory DVs) or StoreReadOnly (multi-segment .dv files).
 	 *
 	 * This Repo is the Primary Stream for this DV if all of these conditions are met:
-	 * 1. No Primary Stream has been assigned, or the Primary Stream is a Memory Stream and this Repo is a File Stream
+	 * 1. No Primary Stream has been assigned, or the Primary Stream is a Memory Stream and this Repo is a File Stream (or Mapped File)
 	 * 2. The Name in the Segment Header matches the DataVault name
 	 * 3. The Name of the Repo matches the DataVault name ('name' or 'name.dv')
 	 * 4. The Repo Name file has a .dv extension (or none)
 	 */
-	if (self && repo && repo->stream && repo->stream->type != StreamMemory &&
+	Bool isFile = (repo && repo->stream && (repo->stream->type == StreamFile || IOStream_IsMapped(repo->stream)));
+	if (self && isFile &&
 		(self->stream == NULL || self->stream->type == StreamNull ||
-		(self->stream->type == StreamMemory && repo->stream->type == StreamFile))) {
+		(self->stream->type == StreamMemory && !IOStream_IsMapped(self->stream)))) {
 
 		char reponame[sizeof(self->name)] = { 0 };
 		DataRepo_GetName(repo, reponame, sizeof(reponame));
@@ -2078,11 +2637,24 @@ esif_error_t DataRepo_LoadSegments(DataRepoPtr self)
 {
 	esif_error_t rc = ESIF_E_PARAMETER_IS_NULL;
 	DataVaultHeader header = { 0 };
+	DataVaultHeader primaryHeader = { 0 };
 	DataVaultPtr DV = NULL;
 	char PrimaryDV[sizeof(DV->name)] = { 0 };
 	int segments = 0;
 
 	if (self && self->stream) {
+		Bool isStatic = ESIF_FALSE;
+		char mappedFile[MAX_PATH] = { 0 };
+
+		// Map Read-Only File Repos into memory so their Values can be referenced in place rather than copied
+		if (self->stream->type == StreamFile && self->stream->base.store == StoreReadOnly && self->stream->file.name != NULL) {
+			esif_ccb_strcpy(mappedFile, self->stream->file.name, sizeof(mappedFile));
+			if (IOStream_MapFile(self->stream, self->stream->file.name) != EOK) {
+				mappedFile[0] = 0;
+			}
+		}
+		isStatic = (self->stream->type == StreamMemory && self->stream->base.store == StoreStatic && !IOStream_IsMapped(self->stream));
+
 		if (IOStream_Open(self->stream) != EOK) {
 			rc = ESIF_E_IO_OPEN_FAILED;
 			goto exit;
@@ -2100,12 +2672,12 @@ esif_error_t DataRepo_LoadSegments(DataRepoPtr self)
 
 			// Use previous segmentid if not defined in current header
 			if (major_version == ESIFDV_V1) {
-				if (self->stream->type == StreamMemory && self->stream->base.store == StoreStatic) {
+				if (isStatic) {
 					FLAGS_SET(header.v1.flags, ESIF_SERVICE_CONFIG_STATIC);
 				}
 			}
 			else if (major_version == ESIFDV_V2) {
-				if (self->stream->type == StreamMemory && self->stream->base.store == StoreStatic) {
+				if (isStatic) {
 					FLAGS_SET(header.v2.flags, ESIF_SERVICE_CONFIG_STATIC);
 				}
 				if (header.v2.segmentid[0]) {
@@ -2129,6 +2701,7 @@ esif_error_t DataRepo_LoadSegments(DataRepoPtr self)
 					importMode = ImportCopy;
 					DV->stream = self->stream;
 					DataRepo_GetName(self, PrimaryDV, sizeof(PrimaryDV));
+					esif_ccb_memcpy(&primaryHeader, &header, sizeof(primaryHeader));
 				}
 				rc = DataVault_ReadSegment(DV, self, &header, importMode);
 				DV->stream = currentStream;
@@ -2159,6 +2732,12 @@ esif_error_t DataRepo_LoadSegments(DataRepoPtr self)
 		// Transfer ownership of this Repo stream to the Primary DV, if one was found
 		if (PrimaryDV[0] && ((DV = DataBank_GetDataVault(PrimaryDV)) != NULL)) {
 			esif_ccb_write_lock(&DV->lock);
+
+			// Primary Repos are rewritten and journaled by file name, so switch a Mapped Repo back to its File Stream.
+			// The DV keeps the Mapping pinned for any Values loaded from it, and NOCACHE offsets are the same in both.
+			if (mappedFile[0] && IOStream_IsMapped(self->stream)) {
+				IOStream_SetFile(self->stream, StoreReadOnly, mappedFile, "rb");
+			}
 			IOStream_Destroy(DV->stream);
 			DV->stream = self->stream;
 			self->stream = NULL;
@@ -2167,6 +2746,11 @@ esif_error_t DataRepo_LoadSegments(DataRepoPtr self)
 			if (segments > 1 && DV->stream->base.store == StoreReadWrite) {
 				DV->stream->base.store = StoreReadOnly;
 			}
+
+			// Apply any Journaled changes made since the Primary Repo was last written
+			if (rc == ESIF_OK) {
+				rc = DataVault_ReplayJournal(DV, &primaryHeader);
+			}
 			esif_ccb_write_unlock(&DV->lock);
 			DataVault_PutRef(DV);
 		}
@@ -2388,6 +2972,15 @@ int EsifConfigKeyMatch(
 	return result;
 }
 
+// Iterator Cursor for EsifConfigFindFirst/EsifConfigFindNext
+struct EsifConfigFindCursor_s {
+	DataCachePtr	cache;		// DataCache being iterated
+	UInt32			generation;	// DataCache Generation when index was last valid
+	UInt32			index;		// Index of last returned key
+	esif_string		lastKey;	// Copy of last returned key, to resume after the DataCache is modified
+	size_t			lastKeyLen;	// Allocated size of lastKey
+};
+
 // Find Next path in nameSpace
 esif_error_t EsifConfigFindNext(
 	EsifDataPtr nameSpace,
@@ -2402,44 +2995,82 @@ esif_error_t EsifConfigFindNext(
 	ESIF_ASSERT(nameSpace && path && context);
 	DB = DataBank_GetDataVault((StringPtr)(nameSpace->buf_ptr));
 	if (DB) {
+		struct EsifConfigFindCursor_s *cursor = *context;
+		esif_string pattern = (path->type == ESIF_DATA_STRING ? (esif_string)path->buf_ptr : NULL);
+		size_t prefixLen = 0;
 		UInt32 item = 0;
 
 		esif_ccb_read_lock(&DB->lock);
 
-		for (item = 0; item < DB->cache->size; item++) {
-			if (*context == NULL || esif_ccb_stricmp(DB->cache->elements[item].key.buf_ptr, *context) > 0) {
-				break;
-			}
+		// Matching keys all share the literal prefix before the first wildcard, which is a contiguous range in the sorted cache
+		if (pattern != NULL) {
+			prefixLen = esif_ccb_strcspn(pattern, "*?");
 		}
 
-		// Find next matching key
-		while (item < DB->cache->size && EsifConfigKeyMatch(path, &DB->cache->elements[item].key) != ESIF_TRUE) {
+		// Resume after the last returned key: Use its index if the cache is unchanged, otherwise binary search for it
+		if (cursor == NULL) {
+			item = (prefixLen > 0 ? DataCache_GetLowerBound(DB->cache, pattern, ESIF_FALSE) : 0);
+		}
+		else if (cursor->cache == DB->cache && cursor->generation == DataCache_GetGeneration(DB->cache)) {
+			item = cursor->index + 1;
+		}
+		else {
+			item = DataCache_GetLowerBound(DB->cache, cursor->lastKey, ESIF_TRUE);
+		}
+
+		// Find next matching key, stopping at the end of the prefix range
+		while (item < DB->cache->size) {
+			int comp = (prefixLen > 0 ? esif_ccb_strnicmp((esif_string)DB->cache->elements[item].key.buf_ptr, pattern, prefixLen) : 0);
+			if (comp > 0) {
+				item = DB->cache->size;
+				break;
+			}
+			if (comp == 0 && EsifConfigKeyMatch(path, &DB->cache->elements[item].key) == ESIF_TRUE) {
+				break;
+			}
 			item++;
 		}
 
 		// Return matching item, if any
 		if (item < DB->cache->size) {
-			esif_ccb_free(*context);
-			*context = esif_ccb_strdup(DB->cache->elements[item].key.buf_ptr);
-			
-			if (path->buf_len && path->buf_len < DB->cache->elements[item].key.data_len) {
+			DataCacheEntryPtr keypair = &DB->cache->elements[item];
+
+			if (cursor == NULL) {
+				cursor = (struct EsifConfigFindCursor_s *)esif_ccb_malloc(sizeof(*cursor));
+				*context = cursor;
+			}
+			if (cursor != NULL && cursor->lastKeyLen < keypair->key.data_len) {
+				esif_ccb_free(cursor->lastKey);
+				cursor->lastKeyLen = esif_ccb_max(keypair->key.data_len, MAX_PATH);
+				cursor->lastKey = (esif_string)esif_ccb_malloc(cursor->lastKeyLen);
+			}
+
+			if (cursor == NULL || cursor->lastKey == NULL) {
+				rc = ESIF_E_NO_MEMORY;
+			}
+			else if (path->buf_len && path->buf_len < keypair->key.data_len) {
 				rc = ESIF_E_NEED_LARGER_BUFFER;
 			}
 			else {
+				esif_ccb_strcpy(cursor->lastKey, (esif_string)keypair->key.buf_ptr, cursor->lastKeyLen);
+				cursor->cache = DB->cache;
+				cursor->generation = DataCache_GetGeneration(DB->cache);
+				cursor->index = item;
+
 				EsifData_Set(path, 
 							 ESIF_DATA_STRING,
-							 esif_ccb_strdup((char*)DB->cache->elements[item].key.buf_ptr),
-							 DB->cache->elements[item].key.data_len,
-							 DB->cache->elements[item].key.data_len);
+							 esif_ccb_strdup((char*)keypair->key.buf_ptr),
+							 keypair->key.data_len,
+							 keypair->key.data_len);
 
-				// If no value buffer for result, just return next matching key
+				// If no value buffer for result, just return next matching key, otherwise return the value already found
 				if (NULL == value)
 					rc = ESIF_OK;
 				else
-					rc = EsifConfigGet(nameSpace, path, value);
+					rc = DataVault_CopyValue(DB, keypair, value, NULL);
 			}
 		}
-		else if (*context != NULL) {
+		else if (cursor != NULL) {
 			rc = ESIF_E_ITERATION_DONE;
 		}
 		esif_ccb_read_unlock(&DB->lock);
@@ -2470,7 +3101,8 @@ void EsifConfigFindClose(
 	EsifConfigFindContextPtr context
 	)
 {
-	if (context) {
+	if (context && *context) {
+		esif_ccb_free((*context)->lastKey);
 		esif_ccb_free(*context);
 		*context = NULL;
 	}
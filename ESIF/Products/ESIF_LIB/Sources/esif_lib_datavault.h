@@ -82,6 +82,12 @@
  *       but for DV 2.0, it will usually be an Embedded Repo so that any Data Segment(s)
  *       contained in the Repo can be compressed and the SHA256 hash will be computed
  *       for all segment(s) in the Payload.
+ *    K. Updates to a single Persisted Key in a DV 2.0 Primary Repo are appended to a
+ *       Journal (dvname.dv.jnl) rather than rewriting the entire Repo. Each Journal
+ *       Record contains one Key/Value Pair (or Delete) and its own SHA256 Hash, and the
+ *       Journal is bound to the Payload Hash of the Primary Repo it applies to. Journals
+ *       are replayed whenever the Primary Repo is loaded, ignoring any torn Records,
+ *       and are compacted into the Primary Repo in the background once they grow too large.
  */
 
 // DV Global Definitions
@@ -89,6 +95,7 @@
 #define ESIFDV_REPOEXT              ".dvx"		// Data Repo Extension [repo.dvx]
 #define ESIFDV_TEMPEXT              ".tmp"		// Temp Repo File Extension [name.dv.tmp or repo.dvx.tmp]
 #define ESIFDV_ROLLBACKEXT          ".temp"		// Rollback File Extension [name.dv.temp or repo.dvx.temp]
+#define ESIFDV_JOURNALEXT           ".jnl"		// Journal File Extension [name.dv.jnl]
 #define ESIFDV_TEMP_PREFIX          "$$"		// Temp DV Name Prefix [i.e., $$name.dv]
 #define ESIFDV_EXPORT_PREFIX        "$"			// Exported Repository DV Name Prefix [i.e., $name.dv]
 #define ESIFDV_NAME_LEN				32			// Max DataVault Name (Cache Name) Length (not including NUL)
@@ -114,6 +121,17 @@ typedef struct DataVault_s {
 	IOStreamPtr				stream;							// Primary Stream (Cached Key/Values) ["name.dv"]
 	UInt32					dataclass;						// Payload Data Class (KEYS, REPO, ...)
 	esif_sha256_t			digest;							// SHA-256 Hash used to verify Payload
+	IOStreamMappingPtr		*mappings;						// File Mappings referenced by cached Keys/Values (until destroyed)
+	UInt32					numMappings;					// Number of File Mappings
+	UInt8					journalBase[SHA256_HASH_BYTES];	// Payload Hash of the Primary Repo that the Journal applies to
+	Bool					journalBaseValid;				// Journal may be appended to (Primary Repo is a v2 KEYS file)
+	size_t					journalBaseSize;				// Payload Size of the Primary Repo
+	size_t					journalSize;					// Journal File Size [name.dv.jnl] or 0 if none
+	UInt32					journalRecords;					// Number of Records in the Journal
+	Bool					delayedWrites;					// Persisted Keys written with DELAYWRITE are not in the Primary Repo or Journal
+	Bool					compactPending;					// Journal Compaction scheduled
+	Bool					compactTimerInit;				// Journal Compaction Timer initialized
+	esif_ccb_timer_t		compactTimer;					// Journal Compaction Timer
 } DataVault, *DataVaultPtr;
 
 #ifdef __cplusplus
@@ -134,9 +152,14 @@ void DataVault_PutRef(DataVaultPtr self);
 UInt32 DataVault_GetKeyCount(DataVaultPtr self);
 Bool DataVault_KeyExists(DataVaultPtr self, StringPtr keyName, esif_data_type_t *typePtr, esif_flags_t *flagsPtr);
 esif_error_t DataVault_SetValue(DataVaultPtr self, esif_string key, EsifDataPtr value, esif_flags_t flags);
+
+// Get a Read-Only View of a value without copying it, if it is Static or Mapped from a File, otherwise an allocated copy.
+// Views have buf_len=0 and remain valid until the caller releases its DataVault reference (see DataBank_GetDataVault).
+esif_error_t DataVault_GetView(DataVaultPtr self, esif_string key, EsifDataPtr value, esif_flags_t *flagsPtr);
 esif_error_t DataVault_SetPayload(DataVaultPtr self, UInt32 payload_class, IOStreamPtr payload, Bool compressPayload);
 void DataVault_SetDefaultComment(DataVaultPtr self);
 esif_error_t DataVault_ImportStream(DataVaultPtr self);
+void DataVault_FinishCompaction(DataVaultPtr self);
 
 #ifdef __cplusplus
 }
@@ -67,9 +67,17 @@ void EsifData_dtor (EsifDataPtr self)
 
 
 // new Operator
+// Objects come from the EsifData Memory Pool once it exists and must be released with EsifData_Destroy
 EsifDataPtr EsifData_Create ()
 {
+#ifdef ESIF_FEAT_OPT_MEMPOOL
+	EsifDataPtr self = (EsifDataPtr)esif_ccb_mempool_alloc(ESIF_MEMPOOL_TYPE_ESIFDATA);
+	if (NULL == self) {
+		self = (EsifDataPtr)esif_ccb_malloc(sizeof(*self));
+	}
+#else
 	EsifDataPtr self = (EsifDataPtr)esif_ccb_malloc(sizeof(*self));
+#endif
 	EsifData_ctor(self);
 	return self;
 }
@@ -79,7 +87,11 @@ EsifDataPtr EsifData_Create ()
 void EsifData_Destroy (EsifDataPtr self)
 {
 	EsifData_dtor(self);
+#ifdef ESIF_FEAT_OPT_MEMPOOL
+	esif_ccb_mempool_free(ESIF_MEMPOOL_TYPE_ESIFDATA, self);
+#else
 	esif_ccb_free(self);
+#endif
 }
 
 
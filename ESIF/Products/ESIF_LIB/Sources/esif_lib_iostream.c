@@ -20,6 +20,7 @@
 #include "esif_ccb_rc.h"
 #include "esif_ccb_file.h"
 #include "esif_ccb_memory.h"
+#include "esif_ccb_atomic.h"
 #include "esif_lib_iostream.h"
 
 #include <stdlib.h>
@@ -55,7 +56,10 @@ void IOStream_dtor(IOStreamPtr self)
 			break;
 
 		case StreamMemory:
-			if (self->memory.store != StoreStatic) {
+			if (self->memory.mapping) {
+				IOStreamMapping_PutRef(self->memory.mapping);
+			}
+			else if (self->memory.store != StoreStatic) {
 				esif_ccb_free(self->memory.buffer);
 			}
 			break;
@@ -173,6 +177,48 @@ int IOStream_SetMemory(
 	return rc;
 }
 
+// Set IOStream to a Static Memory Stream containing a Read-Only Mapping of the given File
+int IOStream_MapFile(
+	IOStreamPtr self,
+	StringPtr filename
+)
+{
+	int rc = EINVAL;
+	IOStreamMappingPtr mapping = NULL;
+	BytePtr buffer = NULL;
+	size_t size = 0;
+
+	if (NULL == self || NULL == filename) {
+		goto exit;
+	}
+
+	mapping = (IOStreamMappingPtr)esif_ccb_malloc(sizeof(*mapping));
+	if (NULL == mapping) {
+		rc = ENOMEM;
+		goto exit;
+	}
+	buffer = (BytePtr)esif_ccb_mmap_file(filename, &size);
+	if (NULL == buffer) {
+		esif_ccb_free(mapping);
+		rc = EIO;
+		goto exit;
+	}
+	atomic_set(&mapping->refCount, 1);
+	mapping->buffer = buffer;
+	mapping->size = size;
+
+	// filename may belong to this stream, so only replace its contents once the file is mapped
+	rc = IOStream_SetMemory(self, StoreStatic, buffer, size);
+	if (rc == EOK) {
+		self->memory.mapping = mapping;
+	}
+	else {
+		IOStreamMapping_PutRef(mapping);
+	}
+exit:
+	return rc;
+}
+
 // Set IOStream to use a File and open it
 int IOStream_OpenFile(
 	IOStreamPtr self,
@@ -624,3 +670,38 @@ size_t IOStream_GetFileSize(StringPtr filename)
 }
 
 
+// Return the File Mapping of a Mapped Memory Stream (or NULL if not Mapped)
+IOStreamMappingPtr IOStream_GetMapping(IOStreamPtr self)
+{
+	if (self && self->type == StreamMemory) {
+		return self->memory.mapping;
+	}
+	return NULL;
+}
+
+Bool IOStream_IsMapped(IOStreamPtr self)
+{
+	return (IOStream_GetMapping(self) != NULL ? ESIF_TRUE : ESIF_FALSE);
+}
+
+void IOStreamMapping_GetRef(IOStreamMappingPtr self)
+{
+	if (self) {
+		atomic_inc(&self->refCount);
+	}
+}
+
+// Release a reference and Unmap the File when the last reference is released
+void IOStreamMapping_PutRef(IOStreamMappingPtr self)
+{
+	if (self && atomic_dec(&self->refCount) == 0) {
+		esif_ccb_munmap_file(self->buffer, self->size);
+		esif_ccb_free(self);
+	}
+}
+
+// Does the given pointer refer to the contents of this File Mapping?
+Bool IOStreamMapping_Contains(IOStreamMappingPtr self, const void *ptr)
+{
+	return (self && (const Byte *)ptr >= self->buffer && (const Byte *)ptr < self->buffer + self->size ? ESIF_TRUE : ESIF_FALSE);
+}
@@ -34,6 +34,10 @@
 union IOStream_s;
 typedef union IOStream_s IOStream, *IOStreamPtr, **IOStreamPtrLocation;
 
+// Reference Counted Read-Only File Mapping shared by Memory Streams and the objects that reference its contents
+struct IOStreamMapping_s;
+typedef struct IOStreamMapping_s IOStreamMapping, *IOStreamMappingPtr;
+
 typedef enum stream_type {
 	StreamNull,
 	StreamFile,
@@ -48,6 +52,12 @@ typedef enum store_type {
 
 #ifdef _IOSTREAM_CLASS
 
+struct IOStreamMapping_s {
+	atomic_t    refCount;	// Reference Count
+	BytePtr     buffer;		// Mapped File Contents
+	size_t      size;		// Mapped File Size
+};
+
 union IOStream_s {
 	StreamType  type;			// Stream Type (File, Buffer)
 
@@ -71,6 +81,7 @@ union IOStream_s {
 		size_t      buf_len;	// Buffer Size if Dynamically Allocated
 		size_t      data_len;	// Buffer Data Length
 		size_t      offset;		// Current Offset from Buffer Pointer
+		IOStreamMappingPtr mapping;	// File Mapping if Buffer is a Mapped File
 	} memory;
 };
 
@@ -91,6 +102,7 @@ void IOStream_Destroy(IOStreamPtr self);// delete operator
 int IOStream_SetFile(IOStreamPtr self, StoreType store, StringPtr filename, StringPtr mode);
 int IOStream_SetMemory(IOStreamPtr self, StoreType store, BytePtr buffer, size_t size);
 int IOStream_OpenFile(IOStreamPtr self, StoreType store, StringPtr filename, StringPtr mode);
+int IOStream_MapFile(IOStreamPtr self, StringPtr filename);	// Set to a Static Memory Stream of a Read-Only File Mapping
 int IOStream_Open(IOStreamPtr self);	// fopen equivalent
 int IOStream_Close(IOStreamPtr self);	// fclose equivalent
 
@@ -111,6 +123,13 @@ size_t IOStream_GetSize(IOStreamPtr self);
 BytePtr IOStream_GetMemoryBuffer(IOStreamPtr self);
 size_t IOStream_GetFileSize(StringPtr filename);	// static member
 
+// File Mappings: Take a reference on a Mapped Stream's Mapping to keep its contents valid after the Stream is closed
+IOStreamMappingPtr IOStream_GetMapping(IOStreamPtr self);	// NULL if not a Mapped Stream; does not add a reference
+Bool IOStream_IsMapped(IOStreamPtr self);
+void IOStreamMapping_GetRef(IOStreamMappingPtr self);
+void IOStreamMapping_PutRef(IOStreamMappingPtr self);
+Bool IOStreamMapping_Contains(IOStreamMappingPtr self, const void *ptr);
+
 #ifdef __cplusplus
 }
 #endif
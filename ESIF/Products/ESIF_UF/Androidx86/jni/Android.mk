@@ -51,7 +51,7 @@ LOCAL_PROPRIETARY_MODULE := true
 include $(BUILD_PREBUILT)
 
 include $(CLEAR_VARS)
-LOCAL_CFLAGS    := -g -DESIF_ATTR_OS_ANDROID -DESIF_FEAT_OPT_ACTION_SYSFS -DESIF_ATTR_DAEMON -DESIF_ATTR_USER -Wno-multichar -Wno-error=sequence-point \
+LOCAL_CFLAGS    := -g -DESIF_ATTR_OS_ANDROID -DESIF_FEAT_OPT_ACTION_SYSFS -DESIF_ATTR_DAEMON -DESIF_ATTR_USER -DESIF_FEAT_OPT_MEMPOOL -Wno-multichar -Wno-error=sequence-point \
 	-Wno-sign-compare -Wno-missing-field-initializers -Wno-unused-parameter -Wno-missing-braces -Wno-ignored-qualifiers -Wno-unknown-pragmas -Wno-typedef-redefinition \
 	-Wno-enum-conversion -Wno-switch -Wno-sizeof-pointer-memaccess -Wno-logical-op-parentheses -Wno-comment -Wno-tautological-compare -Wno-logical-not-parentheses -w
 
@@ -74,6 +74,7 @@ LOCAL_SRC_FILES += ESIF_UF/Sources/lin/esif_uf_sensor_manager_os_lin.c
 LOCAL_SRC_FILES += ESIF_UF/Sources/lin/esif_uf_sysfs_enumerate_os_lin.c
 
 LOCAL_SRC_FILES += ESIF_CM/Sources/esif_hash_table.c
+LOCAL_SRC_FILES += ESIF_CM/Sources/esif_ccb_mempool.c
 LOCAL_SRC_FILES += ESIF_CM/Sources/esif_ipc.c
 
 LOCAL_SRC_FILES += ../../Common/esif_link_list.c
@@ -66,7 +66,7 @@ int g_initVarSet = ESIF_FALSE; // Used to set initialization variables only once
 esif_ccb_event_t g_esifUfInitEvent = { 0 };
 
 /* ESIF Memory Pool */
-struct esif_ccb_mempool *g_mempool[ESIF_MEMPOOL_TYPE_MAX] = {0};
+struct esif_ccb_mempool *g_mempool[ESIF_MEMPOOL_TYPE_UF_MAX] = {0};
 esif_ccb_lock_t g_mempool_lock;
 
 #ifdef ESIF_ATTR_MEMTRACE
@@ -690,9 +690,23 @@ esif_string esif_build_path(
 }
 
 
+// Initialize Memory Pool tracking and create the Object Pools for frequently allocated objects.
+// Pools are destroyed by esif_ccb_mempool_uninit_tracking.
+static enum esif_rc esif_uf_mempool_init(void)
+{
+	enum esif_rc rc = esif_ccb_mempool_init_tracking();
+
+	if (ESIF_OK == rc) {
+		esif_ccb_mempool_create(ESIF_MEMPOOL_TYPE_LIST_NODE, ESIF_MEMPOOL_FW_LIST_NODE, sizeof(struct esif_link_list_node));
+		esif_ccb_mempool_create(ESIF_MEMPOOL_TYPE_ESIFDATA, ESIF_MEMPOOL_FW_DATA, sizeof(EsifData));
+	}
+	return rc;
+}
+
+
 EsifInitTableEntry g_esifUfInitTable[] = {
 	{ esif_uf_shell_init,				esif_uf_shell_exit,					ESIF_INIT_FLAG_NONE },
-	{ esif_ccb_mempool_init_tracking,	esif_ccb_mempool_uninit_tracking,	ESIF_INIT_FLAG_NONE },
+	{ esif_uf_mempool_init,				esif_ccb_mempool_uninit_tracking,	ESIF_INIT_FLAG_NONE },
 	{ EsifLogsInit,						EsifLogsExit,						ESIF_INIT_FLAG_NONE },
 	{ esif_link_list_init,				esif_link_list_exit,				ESIF_INIT_FLAG_NONE },
 	{ esif_ht_init,						esif_ht_exit,						ESIF_INIT_FLAG_NONE },
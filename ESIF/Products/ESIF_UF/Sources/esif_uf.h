@@ -209,6 +209,9 @@ void esif_uf_os_exit(void);
 eEsifError esif_uf_os_shell_enable(void);
 void esif_uf_os_shell_disable(void);
 
+/* OS Specific Handle Cache Benchmark; average ns per read of an integer attribute without and with cached handles */
+eEsifError esif_uf_os_handle_cache_bench(const char *attributePath, UInt32 iterations, UInt64 *uncachedNsPtr, UInt64 *cachedNsPtr, Bool *isCachedPtr);
+
 /* Indicates if auto-enumeration is allowed for the input participant type */
 Bool esif_uf_is_auto_enum_allowed(esif_domain_type_t partType);
 
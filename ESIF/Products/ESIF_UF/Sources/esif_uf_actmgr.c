@@ -76,6 +76,8 @@ static eEsifError EsifActMgr_CreateAction(
 	);
 
 static EsifActMgrEntryPtr EsifActMgr_GetActionEntry_Locked(enum esif_action_type type);
+static EsifActMgrEntryPtr EsifActMgr_FindActionEntry_Locked(enum esif_action_type type);
+static void EsifActMgr_RemoveEntry_Locked(EsifActMgrEntryPtr entryPtr, struct esif_link_list_node *nodePtr);
 static EsifActMgrEntryPtr EsifActMgr_GetActEntryByLibname_Locked(EsifString libName);
 static struct esif_link_list_node *EsifActMgr_GetNodeFromEntry_Locked(EsifActMgrEntryPtr entryPtr);
 static eEsifError EsifActMgr_CreatePossActList_Locked();
@@ -115,27 +117,46 @@ EsifActPtr EsifActMgr_GetAction(
 	eEsifError rc = ESIF_OK;
 	EsifActPtr actPtr = NULL;
 	EsifActMgrEntryPtr entryPtr = NULL;
-	struct esif_link_list_node *nodePtr = NULL;
+	Bool loadDelayed = ESIF_FALSE;
 
+	/*
+	 * Loaded actions are found with only a read lock so that concurrent primitive
+	 * executions do not serialize here. Entries are only removed under the write
+	 * lock, so the reference is taken before the entry can be destroyed.
+	 */
+	esif_ccb_read_lock(&g_actMgr.mgrLock);
+
+	entryPtr = EsifActMgr_GetActionEntry_Locked(type);
+	if (entryPtr != NULL) {
+		loadDelayed = entryPtr->loadDelayed;
+		if (loadDelayed == ESIF_FALSE) {
+			actPtr = entryPtr->actPtr;
+			rc = EsifAct_GetRef(actPtr);
+			if (rc != ESIF_OK) {
+				actPtr = NULL;
+			}
+		}
+	}
+
+	esif_ccb_read_unlock(&g_actMgr.mgrLock);
+
+	if (loadDelayed == ESIF_FALSE) {
+		goto exit;
+	}
+
+	/* The action must be loaded; look again under the write lock since it may have changed */
 	esif_ccb_write_lock(&g_actMgr.mgrLock);
 
-	/* First see if the action is available, else see if it can be loaded */
 	entryPtr = EsifActMgr_GetActionEntry_Locked(type);
 	if (NULL == entryPtr) {
 		esif_ccb_write_unlock(&g_actMgr.mgrLock);
 		goto exit;
 	}
 	if (entryPtr->loadDelayed == ESIF_FALSE) {
-		actPtr = entryPtr->actPtr;
-		rc = EsifAct_GetRef(actPtr);
-		if (rc != ESIF_OK) {
-			actPtr = NULL;
-		}
 		esif_ccb_write_unlock(&g_actMgr.mgrLock);
+		actPtr = EsifActMgr_GetAction(type);
 	} else {
-		nodePtr = EsifActMgr_GetNodeFromEntry_Locked(entryPtr);
-		esif_link_list_node_remove(g_actMgr.actions, nodePtr);
-		g_actMgr.numActions--;
+		EsifActMgr_RemoveEntry_Locked(entryPtr, NULL);
 		esif_ccb_write_unlock(&g_actMgr.mgrLock);
 
 		EsifActMgr_DestroyEntry(entryPtr);
@@ -205,10 +226,10 @@ eEsifError EsifActMgr_GetNextAction(
 		iteratorPtr->ref_taken = ESIF_FALSE;
 	}
 
-	esif_ccb_write_lock(&g_actMgr.mgrLock);
+	esif_ccb_read_lock(&g_actMgr.mgrLock);
 
 	if (g_actMgr.actions == NULL) {
-		esif_ccb_write_unlock(&g_actMgr.mgrLock);
+		esif_ccb_read_unlock(&g_actMgr.mgrLock);
 		rc = ESIF_E_UNSPECIFIED;
 		goto exit;
 	}
@@ -247,7 +268,7 @@ eEsifError EsifActMgr_GetNextAction(
 		nextNodePtr = nextNodePtr->next_ptr;
 	}
 
-	esif_ccb_write_unlock(&g_actMgr.mgrLock);
+	esif_ccb_read_unlock(&g_actMgr.mgrLock);
 
 	if (iteratorPtr->type != 0) {
 		nextActPtr = EsifActMgr_GetAction(iteratorPtr->type);
@@ -288,9 +309,9 @@ eEsifError EsifActMgr_RegisterAction(
 		goto exit;
 	}
 
-	esif_ccb_write_lock(&g_actMgr.mgrLock);
+	esif_ccb_read_lock(&g_actMgr.mgrLock);
 	existingEntryPtr = EsifActMgr_GetActionEntry_Locked(actType);
-	esif_ccb_write_unlock(&g_actMgr.mgrLock);
+	esif_ccb_read_unlock(&g_actMgr.mgrLock);
 
 	if (existingEntryPtr != NULL) {
 		rc = ESIF_E_ACTION_ALREADY_STARTED;
@@ -325,7 +346,6 @@ eEsifError EsifActMgr_UnregisterAction(
 {
 	eEsifError rc = ESIF_OK;
 	enum esif_action_type actType = 0;
-	struct esif_link_list_node *nodePtr = NULL;
 	EsifActMgrEntryPtr entryPtr = NULL;
 
 	if (NULL == actIfacePtr) {
@@ -347,9 +367,7 @@ eEsifError EsifActMgr_UnregisterAction(
 		goto exit;
 	}
 
-	nodePtr = EsifActMgr_GetNodeFromEntry_Locked(entryPtr);
-	esif_link_list_node_remove(g_actMgr.actions, nodePtr);
-	g_actMgr.numActions--;
+	EsifActMgr_RemoveEntry_Locked(entryPtr, NULL);
 	esif_ccb_write_unlock(&g_actMgr.mgrLock);
 
 	EsifActMgr_DestroyEntry(entryPtr);
@@ -560,7 +578,6 @@ eEsifError EsifActMgr_StartUpe(
 {
 	eEsifError rc = ESIF_OK;
 	EsifActMgrEntryPtr existingEntryPtr = NULL;
-	struct esif_link_list_node *existingNodePtr = NULL;
 	EsifActMgrEntryPtr entryPtr = NULL;
 	GetIfaceFuncPtr getIfacePtr = NULL;
 	EsifActIface iface = {0};
@@ -573,9 +590,9 @@ eEsifError EsifActMgr_StartUpe(
 	}
 
 	/* Check to see if the action is already running only one instance per action allowed */
-	esif_ccb_write_lock(&g_actMgr.mgrLock);
+	esif_ccb_read_lock(&g_actMgr.mgrLock);
 	existingEntryPtr = EsifActMgr_GetActEntryByLibname_Locked(upeName);
-	esif_ccb_write_unlock(&g_actMgr.mgrLock);
+	esif_ccb_read_unlock(&g_actMgr.mgrLock);
 	if (existingEntryPtr != NULL) {
 		rc = ESIF_E_ACTION_ALREADY_STARTED;
 		goto exit;
@@ -623,9 +640,7 @@ eEsifError EsifActMgr_StartUpe(
 	existingEntryPtr = EsifActMgr_GetActionEntry_Locked(actType);
 
 	if (existingEntryPtr != NULL) {
-		existingNodePtr = EsifActMgr_GetNodeFromEntry_Locked(existingEntryPtr);
-		esif_link_list_node_remove(g_actMgr.actions, existingNodePtr);
-		g_actMgr.numActions--;
+		EsifActMgr_RemoveEntry_Locked(existingEntryPtr, NULL);
 	}
 
 	esif_ccb_write_unlock(&g_actMgr.mgrLock);
@@ -680,8 +695,7 @@ static eEsifError EsifActMgr_StopUnusedUpes()
 			if (curEntryPtr && EsifAct_IsPlugin(curEntryPtr->actPtr) && !EsifUpPm_IsActionUsedByParticipants(curEntryPtr->type)) {
 				ESIF_TRACE_DEBUG("Stopping Action: %s\n", curEntryPtr->libName);
 
-				esif_link_list_node_remove(g_actMgr.actions, curNodePtr);
-				g_actMgr.numActions--;
+				EsifActMgr_RemoveEntry_Locked(curEntryPtr, curNodePtr);
 				break;
 			}
 			curNodePtr = curNodePtr->next_ptr;
@@ -706,7 +720,6 @@ eEsifError EsifActMgr_StopUpe(EsifString upeName)
 {
 	eEsifError rc = ESIF_OK;
 	EsifActMgrEntryPtr entryPtr = NULL;
-	struct esif_link_list_node *nodePtr = NULL;
 	enum esif_action_type actType = 0;
 	EsifData eventData = { ESIF_DATA_UINT32, &actType, sizeof(actType), sizeof(actType) };
 
@@ -725,9 +738,7 @@ eEsifError EsifActMgr_StopUpe(EsifString upeName)
 		goto exit;
 	}
 
-	nodePtr = EsifActMgr_GetNodeFromEntry_Locked(entryPtr);
-	esif_link_list_node_remove(g_actMgr.actions, nodePtr);
-	g_actMgr.numActions--;
+	EsifActMgr_RemoveEntry_Locked(entryPtr, NULL);
 
 	esif_ccb_write_unlock(&g_actMgr.mgrLock);
 
@@ -875,6 +886,11 @@ static eEsifError EsifActMgr_AddEntry(
 		goto exit;
 	}
 	g_actMgr.numActions++;
+
+	/* The list is searched from the front, so the new entry is now the first of its type */
+	if ((UInt32)entryPtr->type < ACT_MGR_TYPE_INDEX_SIZE) {
+		g_actMgr.typeIndex[entryPtr->type] = entryPtr;
+	}
 exit:
 	esif_ccb_write_unlock(&g_actMgr.mgrLock);
 	return rc;
@@ -908,6 +924,18 @@ exit:
 static EsifActMgrEntryPtr EsifActMgr_GetActionEntry_Locked(
 	enum esif_action_type type
 	)
+{
+	if ((UInt32)type < ACT_MGR_TYPE_INDEX_SIZE) {
+		return g_actMgr.typeIndex[type];
+	}
+	return EsifActMgr_FindActionEntry_Locked(type);
+}
+
+
+/* Searches the actions list; used for types that are not indexed and to rebuild the index */
+static EsifActMgrEntryPtr EsifActMgr_FindActionEntry_Locked(
+	enum esif_action_type type
+	)
 {
 	EsifActMgrEntryPtr entryPtr = NULL;
 	EsifActMgrEntryPtr curEntryPtr = NULL;
@@ -960,6 +988,33 @@ exit:
 }
 
 
+/* Removes an entry from the actions list and type index; nodePtr is optional */
+static void EsifActMgr_RemoveEntry_Locked(
+	EsifActMgrEntryPtr entryPtr,
+	struct esif_link_list_node *nodePtr
+	)
+{
+	if (NULL == entryPtr) {
+		goto exit;
+	}
+
+	if (NULL == nodePtr) {
+		nodePtr = EsifActMgr_GetNodeFromEntry_Locked(entryPtr);
+	}
+	if (nodePtr != NULL) {
+		esif_link_list_node_remove(g_actMgr.actions, nodePtr);
+		g_actMgr.numActions--;
+	}
+
+	if (((UInt32)entryPtr->type < ACT_MGR_TYPE_INDEX_SIZE) &&
+		(g_actMgr.typeIndex[entryPtr->type] == entryPtr)) {
+		g_actMgr.typeIndex[entryPtr->type] = EsifActMgr_FindActionEntry_Locked(entryPtr->type);
+	}
+exit:
+	return;
+}
+
+
 static struct esif_link_list_node *EsifActMgr_GetNodeFromEntry_Locked(
 	EsifActMgrEntryPtr entryPtr
 	)
@@ -1072,6 +1127,7 @@ void EsifActMgrExit()
 	esif_link_list_free_data_and_destroy(g_actMgr.loadedActions, NULL);
 	g_actMgr.loadedActions = NULL;
 
+	esif_ccb_memset(g_actMgr.typeIndex, 0, sizeof(g_actMgr.typeIndex));
 	esif_link_list_free_data_and_destroy(g_actMgr.actions, EsifActMgr_LLEntryDestroyCallback);
 	g_actMgr.actions = NULL;
 
@@ -1121,12 +1177,12 @@ static eEsifError ESIF_CALLCONV EsifActMgr_EventCallback(
 			ESIF_TRACE_INFO("Action unload request for %d\n", actionType);
 
 			// Get the library name of the UPE to unload based on action type
-			esif_ccb_write_lock(&g_actMgr.mgrLock);
+			esif_ccb_read_lock(&g_actMgr.mgrLock);
 			entryPtr = EsifActMgr_GetActionEntry_Locked(actionType);
 			if (entryPtr && entryPtr->libName) {
 				libName = esif_ccb_strdup(entryPtr->libName);
 			}
-			esif_ccb_write_unlock(&g_actMgr.mgrLock);
+			esif_ccb_read_unlock(&g_actMgr.mgrLock);
 
 			if (libName != NULL) {
 				ESIF_TRACE_INFO("Unloading UPE library %s\n", libName);
@@ -24,6 +24,7 @@
 #include "esif_uf_action_iface.h"
 
 #define ACT_MGR_ITERATOR_MARKER 'AMGR'
+#define ACT_MGR_TYPE_INDEX_SIZE 128 /* Action types below this value are indexed directly */
 
 typedef struct ActMgrIterator_s {
 	u32 marker;
@@ -51,6 +52,12 @@ typedef struct EsifActMgr_s {
 	UInt8 numActions;
 	EsifLinkListPtr actions;	/* EsifActMgrEntry items */
 
+	/*
+	 * First entry in the actions list for each type, so that looking up an action
+	 * for a primitive only needs a read lock and does not walk the list
+	 */
+	EsifActMgrEntryPtr typeIndex[ACT_MGR_TYPE_INDEX_SIZE];
+
 	EsifLinkListPtr possibleActions;/* EsifActMgrEntry items for delayed load */
 
 	/* The following are used to create dependent participants based on CPU arrival */
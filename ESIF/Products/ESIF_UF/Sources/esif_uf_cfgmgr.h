@@ -43,8 +43,9 @@ eEsifError EsifConfigGetSubKey(EsifDataPtr nameSpace, EsifDataPtr path, EsifData
 eEsifError EsifConfigSet(EsifDataPtr nameSpace, EsifDataPtr path, esif_flags_t flags, EsifDataPtr value);
 eEsifError EsifConfigDelete(EsifDataPtr nameSpace, EsifDataPtr path);
 
-/* Iterate Context type */
-typedef esif_string EsifConfigFindContext, *EsifConfigFindContextPtr;
+/* Iterate Context type (opaque cursor; NULL before FindFirst and after FindClose) */
+struct EsifConfigFindCursor_s;
+typedef struct EsifConfigFindCursor_s *EsifConfigFindContext, **EsifConfigFindContextPtr;
 
 /* Iterate First */
 eEsifError EsifConfigFindFirst(EsifDataPtr nameSpace, EsifDataPtr path, EsifDataPtr value, EsifConfigFindContextPtr context);
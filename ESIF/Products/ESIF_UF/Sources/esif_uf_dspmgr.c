@@ -853,12 +853,12 @@ static eEsifError esif_dsp_file_scan()
 	// 1. Load all EDP's in the DSP Configuration Namespace, if any exist
 	EsifDataPtr nameSpace = EsifData_CreateAs(ESIF_DATA_AUTO, namesp, 0, ESIFAUTOLEN);
 	EsifDataPtr key       = EsifData_CreateAs(ESIF_DATA_AUTO, NULL, ESIF_DATA_ALLOCATE, 0);
-	EsifDataPtr value     = EsifData_CreateAs(ESIF_DATA_AUTO, NULL, ESIF_DATA_ALLOCATE, 0);
 	EsifConfigFindContext context = NULL;
 
+	// Enumerate keys only; each EDP's value is loaded on demand by esif_dsp_entry_create
 	ESIF_TRACE_DEBUG("SCAN CONFIG For DSP Files NameSpace = %s, Pattern %s", namesp, pattern);
-	if (nameSpace != NULL && key != NULL && value != NULL &&
-		(rc = EsifConfigFindFirst(nameSpace, key, value, &context)) == ESIF_OK) {
+	if (nameSpace != NULL && key != NULL &&
+		(rc = EsifConfigFindFirst(nameSpace, key, NULL, &context)) == ESIF_OK) {
 		do {
 			// Load all keys from the DataVault with an ".edp" extension
 			if (key->data_len >= 5 && esif_ccb_stricmp(((StringPtr)(key->buf_ptr)) + key->data_len - 5, ".edp") == 0) {
@@ -874,8 +874,7 @@ static eEsifError esif_dsp_file_scan()
 				}
 			}
 			EsifData_Set(key, ESIF_DATA_AUTO, NULL, ESIF_DATA_ALLOCATE, 0);
-			EsifData_Set(value, ESIF_DATA_AUTO, NULL, ESIF_DATA_ALLOCATE, 0);
-		} while ((rc = EsifConfigFindNext(nameSpace, key, value, &context)) == ESIF_OK);
+		} while ((rc = EsifConfigFindNext(nameSpace, key, NULL, &context)) == ESIF_OK);
 
 		EsifConfigFindClose(&context);
 		if (rc == ESIF_E_ITERATION_DONE) {
@@ -884,7 +883,6 @@ static eEsifError esif_dsp_file_scan()
 	}
 	EsifData_Destroy(nameSpace);
 	EsifData_Destroy(key);
-	EsifData_Destroy(value);
 
 	// 2. Load all EDP's from the DSP folder, if any exist, except ones already loaded from DataBank
 	esif_build_path(path, MAX_PATH, ESIF_PATHTYPE_DSP, NULL, NULL);
@@ -111,6 +111,7 @@ esif_error_t EsifEventCache_GetValue(
 				if (curEntryPtr->data.buf_ptr != NULL) {
 					if (dataPtr->buf_len >= curEntryPtr->data.data_len) {
 						esif_ccb_memcpy(dataPtr->buf_ptr, curEntryPtr->data.buf_ptr, curEntryPtr->data.data_len);
+						dataPtr->type = curEntryPtr->data.type;
 						rc = ESIF_OK;
 					}
 					else {
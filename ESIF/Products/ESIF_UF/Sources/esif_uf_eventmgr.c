@@ -27,29 +27,103 @@
 #include "esif_uf_sensors.h"
 #include "esif_uf_ccb_timedwait.h"
 #include "esif_uf_event_cache.h"
+#include "esif_uf_cfgmgr.h"
+#include "esif_lib_databank.h"
 
 
-#define NUM_EVENT_LISTS 64
+#define NUM_EVENT_LISTS (MAX_ESIF_EVENT_ENUM_VALUE + 2) /* One list per known event type and one for all others */
+#define EVENT_MGR_OTHER_EVENTS_LIST (MAX_ESIF_EVENT_ENUM_VALUE + 1)
+#define EVENT_MGR_DOMAIN_KEY_MAX 0x10000 /* Greater than any UInt16 domain ID; used for snapshot searches */
 #define EVENT_MGR_FILTERED_EVENTS_PER_LINE 64
 #define EVENT_MGR_ITERATOR_MARKER 'UFEM'
 
 #define ESIF_INTR_STATE_DISABLE 0x0
 #define ESIF_INTR_STATE_ENABLE 0x1
 
+#define EVENT_MGR_QUEUE_ITEM_POOL_SIZE 256	/* Number of preallocated event queue items */
+#define EVENT_MGR_INLINE_DATA_SIZE 64		/* Payloads up to this size are stored in the queue item */
+#define EVENT_MGR_PAYLOAD_POOL_SIZE 32		/* Number of preallocated large payload buffers */
+#define EVENT_MGR_PAYLOAD_BLOCK_SIZE 1024	/* Size of each large payload buffer */
+
+#define EVENT_MGR_QUEUE_RING_SIZE 256		/* Ring buffer capacity of each shard queue; overflow goes to a list */
+#define EVENT_MGR_PRIORITY_RING_SIZE 32		/* Ring buffer capacity of each shard priority queue */
+#define EVENT_MGR_PARTICIPANT_SLOTS 64		/* Slots counting the queued events of each participant in a shard; must be a power of 2 */
+#define EVENT_MGR_LATENCY_BUCKET_BASE 10	/* Upper bound of the first latency bucket (usec); each bucket is 10x the previous */
+#define EVENT_MGR_COALESCE_BUCKETS 64		/* Hash buckets used to find pending coalescable events; must be a power of 2 */
+#define EVENT_MGR_NUM_COALESCE_TYPES (MAX_ESIF_EVENT_ENUM_VALUE + 1)
+#define EVENT_MGR_DISPATCH_STACK_ENTRIES 32	/* Observers matched per event before a dispatch buffer is allocated */
+
+typedef struct EsifEventQueueItem_s *EsifEventQueueItemPtr;
+
+
+/*
+ * Event queue shard; each shard is drained by its own worker thread.
+ * Statistics are only updated by the shard's worker, except for the queue
+ * high water mark which is updated by the signaling threads.
+ */
+typedef struct EsifEventMgr_Shard_s {
+	EsifQueuePtr queuePtr;
+	EsifQueuePtr priorityQueuePtr;	/* Latency sensitive events; drained before queuePtr */
+	atomic_t queuedEvents[EVENT_MGR_PARTICIPANT_SLOTS];	/* Events in queuePtr for each participant slot */
+	esif_thread_t thread;
+	esif_ccb_lock_t coalesceLock;	/* Protects coalesceBuckets; held while coalescable events are queued */
+	EsifEventQueueItemPtr coalesceBuckets[EVENT_MGR_COALESCE_BUCKETS];	/* Pending coalescable events */
+	esif_ccb_lock_t statsLock;
+	UInt32 queueHighWater;
+	UInt64 eventsDispatched;
+	UInt64 callbacksInvoked;
+	UInt64 dispatchTimeTotal;	/* usec */
+	UInt64 dispatchTimeMax;		/* usec */
+	UInt64 waitTimeHist[ESIF_UF_EVENT_LATENCY_BUCKETS];
+	UInt64 dispatchTimeHist[ESIF_UF_EVENT_LATENCY_BUCKETS];
+} EsifEventMgr_Shard;
+
+
+/*
+ * Fixed-capacity block pool used to avoid heap allocations in the event path.
+ * All blocks are carved from a single allocation made during init; requests
+ * that cannot be satisfied from the pool (pool exhausted or request larger
+ * than the block size) fall back to the overflow Memory Pool, if any, or the heap.
+ */
+typedef struct EsifEventMgr_Pool_s {
+	UInt8 *blocksPtr;		/* Contiguous storage for all blocks */
+	void **freeListPtr;		/* Stack of available blocks */
+	size_t blockSize;
+	UInt32 numBlocks;
+	UInt32 numFree;
+	UInt32 inUse;			/* Blocks currently allocated (pooled and heap) */
+	UInt32 highWater;
+	UInt64 hits;
+	UInt64 misses;
+	enum esif_mempool_type overflowPool;	/* Memory Pool for fixed-size overflow blocks or ESIF_MEMPOOL_TYPE_UF_MAX */
+	Bool isDestroyed;		/* Storage is released once the last outstanding pooled block is freed */
+	esif_ccb_lock_t lock;
+} EsifEventMgr_Pool;
+
+
+typedef struct EventMgrSnapshot_s *EventMgrSnapshotPtr;
 
 typedef struct EsifEventMgr_s {
 	EsifLinkListPtr observerLists[NUM_EVENT_LISTS];
+	EventMgrSnapshotPtr observerSnapshots[NUM_EVENT_LISTS]; /* Published dispatch snapshots of observerLists */
 	esif_ccb_lock_t listLock;
+	UInt64 nextObserverOrder;		/* Registration sequence of the next new observer entry */
 
 	EsifLinkListPtr garbageList;
 
-	EsifQueuePtr eventQueuePtr;
+	EsifEventMgr_Shard shards[ESIF_UF_EVENT_SHARDS_MAX];
+	UInt32 numWorkers;				/* Participant shards */
+	EsifEventMgr_Pool itemPool;		/* EsifEventQueueItem pool */
+	EsifEventMgr_Pool payloadPool;	/* Pool for payloads too large to be stored inline */
+	atomic64_t inlinePayloads;
+
+	UInt8 coalesceRules[EVENT_MGR_NUM_COALESCE_TYPES];	/* EsifEventCoalesceRule for each event type */
+	atomic64_t eventsMerged[EVENT_MGR_NUM_COALESCE_TYPES];
+	atomic64_t eventsDropped[EVENT_MGR_NUM_COALESCE_TYPES];
 
 	Bool eventQueueExitFlag;
 	Bool eventsDisabled;
 
-	esif_thread_t eventQueueThread;
-
 	UInt64 filteredEvents[(MAX_ESIF_EVENT_ENUM_VALUE / EVENT_MGR_FILTERED_EVENTS_PER_LINE) + 1];
 	Bool *cacheableEventListPtr;
 
@@ -83,12 +157,38 @@ typedef struct EventMgrEntry_s {
 										 * Expected to act as a context for the callback, an event observer identifier,
 										 * and to help uniquely identify an event observer while unregistering.
 										 */
-	atomic_t refCount;					/* Reference count */
-	Bool isInUse;						/* Indicates the event is being processed */
+	atomic_t refCount;					/* Registration reference count */
+	atomic_t holdCount;					/* References held by the observer list and dispatch snapshots */
+	UInt64 order;						/* Registration sequence; observers are called in this order */
+	Bool isEventEnabled;				/* Indicates the event was enabled and must be disabled on destruction */
 	Bool markedForDelete;				/* Indicates the event is marked for deletion */
+	esif_ccb_mutex_t callLock;			/* Serializes the calls made for this registration */
 } EventMgrEntry, *EventMgrEntryPtr;
 
 
+/*
+ * Immutable, reference counted snapshot of the observers for one event type.
+ * A new snapshot is published each time the observer list changes, so that
+ * the event thread only holds the list lock long enough to take a reference.
+ * Observers are grouped so that the entries for a given participant/domain
+ * are found without scanning every observer of the event type:
+ *   anyEntries     - Registered with EVENT_MGR_MATCH_ANY
+ *   primaryEntries - Registered for a primary participant (match any primary ID)
+ *   partEntries    - All others; sorted by participant and then domain
+ * Each snapshot holds a reference (holdCount) on all entries it contains.
+ */
+typedef struct EventMgrSnapshot_s {
+	atomic_t refCount;
+	UInt32 numAny;
+	UInt32 numPrimary;
+	UInt32 numPart;
+	EventMgrEntryPtr *anyEntries;
+	EventMgrEntryPtr *primaryEntries;
+	EventMgrEntryPtr *partEntries;
+	/* Entry pointers for all groups follow at this point */
+} EventMgrSnapshot;
+
+
 typedef struct EsifEventMgr_SynchronousEventContext_s {
 	Bool useComplete;
 	esif_ccb_event_t completionEvent;
@@ -103,7 +203,12 @@ typedef struct EsifEventQueueItem_s {
 	Bool isUnfiltered;
 	Bool useCachedData;
 	EsifEventMgr_SynchronousEventContext *syncContextPtr;
-}EsifEventQueueItem, *EsifEventQueueItemPtr;
+	UInt64 queuedTime;		/* Realtime clock ticks when queued */
+	UInt32 participantSlot;	/* Participant slot in the shard; see EsifEventMgr_QueueItem */
+	Bool isCoalescePending;	/* Item is in its shard's coalesce buckets */
+	struct EsifEventQueueItem_s *coalesceNextPtr;
+	UInt8 inlineData[EVENT_MGR_INLINE_DATA_SIZE]; /* Storage for small payloads */
+}EsifEventQueueItem;
 
 
 typedef struct EsifEventMgr_AppRemovalEntry_s {
@@ -114,6 +219,19 @@ typedef struct EsifEventMgr_AppRemovalEntry_s {
 
 /*
  * All event received are asynchronous and placed in an event queue to be handled by a worker thread.
+ * Events are sharded across a configurable number of worker queues by participant, so that a slow
+ * observer only delays later events routed to the same worker; events for a given participant are always
+ * handled in order.  LF events are routed by the UF participant they map to, so that they share a shard with
+ * the UF events for the same participant.  Latency sensitive events (temperature and fan speed threshold
+ * crossings) are placed in the shard's priority queue, which its worker drains first, unless an earlier event
+ * for the same participant is still queued; they then wait their turn behind it.
+ * Each observer registration is only ever called from one worker at a time, as observers such as the
+ * applications were written to be called by a single event thread; calls for different registrations may
+ * be made concurrently.
+ * Event types may be configured to be coalesced; an event of such a type is either merged into or dropped in
+ * favor of an event with the same type, participant and domain which is still pending in the same shard.
+ * Queue items (and payloads too large to be stored inline in an item) come from fixed-capacity pools
+ * allocated at init time; the heap is only used when a pool is exhausted.
  *
  * The manager maintains information on registered event "observers"
  * Interface:
@@ -121,8 +239,11 @@ typedef struct EsifEventMgr_AppRemovalEntry_s {
  *   EsifEventMgr_RegisterEventByType
  *   EsifEventMgr_UnregisterEventByType
  *
- * Event observer information is maintained as an array of linked lists with a list of observers the event types
- * There are 64 event lists (Information is placed in a given list given by the modulo 64 of the event type)
+ * Event observer information is maintained as an array of linked lists, one list per known event type, plus a
+ * single list for any event types beyond MAX_ESIF_EVENT_ENUM_VALUE.
+ * Each list has a published, read-only dispatch snapshot which groups the observers by participant and domain;
+ * the snapshot is rebuilt whenever its list changes.  The observers matching an event are called in the order in which
+ * they registered, as they were when each list was walked in full.
  * Event observers may register based on the event type or GUID.
  * EVENT_MGR_MATCH_ANY may be used as the participant ID during registration to observe events from all participants;
  * or if registration takes place before the participants are present. Must only be used for events which do not
@@ -131,9 +252,10 @@ typedef struct EsifEventMgr_AppRemovalEntry_s {
  * Locks are released before any calls outside the event manager which may result in obtaining other locks;
  * locks re-acquired upon return.
  * A reference count is kept for each observer; events are only sent to observers with a positive reference count
- * When the reference count reaches 0, the node is garbage collected
- * Before an observer is called, the reference count is incremented so that the node is not removed while in use;
- * the reference count is decrement upon return and the node is garbage collected if the reference count is then 0.
+ * When the reference count reaches 0, the node is removed from its list and marked for deletion.
+ * The list and each snapshot containing an observer hold a reference (holdCount) on it; the event thread takes a
+ * reference on the snapshot so that no lock is held while observers are called.  The observer is garbage collected
+ * once the last holdCount reference is released.
  * A single garbage collection linked list is maintained.  Any garbage nodes are moved to that list for destruction.
  * Any steps required to enable/disable an event, for example DPPE, will be performed during creation/destruction.
  * Simulation Support:
@@ -174,14 +296,40 @@ static eEsifError EsifEventMgr_ProcessEvent(
 	esif_handle_t participantId,
 	UInt16 domainId,
 	eEsifEventType eventType,
-	EsifDataPtr eventDataPtr
+	EsifDataPtr eventDataPtr,
+	UInt32 *numCalledPtr
 	);
 
 static eEsifError EsifEventMgr_EnableEvent(EventMgrEntryPtr entryPtr);
 static eEsifError EsifEventMgr_DisableEvent(EventMgrEntryPtr entryPtr);
 static eEsifError EsifEventMgr_MoveEntryToGarbage(EventMgrEntryPtr entryPtr);
+static size_t EsifEventMgr_GetListIndex(eEsifEventType eventType);
+static Bool EsifEventMgr_PutEntry_Locked(EventMgrEntryPtr entryPtr);
+static Bool EsifEventMgr_RemoveEntry_Locked(EsifLinkListPtr listPtr, EsifLinkListNodePtr nodePtr);
+static eEsifError EsifEventMgr_PublishSnapshot_Locked(size_t listIndex);
+static EventMgrSnapshotPtr EsifEventMgr_GetSnapshot(size_t listIndex);
+static Bool EsifEventMgr_ReleaseSnapshot(EventMgrSnapshotPtr snapPtr, Bool isLocked);
+static void EsifEventMgr_DestroyEntry(EventMgrEntryPtr entryPtr);
 static eEsifError EsifEventMgr_DumpGarbage();
 static void EsifEventMgr_QueueDestroyCallback(void *ctxPtr);
+static void EsifEventMgr_DestroyQueueItem(EsifEventQueueItemPtr queueEventPtr);
+static EsifEventMgr_Shard *EsifEventMgr_SelectShard(EsifEventQueueItemPtr queueEventPtr);
+static esif_error_t EsifEventMgr_EnqueueEvent(EsifEventMgr_Shard *shardPtr, EsifEventQueueItemPtr queueEventPtr, Bool *isCoalescedPtr);
+static esif_error_t EsifEventMgr_QueueItem(EsifEventMgr_Shard *shardPtr, EsifEventQueueItemPtr queueEventPtr);
+static void EsifEventMgr_RemovePendingEvent(EsifEventMgr_Shard *shardPtr, EsifEventQueueItemPtr queueEventPtr);
+static size_t EsifEventMgr_GetCoalesceBucket(EsifEventQueueItemPtr queueEventPtr);
+static void EsifEventMgr_MovePayload(EsifEventQueueItemPtr destPtr, EsifEventQueueItemPtr srcPtr);
+static void EsifEventMgr_LoadCoalesceRules(void);
+static UInt32 EsifEventMgr_GetConfiguredWorkers(void);
+static UInt32 EsifEventMgr_GetLatencyBucket(UInt64 usec);
+
+static esif_error_t EsifEventMgr_PoolCreate(EsifEventMgr_Pool *poolPtr, size_t blockSize, UInt32 numBlocks);
+static void EsifEventMgr_PoolDestroy(EsifEventMgr_Pool *poolPtr);
+static void EsifEventMgr_PoolReleaseStorage(EsifEventMgr_Pool *poolPtr);
+static void *EsifEventMgr_PoolAlloc(EsifEventMgr_Pool *poolPtr, size_t size);
+static void EsifEventMgr_PoolFree(EsifEventMgr_Pool *poolPtr, void *blockPtr);
+static void EsifEventMgr_PoolGetStats(EsifEventMgr_Pool *poolPtr, EsifEventMgr_PoolStats *statsPtr);
+static void EsifEventMgr_PoolResetStats(EsifEventMgr_Pool *poolPtr);
 static void EsifEventMgr_LLEntryDestroyCallback(void *dataPtr);
 
 static eEsifError ESIF_CALLCONV EsifEventMgr_SignalEvent_Local (
@@ -367,6 +515,9 @@ static eEsifError ESIF_CALLCONV EsifEventMgr_SignalEvent_Local(
 	eEsifError rc = ESIF_OK;
 	EsifEventQueueItemPtr queueEventPtr = NULL;
 	void *queueDataPtr = NULL;
+	EsifEventMgr_Shard *shardPtr = NULL;
+	UInt32 queueDepth = 0;
+	Bool isCoalesced = ESIF_FALSE;
 
 	/* Exit if filtered event */
 	if (isFilteredEvent && EsifEventMgr_IsEventFiltered(eventType)) {
@@ -374,19 +525,19 @@ static eEsifError ESIF_CALLCONV EsifEventMgr_SignalEvent_Local(
 		goto exit;
 	}
 
-	if (NULL == g_EsifEventMgr.eventQueuePtr) { /* Should never happen */
+	if (0 == g_EsifEventMgr.numWorkers) { /* Should never happen */
 		rc = ESIF_E_UNSPECIFIED;
 		goto exit;
 	}
 
-	queueEventPtr = esif_ccb_malloc(sizeof(*queueEventPtr));
+	queueEventPtr = EsifEventMgr_PoolAlloc(&g_EsifEventMgr.itemPool, sizeof(*queueEventPtr));
 	if (NULL == queueEventPtr) {
 		rc = ESIF_E_NO_MEMORY;
 		goto exit;
 	}
 	/*
 	* Make a copy of the data as the thread exposing it will continue and may
-	* destroy it
+	* destroy it.  Small payloads are stored inline in the queue item.
 	*/
 	if ((eventDataPtr != NULL) &&
 		(eventDataPtr->buf_ptr != NULL) &&
@@ -394,10 +545,16 @@ static eEsifError ESIF_CALLCONV EsifEventMgr_SignalEvent_Local(
 		(eventDataPtr->data_len > 0) &&
 		(eventDataPtr->buf_len >= eventDataPtr->data_len)) {
 
-		queueDataPtr = esif_ccb_malloc(eventDataPtr->data_len);
-		if (NULL == queueDataPtr) {
-			rc = ESIF_E_NO_MEMORY;
-			goto exit;
+		if (eventDataPtr->data_len <= sizeof(queueEventPtr->inlineData)) {
+			queueDataPtr = queueEventPtr->inlineData;
+			atomic64_inc(&g_EsifEventMgr.inlinePayloads);
+		}
+		else {
+			queueDataPtr = EsifEventMgr_PoolAlloc(&g_EsifEventMgr.payloadPool, eventDataPtr->data_len);
+			if (NULL == queueDataPtr) {
+				rc = ESIF_E_NO_MEMORY;
+				goto exit;
+			}
 		}
 
 		esif_ccb_memcpy(queueDataPtr, eventDataPtr->buf_ptr, eventDataPtr->data_len);
@@ -421,15 +578,33 @@ static eEsifError ESIF_CALLCONV EsifEventMgr_SignalEvent_Local(
 		domainId,
 		isLfEvent);
 
-	rc = esif_queue_enqueue(g_EsifEventMgr.eventQueuePtr, queueEventPtr);
+	shardPtr = EsifEventMgr_SelectShard(queueEventPtr);
+	queueEventPtr->queuedTime = esif_ccb_realtime_current().clockticks;
+
+	rc = EsifEventMgr_EnqueueEvent(shardPtr, queueEventPtr, &isCoalesced);
 	if (rc != ESIF_OK) {
 		goto exit;
 	}
+	if (isCoalesced) {
+		EsifEventMgr_DestroyQueueItem(queueEventPtr);
+		goto exit;
+	}
+
+	queueDepth = esif_queue_size(shardPtr->queuePtr) + esif_queue_size(shardPtr->priorityQueuePtr);
+	if (queueDepth > shardPtr->queueHighWater) {
+		esif_ccb_write_lock(&shardPtr->statsLock);
+		if (queueDepth > shardPtr->queueHighWater) {
+			shardPtr->queueHighWater = queueDepth;
+		}
+		esif_ccb_write_unlock(&shardPtr->statsLock);
+	}
 
 exit:
 	if (rc != ESIF_OK) {
-		esif_ccb_free(queueEventPtr);
-		esif_ccb_free(queueDataPtr);
+		if (queueEventPtr && (queueDataPtr != queueEventPtr->inlineData)) {
+			EsifEventMgr_PoolFree(&g_EsifEventMgr.payloadPool, queueDataPtr);
+		}
+		EsifEventMgr_PoolFree(&g_EsifEventMgr.itemPool, queueEventPtr);
 		if (syncContextPtr) {
 			/* Release synchronous waiter and destroy context if needed */
 			esif_ccb_event_set(&syncContextPtr->completionEvent);
@@ -440,22 +615,255 @@ exit:
 }
 
 
+/*
+ * Selects the shard for a queued event.  All events for a participant are
+ * routed to the same shard so that they are handled in order.  LF events are
+ * keyed by the UF participant they map to; the target of an LF event is still
+ * only determined once dequeued.  LF events for a participant which cannot be
+ * mapped yet (such as its creation) are keyed by the primary participant, as
+ * that is where participant creation events are sent.  The key also selects
+ * the participant slot of the event within the shard.
+ */
+static EsifEventMgr_Shard *EsifEventMgr_SelectShard(EsifEventQueueItemPtr queueEventPtr)
+{
+	esif_handle_t participantId = queueEventPtr->participantId;
+	UInt64 key = 0;
+
+	if (queueEventPtr->isLfEvent) {
+		if (EsifUpPm_MapLpidToParticipantInstance((u8)queueEventPtr->participantId, &participantId) != ESIF_OK) {
+			participantId = ESIF_HANDLE_PRIMARY_PARTICIPANT;
+		}
+	}
+
+	key = (UInt64)participantId;
+	key ^= (key >> 32);
+	queueEventPtr->participantSlot = (UInt32)((key / g_EsifEventMgr.numWorkers) & (EVENT_MGR_PARTICIPANT_SLOTS - 1));
+	return &g_EsifEventMgr.shards[key % g_EsifEventMgr.numWorkers];
+}
+
+
+/* Events which are placed in the priority queue when they would not overtake an event for the same participant */
+static Bool EsifEventMgr_IsPriorityEvent(eEsifEventType eventType)
+{
+	switch (eventType) {
+	case ESIF_EVENT_TEMP_THRESHOLD_CROSSED:
+	case ESIF_EVENT_FAN_SPEED_THRESHOLD_CROSSED:
+		return ESIF_TRUE;
+	default:
+		return ESIF_FALSE;
+	}
+}
+
+
+/*
+ * Places an event in its shard's queues.  A priority event only goes to the
+ * priority queue if no event for its participant slot is in the normal queue,
+ * so it never overtakes an earlier event for the same participant; participants
+ * which share a slot are simply not reordered.  Otherwise, or if the priority
+ * queue is full, the event goes to the normal queue.
+ */
+static esif_error_t EsifEventMgr_QueueItem(
+	EsifEventMgr_Shard *shardPtr,
+	EsifEventQueueItemPtr queueEventPtr
+	)
+{
+	esif_error_t rc = ESIF_OK;
+	atomic_t *queuedPtr = &shardPtr->queuedEvents[queueEventPtr->participantSlot];
+
+	if (EsifEventMgr_IsPriorityEvent(queueEventPtr->eventType) && (0 == atomic_read(queuedPtr))) {
+		rc = esif_queue_enqueue(shardPtr->priorityQueuePtr, queueEventPtr);
+		if (ESIF_OK == rc) {
+			/* The worker waits on the normal queue */
+			esif_queue_signal_event(shardPtr->queuePtr);
+			goto exit;
+		}
+	}
+
+	/* Counted before queuing, as the worker may dequeue the event immediately */
+	atomic_inc(queuedPtr);
+	rc = esif_queue_enqueue(shardPtr->queuePtr, queueEventPtr);
+	if (rc != ESIF_OK) {
+		atomic_dec(queuedPtr);
+	}
+exit:
+	return rc;
+}
+
+
+/* Hash of the coalescing key (event type, participant and domain) */
+static size_t EsifEventMgr_GetCoalesceBucket(EsifEventQueueItemPtr queueEventPtr)
+{
+	UInt64 hash = (UInt64)queueEventPtr->participantId ^ ((UInt64)queueEventPtr->eventType << 16) ^ queueEventPtr->domainId;
+
+	hash ^= (hash >> 32) ^ (hash >> 16);
+	return (size_t)(hash & (EVENT_MGR_COALESCE_BUCKETS - 1));
+}
+
+
+/*
+ * Queues an event in the given shard, applying any coalescing rule for the event type.
+ * If the event is merged into or dropped in favor of a pending event, isCoalescedPtr is
+ * set and the caller retains ownership of the (now unneeded) queue item.
+ */
+static esif_error_t EsifEventMgr_EnqueueEvent(
+	EsifEventMgr_Shard *shardPtr,
+	EsifEventQueueItemPtr queueEventPtr,
+	Bool *isCoalescedPtr
+	)
+{
+	esif_error_t rc = ESIF_OK;
+	EsifEventCoalesceRule rule = ESIF_EVENT_COALESCE_NONE;
+	EsifEventQueueItemPtr pendingPtr = NULL;
+	size_t bucket = 0;
+
+	*isCoalescedPtr = ESIF_FALSE;
+
+	if ((NULL == queueEventPtr->syncContextPtr) && ((UInt32)queueEventPtr->eventType < EVENT_MGR_NUM_COALESCE_TYPES)) {
+		rule = (EsifEventCoalesceRule)g_EsifEventMgr.coalesceRules[queueEventPtr->eventType];
+	}
+	if (ESIF_EVENT_COALESCE_NONE == rule) {
+		rc = EsifEventMgr_QueueItem(shardPtr, queueEventPtr);
+		goto exit;
+	}
+
+	bucket = EsifEventMgr_GetCoalesceBucket(queueEventPtr);
+
+	/* The lock is held while queuing so that a pending event is always in the queue */
+	esif_ccb_write_lock(&shardPtr->coalesceLock);
+
+	for (pendingPtr = shardPtr->coalesceBuckets[bucket]; pendingPtr != NULL; pendingPtr = pendingPtr->coalesceNextPtr) {
+		if ((pendingPtr->eventType == queueEventPtr->eventType) &&
+			(pendingPtr->participantId == queueEventPtr->participantId) &&
+			(pendingPtr->domainId == queueEventPtr->domainId) &&
+			(pendingPtr->isLfEvent == queueEventPtr->isLfEvent)) {
+			break;
+		}
+	}
+
+	if (pendingPtr != NULL) {
+		if (ESIF_EVENT_COALESCE_LATEST == rule) {
+			EsifEventMgr_MovePayload(pendingPtr, queueEventPtr);
+			pendingPtr->useCachedData = queueEventPtr->useCachedData;
+			/* Wait time is reported for the payload that is dispatched, so it starts from the latest arrival */
+			pendingPtr->queuedTime = queueEventPtr->queuedTime;
+			atomic64_inc(&g_EsifEventMgr.eventsMerged[queueEventPtr->eventType]);
+		}
+		else {
+			atomic64_inc(&g_EsifEventMgr.eventsDropped[queueEventPtr->eventType]);
+		}
+		*isCoalescedPtr = ESIF_TRUE;
+	}
+	else {
+		/* Mark the event pending before queuing, as a worker may dequeue it immediately */
+		queueEventPtr->coalesceNextPtr = shardPtr->coalesceBuckets[bucket];
+		queueEventPtr->isCoalescePending = ESIF_TRUE;
+		shardPtr->coalesceBuckets[bucket] = queueEventPtr;
+
+		rc = EsifEventMgr_QueueItem(shardPtr, queueEventPtr);
+		if (rc != ESIF_OK) {
+			shardPtr->coalesceBuckets[bucket] = queueEventPtr->coalesceNextPtr;
+			queueEventPtr->coalesceNextPtr = NULL;
+			queueEventPtr->isCoalescePending = ESIF_FALSE;
+		}
+	}
+
+	esif_ccb_write_unlock(&shardPtr->coalesceLock);
+exit:
+	return rc;
+}
+
+
+/*
+ * Removes a dequeued event from the pending coalescable events; must be called
+ * before the event payload is used so that it is no longer updated by merges
+ */
+static void EsifEventMgr_RemovePendingEvent(
+	EsifEventMgr_Shard *shardPtr,
+	EsifEventQueueItemPtr queueEventPtr
+	)
+{
+	EsifEventQueueItemPtr *linkPtr = NULL;
+
+	esif_ccb_write_lock(&shardPtr->coalesceLock);
+	linkPtr = &shardPtr->coalesceBuckets[EsifEventMgr_GetCoalesceBucket(queueEventPtr)];
+	while (*linkPtr != NULL) {
+		if (*linkPtr == queueEventPtr) {
+			*linkPtr = queueEventPtr->coalesceNextPtr;
+			break;
+		}
+		linkPtr = &(*linkPtr)->coalesceNextPtr;
+	}
+	queueEventPtr->coalesceNextPtr = NULL;
+	queueEventPtr->isCoalescePending = ESIF_FALSE;
+	esif_ccb_write_unlock(&shardPtr->coalesceLock);
+}
+
+
+/* Replaces the payload of a pending event with that of a new event; the new event is left without a payload */
+static void EsifEventMgr_MovePayload(
+	EsifEventQueueItemPtr destPtr,
+	EsifEventQueueItemPtr srcPtr
+	)
+{
+	if (destPtr->eventData.buf_ptr != destPtr->inlineData) {
+		EsifEventMgr_PoolFree(&g_EsifEventMgr.payloadPool, destPtr->eventData.buf_ptr);
+	}
+
+	destPtr->eventData = srcPtr->eventData;
+	if (srcPtr->eventData.buf_ptr == srcPtr->inlineData) {
+		esif_ccb_memcpy(destPtr->inlineData, srcPtr->inlineData, srcPtr->eventData.data_len);
+		destPtr->eventData.buf_ptr = destPtr->inlineData;
+	}
+	esif_ccb_memset(&srcPtr->eventData, 0, sizeof(srcPtr->eventData));
+}
+
+
+/* Returns the histogram bucket for a latency; bucket upper bounds are 10us, 100us, ... */
+static UInt32 EsifEventMgr_GetLatencyBucket(UInt64 usec)
+{
+	UInt32 bucket = 0;
+	UInt64 limit = EVENT_MGR_LATENCY_BUCKET_BASE;
+
+	while ((bucket < ESIF_UF_EVENT_LATENCY_BUCKETS - 1) && (usec >= limit)) {
+		bucket++;
+		limit *= 10;
+	}
+	return bucket;
+}
+
+
 static void *ESIF_CALLCONV EsifEventMgr_EventQueueThread(void *ctxPtr)
 {
 	esif_error_t rc = ESIF_OK;
+	EsifEventMgr_Shard *shardPtr = (EsifEventMgr_Shard *)ctxPtr;
 	EsifEventQueueItemPtr queueEventPtr = NULL;
 	esif_handle_t participantId = ESIF_INVALID_HANDLE;
 	EsifData cachedEventData = { ESIF_DATA_VOID, NULL, 0, 0 };
 	EsifData *dataPtr = NULL;
+	void *cacheBufPtr = NULL;
+	u32 cacheBufLen = 0;
+	UInt32 numCalled = 0;
+	UInt64 startTime = 0;
+	UInt64 waitTime = 0;
+	UInt64 dispatchTime = 0;
 
-	UNREFERENCED_PARAMETER(ctxPtr);
+	ESIF_ASSERT(shardPtr != NULL);
 
 	while(!g_EsifEventMgr.eventQueueExitFlag) {
 		rc = ESIF_OK;
-		queueEventPtr = esif_queue_pull(g_EsifEventMgr.eventQueuePtr);
-
+		queueEventPtr = esif_queue_dequeue(shardPtr->priorityQueuePtr);
 		if (NULL == queueEventPtr) {
-			continue;
+			queueEventPtr = esif_queue_pull(shardPtr->queuePtr);
+			if (NULL == queueEventPtr) {
+				continue;
+			}
+			atomic_dec(&shardPtr->queuedEvents[queueEventPtr->participantSlot]);
+		}
+		startTime = esif_ccb_realtime_current().clockticks;
+		numCalled = 0;
+
+		if (queueEventPtr->isCoalescePending) {
+			EsifEventMgr_RemovePendingEvent(shardPtr, queueEventPtr);
 		}
 
 		participantId = queueEventPtr->participantId;
@@ -478,7 +886,20 @@ static void *ESIF_CALLCONV EsifEventMgr_EventQueueThread(void *ctxPtr)
 		if (ESIF_OK == rc) {
 			dataPtr = &queueEventPtr->eventData;
 			if (queueEventPtr->useCachedData) {
-				rc = EsifEventCache_GetValueClone(queueEventPtr->eventType, &cachedEventData);
+				/* The cache buffer is reused between events and only grows when required */
+				cachedEventData.buf_ptr = cacheBufPtr;
+				cachedEventData.buf_len = cacheBufLen;
+				rc = EsifEventCache_GetValue(queueEventPtr->eventType, &cachedEventData);
+				if (ESIF_E_NEED_LARGER_BUFFER == rc) {
+					void *newBufPtr = esif_ccb_realloc(cacheBufPtr, cachedEventData.data_len);
+					if (newBufPtr) {
+						cacheBufPtr = newBufPtr;
+						cacheBufLen = cachedEventData.data_len;
+						cachedEventData.buf_ptr = cacheBufPtr;
+						cachedEventData.buf_len = cacheBufLen;
+						rc = EsifEventCache_GetValue(queueEventPtr->eventType, &cachedEventData);
+					}
+				}
 				if (ESIF_OK == rc) {
 					dataPtr = &cachedEventData;
 				}
@@ -490,38 +911,160 @@ static void *ESIF_CALLCONV EsifEventMgr_EventQueueThread(void *ctxPtr)
 			EsifEventMgr_ProcessEvent(participantId,
 				queueEventPtr->domainId,
 				queueEventPtr->eventType,
-				dataPtr);
+				dataPtr,
+				&numCalled);
 		}
 		/* Release any synchronous event waiters */
 		if (queueEventPtr->syncContextPtr) {
 			esif_ccb_event_set(&queueEventPtr->syncContextPtr->completionEvent);
 			DestroySynchronizationContext(queueEventPtr->syncContextPtr);
 		}
-		esif_ccb_free(cachedEventData.buf_ptr);
-		cachedEventData.buf_ptr = NULL;
-		esif_ccb_free(queueEventPtr->eventData.buf_ptr);
-		esif_ccb_free(queueEventPtr);
+
+		waitTime = (startTime > queueEventPtr->queuedTime) ? (startTime - queueEventPtr->queuedTime) / 1000 : 0;
+		dispatchTime = (esif_ccb_realtime_current().clockticks - startTime) / 1000;
+
+		esif_ccb_write_lock(&shardPtr->statsLock);
+		shardPtr->eventsDispatched++;
+		shardPtr->callbacksInvoked += numCalled;
+		shardPtr->dispatchTimeTotal += dispatchTime;
+		if (dispatchTime > shardPtr->dispatchTimeMax) {
+			shardPtr->dispatchTimeMax = dispatchTime;
+		}
+		shardPtr->waitTimeHist[EsifEventMgr_GetLatencyBucket(waitTime)]++;
+		shardPtr->dispatchTimeHist[EsifEventMgr_GetLatencyBucket(dispatchTime)]++;
+		esif_ccb_write_unlock(&shardPtr->statsLock);
+
+		EsifEventMgr_DestroyQueueItem(queueEventPtr);
 	}
-	esif_ccb_free(cachedEventData.buf_ptr);
+	esif_ccb_free(cacheBufPtr);
 	return 0;
 }
 
 
-static eEsifError EsifEventMgr_ProcessEvent(
+/* Binary search partEntries for the first entry not less than the given participant/domain key */
+static UInt32 EsifEventMgr_SnapshotLowerBound(
+	EventMgrSnapshotPtr snapPtr,
 	esif_handle_t participantId,
+	UInt32 domainKey
+	)
+{
+	UInt32 first = 0;
+	UInt32 count = snapPtr->numPart;
+	UInt32 step = 0;
+	UInt32 mid = 0;
+	EventMgrEntryPtr entryPtr = NULL;
+
+	while (count > 0) {
+		step = count / 2;
+		mid = first + step;
+		entryPtr = snapPtr->partEntries[mid];
+		if ((entryPtr->participantId < participantId) ||
+			((entryPtr->participantId == participantId) && ((UInt32)entryPtr->domainId < domainKey))) {
+			first = mid + 1;
+			count -= step + 1;
+		}
+		else {
+			count = step;
+		}
+	}
+	return first;
+}
+
+
+/*
+ * Appends the observers in the given range whose event type and domain match
+ * the event to the matched list, and returns the new number of matches
+ * Participant matching is implied by the snapshot group the entries are taken from
+ */
+static UInt32 EsifEventMgr_MatchEntries(
+	EventMgrEntryPtr *entries,
+	UInt32 numEntries,
 	UInt16 domainId,
 	eEsifEventType eventType,
+	EventMgrEntryPtr *matchedPtr,
+	UInt32 numMatched
+	)
+{
+	UInt32 i = 0;
+	EventMgrEntryPtr entryPtr = NULL;
+
+	for (i = 0; i < numEntries; i++) {
+		entryPtr = entries[i];
+		ESIF_ASSERT(entryPtr != NULL);
+
+		if ((eventType == entryPtr->fpcEvent.esif_event) &&
+			((entryPtr->domainId == domainId) || (entryPtr->domainId == EVENT_MGR_MATCH_ANY_DOMAIN) || (domainId == EVENT_MGR_DOMAIN_NA))) {
+			matchedPtr[numMatched++] = entryPtr;
+		}
+	}
+	return numMatched;
+}
+
+
+/*
+ * Calls the matched observers in registration order, skipping any which were
+ * unregistered by an earlier callback
+ */
+static UInt32 EsifEventMgr_DispatchToEntries(
+	EventMgrEntryPtr *entries,
+	UInt32 numEntries,
+	esif_handle_t participantId,
+	UInt16 domainId,
 	EsifDataPtr eventDataPtr
 	)
 {
-	eEsifError rc = ESIF_OK;
-	EsifLinkListPtr listPtr = NULL;
-	EsifLinkListNodePtr nodePtr = NULL;
-	EsifLinkListNodePtr nextNodePtr = NULL;
+	UInt32 numCalled = 0;
+	UInt32 i = 0;
+	UInt32 j = 0;
 	EventMgrEntryPtr entryPtr = NULL;
+
+	/* Entries within each snapshot group are already in registration order, so this only merges the groups */
+	for (i = 1; i < numEntries; i++) {
+		entryPtr = entries[i];
+		for (j = i; (j > 0) && (entries[j - 1]->order > entryPtr->order); j--) {
+			entries[j] = entries[j - 1];
+		}
+		entries[j] = entryPtr;
+	}
+
+	for (i = 0; i < numEntries; i++) {
+		entryPtr = entries[i];
+
+		if ((atomic_read(&entryPtr->refCount) > 0) &&
+			(!entryPtr->markedForDelete)) {
+
+			esif_ccb_mutex_lock(&entryPtr->callLock);
+			entryPtr->callback(entryPtr->context,
+				participantId,
+				domainId,
+				&entryPtr->fpcEvent,
+				eventDataPtr);
+			esif_ccb_mutex_unlock(&entryPtr->callLock);
+			numCalled++;
+		}
+	}
+	return numCalled;
+}
+
+
+static eEsifError EsifEventMgr_ProcessEvent(
+	esif_handle_t participantId,
+	UInt16 domainId,
+	eEsifEventType eventType,
+	EsifDataPtr eventDataPtr,
+	UInt32 *numCalledPtr
+	)
+{
+	eEsifError rc = ESIF_OK;
+	EventMgrSnapshotPtr snapPtr = NULL;
+	EventMgrEntryPtr matchedBuf[EVENT_MGR_DISPATCH_STACK_ENTRIES] = { 0 };
+	EventMgrEntryPtr *matchedPtr = matchedBuf;
+	UInt32 numEntries = 0;
+	UInt32 numMatched = 0;
+	UInt32 first = 0;
+	UInt32 last = 0;
+	UInt32 numCalled = 0;
 	char domain_str[8] = "";
-	atomic_t refCount = 0;
-	UInt8 shouldDumpGarbage = ESIF_FALSE;
 
 	UNREFERENCED_PARAMETER(domain_str);
 
@@ -571,71 +1114,62 @@ static eEsifError EsifEventMgr_ProcessEvent(
 			eventDataPtr
 		);
 	}
-	esif_ccb_write_lock(&g_EsifEventMgr.listLock);
-
 	/*
-	* Next, send the event to all registered listeners.
+	* Next, send the event to all registered listeners.  The snapshot keeps the
+	* observers alive while they are called, so no lock is held during the callbacks.
 	*/
-	listPtr = g_EsifEventMgr.observerLists[(unsigned)eventType % NUM_EVENT_LISTS];
-	if(NULL == listPtr) {
-		rc = ESIF_E_UNSPECIFIED;
-		esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
-		goto exit;
-	}
-
-	nodePtr = listPtr->head_ptr;
-	while (NULL != nodePtr) {
-		nextNodePtr = nodePtr->next_ptr;
-
-		entryPtr = (EventMgrEntryPtr)nodePtr->data_ptr;
-		ESIF_ASSERT(entryPtr != NULL);
-
-		if ((eventType == entryPtr->fpcEvent.esif_event) &&
-			((entryPtr->participantId == participantId) || (entryPtr->participantId == EVENT_MGR_MATCH_ANY) || (entryPtr->isParticipant0Id && EsifUpPm_IsPrimaryParticipantId(participantId))) &&
-			((entryPtr->domainId == domainId) || (entryPtr->domainId == EVENT_MGR_MATCH_ANY_DOMAIN) || (domainId == EVENT_MGR_DOMAIN_NA)) &&
-			(entryPtr->refCount > 0) &&
-			(!entryPtr->markedForDelete)) {
+	snapPtr = EsifEventMgr_GetSnapshot(EsifEventMgr_GetListIndex(eventType));
+	if (snapPtr != NULL) {
+		numEntries = snapPtr->numAny + snapPtr->numPrimary + snapPtr->numPart;
+		if (numEntries > EVENT_MGR_DISPATCH_STACK_ENTRIES) {
+			matchedPtr = (EventMgrEntryPtr *)esif_ccb_malloc(numEntries * sizeof(*matchedPtr));
+		}
+		if (NULL == matchedPtr) {
+			rc = ESIF_E_NO_MEMORY;
+			goto release;
+		}
 
-			/*
-			 * Increment the reference count so that the node is not removed while in use,
-			 * then release the lock so that we avoid a deadlock condition
-			 */
-			atomic_inc(&entryPtr->refCount);
-			entryPtr->isInUse = ESIF_TRUE;
-			esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
+		/* Observers registered for this specific participant (and domain) */
+		if (domainId == EVENT_MGR_DOMAIN_NA) {
+			first = EsifEventMgr_SnapshotLowerBound(snapPtr, participantId, 0);
+			last = EsifEventMgr_SnapshotLowerBound(snapPtr, participantId, EVENT_MGR_DOMAIN_KEY_MAX);
+			numMatched = EsifEventMgr_MatchEntries(&snapPtr->partEntries[first], last - first, domainId, eventType, matchedPtr, numMatched);
+		}
+		else {
+			first = EsifEventMgr_SnapshotLowerBound(snapPtr, participantId, domainId);
+			last = EsifEventMgr_SnapshotLowerBound(snapPtr, participantId, (UInt32)domainId + 1);
+			numMatched = EsifEventMgr_MatchEntries(&snapPtr->partEntries[first], last - first, domainId, eventType, matchedPtr, numMatched);
+
+			if (domainId != EVENT_MGR_MATCH_ANY_DOMAIN) {
+				first = EsifEventMgr_SnapshotLowerBound(snapPtr, participantId, EVENT_MGR_MATCH_ANY_DOMAIN);
+				last = EsifEventMgr_SnapshotLowerBound(snapPtr, participantId, (UInt32)EVENT_MGR_MATCH_ANY_DOMAIN + 1);
+				numMatched = EsifEventMgr_MatchEntries(&snapPtr->partEntries[first], last - first, domainId, eventType, matchedPtr, numMatched);
+			}
+		}
 
-			entryPtr->callback(entryPtr->context,
-				participantId,
-				domainId,
-				&entryPtr->fpcEvent,
-				eventDataPtr);
+		/* Observers registered for the primary participant */
+		if ((snapPtr->numPrimary > 0) && EsifUpPm_IsPrimaryParticipantId(participantId)) {
+			numMatched = EsifEventMgr_MatchEntries(snapPtr->primaryEntries, snapPtr->numPrimary, domainId, eventType, matchedPtr, numMatched);
+		}
 
-			/* 
-			 * Get the lock back and decrement the reference count.  Remove the node now
-			 * if the reference count is 0
-			 */
-			esif_ccb_write_lock(&g_EsifEventMgr.listLock);
+		/* Observers registered for any participant */
+		numMatched = EsifEventMgr_MatchEntries(snapPtr->anyEntries, snapPtr->numAny, domainId, eventType, matchedPtr, numMatched);
 
-			nextNodePtr = nodePtr->next_ptr;
+		numCalled = EsifEventMgr_DispatchToEntries(matchedPtr, numMatched, participantId, domainId, eventDataPtr);
 
-			entryPtr->isInUse = ESIF_FALSE;
-			refCount = atomic_dec(&entryPtr->refCount);
-			if ((refCount <= 0) || (entryPtr->markedForDelete)) {
-				EsifEventMgr_MoveEntryToGarbage(entryPtr);
-				esif_link_list_node_remove(listPtr, nodePtr);
-				shouldDumpGarbage = ESIF_TRUE;
-			}
+		if (matchedPtr != matchedBuf) {
+			esif_ccb_free(matchedPtr);
+		}
+release:
+		if (EsifEventMgr_ReleaseSnapshot(snapPtr, ESIF_FALSE)) {
+			EsifEventMgr_DumpGarbage();
 		}
-		nodePtr = nextNodePtr;
 	}
 
-	esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
-
-	if (shouldDumpGarbage) {
-		EsifEventMgr_DumpGarbage();
+	if (numCalledPtr) {
+		*numCalledPtr = numCalled;
 	}
 
-exit:
 	ESIF_TRACE_DEBUG("Event processing complete = %d\n", rc);
 	return rc;
 }
@@ -822,7 +1356,8 @@ static eEsifError ESIF_CALLCONV EsifEventMgr_UnregisterApp(
 	EsifLinkListNodePtr curNodePtr = NULL;
 	EsifLinkListNodePtr nextNodePtr = NULL;
 	EventMgrEntryPtr curEntryPtr = NULL;
-	UInt8 i = 0;
+	Bool isListChanged = ESIF_FALSE;
+	size_t i = 0;
 
 	ESIF_TRACE_DEBUG("Unregistering all events for app " ESIF_HANDLE_FMT "\n", context);
 
@@ -841,6 +1376,7 @@ static eEsifError ESIF_CALLCONV EsifEventMgr_UnregisterApp(
 		}
 
 		/* Find the matching entry */
+		isListChanged = ESIF_FALSE;
 		curNodePtr = listPtr->head_ptr;
 		while (curNodePtr != NULL) {
 			nextNodePtr = curNodePtr->next_ptr; // Get next ptr now as the current node may be removed below
@@ -849,14 +1385,14 @@ static eEsifError ESIF_CALLCONV EsifEventMgr_UnregisterApp(
 			if ((curEntryPtr->callback == eventCallback) &&
 				(curEntryPtr->context == context)) {
 
-				curEntryPtr->markedForDelete = ESIF_TRUE;
-				if (!curEntryPtr->isInUse) {
-					EsifEventMgr_MoveEntryToGarbage(curEntryPtr);
-					esif_link_list_node_remove(listPtr, curNodePtr);
-				}
+				EsifEventMgr_RemoveEntry_Locked(listPtr, curNodePtr);
+				isListChanged = ESIF_TRUE;
 			}
 			curNodePtr = nextNodePtr;
 		}
+		if (isListChanged) {
+			EsifEventMgr_PublishSnapshot_Locked(i);
+		}
 	}
 
 	esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
@@ -907,13 +1443,15 @@ static eEsifError EsifEventMgr_AddEntry(
 	EventMgrEntryPtr curEntryPtr = NULL;
 	EventMgrEntryPtr newEntryPtr = NULL;
 	atomic_t refCount = 1;
+	size_t listIndex = 0;
 
 	ESIF_ASSERT(fpcEventPtr != NULL);
 	ESIF_ASSERT(eventCallback != NULL);
 
 	esif_ccb_write_lock(&g_EsifEventMgr.listLock);
 
-	listPtr = g_EsifEventMgr.observerLists[fpcEventPtr->esif_event % NUM_EVENT_LISTS];
+	listIndex = EsifEventMgr_GetListIndex(fpcEventPtr->esif_event);
+	listPtr = g_EsifEventMgr.observerLists[listIndex];
 	if(NULL == listPtr) {
 		rc = ESIF_E_UNSPECIFIED;
 		esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
@@ -964,29 +1502,40 @@ static eEsifError EsifEventMgr_AddEntry(
 	newEntryPtr->domainId = domainId;
 	newEntryPtr->participantId = participantId;
 	newEntryPtr->refCount = refCount;
+	newEntryPtr->holdCount = 1; /* Observer list reference */
 	esif_ccb_memcpy(&newEntryPtr->fpcEvent, fpcEventPtr, sizeof(newEntryPtr->fpcEvent));
 	newEntryPtr->isParticipant0Id = EsifUpPm_IsPrimaryParticipantId(participantId);
+	esif_ccb_mutex_init(&newEntryPtr->callLock);
 
 	nodePtr = esif_link_list_create_node(newEntryPtr);
 	if (NULL == nodePtr) {
+		esif_ccb_mutex_uninit(&newEntryPtr->callLock);
+		esif_ccb_free(newEntryPtr);
 		rc = ESIF_E_NO_MEMORY;
 		goto exit;
 	}
 	
 	esif_ccb_write_lock(&g_EsifEventMgr.listLock);
+	newEntryPtr->order = g_EsifEventMgr.nextObserverOrder++;
 	esif_link_list_add_node_at_back(listPtr, nodePtr);
+	rc = EsifEventMgr_PublishSnapshot_Locked(listIndex);
 	esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
 
-	rc = EsifEventMgr_EnableEvent(newEntryPtr);
-
-exit:
-	if (ESIF_OK != rc) {
+	if (ESIF_OK == rc) {
+		rc = EsifEventMgr_EnableEvent(newEntryPtr);
+	}
+	if (ESIF_OK == rc) {
+		newEntryPtr->isEventEnabled = ESIF_TRUE;
+	}
+	else {
+		/* The entry is destroyed once released by any dispatch snapshots */
 		esif_ccb_write_lock(&g_EsifEventMgr.listLock);
-		esif_link_list_node_remove(listPtr, nodePtr);
+		EsifEventMgr_RemoveEntry_Locked(listPtr, nodePtr);
+		EsifEventMgr_PublishSnapshot_Locked(listIndex);
 		esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
-		esif_ccb_free(newEntryPtr);
+		EsifEventMgr_DumpGarbage();
 	}
-
+exit:
 	return rc;
 }
 
@@ -1004,13 +1553,15 @@ static eEsifError EsifEventMgr_ReleaseEntry(
 	EsifLinkListNodePtr nodePtr = NULL;
 	EventMgrEntryPtr curEntryPtr = NULL;
 	atomic_t refCount = -1;
+	size_t listIndex = 0;
 
 	ESIF_ASSERT(eventCallback != NULL);
 	ESIF_ASSERT(fpcEventPtr != NULL);
 
 	esif_ccb_write_lock(&g_EsifEventMgr.listLock);
 
-	listPtr = g_EsifEventMgr.observerLists[fpcEventPtr->esif_event % NUM_EVENT_LISTS];
+	listIndex = EsifEventMgr_GetListIndex(fpcEventPtr->esif_event);
+	listPtr = g_EsifEventMgr.observerLists[listIndex];
 	if(NULL == listPtr) {
 		rc = ESIF_E_UNSPECIFIED;
 		goto exit;
@@ -1033,8 +1584,8 @@ static eEsifError EsifEventMgr_ReleaseEntry(
 	if (nodePtr != NULL) {
 		refCount = atomic_dec(&curEntryPtr->refCount);
 		if ((refCount <= 0) || (curEntryPtr->markedForDelete)) {
-			EsifEventMgr_MoveEntryToGarbage(curEntryPtr);
-			esif_link_list_node_remove(listPtr, nodePtr);
+			EsifEventMgr_RemoveEntry_Locked(listPtr, nodePtr);
+			EsifEventMgr_PublishSnapshot_Locked(listIndex);
 		}
 		goto exit;
 	}
@@ -1162,7 +1713,7 @@ Bool EsifEventMgr_IsEventRegistered(
 	EventMgrEntryPtr entryPtr = NULL;
 
 	esif_ccb_read_lock(&g_EsifEventMgr.listLock);
-	listPtr = g_EsifEventMgr.observerLists[eventType % NUM_EVENT_LISTS];
+	listPtr = g_EsifEventMgr.observerLists[EsifEventMgr_GetListIndex(eventType)];
 	if (NULL == listPtr) {
 		goto exit;
 	}
@@ -1239,11 +1790,11 @@ esif_error_t EsifEventMgr_GetNextEvent(
 
 		eventType = iterPtr->eventType;
 
-		esif_ccb_write_lock(&g_EsifEventMgr.listLock);
+		esif_ccb_read_lock(&g_EsifEventMgr.listLock);
 
 		while (eventType <= MAX_ESIF_EVENT_ENUM_VALUE) {
 
-			listPtr = g_EsifEventMgr.observerLists[(unsigned)eventType % NUM_EVENT_LISTS];
+			listPtr = g_EsifEventMgr.observerLists[EsifEventMgr_GetListIndex(eventType)];
 			if (NULL == listPtr) {
 				rc = ESIF_E_UNSPECIFIED;
 				goto lockExit;
@@ -1293,7 +1844,7 @@ esif_error_t EsifEventMgr_GetNextEvent(
 		rc = ESIF_E_ITERATION_DONE;
 
 lockExit:
-		esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
+		esif_ccb_read_unlock(&g_EsifEventMgr.listLock);
 	}
 exit:
 	return rc;
@@ -1417,7 +1968,10 @@ static void EsifEventMgr_UnregisterEvents(void)
 eEsifError EsifEventMgr_Init(void)
 {
 	eEsifError rc = ESIF_OK;
-	UInt8 i;
+	size_t i;
+	size_t numShards = 0;
+	EsifEventMgr_Shard *shardPtr = NULL;
+	char queueName[ESIF_QUEUE_NAME_LEN] = { 0 };
 
 	ESIF_TRACE_ENTRY_INFO();
 
@@ -1425,7 +1979,12 @@ eEsifError EsifEventMgr_Init(void)
 	esif_ccb_lock_init(&g_EsifEventMgr.appUnregisterListLock);
 	esif_ccb_lock_init(&g_EsifEventMgr.synchronousEventLock);
 	esif_ccb_lock_init(&g_EsifEventMgr.eventRegistrationLock);
-
+	esif_ccb_lock_init(&g_EsifEventMgr.itemPool.lock);
+	esif_ccb_lock_init(&g_EsifEventMgr.payloadPool.lock);
+	for (i = 0; i < ESIF_UF_EVENT_SHARDS_MAX; i++) {
+		esif_ccb_lock_init(&g_EsifEventMgr.shards[i].statsLock);
+		esif_ccb_lock_init(&g_EsifEventMgr.shards[i].coalesceLock);
+	}
 
 	for (i = 0; i < NUM_EVENT_LISTS; i++) {
 		g_EsifEventMgr.observerLists[i] = esif_link_list_create();
@@ -1435,23 +1994,53 @@ eEsifError EsifEventMgr_Init(void)
 		}
 	}
 
-	g_EsifEventMgr.eventQueuePtr = esif_queue_create(ESIF_UF_EVENT_QUEUE_SIZE, ESIF_UF_EVENT_QUEUE_NAME, ESIF_UF_EVENT_QUEUE_TIMEOUT);
-	g_EsifEventMgr.garbageList = esif_link_list_create();
-	g_EsifEventMgr.appUnregisterList = esif_link_list_create();
-
-	if ((NULL == g_EsifEventMgr.eventQueuePtr) ||
-		(NULL == g_EsifEventMgr.garbageList) ||
-		(NULL == g_EsifEventMgr.appUnregisterList)) {
-		rc = ESIF_E_NO_MEMORY;
+	rc = EsifEventMgr_PoolCreate(&g_EsifEventMgr.itemPool, sizeof(EsifEventQueueItem), EVENT_MGR_QUEUE_ITEM_POOL_SIZE);
+	if (rc != ESIF_OK) {
+		goto exit;
+	}
+	esif_ccb_mempool_create(ESIF_MEMPOOL_TYPE_EVENT, ESIF_MEMPOOL_FW_QUEUE, sizeof(EsifEventQueueItem));
+	g_EsifEventMgr.itemPool.overflowPool = ESIF_MEMPOOL_TYPE_EVENT;
+
+	rc = EsifEventMgr_PoolCreate(&g_EsifEventMgr.payloadPool, EVENT_MGR_PAYLOAD_BLOCK_SIZE, EVENT_MGR_PAYLOAD_POOL_SIZE);
+	if (rc != ESIF_OK) {
+		goto exit;
+	}
+
+	g_EsifEventMgr.garbageList = esif_link_list_create();
+	g_EsifEventMgr.appUnregisterList = esif_link_list_create();
+
+	if ((NULL == g_EsifEventMgr.garbageList) ||
+		(NULL == g_EsifEventMgr.appUnregisterList)) {
+		rc = ESIF_E_NO_MEMORY;
 		goto exit;
 	}
 
 	g_EsifEventMgr.delayedAppUnregistrationEnabled = ESIF_TRUE;
 	g_EsifEventMgr.delayAppUnregistration = ESIF_FALSE;
 
-	rc = esif_ccb_thread_create(&g_EsifEventMgr.eventQueueThread, EsifEventMgr_EventQueueThread, NULL);
-	if (rc != ESIF_OK) {
-		goto exit;
+	EsifEventMgr_LoadCoalesceRules();
+
+	/* Create the worker shards */
+	numShards = EsifEventMgr_GetConfiguredWorkers();
+	for (i = 0; i < numShards; i++) {
+		shardPtr = &g_EsifEventMgr.shards[i];
+		esif_ccb_sprintf(sizeof(queueName), queueName, "%s%u", ESIF_UF_EVENT_QUEUE_NAME, (unsigned int)i);
+		shardPtr->queuePtr = esif_queue_create_ring(ESIF_UF_EVENT_QUEUE_SIZE, queueName, ESIF_UF_EVENT_QUEUE_TIMEOUT, EVENT_MGR_QUEUE_RING_SIZE);
+		esif_ccb_sprintf(sizeof(queueName), queueName, "%sPri%u", ESIF_UF_EVENT_QUEUE_NAME, (unsigned int)i);
+		shardPtr->priorityQueuePtr = esif_queue_create_ring(EVENT_MGR_PRIORITY_RING_SIZE, queueName, ESIF_UF_EVENT_QUEUE_TIMEOUT, EVENT_MGR_PRIORITY_RING_SIZE);
+		if ((NULL == shardPtr->queuePtr) || (NULL == shardPtr->priorityQueuePtr)) {
+			rc = ESIF_E_NO_MEMORY;
+			goto exit;
+		}
+	}
+	g_EsifEventMgr.numWorkers = (UInt32)numShards;
+
+	for (i = 0; i < numShards; i++) {
+		shardPtr = &g_EsifEventMgr.shards[i];
+		rc = esif_ccb_thread_create(&shardPtr->thread, EsifEventMgr_EventQueueThread, shardPtr);
+		if (rc != ESIF_OK) {
+			goto exit;
+		}
 	}
 
 	g_EsifEventMgr.cacheableEventListPtr = (Bool *)esif_ccb_malloc(MAX_ESIF_EVENT_ENUM_VALUE * sizeof(*g_EsifEventMgr.cacheableEventListPtr));
@@ -1460,7 +2049,7 @@ eEsifError EsifEventMgr_Init(void)
 		goto exit;
 	}
 	for (i = 0; i < MAX_ESIF_EVENT_ENUM_VALUE; i++) {
-		g_EsifEventMgr.cacheableEventListPtr[i] = EsifEventCache_IsEventCacheable(i);
+		g_EsifEventMgr.cacheableEventListPtr[i] = EsifEventCache_IsEventCacheable((esif_event_type_t)i);
 	}
 exit:
 	if (rc != ESIF_OK) {
@@ -1483,7 +2072,7 @@ esif_error_t EsifEventMgr_Start(void)
 
 void EsifEventMgr_Exit(void)
 {
-	UInt8 i;
+	size_t i;
 	EsifLinkListPtr listPtr = NULL;
 
 	ESIF_TRACE_ENTRY_INFO();
@@ -1501,6 +2090,10 @@ void EsifEventMgr_Exit(void)
 	esif_ccb_write_lock(&g_EsifEventMgr.listLock);
 
 	for (i = 0; i < NUM_EVENT_LISTS; i++) {
+		/* The event thread is stopped, so the list holds the only remaining entry references */
+		EsifEventMgr_ReleaseSnapshot(g_EsifEventMgr.observerSnapshots[i], ESIF_TRUE);
+		g_EsifEventMgr.observerSnapshots[i] = NULL;
+
 		listPtr = g_EsifEventMgr.observerLists[i];
 		esif_link_list_free_data_and_destroy(listPtr, EsifEventMgr_LLEntryDestroyCallback);
 		g_EsifEventMgr.observerLists[i] = NULL;
@@ -1508,11 +2101,21 @@ void EsifEventMgr_Exit(void)
 
 	esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
 
-	/* Destroy the event thread */
+	/* Event threads should already be destroyed in the disable func. Destroy the queues */
+	g_EsifEventMgr.numWorkers = 0;
+	for (i = 0; i < ESIF_UF_EVENT_SHARDS_MAX; i++) {
+		esif_ccb_write_lock(&g_EsifEventMgr.shards[i].coalesceLock);
+		esif_queue_destroy(g_EsifEventMgr.shards[i].queuePtr, EsifEventMgr_QueueDestroyCallback);
+		g_EsifEventMgr.shards[i].queuePtr = NULL;
+		esif_queue_destroy(g_EsifEventMgr.shards[i].priorityQueuePtr, EsifEventMgr_QueueDestroyCallback);
+		g_EsifEventMgr.shards[i].priorityQueuePtr = NULL;
+		esif_ccb_memset(g_EsifEventMgr.shards[i].coalesceBuckets, 0, sizeof(g_EsifEventMgr.shards[i].coalesceBuckets));
+		esif_ccb_write_unlock(&g_EsifEventMgr.shards[i].coalesceLock);
+	}
 
-	/* Event thread should already be destroyed in the disable func. Destroy the queue */
-	esif_queue_destroy(g_EsifEventMgr.eventQueuePtr, EsifEventMgr_QueueDestroyCallback);
-	g_EsifEventMgr.eventQueuePtr = NULL;
+	/* Release the queue item pools once all queued items are destroyed */
+	EsifEventMgr_PoolDestroy(&g_EsifEventMgr.payloadPool);
+	EsifEventMgr_PoolDestroy(&g_EsifEventMgr.itemPool);
 
 	/* Release the cacheable event list */
 	esif_ccb_free(g_EsifEventMgr.cacheableEventListPtr);
@@ -1534,19 +2137,31 @@ void EsifEventMgr_Exit(void)
 	esif_ccb_lock_uninit(&g_EsifEventMgr.synchronousEventLock);
 	esif_ccb_lock_uninit(&g_EsifEventMgr.listLock);
 	esif_ccb_lock_uninit(&g_EsifEventMgr.appUnregisterListLock);
-	
+	esif_ccb_lock_uninit(&g_EsifEventMgr.itemPool.lock);
+	esif_ccb_lock_uninit(&g_EsifEventMgr.payloadPool.lock);
+	for (i = 0; i < ESIF_UF_EVENT_SHARDS_MAX; i++) {
+		esif_ccb_lock_uninit(&g_EsifEventMgr.shards[i].statsLock);
+		esif_ccb_lock_uninit(&g_EsifEventMgr.shards[i].coalesceLock);
+	}
+
 
 	ESIF_TRACE_EXIT_INFO();
 }
 
 void EsifEventMgr_Disable(void)
 {
+	size_t i;
+
 	ESIF_TRACE_ENTRY_INFO();
 
-	/* Release and destroy the event thread */
+	/* Release and destroy the event threads */
 	g_EsifEventMgr.eventQueueExitFlag = ESIF_TRUE;
-	esif_queue_signal_event(g_EsifEventMgr.eventQueuePtr);
-	esif_ccb_thread_join(&g_EsifEventMgr.eventQueueThread);
+	for (i = 0; i < ESIF_UF_EVENT_SHARDS_MAX; i++) {
+		esif_queue_signal_event(g_EsifEventMgr.shards[i].queuePtr);
+	}
+	for (i = 0; i < ESIF_UF_EVENT_SHARDS_MAX; i++) {
+		esif_ccb_thread_join(&g_EsifEventMgr.shards[i].thread);
+	}
 	g_EsifEventMgr.eventsDisabled = ESIF_TRUE;
 
 	ESIF_TRACE_EXIT_INFO();
@@ -1591,8 +2206,7 @@ static eEsifError EsifEventMgr_DumpGarbage()
 		/* remove the node first so that it isn't considered active while we disable events */
 		esif_link_list_node_remove(listPtr, nodePtr); 
 		esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
-		EsifEventMgr_DisableEvent(entryPtr);
-		esif_ccb_free(entryPtr);
+		EsifEventMgr_DestroyEntry(entryPtr);
 		esif_ccb_write_lock(&g_EsifEventMgr.listLock);
 
 		nodePtr = listPtr->head_ptr;
@@ -1606,26 +2220,661 @@ exit:
 
 static void EsifEventMgr_QueueDestroyCallback(void *ctxPtr)
 {
-	EsifEventQueueItemPtr queueEventPtr = (EsifEventQueueItemPtr)ctxPtr;
+	EsifEventMgr_DestroyQueueItem((EsifEventQueueItemPtr)ctxPtr);
+}
+
+
+static void EsifEventMgr_DestroyQueueItem(EsifEventQueueItemPtr queueEventPtr)
+{
+	if (queueEventPtr != NULL) {
+		if (queueEventPtr->eventData.buf_ptr != queueEventPtr->inlineData) {
+			EsifEventMgr_PoolFree(&g_EsifEventMgr.payloadPool, queueEventPtr->eventData.buf_ptr);
+		}
+		EsifEventMgr_PoolFree(&g_EsifEventMgr.itemPool, queueEventPtr);
+	}
+}
+
+
+static esif_error_t EsifEventMgr_PoolCreate(
+	EsifEventMgr_Pool *poolPtr,
+	size_t blockSize,
+	UInt32 numBlocks
+	)
+{
+	esif_error_t rc = ESIF_OK;
+	UInt32 i = 0;
+
+	ESIF_ASSERT(poolPtr != NULL);
+
+	/* Keep each block pointer-aligned */
+	blockSize = (blockSize + sizeof(void *) - 1) & ~(sizeof(void *) - 1);
+
+	poolPtr->blocksPtr = (UInt8 *)esif_ccb_malloc(blockSize * numBlocks);
+	poolPtr->freeListPtr = (void **)esif_ccb_malloc(sizeof(*poolPtr->freeListPtr) * numBlocks);
+	if ((NULL == poolPtr->blocksPtr) || (NULL == poolPtr->freeListPtr)) {
+		esif_ccb_free(poolPtr->blocksPtr);
+		esif_ccb_free(poolPtr->freeListPtr);
+		poolPtr->blocksPtr = NULL;
+		poolPtr->freeListPtr = NULL;
+		rc = ESIF_E_NO_MEMORY;
+		goto exit;
+	}
+
+	poolPtr->blockSize = blockSize;
+	poolPtr->numBlocks = numBlocks;
+	poolPtr->overflowPool = ESIF_MEMPOOL_TYPE_UF_MAX;
+	poolPtr->isDestroyed = ESIF_FALSE;
+	for (i = 0; i < numBlocks; i++) {
+		poolPtr->freeListPtr[i] = poolPtr->blocksPtr + ((size_t)(numBlocks - i - 1) * blockSize);
+	}
+	poolPtr->numFree = numBlocks;
+exit:
+	return rc;
+}
+
+
+/* Releases the pool storage, deferring it until any outstanding pooled blocks are freed */
+static void EsifEventMgr_PoolDestroy(EsifEventMgr_Pool *poolPtr)
+{
+	ESIF_ASSERT(poolPtr != NULL);
+
+	esif_ccb_write_lock(&poolPtr->lock);
+	poolPtr->isDestroyed = ESIF_TRUE;
+	if (poolPtr->numFree == poolPtr->numBlocks) {
+		EsifEventMgr_PoolReleaseStorage(poolPtr);
+	}
+	esif_ccb_write_unlock(&poolPtr->lock);
+}
+
+
+/* Pool lock must be held */
+static void EsifEventMgr_PoolReleaseStorage(EsifEventMgr_Pool *poolPtr)
+{
+	esif_ccb_free(poolPtr->freeListPtr);
+	esif_ccb_free(poolPtr->blocksPtr);
+	poolPtr->freeListPtr = NULL;
+	poolPtr->blocksPtr = NULL;
+	poolPtr->numBlocks = 0;
+	poolPtr->numFree = 0;
+}
+
+
+/* Returns a zeroed block of at least the requested size */
+static void *EsifEventMgr_PoolAlloc(
+	EsifEventMgr_Pool *poolPtr,
+	size_t size
+	)
+{
+	void *blockPtr = NULL;
+
+	ESIF_ASSERT(poolPtr != NULL);
+
+	esif_ccb_write_lock(&poolPtr->lock);
+	if ((size <= poolPtr->blockSize) && (poolPtr->numFree > 0) && !poolPtr->isDestroyed) {
+		blockPtr = poolPtr->freeListPtr[--poolPtr->numFree];
+		poolPtr->hits++;
+	}
+	else {
+		poolPtr->misses++;
+	}
+	poolPtr->inUse++;
+	if (poolPtr->inUse > poolPtr->highWater) {
+		poolPtr->highWater = poolPtr->inUse;
+	}
+	esif_ccb_write_unlock(&poolPtr->lock);
+
+	if (blockPtr != NULL) {
+		esif_ccb_memset(blockPtr, 0, size);
+	}
+	else {
+		blockPtr = ((poolPtr->overflowPool < ESIF_MEMPOOL_TYPE_UF_MAX) && (size <= poolPtr->blockSize)
+			? esif_ccb_mempool_alloc(poolPtr->overflowPool)
+			: NULL);
+		if (NULL == blockPtr) {
+			blockPtr = esif_ccb_malloc(size);
+		}
+		if (NULL == blockPtr) {
+			esif_ccb_write_lock(&poolPtr->lock);
+			poolPtr->inUse--;
+			esif_ccb_write_unlock(&poolPtr->lock);
+		}
+	}
+	return blockPtr;
+}
+
+
+static void EsifEventMgr_PoolFree(
+	EsifEventMgr_Pool *poolPtr,
+	void *blockPtr
+	)
+{
+	Bool isPooled = ESIF_FALSE;
+
+	ESIF_ASSERT(poolPtr != NULL);
+
+	if (NULL == blockPtr) {
+		return;
+	}
+
+	esif_ccb_write_lock(&poolPtr->lock);
+	if ((poolPtr->blocksPtr != NULL) &&
+		((UInt8 *)blockPtr >= poolPtr->blocksPtr) &&
+		((UInt8 *)blockPtr < poolPtr->blocksPtr + (poolPtr->blockSize * poolPtr->numBlocks))) {
+		poolPtr->freeListPtr[poolPtr->numFree++] = blockPtr;
+		isPooled = ESIF_TRUE;
+
+		/* Complete a deferred destroy once the last pooled block is returned */
+		if (poolPtr->isDestroyed && (poolPtr->numFree == poolPtr->numBlocks)) {
+			EsifEventMgr_PoolReleaseStorage(poolPtr);
+		}
+	}
+	if (poolPtr->inUse > 0) {
+		poolPtr->inUse--;
+	}
+	esif_ccb_write_unlock(&poolPtr->lock);
+
+	if (!isPooled) {
+		/* Releases heap blocks with esif_ccb_free when there is no overflow Memory Pool */
+		esif_ccb_mempool_free(poolPtr->overflowPool, blockPtr);
+	}
+}
+
+
+static void EsifEventMgr_PoolGetStats(
+	EsifEventMgr_Pool *poolPtr,
+	EsifEventMgr_PoolStats *statsPtr
+	)
+{
+	ESIF_ASSERT(poolPtr != NULL);
+	ESIF_ASSERT(statsPtr != NULL);
+
+	esif_ccb_read_lock(&poolPtr->lock);
+	statsPtr->blockSize = (UInt32)poolPtr->blockSize;
+	statsPtr->numBlocks = poolPtr->numBlocks;
+	statsPtr->inUse = poolPtr->inUse;
+	statsPtr->highWater = poolPtr->highWater;
+	statsPtr->hits = poolPtr->hits;
+	statsPtr->misses = poolPtr->misses;
+	esif_ccb_read_unlock(&poolPtr->lock);
+}
+
+
+static void EsifEventMgr_PoolResetStats(EsifEventMgr_Pool *poolPtr)
+{
+	ESIF_ASSERT(poolPtr != NULL);
+
+	esif_ccb_write_lock(&poolPtr->lock);
+	poolPtr->highWater = poolPtr->inUse;
+	poolPtr->hits = 0;
+	poolPtr->misses = 0;
+	esif_ccb_write_unlock(&poolPtr->lock);
+}
+
+
+esif_error_t EsifEventMgr_GetStats(EsifEventMgr_StatsPtr statsPtr)
+{
+	esif_error_t rc = ESIF_E_PARAMETER_IS_NULL;
+	UInt32 i = 0;
+	EsifEventMgr_Shard *shardPtr = NULL;
+	EsifEventMgr_ShardStats *shardStatsPtr = NULL;
+
+	if (statsPtr) {
+		esif_ccb_memset(statsPtr, 0, sizeof(*statsPtr));
+		EsifEventMgr_PoolGetStats(&g_EsifEventMgr.itemPool, &statsPtr->itemPool);
+		EsifEventMgr_PoolGetStats(&g_EsifEventMgr.payloadPool, &statsPtr->payloadPool);
+		statsPtr->inlinePayloads = (UInt64)atomic64_read(&g_EsifEventMgr.inlinePayloads);
+		for (i = 0; i < EVENT_MGR_NUM_COALESCE_TYPES; i++) {
+			statsPtr->eventsMerged += (UInt64)atomic64_read(&g_EsifEventMgr.eventsMerged[i]);
+			statsPtr->eventsDropped += (UInt64)atomic64_read(&g_EsifEventMgr.eventsDropped[i]);
+		}
+
+		for (i = 0; i < g_EsifEventMgr.numWorkers; i++) {
+			shardPtr = &g_EsifEventMgr.shards[i];
+			shardStatsPtr = &statsPtr->shards[i];
+
+			esif_ccb_read_lock(&shardPtr->statsLock);
+			shardStatsPtr->queueDepth = esif_queue_size(shardPtr->queuePtr) + esif_queue_size(shardPtr->priorityQueuePtr);
+			shardStatsPtr->queueHighWater = shardPtr->queueHighWater;
+			shardStatsPtr->eventsDispatched = shardPtr->eventsDispatched;
+			shardStatsPtr->callbacksInvoked = shardPtr->callbacksInvoked;
+			shardStatsPtr->dispatchTimeTotal = shardPtr->dispatchTimeTotal;
+			shardStatsPtr->dispatchTimeMax = shardPtr->dispatchTimeMax;
+			esif_ccb_memcpy(shardStatsPtr->waitTimeHist, shardPtr->waitTimeHist, sizeof(shardStatsPtr->waitTimeHist));
+			esif_ccb_memcpy(shardStatsPtr->dispatchTimeHist, shardPtr->dispatchTimeHist, sizeof(shardStatsPtr->dispatchTimeHist));
+			esif_ccb_read_unlock(&shardPtr->statsLock);
+
+			statsPtr->queueDepth += shardStatsPtr->queueDepth;
+			statsPtr->eventsDispatched += shardStatsPtr->eventsDispatched;
+			statsPtr->callbacksInvoked += shardStatsPtr->callbacksInvoked;
+			statsPtr->dispatchTimeTotal += shardStatsPtr->dispatchTimeTotal;
+			if (shardStatsPtr->dispatchTimeMax > statsPtr->dispatchTimeMax) {
+				statsPtr->dispatchTimeMax = shardStatsPtr->dispatchTimeMax;
+			}
+			statsPtr->numShards++;
+		}
+		rc = ESIF_OK;
+	}
+	return rc;
+}
+
+
+void EsifEventMgr_ResetStats(void)
+{
+	UInt32 i = 0;
+	EsifEventMgr_Shard *shardPtr = NULL;
+
+	EsifEventMgr_PoolResetStats(&g_EsifEventMgr.itemPool);
+	EsifEventMgr_PoolResetStats(&g_EsifEventMgr.payloadPool);
+	atomic64_set(&g_EsifEventMgr.inlinePayloads, 0);
+
+	for (i = 0; i < ESIF_UF_EVENT_SHARDS_MAX; i++) {
+		shardPtr = &g_EsifEventMgr.shards[i];
+
+		esif_ccb_write_lock(&shardPtr->statsLock);
+		shardPtr->queueHighWater = esif_queue_size(shardPtr->queuePtr);
+		shardPtr->eventsDispatched = 0;
+		shardPtr->callbacksInvoked = 0;
+		shardPtr->dispatchTimeTotal = 0;
+		shardPtr->dispatchTimeMax = 0;
+		esif_ccb_memset(shardPtr->waitTimeHist, 0, sizeof(shardPtr->waitTimeHist));
+		esif_ccb_memset(shardPtr->dispatchTimeHist, 0, sizeof(shardPtr->dispatchTimeHist));
+		esif_ccb_write_unlock(&shardPtr->statsLock);
+	}
+}
+
+
+esif_error_t EsifEventMgr_SetCoalesceRule(
+	eEsifEventType eventType,
+	EsifEventCoalesceRule rule
+	)
+{
+	esif_error_t rc = ESIF_OK;
+
+	if ((UInt32)eventType >= EVENT_MGR_NUM_COALESCE_TYPES) {
+		rc = ESIF_E_NOT_SUPPORTED;
+		goto exit;
+	}
+	if ((UInt32)rule > ESIF_EVENT_COALESCE_MAX) {
+		rc = ESIF_E_PARAMETER_IS_OUT_OF_BOUNDS;
+		goto exit;
+	}
+
+	/* Pending events stay pending until dequeued; the new rule applies to subsequent events */
+	g_EsifEventMgr.coalesceRules[eventType] = (UInt8)rule;
+	ESIF_TRACE_INFO("Coalescing for %s set to %s\n", esif_event_type_str(eventType), EsifEventMgr_CoalesceRuleStr(rule));
+exit:
+	return rc;
+}
+
+
+EsifEventCoalesceRule EsifEventMgr_GetCoalesceRule(eEsifEventType eventType)
+{
+	EsifEventCoalesceRule rule = ESIF_EVENT_COALESCE_NONE;
+
+	if ((UInt32)eventType < EVENT_MGR_NUM_COALESCE_TYPES) {
+		rule = (EsifEventCoalesceRule)g_EsifEventMgr.coalesceRules[eventType];
+	}
+	return rule;
+}
+
+
+esif_error_t EsifEventMgr_GetCoalesceStats(
+	eEsifEventType eventType,
+	UInt64 *mergedPtr,
+	UInt64 *droppedPtr
+	)
+{
+	esif_error_t rc = ESIF_OK;
+
+	if ((NULL == mergedPtr) || (NULL == droppedPtr)) {
+		rc = ESIF_E_PARAMETER_IS_NULL;
+		goto exit;
+	}
+	if ((UInt32)eventType >= EVENT_MGR_NUM_COALESCE_TYPES) {
+		rc = ESIF_E_NOT_SUPPORTED;
+		goto exit;
+	}
+
+	*mergedPtr = (UInt64)atomic64_read(&g_EsifEventMgr.eventsMerged[eventType]);
+	*droppedPtr = (UInt64)atomic64_read(&g_EsifEventMgr.eventsDropped[eventType]);
+exit:
+	return rc;
+}
+
+
+void EsifEventMgr_ResetCoalesceStats(void)
+{
+	size_t i = 0;
+
+	for (i = 0; i < EVENT_MGR_NUM_COALESCE_TYPES; i++) {
+		atomic64_set(&g_EsifEventMgr.eventsMerged[i], 0);
+		atomic64_set(&g_EsifEventMgr.eventsDropped[i], 0);
+	}
+}
+
 
-	if(queueEventPtr != NULL) {
-		esif_ccb_free(queueEventPtr->eventData.buf_ptr);
-		esif_ccb_free(queueEventPtr);
+const char *EsifEventMgr_CoalesceRuleStr(EsifEventCoalesceRule rule)
+{
+	switch (rule) {
+	case ESIF_EVENT_COALESCE_NONE:
+		return "none";
+	case ESIF_EVENT_COALESCE_LATEST:
+		return "latest";
+	case ESIF_EVENT_COALESCE_FIRST:
+		return "first";
+	default:
+		return ESIF_NOT_AVAILABLE;
 	}
 }
 
 
+esif_error_t EsifEventMgr_CoalesceRuleFromStr(
+	const char *name,
+	EsifEventCoalesceRule *rulePtr
+	)
+{
+	esif_error_t rc = ESIF_E_PARAMETER_IS_OUT_OF_BOUNDS;
+	UInt32 rule = 0;
+
+	if ((NULL == name) || (NULL == rulePtr)) {
+		rc = ESIF_E_PARAMETER_IS_NULL;
+		goto exit;
+	}
+
+	for (rule = 0; rule <= ESIF_EVENT_COALESCE_MAX; rule++) {
+		if (esif_ccb_stricmp(name, EsifEventMgr_CoalesceRuleStr((EsifEventCoalesceRule)rule)) == 0) {
+			*rulePtr = (EsifEventCoalesceRule)rule;
+			rc = ESIF_OK;
+			break;
+		}
+	}
+exit:
+	return rc;
+}
+
+
+/*
+ * Loads the coalescing rules from the default DataVault; keys are of the form
+ * /eventmgr/coalesce/<event type>, where the event type is a name or number,
+ * and the value is the rule name
+ */
+static void EsifEventMgr_LoadCoalesceRules(void)
+{
+	EsifConfigFindContext context = NULL;
+	EsifDataPtr nameSpacePtr = EsifData_CreateAs(ESIF_DATA_STRING, DataBank_GetDefault(), 0, ESIFAUTOLEN);
+	EsifDataPtr keyPtr = EsifData_CreateAs(ESIF_DATA_STRING, ESIF_UF_EVENT_COALESCE_KEY "*", 0, ESIFAUTOLEN);
+	EsifDataPtr valuePtr = EsifData_CreateAs(ESIF_DATA_STRING, NULL, ESIF_DATA_ALLOCATE, 0);
+	esif_string typeName = NULL;
+	eEsifEventType eventType = ESIF_EVENT_NONE;
+	EsifEventCoalesceRule rule = ESIF_EVENT_COALESCE_NONE;
+
+	if ((NULL == nameSpacePtr) || (NULL == keyPtr) || (NULL == valuePtr)) {
+		goto exit;
+	}
+
+	if (EsifConfigFindFirst(nameSpacePtr, keyPtr, valuePtr, &context) == ESIF_OK) {
+		do {
+			typeName = (esif_string)keyPtr->buf_ptr + sizeof(ESIF_UF_EVENT_COALESCE_KEY) - 1;
+			if (isdigit(typeName[0])) {
+				eventType = (eEsifEventType)esif_atoi(typeName);
+			}
+			else {
+				eventType = esif_event_type_str2enum(typeName);
+			}
+
+			if ((ESIF_DATA_STRING != valuePtr->type) ||
+				(EsifEventMgr_CoalesceRuleFromStr((const char *)valuePtr->buf_ptr, &rule) != ESIF_OK) ||
+				(EsifEventMgr_SetCoalesceRule(eventType, rule) != ESIF_OK)) {
+				ESIF_TRACE_WARN("Invalid event coalescing rule in DV: %s\n", (esif_string)keyPtr->buf_ptr);
+			}
+
+			EsifData_Set(keyPtr, ESIF_DATA_STRING, ESIF_UF_EVENT_COALESCE_KEY "*", 0, ESIFAUTOLEN);
+			EsifData_Set(valuePtr, ESIF_DATA_STRING, NULL, ESIF_DATA_ALLOCATE, 0);
+		} while (EsifConfigFindNext(nameSpacePtr, keyPtr, valuePtr, &context) == ESIF_OK);
+
+		EsifConfigFindClose(&context);
+	}
+exit:
+	EsifData_Destroy(nameSpacePtr);
+	EsifData_Destroy(keyPtr);
+	EsifData_Destroy(valuePtr);
+}
+
+
+/* Number of participant shards (worker threads); may be overridden in the default DataVault */
+static UInt32 EsifEventMgr_GetConfiguredWorkers(void)
+{
+	UInt32 numWorkers = ESIF_UF_EVENT_WORKERS_DEFAULT;
+	UInt32 configValue = 0;
+	EsifData nameSpace = { ESIF_DATA_STRING };
+	EsifData key = { ESIF_DATA_STRING };
+	EsifData value = { ESIF_DATA_UINT32, &configValue, sizeof(configValue), 0 };
+	StringPtr dvName = DataBank_GetDefault();
+
+	ESIF_DATA_STRING_ASSIGN(nameSpace, dvName, (u32)esif_ccb_strlen(dvName, ESIF_NAME_LEN) + 1);
+	ESIF_DATA_STRING_ASSIGN(key, ESIF_UF_EVENT_WORKERS_KEY, sizeof(ESIF_UF_EVENT_WORKERS_KEY));
+
+	if (EsifConfigGet(&nameSpace, &key, &value) == ESIF_OK) {
+		if ((configValue > 0) && (configValue <= ESIF_UF_EVENT_WORKERS_MAX)) {
+			numWorkers = configValue;
+		}
+		else {
+			ESIF_TRACE_WARN("Invalid event worker count in DV: %u; using %u\n", configValue, numWorkers);
+		}
+	}
+	ESIF_TRACE_INFO("Using %u event worker(s)\n", numWorkers);
+	return numWorkers;
+}
+
+
 static void EsifEventMgr_LLEntryDestroyCallback(
 	void *dataPtr
 	)
 {
 	esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
-	EsifEventMgr_DisableEvent((EventMgrEntryPtr)dataPtr);
-	esif_ccb_free(dataPtr);
+	EsifEventMgr_DestroyEntry((EventMgrEntryPtr)dataPtr);
 	esif_ccb_write_lock(&g_EsifEventMgr.listLock);
 }
 
 
+static void EsifEventMgr_DestroyEntry(EventMgrEntryPtr entryPtr)
+{
+	if (entryPtr != NULL) {
+		if (entryPtr->isEventEnabled) {
+			EsifEventMgr_DisableEvent(entryPtr);
+		}
+		esif_ccb_mutex_uninit(&entryPtr->callLock);
+		esif_ccb_free(entryPtr);
+	}
+}
+
+
+static size_t EsifEventMgr_GetListIndex(eEsifEventType eventType)
+{
+	size_t listIndex = EVENT_MGR_OTHER_EVENTS_LIST;
+
+	if ((eventType >= 0) && (eventType <= MAX_ESIF_EVENT_ENUM_VALUE)) {
+		listIndex = (size_t)eventType;
+	}
+	return listIndex;
+}
+
+
+/*
+ * Releases a reference on an entry and moves it to the garbage list when the
+ * last reference is released.  Returns ESIF_TRUE if moved to the garbage list.
+ * Write lock should be held when called.
+ */
+static Bool EsifEventMgr_PutEntry_Locked(EventMgrEntryPtr entryPtr)
+{
+	Bool isGarbage = ESIF_FALSE;
+
+	ESIF_ASSERT(entryPtr != NULL);
+
+	if (atomic_dec(&entryPtr->holdCount) <= 0) {
+		EsifEventMgr_MoveEntryToGarbage(entryPtr);
+		isGarbage = ESIF_TRUE;
+	}
+	return isGarbage;
+}
+
+
+/*
+ * Removes an entry from an observer list; the caller is responsible for
+ * publishing a new snapshot for the list.
+ * Write lock should be held when called.
+ */
+static Bool EsifEventMgr_RemoveEntry_Locked(
+	EsifLinkListPtr listPtr,
+	EsifLinkListNodePtr nodePtr
+	)
+{
+	EventMgrEntryPtr entryPtr = NULL;
+
+	ESIF_ASSERT(listPtr != NULL);
+	ESIF_ASSERT(nodePtr != NULL);
+
+	entryPtr = (EventMgrEntryPtr)nodePtr->data_ptr;
+	esif_link_list_node_remove(listPtr, nodePtr);
+
+	entryPtr->markedForDelete = ESIF_TRUE;
+	return EsifEventMgr_PutEntry_Locked(entryPtr);
+}
+
+
+/*
+ * Builds a new dispatch snapshot from an observer list and publishes it in
+ * place of the current one.
+ * Write lock should be held when called.
+ */
+static eEsifError EsifEventMgr_PublishSnapshot_Locked(size_t listIndex)
+{
+	eEsifError rc = ESIF_OK;
+	EsifLinkListPtr listPtr = g_EsifEventMgr.observerLists[listIndex];
+	EsifLinkListNodePtr nodePtr = NULL;
+	EventMgrEntryPtr entryPtr = NULL;
+	EventMgrEntryPtr keyPtr = NULL;
+	EventMgrSnapshotPtr snapPtr = NULL;
+	UInt32 numAny = 0;
+	UInt32 numPrimary = 0;
+	UInt32 numPart = 0;
+	UInt32 j = 0;
+
+	if (NULL == listPtr) {
+		rc = ESIF_E_UNSPECIFIED;
+		goto exit;
+	}
+
+	for (nodePtr = listPtr->head_ptr; nodePtr != NULL; nodePtr = nodePtr->next_ptr) {
+		entryPtr = (EventMgrEntryPtr)nodePtr->data_ptr;
+		if (entryPtr->participantId == EVENT_MGR_MATCH_ANY) {
+			numAny++;
+		}
+		else if (entryPtr->isParticipant0Id) {
+			numPrimary++;
+		}
+		else {
+			numPart++;
+		}
+	}
+
+	/* An empty list has no snapshot */
+	if (numAny + numPrimary + numPart > 0) {
+		snapPtr = (EventMgrSnapshotPtr)esif_ccb_malloc(sizeof(*snapPtr) + ((size_t)numAny + numPrimary + numPart) * sizeof(EventMgrEntryPtr));
+		if (NULL == snapPtr) {
+			rc = ESIF_E_NO_MEMORY;
+			goto exit;
+		}
+		snapPtr->refCount = 1; /* Published reference */
+		snapPtr->anyEntries = (EventMgrEntryPtr *)(snapPtr + 1);
+		snapPtr->primaryEntries = snapPtr->anyEntries + numAny;
+		snapPtr->partEntries = snapPtr->primaryEntries + numPrimary;
+
+		/* Registration order is kept within each group */
+		for (nodePtr = listPtr->head_ptr; nodePtr != NULL; nodePtr = nodePtr->next_ptr) {
+			entryPtr = (EventMgrEntryPtr)nodePtr->data_ptr;
+			atomic_inc(&entryPtr->holdCount);
+
+			if (entryPtr->participantId == EVENT_MGR_MATCH_ANY) {
+				snapPtr->anyEntries[snapPtr->numAny++] = entryPtr;
+			}
+			else if (entryPtr->isParticipant0Id) {
+				snapPtr->primaryEntries[snapPtr->numPrimary++] = entryPtr;
+			}
+			else {
+				/* Stable insertion sort by participant and then domain */
+				keyPtr = entryPtr;
+				j = snapPtr->numPart++;
+				while ((j > 0) &&
+					((snapPtr->partEntries[j - 1]->participantId > keyPtr->participantId) ||
+					 ((snapPtr->partEntries[j - 1]->participantId == keyPtr->participantId) && (snapPtr->partEntries[j - 1]->domainId > keyPtr->domainId)))) {
+					snapPtr->partEntries[j] = snapPtr->partEntries[j - 1];
+					j--;
+				}
+				snapPtr->partEntries[j] = keyPtr;
+			}
+		}
+	}
+
+	EsifEventMgr_ReleaseSnapshot(g_EsifEventMgr.observerSnapshots[listIndex], ESIF_TRUE);
+	g_EsifEventMgr.observerSnapshots[listIndex] = snapPtr;
+exit:
+	return rc;
+}
+
+
+/* Returns a referenced snapshot for an observer list (if any); release with EsifEventMgr_ReleaseSnapshot */
+static EventMgrSnapshotPtr EsifEventMgr_GetSnapshot(size_t listIndex)
+{
+	EventMgrSnapshotPtr snapPtr = NULL;
+
+	esif_ccb_read_lock(&g_EsifEventMgr.listLock);
+	snapPtr = g_EsifEventMgr.observerSnapshots[listIndex];
+	if (snapPtr != NULL) {
+		atomic_inc(&snapPtr->refCount);
+	}
+	esif_ccb_read_unlock(&g_EsifEventMgr.listLock);
+
+	return snapPtr;
+}
+
+
+/*
+ * Releases a snapshot reference; the entry references held by the snapshot
+ * are released with the last snapshot reference.
+ * Returns ESIF_TRUE if any entries were moved to the garbage list.
+ */
+static Bool EsifEventMgr_ReleaseSnapshot(
+	EventMgrSnapshotPtr snapPtr,
+	Bool isLocked
+	)
+{
+	Bool hasGarbage = ESIF_FALSE;
+	EventMgrEntryPtr *entries = NULL;
+	UInt32 numEntries = 0;
+	UInt32 i = 0;
+
+	if ((snapPtr != NULL) && (atomic_dec(&snapPtr->refCount) <= 0)) {
+		entries = snapPtr->anyEntries;
+		numEntries = snapPtr->numAny + snapPtr->numPrimary + snapPtr->numPart;
+
+		if (!isLocked) {
+			esif_ccb_write_lock(&g_EsifEventMgr.listLock);
+		}
+		for (i = 0; i < numEntries; i++) {
+			if (EsifEventMgr_PutEntry_Locked(entries[i])) {
+				hasGarbage = ESIF_TRUE;
+			}
+		}
+		if (!isLocked) {
+			esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
+		}
+		esif_ccb_free(snapPtr);
+	}
+	return hasGarbage;
+}
+
+
 eEsifError HandlePackagedEvent(
 	EsifEventParamsPtr eventParamsPtr,
 	size_t dataLen
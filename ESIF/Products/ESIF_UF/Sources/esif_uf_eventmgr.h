@@ -84,6 +84,25 @@
 #define ESIF_UF_EVENT_QUEUE_TIMEOUT ESIF_QUEUE_TIMEOUT_INFINITE /* No timeout */
 #define EVENT_MGR_SYNCHRONOUS_EVENT_TIME_MAX 10000 /* ms */
 
+#define ESIF_UF_EVENT_WORKERS_KEY "/eventmgr/workers"	/* DataVault key used to override the default worker count */
+#define ESIF_UF_EVENT_WORKERS_DEFAULT 2
+#define ESIF_UF_EVENT_WORKERS_MAX 8
+#define ESIF_UF_EVENT_SHARDS_MAX ESIF_UF_EVENT_WORKERS_MAX /* One shard per worker */
+#define ESIF_UF_EVENT_LATENCY_BUCKETS 7 /* <10us, <100us, <1ms, <10ms, <100ms, <1s, >=1s */
+#define ESIF_UF_EVENT_COALESCE_KEY "/eventmgr/coalesce/"	/* DataVault keys: /eventmgr/coalesce/<event type> = none|latest|first */
+
+/*
+ * Coalescing rules; applied per event type to events which are pending in the
+ * event queue with the same event type, participant and domain.
+ * Synchronous events are never coalesced.
+ */
+typedef enum EsifEventCoalesceRule_e {
+	ESIF_EVENT_COALESCE_NONE = 0,	/* Queue every event (default) */
+	ESIF_EVENT_COALESCE_LATEST,		/* Merge into the pending event; the latest payload and queued time are kept */
+	ESIF_EVENT_COALESCE_FIRST,		/* Drop the new event; the pending payload is kept */
+	ESIF_EVENT_COALESCE_MAX = ESIF_EVENT_COALESCE_FIRST
+} EsifEventCoalesceRule;
+
 #include "lin/esif_uf_sensor_manager_os_lin.h"
 
 #define register_for_power_notification(guid_ptr) register_for_system_metric_notification_lin(guid_ptr)
@@ -138,6 +157,44 @@ typedef struct EventMgr_IteratorData_s {
 
 #pragma pack(pop)
 
+/* Allocation statistics for one of the Event Manager queue pools */
+typedef struct EsifEventMgr_PoolStats_s {
+	UInt32 blockSize;		/* Size of each pooled block */
+	UInt32 numBlocks;		/* Capacity of the pool */
+	UInt32 inUse;			/* Blocks currently allocated (pooled and heap) */
+	UInt32 highWater;		/* Maximum number of blocks allocated at once */
+	UInt64 hits;			/* Allocations satisfied from the pool */
+	UInt64 misses;			/* Allocations that fell back to the heap */
+} EsifEventMgr_PoolStats;
+
+/* Statistics for a single event queue shard (worker thread) */
+typedef struct EsifEventMgr_ShardStats_s {
+	UInt32 queueDepth;					/* Current number of queued events */
+	UInt32 queueHighWater;				/* Maximum number of queued events */
+	UInt64 eventsDispatched;			/* Events delivered to the observer dispatcher */
+	UInt64 callbacksInvoked;			/* Observer callbacks made */
+	UInt64 dispatchTimeTotal;			/* Total dispatch time (usec) */
+	UInt64 dispatchTimeMax;				/* Longest single event dispatch (usec) */
+	UInt64 waitTimeHist[ESIF_UF_EVENT_LATENCY_BUCKETS];		/* Time from queuing to dispatch */
+	UInt64 dispatchTimeHist[ESIF_UF_EVENT_LATENCY_BUCKETS];	/* Time spent calling the observers */
+} EsifEventMgr_ShardStats;
+
+/* Event Manager statistics; for shell use */
+typedef struct EsifEventMgr_Stats_s {
+	EsifEventMgr_PoolStats itemPool;	/* Event queue items */
+	EsifEventMgr_PoolStats payloadPool;	/* Payloads too large to be stored inline */
+	UInt64 inlinePayloads;				/* Payloads stored inline in the queue item */
+	UInt32 queueDepth;					/* Current number of queued events (all shards) */
+	UInt64 eventsDispatched;			/* Events delivered to the observer dispatcher (all shards) */
+	UInt64 callbacksInvoked;			/* Observer callbacks made (all shards) */
+	UInt64 dispatchTimeTotal;			/* Total dispatch time (usec; all shards) */
+	UInt64 dispatchTimeMax;				/* Longest single event dispatch (usec; all shards) */
+	UInt64 eventsMerged;				/* Events merged into a pending event (all types) */
+	UInt64 eventsDropped;				/* Events dropped in favor of a pending event (all types) */
+	UInt32 numShards;					/* Valid entries in shards */
+	EsifEventMgr_ShardStats shards[ESIF_UF_EVENT_SHARDS_MAX];
+} EsifEventMgr_Stats, *EsifEventMgr_StatsPtr;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -247,6 +304,18 @@ esif_error_t EsifEventMgr_GetNextEvent(
 	EventMgr_IteratorDataPtr dataPtr
 	);
 
+/* For shell use */
+esif_error_t EsifEventMgr_GetStats(EsifEventMgr_StatsPtr statsPtr);
+void EsifEventMgr_ResetStats(void);
+
+/* Event coalescing rules; only event types up to MAX_ESIF_EVENT_ENUM_VALUE may be coalesced */
+esif_error_t EsifEventMgr_SetCoalesceRule(eEsifEventType eventType, EsifEventCoalesceRule rule);
+EsifEventCoalesceRule EsifEventMgr_GetCoalesceRule(eEsifEventType eventType);
+esif_error_t EsifEventMgr_GetCoalesceStats(eEsifEventType eventType, UInt64 *mergedPtr, UInt64 *droppedPtr);
+void EsifEventMgr_ResetCoalesceStats(void);
+const char *EsifEventMgr_CoalesceRuleStr(EsifEventCoalesceRule rule);
+esif_error_t EsifEventMgr_CoalesceRuleFromStr(const char *name, EsifEventCoalesceRule *rulePtr);
+
 /* Use to Enable/Disable Events using a Reference Count*/
 esif_error_t EsifEventMgr_ToggleEventRef(esif_event_type_t eventType, Bool enable);
 
@@ -57,6 +57,7 @@
 #include "esif_lib_json.h"
 
 #include "esif_dsp.h"
+#include "esif_hash_table.h"
 #include "esif_uf_fpc.h"
 #include "esif_uf_ccb_system.h"
 #include "esif_uf_ccb_imp_spec.h"
@@ -2267,6 +2268,301 @@ static char *esif_shell_cmd_events(EsifShellCmdPtr shell)
 	return output;
 }
 
+static char *esif_shell_cmd_eventstats(EsifShellCmdPtr shell)
+{
+	int argc = shell->argc;
+	char **argv = shell->argv;
+	char *output = shell->outbuf;
+	esif_error_t rc = ESIF_OK;
+	EsifEventMgr_Stats stats = { 0 };
+	struct {
+		const char *name;
+		EsifEventMgr_PoolStats *poolPtr;
+	} pools[] = {
+		{ "QueueItems", &stats.itemPool },
+		{ "Payloads", &stats.payloadPool },
+	};
+	const char *bucketNames[ESIF_UF_EVENT_LATENCY_BUCKETS] = { "<10us", "<100us", "<1ms", "<10ms", "<100ms", "<1s", ">=1s" };
+	EsifEventMgr_ShardStats *shardPtr = NULL;
+	char shardName[8] = { 0 };
+	size_t j = 0;
+	size_t k = 0;
+
+	// eventstats [reset]
+	if (argc > 1) {
+		if (esif_ccb_stricmp(argv[1], "reset") == 0) {
+			EsifEventMgr_ResetStats();
+		}
+		else {
+			esif_ccb_sprintf(OUT_BUF_LEN, output, "%s\n", esif_rc_str(ESIF_E_PARAMETER_IS_OUT_OF_BOUNDS));
+			goto exit;
+		}
+	}
+
+	rc = EsifEventMgr_GetStats(&stats);
+	if (rc != ESIF_OK) {
+		esif_ccb_sprintf(OUT_BUF_LEN, output, "Failed to get event statistics: [%s (%d)]\n", esif_rc_str(rc), rc);
+		goto exit;
+	}
+
+	if (FORMAT_TEXT == g_format) {
+		esif_ccb_sprintf(OUT_BUF_LEN, output,
+			"\nEVENT MANAGER STATISTICS:\n\n"
+			"Queue Depth:       %u\n"
+			"Inline Payloads:   %llu\n"
+			"Events Dispatched: %llu\n"
+			"Callbacks Invoked: %llu\n"
+			"Dispatch Avg/Max:  %llu/%llu usec\n"
+			"Merged/Dropped:    %llu/%llu\n\n"
+			"Pool        Size Blocks InUse  HighWater Hits         Misses      \n"
+			"----------  ---- ------ ------ --------- ------------ ------------\n",
+			stats.queueDepth,
+			(unsigned long long)stats.inlinePayloads,
+			(unsigned long long)stats.eventsDispatched,
+			(unsigned long long)stats.callbacksInvoked,
+			(unsigned long long)(stats.eventsDispatched ? stats.dispatchTimeTotal / stats.eventsDispatched : 0),
+			(unsigned long long)stats.dispatchTimeMax,
+			(unsigned long long)stats.eventsMerged,
+			(unsigned long long)stats.eventsDropped);
+	}
+	else {// FORMAT_XML
+		esif_ccb_sprintf(OUT_BUF_LEN, output,
+			"<eventstats>\n"
+			"  <queueDepth>%u</queueDepth>\n"
+			"  <inlinePayloads>%llu</inlinePayloads>\n"
+			"  <eventsDispatched>%llu</eventsDispatched>\n"
+			"  <callbacksInvoked>%llu</callbacksInvoked>\n"
+			"  <dispatchTimeTotal>%llu</dispatchTimeTotal>\n"
+			"  <dispatchTimeMax>%llu</dispatchTimeMax>\n"
+			"  <eventsMerged>%llu</eventsMerged>\n"
+			"  <eventsDropped>%llu</eventsDropped>\n",
+			stats.queueDepth,
+			(unsigned long long)stats.inlinePayloads,
+			(unsigned long long)stats.eventsDispatched,
+			(unsigned long long)stats.callbacksInvoked,
+			(unsigned long long)stats.dispatchTimeTotal,
+			(unsigned long long)stats.dispatchTimeMax,
+			(unsigned long long)stats.eventsMerged,
+			(unsigned long long)stats.eventsDropped);
+	}
+
+	for (j = 0; j < ESIF_ARRAY_LEN(pools); j++) {
+		if (FORMAT_TEXT == g_format) {
+			esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "%-10s  %4u %6u %6u %9u %-12llu %-12llu\n",
+				pools[j].name,
+				pools[j].poolPtr->blockSize,
+				pools[j].poolPtr->numBlocks,
+				pools[j].poolPtr->inUse,
+				pools[j].poolPtr->highWater,
+				(unsigned long long)pools[j].poolPtr->hits,
+				(unsigned long long)pools[j].poolPtr->misses);
+		}
+		else {// FORMAT_XML
+			esif_ccb_sprintf_concat(OUT_BUF_LEN, output,
+				"  <pool>\n"
+				"    <name>%s</name>\n"
+				"    <size>%u</size>\n"
+				"    <blocks>%u</blocks>\n"
+				"    <inuse>%u</inuse>\n"
+				"    <highWater>%u</highWater>\n"
+				"    <hits>%llu</hits>\n"
+				"    <misses>%llu</misses>\n"
+				"  </pool>\n",
+				pools[j].name,
+				pools[j].poolPtr->blockSize,
+				pools[j].poolPtr->numBlocks,
+				pools[j].poolPtr->inUse,
+				pools[j].poolPtr->highWater,
+				(unsigned long long)pools[j].poolPtr->hits,
+				(unsigned long long)pools[j].poolPtr->misses);
+		}
+	}
+
+	// Per-shard queue statistics
+	if (FORMAT_TEXT == g_format) {
+		esif_ccb_sprintf_concat(OUT_BUF_LEN, output,
+			"\n"
+			"Shard Depth  HighWater Events       Callbacks    Avg(us)  Max(us) \n"
+			"----- ------ --------- ------------ ------------ -------- --------\n");
+	}
+	for (j = 0; j < stats.numShards; j++) {
+		shardPtr = &stats.shards[j];
+		esif_ccb_sprintf(sizeof(shardName), shardName, "%u", (unsigned int)j);
+
+		if (FORMAT_TEXT == g_format) {
+			esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "%-5s %6u %9u %-12llu %-12llu %8llu %8llu\n",
+				shardName,
+				shardPtr->queueDepth,
+				shardPtr->queueHighWater,
+				(unsigned long long)shardPtr->eventsDispatched,
+				(unsigned long long)shardPtr->callbacksInvoked,
+				(unsigned long long)(shardPtr->eventsDispatched ? shardPtr->dispatchTimeTotal / shardPtr->eventsDispatched : 0),
+				(unsigned long long)shardPtr->dispatchTimeMax);
+		}
+		else {// FORMAT_XML
+			esif_ccb_sprintf_concat(OUT_BUF_LEN, output,
+				"  <shard>\n"
+				"    <name>%s</name>\n"
+				"    <queueDepth>%u</queueDepth>\n"
+				"    <highWater>%u</highWater>\n"
+				"    <eventsDispatched>%llu</eventsDispatched>\n"
+				"    <callbacksInvoked>%llu</callbacksInvoked>\n"
+				"    <dispatchTimeTotal>%llu</dispatchTimeTotal>\n"
+				"    <dispatchTimeMax>%llu</dispatchTimeMax>\n",
+				shardName,
+				shardPtr->queueDepth,
+				shardPtr->queueHighWater,
+				(unsigned long long)shardPtr->eventsDispatched,
+				(unsigned long long)shardPtr->callbacksInvoked,
+				(unsigned long long)shardPtr->dispatchTimeTotal,
+				(unsigned long long)shardPtr->dispatchTimeMax);
+			for (k = 0; k < ESIF_UF_EVENT_LATENCY_BUCKETS; k++) {
+				esif_ccb_sprintf_concat(OUT_BUF_LEN, output,
+					"    <latency>\n"
+					"      <bucket>%s</bucket>\n"
+					"      <wait>%llu</wait>\n"
+					"      <dispatch>%llu</dispatch>\n"
+					"    </latency>\n",
+					bucketNames[k],
+					(unsigned long long)shardPtr->waitTimeHist[k],
+					(unsigned long long)shardPtr->dispatchTimeHist[k]);
+			}
+			esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "  </shard>\n");
+		}
+	}
+
+	// Latency histograms; Wait is the time spent queued and Dispatch the time spent calling observers
+	if (FORMAT_TEXT == g_format) {
+		esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "\nShard Latency ");
+		for (k = 0; k < ESIF_UF_EVENT_LATENCY_BUCKETS; k++) {
+			esif_ccb_sprintf_concat(OUT_BUF_LEN, output, " %-9s", bucketNames[k]);
+		}
+		esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "\n----- --------");
+		for (k = 0; k < ESIF_UF_EVENT_LATENCY_BUCKETS; k++) {
+			esif_ccb_sprintf_concat(OUT_BUF_LEN, output, " ---------");
+		}
+		esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "\n");
+
+		for (j = 0; j < stats.numShards; j++) {
+			shardPtr = &stats.shards[j];
+			esif_ccb_sprintf(sizeof(shardName), shardName, "%u", (unsigned int)j);
+
+			esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "%-5s Wait    ", shardName);
+			for (k = 0; k < ESIF_UF_EVENT_LATENCY_BUCKETS; k++) {
+				esif_ccb_sprintf_concat(OUT_BUF_LEN, output, " %-9llu", (unsigned long long)shardPtr->waitTimeHist[k]);
+			}
+			esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "\n%-5s Dispatch", "");
+			for (k = 0; k < ESIF_UF_EVENT_LATENCY_BUCKETS; k++) {
+				esif_ccb_sprintf_concat(OUT_BUF_LEN, output, " %-9llu", (unsigned long long)shardPtr->dispatchTimeHist[k]);
+			}
+			esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "\n");
+		}
+		esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "\n");
+	}
+	else {
+		esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "</eventstats>\n");
+	}
+exit:
+	return output;
+}
+
+static char *esif_shell_cmd_eventcoalesce(EsifShellCmdPtr shell)
+{
+	int argc = shell->argc;
+	char **argv = shell->argv;
+	char *output = shell->outbuf;
+	esif_error_t rc = ESIF_OK;
+	eEsifEventType eventType = ESIF_EVENT_NONE;
+	EsifEventCoalesceRule rule = ESIF_EVENT_COALESCE_NONE;
+	UInt64 merged = 0;
+	UInt64 dropped = 0;
+	UInt32 i = 0;
+
+	// eventcoalesce reset
+	if ((argc == 2) && (esif_ccb_stricmp(argv[1], "reset") == 0)) {
+		EsifEventMgr_ResetCoalesceStats();
+	}
+	// eventcoalesce <eventType> <none|latest|first>
+	else if (argc > 2) {
+		if (isdigit(argv[1][0])) {
+			eventType = (eEsifEventType)esif_atoi(argv[1]);
+		}
+		else {
+			eventType = esif_event_type_str2enum(argv[1]);
+			if (eventType == ESIF_EVENT_NONE) {
+				rc = ESIF_E_EVENT_NOT_FOUND;
+				goto exit;
+			}
+		}
+		rc = EsifEventMgr_CoalesceRuleFromStr(argv[2], &rule);
+		if (rc != ESIF_OK) {
+			goto exit;
+		}
+		rc = EsifEventMgr_SetCoalesceRule(eventType, rule);
+		if (rc != ESIF_OK) {
+			goto exit;
+		}
+	}
+	else if (argc > 1) {
+		rc = ESIF_E_PARAMETER_IS_OUT_OF_BOUNDS;
+		goto exit;
+	}
+
+	// List event types with a coalescing rule or coalesced events
+	if (FORMAT_TEXT == g_format) {
+		esif_ccb_sprintf(OUT_BUF_LEN, output,
+			"\nID  Event Type                                         Rule    Merged       Dropped     \n"
+			"--- -------------------------------------------------- ------- ------------ ------------\n");
+	}
+	else {// FORMAT_XML
+		esif_ccb_sprintf(OUT_BUF_LEN, output, "<eventcoalesce>\n");
+	}
+
+	for (i = 0; i <= MAX_ESIF_EVENT_ENUM_VALUE; i++) {
+		rule = EsifEventMgr_GetCoalesceRule((eEsifEventType)i);
+		if ((EsifEventMgr_GetCoalesceStats((eEsifEventType)i, &merged, &dropped) != ESIF_OK) ||
+			((ESIF_EVENT_COALESCE_NONE == rule) && (0 == merged) && (0 == dropped))) {
+			continue;
+		}
+
+		if (FORMAT_TEXT == g_format) {
+			esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "%3u %-50s %-7s %-12llu %-12llu\n",
+				i,
+				esif_event_type_str((eEsifEventType)i),
+				EsifEventMgr_CoalesceRuleStr(rule),
+				(unsigned long long)merged,
+				(unsigned long long)dropped);
+		}
+		else {// FORMAT_XML
+			esif_ccb_sprintf_concat(OUT_BUF_LEN, output,
+				"  <event>\n"
+				"    <id>%u</id>\n"
+				"    <name>%s</name>\n"
+				"    <rule>%s</rule>\n"
+				"    <merged>%llu</merged>\n"
+				"    <dropped>%llu</dropped>\n"
+				"  </event>\n",
+				i,
+				esif_event_type_str((eEsifEventType)i),
+				EsifEventMgr_CoalesceRuleStr(rule),
+				(unsigned long long)merged,
+				(unsigned long long)dropped);
+		}
+	}
+
+	if (FORMAT_TEXT == g_format) {
+		esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "\n");
+	}
+	else {
+		esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "</eventcoalesce>\n");
+	}
+exit:
+	if (rc != ESIF_OK) {
+		esif_ccb_sprintf(OUT_BUF_LEN, output, "%s\n", esif_rc_str(rc));
+	}
+	return output;
+}
+
 static char *esif_shell_cmd_appstart(EsifShellCmdPtr shell)
 {
 	int argc = shell->argc;
@@ -3986,8 +4282,10 @@ exit:
 	esif_ccb_free(data_ptr);
 	if (primitiveInDataPtr) {
 		esif_ccb_free(primitiveInDataPtr->buf_ptr);
+		primitiveInDataPtr->buf_ptr = NULL;
+		primitiveInDataPtr->buf_len = 0;
 	}
-	esif_ccb_free(primitiveInDataPtr);
+	EsifData_Destroy(primitiveInDataPtr);
 
 	if (output && *output == 0 && rc != ESIF_OK) {
 		esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "%s\n", esif_rc_str(rc));
@@ -5358,6 +5656,802 @@ exit:
 	return output;
 }
 
+// Upper Framework Memory Pool Statistics
+static char *esif_shell_cmd_mempools(EsifShellCmdPtr shell)
+{
+	char *output = shell->outbuf;
+	struct esif_ccb_mempool_stats stats = { 0 };
+	u32 i = 0;
+
+	if (FORMAT_TEXT == g_format) {
+		esif_ccb_sprintf(OUT_BUF_LEN, output,
+			"\nUF Memory Pools:\n"
+			"Name                      Size Allocs       Frees        Live       Peak       Slabs  Poisoned\n"
+			"------------------------- ---- ------------ ------------ ---------- ---------- ------ --------\n");
+	}
+	else {// FORMAT_XML
+		esif_ccb_sprintf(OUT_BUF_LEN, output, "<mempools>\n");
+	}
+
+	for (i = ESIF_MEMPOOL_TYPE_MAX; i < ESIF_MEMPOOL_TYPE_UF_MAX; i++) {
+		if (esif_ccb_mempool_get_stats((enum esif_mempool_type)i, &stats) != ESIF_OK) {
+			continue;
+		}
+
+		if (FORMAT_TEXT == g_format) {
+			esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "%-25s %-4u %-12llu %-12llu %-10llu %-10llu %-6llu %llu\n",
+				stats.name_ptr,
+				stats.object_size,
+				(unsigned long long)stats.alloc_count,
+				(unsigned long long)stats.free_count,
+				(unsigned long long)stats.live,
+				(unsigned long long)stats.peak,
+				(unsigned long long)stats.slab_count,
+				(unsigned long long)stats.poison_errors);
+		}
+		else {// FORMAT_XML
+			esif_ccb_sprintf_concat(OUT_BUF_LEN, output,
+				"  <mempool>\n"
+				"    <name>%s</name>\n"
+				"    <size>%u</size>\n"
+				"    <allocs>%llu</allocs>\n"
+				"    <frees>%llu</frees>\n"
+				"    <live>%llu</live>\n"
+				"    <peak>%llu</peak>\n"
+				"    <slabs>%llu</slabs>\n"
+				"    <poisoned>%llu</poisoned>\n"
+				"  </mempool>\n",
+				stats.name_ptr,
+				stats.object_size,
+				(unsigned long long)stats.alloc_count,
+				(unsigned long long)stats.free_count,
+				(unsigned long long)stats.live,
+				(unsigned long long)stats.peak,
+				(unsigned long long)stats.slab_count,
+				(unsigned long long)stats.poison_errors);
+		}
+	}
+
+	if (FORMAT_TEXT == g_format) {
+		esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "\n");
+	}
+	else {// FORMAT_XML
+		esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "</mempools>\n");
+	}
+	return output;
+}
+
+// Queue Benchmark
+#define QUEUEBENCH_MAX_PRODUCERS	16
+#define QUEUEBENCH_MAX_ITEMS		1000000	/* Total items per run */
+#define QUEUEBENCH_DEFAULT_RING_SIZE	1024
+
+typedef struct QueueBenchContext_s {
+	EsifQueuePtr queuePtr;
+	UInt64 *queuedTimes;	/* Realtime clock ticks when each item was queued */
+	size_t first;			/* First item queued by this producer */
+	size_t count;			/* Number of items queued by this producer */
+	UInt64 retries;			/* Enqueue failures */
+} QueueBenchContext;
+
+static void *ESIF_CALLCONV esif_shell_queuebench_producer(void *ctxPtr)
+{
+	QueueBenchContext *benchPtr = (QueueBenchContext *)ctxPtr;
+	size_t j = 0;
+
+	for (j = benchPtr->first; j < benchPtr->first + benchPtr->count; j++) {
+		benchPtr->queuedTimes[j] = esif_ccb_realtime_current().clockticks;
+		while (esif_queue_enqueue(benchPtr->queuePtr, &benchPtr->queuedTimes[j]) != ESIF_OK) {
+			benchPtr->retries++;
+		}
+	}
+	return 0;
+}
+
+static int ESIF_CALLCONV esif_shell_queuebench_compare(const void *arg1, const void *arg2, void *ctx)
+{
+	UInt64 val1 = *(const UInt64 *)arg1;
+	UInt64 val2 = *(const UInt64 *)arg2;
+
+	UNREFERENCED_PARAMETER(ctx);
+	return (val1 < val2 ? -1 : (val1 > val2 ? 1 : 0));
+}
+
+// queuebench [producers] [items per producer] [ring size]
+static char *esif_shell_cmd_queuebench(EsifShellCmdPtr shell)
+{
+	int argc = shell->argc;
+	char **argv = shell->argv;
+	char *output = shell->outbuf;
+	esif_error_t rc = ESIF_OK;
+	UInt32 numProducers = 4;
+	UInt32 numItems = 100000;
+	UInt32 ringSize = QUEUEBENCH_DEFAULT_RING_SIZE;
+	QueueBenchContext producers[QUEUEBENCH_MAX_PRODUCERS] = { 0 };
+	esif_thread_t threads[QUEUEBENCH_MAX_PRODUCERS] = { 0 };
+	UInt64 *queuedTimes = NULL;
+	UInt64 *latencies = NULL;
+	UInt64 *itemPtr = NULL;
+	UInt64 startTime = 0;
+	UInt64 elapsedTime = 0;
+	UInt64 retries = 0;
+	size_t total = 0;
+	size_t received = 0;
+	UInt32 backend = 0;
+	UInt32 j = 0;
+
+	if (argc > 1) {
+		numProducers = (UInt32)esif_atoi(argv[1]);
+	}
+	if (argc > 2) {
+		numItems = (UInt32)esif_atoi(argv[2]);
+	}
+	if (argc > 3) {
+		ringSize = (UInt32)esif_atoi(argv[3]);
+	}
+	if ((numProducers < 1) || (numProducers > QUEUEBENCH_MAX_PRODUCERS) ||
+		(numItems < 1) || ((UInt64)numProducers * numItems > QUEUEBENCH_MAX_ITEMS) ||
+		(ringSize < 1) || (ringSize > ESIF_QUEUE_RING_SIZE_MAX)) {
+		rc = ESIF_E_PARAMETER_IS_OUT_OF_BOUNDS;
+		goto exit;
+	}
+
+	total = (size_t)numProducers * numItems;
+	queuedTimes = (UInt64 *)esif_ccb_malloc(sizeof(*queuedTimes) * total);
+	latencies = (UInt64 *)esif_ccb_malloc(sizeof(*latencies) * total);
+	if ((NULL == queuedTimes) || (NULL == latencies)) {
+		rc = ESIF_E_NO_MEMORY;
+		goto exit;
+	}
+
+	if (FORMAT_TEXT == g_format) {
+		esif_ccb_sprintf(OUT_BUF_LEN, output,
+			"\nQUEUE BENCHMARK: %u producer(s) x %u items; ring size %u\n\n"
+			"Queue  Items/sec    p50(us)  p99(us)  p999(us) Max(us)  Overflows    Retries     \n"
+			"------ ------------ -------- -------- -------- -------- ------------ ------------\n",
+			numProducers, numItems, ringSize);
+	}
+	else {// FORMAT_XML
+		esif_ccb_sprintf(OUT_BUF_LEN, output,
+			"<queuebench>\n"
+			"  <producers>%u</producers>\n"
+			"  <items>%u</items>\n"
+			"  <ringSize>%u</ringSize>\n",
+			numProducers, numItems, ringSize);
+	}
+
+	// Run once using each queue backend: 0 = Linked List, 1 = Ring Buffer
+	for (backend = 0; backend < 2; backend++) {
+		EsifQueuePtr queuePtr = NULL;
+
+		if (backend == 0) {
+			queuePtr = esif_queue_create(ESIF_UF_EVENT_QUEUE_SIZE, "BenchList", ESIF_QUEUE_TIMEOUT_INFINITE);
+		}
+		else {
+			queuePtr = esif_queue_create_ring(ESIF_UF_EVENT_QUEUE_SIZE, "BenchRing", ESIF_QUEUE_TIMEOUT_INFINITE, ringSize);
+		}
+		if (NULL == queuePtr) {
+			rc = ESIF_E_NO_MEMORY;
+			goto exit;
+		}
+
+		esif_ccb_memset(threads, 0, sizeof(threads));
+		received = 0;
+		retries = 0;
+		startTime = esif_ccb_realtime_current().clockticks;
+
+		for (j = 0; j < numProducers; j++) {
+			producers[j].queuePtr = queuePtr;
+			producers[j].queuedTimes = queuedTimes;
+			producers[j].first = (size_t)j * numItems;
+			producers[j].count = numItems;
+			producers[j].retries = 0;
+			if (esif_ccb_thread_create(&threads[j], esif_shell_queuebench_producer, &producers[j]) != ESIF_OK) {
+				producers[j].count = 0;
+				total -= numItems;
+			}
+		}
+
+		// The shell thread is the single consumer
+		while (received < total) {
+			itemPtr = (UInt64 *)esif_queue_pull(queuePtr);
+			if (itemPtr != NULL) {
+				latencies[received++] = esif_ccb_realtime_current().clockticks - *itemPtr;
+			}
+		}
+		elapsedTime = esif_ccb_realtime_current().clockticks - startTime;
+
+		for (j = 0; j < numProducers; j++) {
+			esif_ccb_thread_join(&threads[j]);
+			retries += producers[j].retries;
+		}
+		total = (size_t)numProducers * numItems;
+
+		esif_ccb_qsort(latencies, received, sizeof(*latencies), esif_shell_queuebench_compare, NULL);
+
+		if (received > 0) {
+			if (FORMAT_TEXT == g_format) {
+				esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "%-6s %-12llu %8llu %8llu %8llu %8llu %-12llu %-12llu\n",
+					(backend == 0 ? "List" : "Ring"),
+					(unsigned long long)(elapsedTime ? (UInt64)received * 1000000000 / elapsedTime : 0),
+					(unsigned long long)(latencies[received / 2] / 1000),
+					(unsigned long long)(latencies[(received * 99) / 100] / 1000),
+					(unsigned long long)(latencies[(received * 999) / 1000] / 1000),
+					(unsigned long long)(latencies[received - 1] / 1000),
+					(unsigned long long)queuePtr->overflow_total,
+					(unsigned long long)retries);
+			}
+			else {// FORMAT_XML
+				esif_ccb_sprintf_concat(OUT_BUF_LEN, output,
+					"  <queue>\n"
+					"    <name>%s</name>\n"
+					"    <itemsPerSec>%llu</itemsPerSec>\n"
+					"    <p50>%llu</p50>\n"
+					"    <p99>%llu</p99>\n"
+					"    <p999>%llu</p999>\n"
+					"    <max>%llu</max>\n"
+					"    <overflows>%llu</overflows>\n"
+					"    <retries>%llu</retries>\n"
+					"  </queue>\n",
+					(backend == 0 ? "List" : "Ring"),
+					(unsigned long long)(elapsedTime ? (UInt64)received * 1000000000 / elapsedTime : 0),
+					(unsigned long long)(latencies[received / 2] / 1000),
+					(unsigned long long)(latencies[(received * 99) / 100] / 1000),
+					(unsigned long long)(latencies[(received * 999) / 1000] / 1000),
+					(unsigned long long)(latencies[received - 1] / 1000),
+					(unsigned long long)queuePtr->overflow_total,
+					(unsigned long long)retries);
+			}
+		}
+		esif_queue_destroy(queuePtr, NULL);
+	}
+
+	if (FORMAT_TEXT == g_format) {
+		esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "\n");
+	}
+	else {
+		esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "</queuebench>\n");
+	}
+exit:
+	if (rc != ESIF_OK) {
+		esif_ccb_sprintf(OUT_BUF_LEN, output, "%s\n", esif_rc_str(rc));
+	}
+	esif_ccb_free(queuedTimes);
+	esif_ccb_free(latencies);
+	return output;
+}
+
+#define DVBENCH_MAX_KEYS	1000000
+
+// Load a DataCache with the given number of keys, either one sorted Insert at a time or Bulk Append + Sort
+static esif_error_t esif_shell_dvbench_load(
+	DataCachePtr cache,
+	UInt32 numKeys,
+	Bool bulkLoad
+	)
+{
+	esif_error_t rc = ESIF_OK;
+	char key[MAX_PATH] = { 0 };
+	UInt32 j = 0;
+
+	for (j = 0; rc == ESIF_OK && j < numKeys; j++) {
+		UInt32 value = j;
+		EsifData data = { ESIF_DATA_UINT32 };
+		data.buf_ptr = &value;
+		data.buf_len = 0; // Static
+		data.data_len = sizeof(value);
+
+		// DataVault files are written in sorted key order
+		esif_ccb_sprintf(sizeof(key), key, "/participants/BENCH%07u/value", j);
+		if (bulkLoad) {
+			rc = DataCache_AppendValue(cache, key, &data, ESIF_SERVICE_CONFIG_PERSIST);
+		}
+		else {
+			if (DataCache_GetValue(cache, key) != NULL) {
+				rc = DataCache_DeleteValue(cache, key);
+			}
+			if (rc == ESIF_OK) {
+				rc = DataCache_InsertValue(cache, key, &data, ESIF_SERVICE_CONFIG_PERSIST);
+			}
+		}
+	}
+	if (rc == ESIF_OK && bulkLoad) {
+		rc = DataCache_Sort(cache, ESIF_FALSE);
+	}
+	return rc;
+}
+
+// dvbench [keys ...]
+static char *esif_shell_cmd_dvbench(EsifShellCmdPtr shell)
+{
+	int argc = shell->argc;
+	char **argv = shell->argv;
+	char *output = shell->outbuf;
+	esif_error_t rc = ESIF_OK;
+	UInt32 defaultKeys[] = { 10000, 25000, 50000, 100000 };
+	UInt32 numRuns = (argc > 1 ? (UInt32)(argc - 1) : (UInt32)(sizeof(defaultKeys) / sizeof(defaultKeys[0])));
+	UInt32 run = 0;
+
+	if (FORMAT_TEXT == g_format) {
+		esif_ccb_sprintf(OUT_BUF_LEN, output,
+			"\nDATACACHE LOAD BENCHMARK\n\n"
+			"Keys     Insert(ms) Bulk(ms)   Lookup(ms) Capacity Arena(KB)\n"
+			"-------- ---------- ---------- ---------- -------- ---------\n");
+	}
+	else {// FORMAT_XML
+		esif_ccb_sprintf(OUT_BUF_LEN, output, "<dvbench>\n");
+	}
+
+	for (run = 0; run < numRuns; run++) {
+		UInt32 numKeys = (argc > 1 ? (UInt32)esif_atoi(argv[run + 1]) : defaultKeys[run]);
+		DataCachePtr insertCache = NULL;
+		DataCachePtr bulkCache = NULL;
+		UInt64 insertTime = 0;
+		UInt64 bulkTime = 0;
+		UInt64 lookupTime = 0;
+		UInt64 startTime = 0;
+		char key[MAX_PATH] = { 0 };
+		UInt32 j = 0;
+
+		if ((numKeys < 1) || (numKeys > DVBENCH_MAX_KEYS)) {
+			rc = ESIF_E_PARAMETER_IS_OUT_OF_BOUNDS;
+			goto exit;
+		}
+
+		insertCache = DataCache_Create();
+		bulkCache = DataCache_Create();
+		if ((NULL == insertCache) || (NULL == bulkCache)) {
+			rc = ESIF_E_NO_MEMORY;
+		}
+
+		if (rc == ESIF_OK) {
+			startTime = esif_ccb_realtime_current().clockticks;
+			rc = esif_shell_dvbench_load(insertCache, numKeys, ESIF_FALSE);
+			insertTime = esif_ccb_realtime_current().clockticks - startTime;
+		}
+		if (rc == ESIF_OK) {
+			startTime = esif_ccb_realtime_current().clockticks;
+			rc = esif_shell_dvbench_load(bulkCache, numKeys, ESIF_TRUE);
+			bulkTime = esif_ccb_realtime_current().clockticks - startTime;
+		}
+		if (rc == ESIF_OK) {
+			startTime = esif_ccb_realtime_current().clockticks;
+			for (j = 0; rc == ESIF_OK && j < numKeys; j++) {
+				esif_ccb_sprintf(sizeof(key), key, "/participants/BENCH%07u/value", (UInt32)(((UInt64)j * 7919) % numKeys));
+				if (DataCache_GetValue(bulkCache, key) == NULL) {
+					rc = ESIF_E_NOT_FOUND;
+				}
+			}
+			lookupTime = esif_ccb_realtime_current().clockticks - startTime;
+		}
+
+		if (rc == ESIF_OK) {
+			if (FORMAT_TEXT == g_format) {
+				esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "%-8u %10llu %10llu %10llu %8u %9llu\n",
+					numKeys,
+					(unsigned long long)(insertTime / 1000000),
+					(unsigned long long)(bulkTime / 1000000),
+					(unsigned long long)(lookupTime / 1000000),
+					bulkCache->capacity,
+					(unsigned long long)(bulkCache->arenaLive / 1024));
+			}
+			else {// FORMAT_XML
+				esif_ccb_sprintf_concat(OUT_BUF_LEN, output,
+					"  <run>\n"
+					"    <keys>%u</keys>\n"
+					"    <insertMs>%llu</insertMs>\n"
+					"    <bulkMs>%llu</bulkMs>\n"
+					"    <lookupMs>%llu</lookupMs>\n"
+					"    <capacity>%u</capacity>\n"
+					"    <arenaBytes>%llu</arenaBytes>\n"
+					"  </run>\n",
+					numKeys,
+					(unsigned long long)(insertTime / 1000000),
+					(unsigned long long)(bulkTime / 1000000),
+					(unsigned long long)(lookupTime / 1000000),
+					bulkCache->capacity,
+					(unsigned long long)bulkCache->arenaLive);
+			}
+		}
+		DataCache_Destroy(insertCache);
+		DataCache_Destroy(bulkCache);
+		if (rc != ESIF_OK) {
+			goto exit;
+		}
+	}
+
+	if (FORMAT_TEXT == g_format) {
+		esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "\n");
+	}
+	else {
+		esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "</dvbench>\n");
+	}
+exit:
+	if (rc != ESIF_OK) {
+		esif_ccb_sprintf(OUT_BUF_LEN, output, "%s\n", esif_rc_str(rc));
+	}
+	return output;
+}
+
+#define HASHBENCH_MAX_ITERATIONS	100000
+
+// hashbench [iterations]
+// Measures Hash Table lookup performance using the Primitive Tuple keys of all loaded DSPs
+static char *esif_shell_cmd_hashbench(EsifShellCmdPtr shell)
+{
+	int argc = shell->argc;
+	char **argv = shell->argv;
+	char *output = shell->outbuf;
+	esif_error_t rc = ESIF_OK;
+	UInt32 iterations = 1000;
+	EsifPrimitiveTuple *keys = NULL;
+	UInt32 numKeys = 0;
+	UInt32 maxKeys = 0;
+	struct esif_ht *htPtr = NULL;
+	struct esif_ht_iterator iter = { 0 };
+	UInt8 *keyPtr = NULL;
+	UInt32 keyLen = 0;
+	void *itemPtr = NULL;
+	UInt64 startTime = 0;
+	UInt64 buildTime = 0;
+	UInt64 hitTime = 0;
+	UInt64 missTime = 0;
+	UInt64 lookups = 0;
+	UInt32 found = 0;
+	UInt32 i = 0;
+	UInt32 j = 0;
+
+	if (argc > 1) {
+		iterations = (UInt32)esif_atoi(argv[1]);
+	}
+	if ((iterations < 1) || (iterations > HASHBENCH_MAX_ITERATIONS)) {
+		rc = ESIF_E_PARAMETER_IS_OUT_OF_BOUNDS;
+		goto exit;
+	}
+
+	// Copy the Primitive Tuples of every loaded DSP
+	esif_ccb_read_lock(&g_dm.lock);
+	for (i = 0; i < g_dm.dme_count; i++) {
+		if (g_dm.dme[i].dsp_ptr != NULL) {
+			maxKeys += esif_ht_get_count(g_dm.dme[i].dsp_ptr->ht_ptr);
+		}
+	}
+	if (maxKeys > 0) {
+		keys = (EsifPrimitiveTuple *)esif_ccb_malloc(sizeof(*keys) * maxKeys);
+	}
+	for (i = 0; keys != NULL && i < g_dm.dme_count; i++) {
+		if ((g_dm.dme[i].dsp_ptr == NULL) ||
+			(esif_ht_init_iterator(g_dm.dme[i].dsp_ptr->ht_ptr, &iter) != ESIF_OK)) {
+			continue;
+		}
+		while ((numKeys < maxKeys) &&
+			(esif_ht_get_next_item(&iter, &keyPtr, &keyLen, &itemPtr) == ESIF_OK)) {
+			if (keyLen == sizeof(*keys)) {
+				esif_ccb_memcpy(&keys[numKeys++], keyPtr, sizeof(*keys));
+			}
+		}
+	}
+	esif_ccb_read_unlock(&g_dm.lock);
+
+	if (numKeys == 0) {
+		rc = (maxKeys > 0 ? ESIF_E_NO_MEMORY : ESIF_E_NOT_FOUND);
+		goto exit;
+	}
+
+	// Build a table from the same keys, as done when a DSP is loaded
+	startTime = esif_ccb_realtime_current().clockticks;
+	htPtr = esif_ht_create(ESIF_DSP_HASHTABLE_SIZE);
+	for (j = 0; htPtr != NULL && rc == ESIF_OK && j < numKeys; j++) {
+		rc = esif_ht_add_item(htPtr, (UInt8 *)&keys[j], sizeof(keys[j]), &keys[j]);
+	}
+	buildTime = esif_ccb_realtime_current().clockticks - startTime;
+	if (htPtr == NULL) {
+		rc = ESIF_E_NO_MEMORY;
+	}
+	if (rc != ESIF_OK) {
+		goto exit;
+	}
+
+	// Successful Lookups
+	startTime = esif_ccb_realtime_current().clockticks;
+	for (i = 0; i < iterations; i++) {
+		for (j = 0; j < numKeys; j++) {
+			if (esif_ht_get_item(htPtr, (UInt8 *)&keys[j], sizeof(keys[j])) != NULL) {
+				found++;
+			}
+		}
+	}
+	hitTime = esif_ccb_realtime_current().clockticks - startTime;
+
+	// Failed Lookups using Instance numbers that are never used by DSPs
+	startTime = esif_ccb_realtime_current().clockticks;
+	for (i = 0; i < iterations; i++) {
+		for (j = 0; j < numKeys; j++) {
+			EsifPrimitiveTuple missKey = keys[j];
+			missKey.instance = (UInt16)(0xFF00 | (i & 0xFF));
+			if (esif_ht_get_item(htPtr, (UInt8 *)&missKey, sizeof(missKey)) != NULL) {
+				found++;
+			}
+		}
+	}
+	missTime = esif_ccb_realtime_current().clockticks - startTime;
+	lookups = (UInt64)iterations * numKeys;
+
+	if (FORMAT_TEXT == g_format) {
+		esif_ccb_sprintf(OUT_BUF_LEN, output,
+			"\nHASH TABLE BENCHMARK: %u DSP key(s) x %u iterations\n\n"
+			"Keys     Slots    Build(us)  Hit(ns)  Miss(ns) Found\n"
+			"-------- -------- ---------- -------- -------- ------------\n"
+			"%-8u %-8u %10llu %8llu %8llu %-12u\n\n",
+			numKeys, iterations,
+			numKeys, htPtr->size,
+			(unsigned long long)(buildTime / 1000),
+			(unsigned long long)(hitTime / lookups),
+			(unsigned long long)(missTime / lookups),
+			found);
+	}
+	else {// FORMAT_XML
+		esif_ccb_sprintf(OUT_BUF_LEN, output,
+			"<hashbench>\n"
+			"  <keys>%u</keys>\n"
+			"  <iterations>%u</iterations>\n"
+			"  <slots>%u</slots>\n"
+			"  <buildUs>%llu</buildUs>\n"
+			"  <hitNs>%llu</hitNs>\n"
+			"  <missNs>%llu</missNs>\n"
+			"  <found>%u</found>\n"
+			"</hashbench>\n",
+			numKeys, iterations, htPtr->size,
+			(unsigned long long)(buildTime / 1000),
+			(unsigned long long)(hitTime / lookups),
+			(unsigned long long)(missTime / lookups),
+			found);
+	}
+exit:
+	if (rc != ESIF_OK) {
+		esif_ccb_sprintf(OUT_BUF_LEN, output, "%s\n", esif_rc_str(rc));
+	}
+	esif_ht_destroy(htPtr, NULL);
+	esif_ccb_free(keys);
+	return output;
+}
+
+// Event Dispatch Benchmark
+#define EVENTBENCH_MAX_OBSERVERS	1000
+#define EVENTBENCH_MAX_EVENTS		1000000
+#define EVENTBENCH_TIMEOUT_MS		10000	/* Maximum time without progress while waiting for events to be dispatched */
+#define EVENTBENCH_EVENT_TYPE		((eEsifEventType)(MAX_ESIF_EVENT_ENUM_VALUE + 1))	/* OEM event type with no other observers */
+
+static atomic_t g_eventbenchCalls = 0;
+static atomic_t g_eventbenchOrderErrors = 0;
+static UInt32 g_eventbenchObservers = 0;
+static UInt32 g_eventbenchNextObserver = 0;
+
+// The context is the 1-based registration index of the observer; observers must be called in registration order
+static eEsifError ESIF_CALLCONV esif_shell_eventbench_callback(
+	esif_context_t context,
+	esif_handle_t participantId,
+	UInt16 domainId,
+	EsifFpcEventPtr fpcEventPtr,
+	EsifDataPtr eventDataPtr
+	)
+{
+	UInt32 observer = (UInt32)context;
+
+	UNREFERENCED_PARAMETER(participantId);
+	UNREFERENCED_PARAMETER(domainId);
+	UNREFERENCED_PARAMETER(fpcEventPtr);
+	UNREFERENCED_PARAMETER(eventDataPtr);
+
+	// All events are signaled for the same participant, so they are dispatched by one event thread
+	if (observer != g_eventbenchNextObserver) {
+		atomic_inc(&g_eventbenchOrderErrors);
+	}
+	g_eventbenchNextObserver = (observer % g_eventbenchObservers) + 1;
+	atomic_inc(&g_eventbenchCalls);
+	return ESIF_OK;
+}
+
+// eventbench [events] [observers ...]
+static char *esif_shell_cmd_eventbench(EsifShellCmdPtr shell)
+{
+	int argc = shell->argc;
+	char **argv = shell->argv;
+	char *output = shell->outbuf;
+	esif_error_t rc = ESIF_OK;
+	UInt32 numEvents = 10000;
+	UInt32 defaultObservers[] = { 1, 10, 100 };
+	UInt32 numRuns = (argc > 2 ? (UInt32)(argc - 2) : (UInt32)(sizeof(defaultObservers) / sizeof(defaultObservers[0])));
+	UInt32 run = 0;
+
+	if (argc > 1) {
+		numEvents = (UInt32)esif_atoi(argv[1]);
+	}
+	if ((numEvents < 1) || (numEvents > EVENTBENCH_MAX_EVENTS)) {
+		rc = ESIF_E_PARAMETER_IS_OUT_OF_BOUNDS;
+		goto exit;
+	}
+
+	if (FORMAT_TEXT == g_format) {
+		esif_ccb_sprintf(OUT_BUF_LEN, output,
+			"\nEVENT DISPATCH BENCHMARK: %u event(s)\n\n"
+			"Observers Events/sec   Calls/sec    ns/Call  Order Errors\n"
+			"--------- ------------ ------------ -------- ------------\n",
+			numEvents);
+	}
+	else {// FORMAT_XML
+		esif_ccb_sprintf(OUT_BUF_LEN, output,
+			"<eventbench>\n"
+			"  <events>%u</events>\n",
+			numEvents);
+	}
+
+	for (run = 0; run < numRuns; run++) {
+		UInt32 numObservers = (argc > 2 ? (UInt32)esif_atoi(argv[run + 2]) : defaultObservers[run]);
+		UInt32 numRegistered = 0;
+		UInt64 expectedCalls = 0;
+		UInt64 lastCalls = 0;
+		UInt64 startTime = 0;
+		UInt64 elapsedTime = 0;
+		UInt32 idleTime = 0;
+		UInt32 j = 0;
+
+		if ((numObservers < 1) || (numObservers > EVENTBENCH_MAX_OBSERVERS)) {
+			rc = ESIF_E_PARAMETER_IS_OUT_OF_BOUNDS;
+			goto exit;
+		}
+
+		g_eventbenchCalls = 0;
+		g_eventbenchOrderErrors = 0;
+		g_eventbenchObservers = numObservers;
+		g_eventbenchNextObserver = 1;
+
+		// Alternate between observers of the signaled domain and observers of any domain
+		for (j = 0; rc == ESIF_OK && j < numObservers; j++) {
+			rc = EsifEventMgr_RegisterEventByType(EVENTBENCH_EVENT_TYPE,
+				EVENT_MGR_MATCH_ANY,
+				((j % 2) ? EVENT_MGR_DOMAIN_D0 : EVENT_MGR_MATCH_ANY_DOMAIN),
+				esif_shell_eventbench_callback,
+				(esif_context_t)(j + 1));
+			if (rc == ESIF_OK) {
+				numRegistered++;
+			}
+		}
+
+		if (rc == ESIF_OK) {
+			expectedCalls = (UInt64)numEvents * numObservers;
+			startTime = esif_ccb_realtime_current().clockticks;
+			for (j = 0; rc == ESIF_OK && j < numEvents; j++) {
+				rc = EsifEventMgr_SignalEvent(ESIF_HANDLE_PRIMARY_PARTICIPANT, EVENT_MGR_DOMAIN_D0, EVENTBENCH_EVENT_TYPE, NULL);
+			}
+			while (rc == ESIF_OK && (UInt64)atomic_read(&g_eventbenchCalls) < expectedCalls) {
+				esif_ccb_sleep_msec(1);
+				if ((UInt64)atomic_read(&g_eventbenchCalls) != lastCalls) {
+					lastCalls = (UInt64)atomic_read(&g_eventbenchCalls);
+					idleTime = 0;
+				}
+				else if (++idleTime >= EVENTBENCH_TIMEOUT_MS) {
+					rc = ESIF_E_TIMEOUT;
+				}
+			}
+			elapsedTime = esif_ccb_realtime_current().clockticks - startTime;
+		}
+
+		for (j = 0; j < numRegistered; j++) {
+			EsifEventMgr_UnregisterEventByType(EVENTBENCH_EVENT_TYPE,
+				EVENT_MGR_MATCH_ANY,
+				((j % 2) ? EVENT_MGR_DOMAIN_D0 : EVENT_MGR_MATCH_ANY_DOMAIN),
+				esif_shell_eventbench_callback,
+				(esif_context_t)(j + 1));
+		}
+		if (rc != ESIF_OK) {
+			goto exit;
+		}
+
+		if (FORMAT_TEXT == g_format) {
+			esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "%-9u %-12llu %-12llu %8llu %-12llu\n",
+				numObservers,
+				(unsigned long long)(elapsedTime ? (UInt64)numEvents * 1000000000 / elapsedTime : 0),
+				(unsigned long long)(elapsedTime ? expectedCalls * 1000000000 / elapsedTime : 0),
+				(unsigned long long)(elapsedTime / expectedCalls),
+				(unsigned long long)atomic_read(&g_eventbenchOrderErrors));
+		}
+		else {// FORMAT_XML
+			esif_ccb_sprintf_concat(OUT_BUF_LEN, output,
+				"  <run>\n"
+				"    <observers>%u</observers>\n"
+				"    <eventsPerSec>%llu</eventsPerSec>\n"
+				"    <callsPerSec>%llu</callsPerSec>\n"
+				"    <nsPerCall>%llu</nsPerCall>\n"
+				"    <orderErrors>%llu</orderErrors>\n"
+				"  </run>\n",
+				numObservers,
+				(unsigned long long)(elapsedTime ? (UInt64)numEvents * 1000000000 / elapsedTime : 0),
+				(unsigned long long)(elapsedTime ? expectedCalls * 1000000000 / elapsedTime : 0),
+				(unsigned long long)(elapsedTime / expectedCalls),
+				(unsigned long long)atomic_read(&g_eventbenchOrderErrors));
+		}
+	}
+
+	if (FORMAT_TEXT == g_format) {
+		esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "\n");
+	}
+	else {
+		esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "</eventbench>\n");
+	}
+exit:
+	if (rc != ESIF_OK) {
+		esif_ccb_sprintf(OUT_BUF_LEN, output, "%s\n", esif_rc_str(rc));
+	}
+	return output;
+}
+
+#define SYSFSBENCH_MAX_ITERATIONS	1000000
+#define SYSFSBENCH_DEFAULT_ATTRIBUTE	"/sys/class/thermal/thermal_zone0/temp"
+
+// sysfsbench [iterations] [attribute]
+// Compares reading an integer attribute by opening it on each read with reading it through the OS handle cache
+static char *esif_shell_cmd_sysfsbench(EsifShellCmdPtr shell)
+{
+	int argc = shell->argc;
+	char **argv = shell->argv;
+	char *output = shell->outbuf;
+	esif_error_t rc = ESIF_OK;
+	UInt32 iterations = 10000;
+	char *attribute = SYSFSBENCH_DEFAULT_ATTRIBUTE;
+	UInt64 uncachedTime = 0;
+	UInt64 cachedTime = 0;
+	Bool isCached = ESIF_FALSE;
+
+	if (argc > 1) {
+		iterations = (UInt32)esif_atoi(argv[1]);
+	}
+	if (argc > 2) {
+		attribute = argv[2];
+	}
+	if ((iterations < 1) || (iterations > SYSFSBENCH_MAX_ITERATIONS)) {
+		rc = ESIF_E_PARAMETER_IS_OUT_OF_BOUNDS;
+		goto exit;
+	}
+
+	rc = esif_uf_os_handle_cache_bench(attribute, iterations, &uncachedTime, &cachedTime, &isCached);
+	if (rc != ESIF_OK) {
+		goto exit;
+	}
+
+	if (FORMAT_TEXT == g_format) {
+		esif_ccb_sprintf(OUT_BUF_LEN, output,
+			"\nSYSFS HANDLE CACHE BENCHMARK: %s x %u reads\n\n"
+			"Open(ns)   Cached(ns) Speedup  Cached\n"
+			"---------- ---------- -------- ------\n"
+			"%10llu %10llu %7llux %s\n\n",
+			attribute, iterations,
+			(unsigned long long)uncachedTime,
+			(unsigned long long)cachedTime,
+			(unsigned long long)(cachedTime ? uncachedTime / cachedTime : 0),
+			(isCached ? "Yes" : "No"));
+	}
+	else {// FORMAT_XML
+		esif_ccb_sprintf(OUT_BUF_LEN, output,
+			"<sysfsbench>\n"
+			"  <attribute>%s</attribute>\n"
+			"  <iterations>%u</iterations>\n"
+			"  <openNs>%llu</openNs>\n"
+			"  <cachedNs>%llu</cachedNs>\n"
+			"  <cached>%d</cached>\n"
+			"</sysfsbench>\n",
+			attribute, iterations,
+			(unsigned long long)uncachedTime,
+			(unsigned long long)cachedTime,
+			isCached);
+	}
+exit:
+	if (rc != ESIF_OK) {
+		esif_ccb_sprintf(OUT_BUF_LEN, output, "%s\n", esif_rc_str(rc));
+	}
+	return output;
+}
+
 static char* esif_shell_cmd_addpart(EsifShellCmdPtr shell)
 {
 	int argc = shell->argc;
@@ -8916,6 +10010,12 @@ static char *esif_shell_cmd_help(EsifShellCmdPtr shell)
 		"echo [?] [parameter...]                  Echos Parameters - if ? is used, each\n"
 		"                                         parameter is on a separate line\n"
 		"memstats [reset]                         Show/Reset Memory Statistics\n"
+		"mempools                                 Show UF Memory Pool Statistics\n"
+		"queuebench [producers] [items] [ringsize]  Compare Linked List and Ring Buffer Queue Performance\n"
+		"dvbench [keys ...]                       Compare DataCache Sorted Insert and Bulk Load Performance\n"
+		"hashbench [iterations]                   Measure Hash Table Lookups using loaded DSP Primitive keys\n"
+		"eventbench [events] [observers ...]      Measure Event Dispatch to Observers of all Participants\n"
+		"sysfsbench [iterations] [attribute]      Compare Attribute Reads with and without Cached Handles\n"
 		"autoexec [command] [...]                 Execute Default Startup Script\n"
 		"affinitize <process name> [mask]         If mask is present, set mask for process by name, otherwise get current mask\n"
 		"\n"
@@ -9069,6 +10169,8 @@ static char *esif_shell_cmd_help(EsifShellCmdPtr shell)
 		"EVENT API:\n"
 		"event [enable|disable] <eventType> [participant] [domain]   Enable/Disable/Send a User Mode Event\n" 
 		"events [namespec] [appspec]                   Display all events registered in the Event Manager\n"
+		"eventstats [reset]                            Display Event Manager queue, pool, shard and latency statistics\n"
+		"eventcoalesce [<eventType> <none|latest|first>|reset]  Display or Set Event Manager coalescing rules\n"
 		"eventkpe <eventType> <index> [u32 data]       Send Kernel Event to KPE\n"
 		"                                              index - Index of the KPE based on\n"
 		"                                              the order of driversk (0-based)\n"
@@ -12376,7 +13478,10 @@ static char *esif_shell_cmd_get_available_devices(EsifShellCmdPtr shell)
 	}
 	
 exit:
-	esif_ccb_free(reqPtr);
+	if (reqPtr) {
+		reqPtr->buf_len = 0; // buf_ptr is a local buffer
+	}
+	EsifData_Destroy(reqPtr);
 	EsifData_Destroy(rspPtr);
 	return output;
 }
@@ -13768,10 +14873,14 @@ static EsifShellMap ShellCommands[] = {
 	{"dst",                  fnArgv, (VoidFunc)esif_shell_cmd_dst                 },
 	{"dstn",                 fnArgv, (VoidFunc)esif_shell_cmd_dstn                },
 	{"dv",                   fnArgv, (VoidFunc)esif_shell_cmd_config              },
+	{"dvbench",              fnArgv, (VoidFunc)esif_shell_cmd_dvbench             },
 	{"echo",                 fnArgv, (VoidFunc)esif_shell_cmd_echo                },
 	{"event",                fnArgv, (VoidFunc)esif_shell_cmd_event               },
+	{"eventbench",           fnArgv, (VoidFunc)esif_shell_cmd_eventbench          },
+	{"eventcoalesce",        fnArgv, (VoidFunc)esif_shell_cmd_eventcoalesce       },
 	{"eventkpe",             fnArgv, (VoidFunc)esif_shell_cmd_eventkpe            },
 	{"events",               fnArgv, (VoidFunc)esif_shell_cmd_events              },
+	{"eventstats",           fnArgv, (VoidFunc)esif_shell_cmd_eventstats          },
 	{"exit",                 fnArgv, (VoidFunc)esif_shell_cmd_exit                },
 	{"format",               fnArgv, (VoidFunc)esif_shell_cmd_format              },
 	{"getb",                 fnArgv, (VoidFunc)esif_shell_cmd_getb                },
@@ -13788,6 +14897,7 @@ static EsifShellMap ShellCommands[] = {
 	{"getp_s",               fnArgv, (VoidFunc)esif_shell_cmd_getp                },
 	{"getp_t",               fnArgv, (VoidFunc)esif_shell_cmd_getp                },
 	{"getp_u32",             fnArgv, (VoidFunc)esif_shell_cmd_getp                },
+	{"hashbench",            fnArgv, (VoidFunc)esif_shell_cmd_hashbench           },
 	{"help",                 fnArgv, (VoidFunc)esif_shell_cmd_help                },
 	{"idsp",                 fnArgv, (VoidFunc)esif_shell_cmd_idsp                },
 	{"info",                 fnArgv, (VoidFunc)esif_shell_cmd_info                },
@@ -13801,6 +14911,7 @@ static EsifShellMap ShellCommands[] = {
 	{"load",                 fnArgv, (VoidFunc)esif_shell_cmd_load                },
 	{"loadtst",              fnArgv, (VoidFunc)esif_shell_cmd_load                },
 	{"log",                  fnArgv, (VoidFunc)esif_shell_cmd_log                 },
+	{"mempools",             fnArgv, (VoidFunc)esif_shell_cmd_mempools            },
 	{"memstats",             fnArgv, (VoidFunc)esif_shell_cmd_memstats            },
 	{"nolog",                fnArgv, (VoidFunc)esif_shell_cmd_nolog               },
 	{"part",                 fnArgv, (VoidFunc)esif_shell_cmd_participant         },
@@ -13815,6 +14926,7 @@ static EsifShellMap ShellCommands[] = {
 	{"paths",                fnArgv, (VoidFunc)esif_shell_cmd_paths               },
 	{"proof",                fnArgv, (VoidFunc)esif_shell_cmd_load                },
 	{"prooftst",             fnArgv, (VoidFunc)esif_shell_cmd_load                },
+	{"queuebench",           fnArgv, (VoidFunc)esif_shell_cmd_queuebench          },
 	{"quit",                 fnArgv, (VoidFunc)esif_shell_cmd_quit                },
 	{"rem",                  fnArgv, (VoidFunc)esif_shell_cmd_rem                 },
 	{"repeat",               fnArgv, (VoidFunc)esif_shell_cmd_repeat              },
@@ -13836,6 +14948,7 @@ static EsifShellMap ShellCommands[] = {
 	{"sleep",                fnArgv, (VoidFunc)esif_shell_cmd_sleep               },
 	{"soe",                  fnArgv, (VoidFunc)esif_shell_cmd_soe                 },
 	{"status",               fnArgv, (VoidFunc)esif_shell_cmd_status              },
+	{"sysfsbench",           fnArgv, (VoidFunc)esif_shell_cmd_sysfsbench          },
 	{"tableobject",          fnArgv, (VoidFunc)esif_shell_cmd_tableobject         },
 	{"test",                 fnArgv, (VoidFunc)esif_shell_cmd_test                },	
 	{"thermalapi",           fnArgv, (VoidFunc)EsifShellCmdThermalApi             },
@@ -337,7 +337,10 @@ static enum esif_rc get_supported_brightness_levels(char *table_str, char *parti
 static eEsifError get_participant_scope(char *acpi_name, char *acpi_scope);
 static int SetActionContext(struct sysfsActionHashKey *keyPtr, EsifString devicePathName, EsifString deviceNodeName, Bool isWrite);
 static Int32 SetActionContextWithFd(struct sysfsActionHashKey *keyPtr, Int32 fd);
+static size_t GetActionContext(struct sysfsActionHashKey *keyPtr);
+static int AddActionContext(struct sysfsActionHashKey *keyPtr, size_t actionContext);
 static struct esif_ht *actionHashTablePtr = NULL;
+static esif_ccb_lock_t actionHashTableLock; /* Primitives run concurrently and Adds may resize the table */
 static char sys_long_string_val[MAX_SYSFS_STRING];
 static eEsifError SetFanLevel(const EsifUpPtr upPtr, const EsifDataPtr requestPtr, const EsifString devicePathPtr);
 static eEsifError SetBrightnessLevel(const EsifUpPtr upPtr, const EsifDataPtr requestPtr, const EsifString devicePathPtr);
@@ -654,7 +657,7 @@ static eEsifError ESIF_CALLCONV ActionSysfsGet(
 	key.participantId = EsifUp_GetInstance(upPtr);
 	key.primitiveTuple = primitivePtr->tuple;
 	key.actionPriority = fpcActionPtr->priority;
-	actionContext = (size_t) esif_ht_get_item(actionHashTablePtr, (u8 *)&key, sizeof(key));
+	actionContext = GetActionContext(&key);
 	sysopt = *(enum esif_sysfs_command *) command;
 
 	switch (sysopt) {
@@ -1125,7 +1128,7 @@ static eEsifError ESIF_CALLCONV ActionSysfsGet(
 				// re-evaluate the action context because all various instances of C-state residency
 				// (PC2 - PC10) share the same file descriptor.
 				key.primitiveTuple.instance = 255; // Do no care - all PCx reads share the same file path
-				actionContext = (size_t) esif_ht_get_item(actionHashTablePtr, (u8 *)&key, sizeof(key));
+				actionContext = GetActionContext(&key);
 				if (ESIF_OK == GetUIntFromActionContext(actionContext, parm4, responsePtr))
 					goto exit;
 
@@ -1925,8 +1928,7 @@ static int SetActionContext(struct sysfsActionHashKey *keyPtr, EsifString device
 	}
 
 	if (fd != -1) {
-		size_t actionContext = (size_t) fd;
-		ret = esif_ht_add_item(actionHashTablePtr, (u8 *) keyPtr, sizeof(struct sysfsActionHashKey), (void *) actionContext);
+		ret = AddActionContext(keyPtr, (size_t) fd);
 	}
 
 	return ret;
@@ -1942,13 +1944,34 @@ static Int32 SetActionContextWithFd(struct sysfsActionHashKey *keyPtr, Int32 fd)
 		goto exit;
 	}
 
-	size_t actionContext = (size_t) fd;
-	ret = esif_ht_add_item(actionHashTablePtr, (u8 *) keyPtr, sizeof(struct sysfsActionHashKey), (void *) actionContext);
+	ret = AddActionContext(keyPtr, (size_t) fd);
 
 exit:
 	return ret;
 }
 
+static size_t GetActionContext(struct sysfsActionHashKey *keyPtr)
+{
+	size_t actionContext = 0;
+
+	esif_ccb_read_lock(&actionHashTableLock);
+	actionContext = (size_t) esif_ht_get_item(actionHashTablePtr, (u8 *) keyPtr, sizeof(*keyPtr));
+	esif_ccb_read_unlock(&actionHashTableLock);
+
+	return actionContext;
+}
+
+static int AddActionContext(struct sysfsActionHashKey *keyPtr, size_t actionContext)
+{
+	int ret = 0;
+
+	esif_ccb_write_lock(&actionHashTableLock);
+	ret = esif_ht_add_item(actionHashTablePtr, (u8 *) keyPtr, sizeof(*keyPtr), (void *) actionContext);
+	esif_ccb_write_unlock(&actionHashTableLock);
+
+	return ret;
+}
+
 
 static int replace_str(char *str, char *orig, char *new, char *rpl_buff, int rpl_buff_len)
 {
@@ -3930,8 +3953,9 @@ static EsifActIfaceStatic g_sysfs = {
 
 enum esif_rc EsifActSysfsInit()
 {
-	EsifActMgr_RegisterAction((EsifActIfacePtr)&g_sysfs);
+	esif_ccb_lock_init(&actionHashTableLock);
 	actionHashTablePtr = esif_ht_create(MAX_ACTION_HT_SIZE);
+	EsifActMgr_RegisterAction((EsifActIfacePtr)&g_sysfs);
 	SetThermalZonePolicy();
 	GetNumberOfCpuCores();
 	AllocateThermalZones();
@@ -3943,8 +3967,12 @@ enum esif_rc EsifActSysfsInit()
 void EsifActSysfsExit()
 {
 	EsifActMgr_UnregisterAction((EsifActIfacePtr)&g_sysfs);
+	esif_ccb_write_lock(&actionHashTableLock);
 	if (actionHashTablePtr)
 		esif_ht_destroy(actionHashTablePtr, ActionContextCleanUp);
+	actionHashTablePtr = NULL;
+	esif_ccb_write_unlock(&actionHashTableLock);
+	esif_ccb_lock_uninit(&actionHashTableLock);
 	if(cpufreq)
 		esif_ccb_free(cpufreq);
 	ResetThermalZonePolicy();
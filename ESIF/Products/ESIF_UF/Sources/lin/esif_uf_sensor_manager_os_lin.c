@@ -37,8 +37,17 @@
 #include <sys/file.h>
 #include <math.h>
 #include <dirent.h>
-
-#define ESIF_IIO_SAMPLE_PERIOD 5 // In seconds
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <signal.h>
+
+#define ESIF_IIO_SAMPLE_PERIOD 5 // In seconds; Base Fallback Interval for each Sensor Source
+#define ESIF_SENSOR_MAX_INTERVAL_POLLED ESIF_IIO_SAMPLE_PERIOD // Sources without Notifications are always checked at the base rate
+#define ESIF_SENSOR_MAX_INTERVAL_BATTERY 120 // Max Fallback Interval for Battery Percentage (seconds)
+#define ESIF_SENSOR_MAX_INTERVAL_NOTIFY 300 // Max Fallback Interval for Sources with Notifications (seconds)
+#define ESIF_SENSOR_COALESCE_MSEC 1000 // Fallback Checks due within this window share one wakeup
+#define ESIF_UEVENT_BUF_SIZE 4096
 #define MAX_GFORCE (9.8 * 2) // All Chromebooks accel have default -2G to 2G range
 #define MOTION_CHANGE_THRESHOLD 0.007 // Normalize threshold to declare motion state change
 #define PLAT_TYPE_CLAMSHELL_ANGLE_MIN 5
@@ -1018,56 +1027,351 @@ static void CheckBatteryPercentChange(void)
 	}
 }
 
-static void *EsifIio_Poll(void *ptr)
+// Sensor Sources are re-checked when their Notification fd fires (if any) or when their
+// Fallback Interval expires. Fallback Intervals start at ESIF_IIO_SAMPLE_PERIOD and double
+// each time a check finds no change (up to maxInterval), and due checks are coalesced into
+// a single wakeup. Sources without Notifications (or whose notifier could not be opened)
+// have a maxInterval of ESIF_IIO_SAMPLE_PERIOD, so they are checked as often as before.
+typedef enum SensorSourceId_e {
+	SENSOR_SRC_ACCEL = 0,
+	SENSOR_SRC_LID_ANGLE,
+	SENSOR_SRC_DOCK_MODE,
+	SENSOR_SRC_LID_STATE,
+	SENSOR_SRC_POWER_SRC,
+	SENSOR_SRC_BATTERY,
+	SENSOR_SRC_POWER_SLIDER,
+	SENSOR_SRC_WORKLOAD,
+	SENSOR_SRC_MAX,
+	SENSOR_SRC_UEVENT = SENSOR_SRC_MAX,	// epoll tag for the netlink uevent socket
+	SENSOR_SRC_STOP,					// epoll tag for the stop eventfd
+} SensorSourceId;
+
+typedef struct SensorSource_s {
+	const char	*name;
+	Bool		(*check)(void);	// Returns ESIF_TRUE if the source changed (or is active)
+	UInt32		maxInterval;	// Max Fallback Interval (seconds)
+	Bool		enabled;
+	Bool		pending;		// Notification received; check on next pass
+	int			notifyFd;		// Notification fd registered with epoll, or -1
+	Bool		notifyDrain;	// Notification fd must be drained (inotify) rather than re-read (sysfs)
+	UInt32		interval;		// Current Fallback Interval (seconds)
+	UInt64		nextDue;		// Next Fallback Check (msec)
+} SensorSource, *SensorSourcePtr;
+
+static Bool SensorSrc_CheckAccel(void);
+static Bool SensorSrc_CheckLidAngle(void);
+static Bool SensorSrc_CheckDockMode(void);
+static Bool SensorSrc_CheckLidState(void);
+static Bool SensorSrc_CheckPowerSrc(void);
+static Bool SensorSrc_CheckBattery(void);
+static Bool SensorSrc_CheckPowerSlider(void);
+static Bool SensorSrc_CheckWorkload(void);
+
+static SensorSource gSensorSources[SENSOR_SRC_MAX] = {
+	{ "accel",			SensorSrc_CheckAccel,		ESIF_SENSOR_MAX_INTERVAL_POLLED },
+	{ "lid_angle",		SensorSrc_CheckLidAngle,	ESIF_SENSOR_MAX_INTERVAL_POLLED },
+	{ "dock_mode",		SensorSrc_CheckDockMode,	ESIF_SENSOR_MAX_INTERVAL_NOTIFY },
+	{ "lid_state",		SensorSrc_CheckLidState,	ESIF_SENSOR_MAX_INTERVAL_POLLED },
+	{ "power_src",		SensorSrc_CheckPowerSrc,	ESIF_SENSOR_MAX_INTERVAL_NOTIFY },
+	{ "battery",		SensorSrc_CheckBattery,		ESIF_SENSOR_MAX_INTERVAL_BATTERY },
+	{ "power_slider",	SensorSrc_CheckPowerSlider,	ESIF_SENSOR_MAX_INTERVAL_NOTIFY },
+	{ "workload",		SensorSrc_CheckWorkload,	ESIF_SENSOR_MAX_INTERVAL_POLLED },
+};
+
+static int gSensorMgrEpollFd = -1;
+static int gSensorMgrStopFd = -1;
+static int gSensorMgrUeventFd = -1;
+static int gSensorMgrInotifyFd = -1;
+
+static UInt64 SensorMgr_GetTimeMs(void)
 {
+	struct timespec ts = { 0 };
 
-	UNREFERENCED_PARAMETER(ptr);
+	// Boot time keeps advancing during suspend, so all fallback checks are due on resume
+	clock_gettime(CLOCK_BOOTTIME, &ts);
+	return ((UInt64)ts.tv_sec * 1000) + ((UInt64)ts.tv_nsec / 1000000);
+}
 
+static Bool SensorSrc_CheckAccel(void)
+{
+	PlatformOrientation platOrientation = gPlatOrientation;
+	DisplayOrientation dispOrientation = gDispOrientation;
+	Motion inMotion = gInMotion;
 
-	while(gEsifSensorMgrStarted) {
-		// Update sensor values
-		if (gAccelLid) {
-			AccelRawUpdate(gAccelLid);
-		}
+	AccelRawUpdate(gAccelLid);
+	AccelRawUpdate(gAccelBase);
+
+	// Platform and display orientation are only valid if the lid accel is present
+	if (gAccelLid) {
+		CheckDispPlatOrientation(gAccelLid);
+	}
+
+	// Motion detection
+	if (gAccelLid) {
+		CheckMotionChange(gAccelLid);
+	} else if (gAccelBase) {
+		CheckMotionChange(gAccelBase);
+	}
+
+	// Keep sampling at the base rate while the platform is moving
+	return (platOrientation != gPlatOrientation || dispOrientation != gDispOrientation ||
+		inMotion != gInMotion || MOTION_ON == gInMotion);
+}
+
+static Bool SensorSrc_CheckLidAngle(void)
+{
+	PlatformType platType = gPlatType;
+
+	// Platform type change detection (clamshell, tablet, tent, etc.)
+	CheckPlatTypeChange(gLidAngle);
+	return (platType != gPlatType);
+}
+
+static Bool SensorSrc_CheckDockMode(void)
+{
+	DockMode dockMode = gDockMode;
+
+	CheckDockModeChange();
+	return (dockMode != gDockMode);
+}
+
+static Bool SensorSrc_CheckLidState(void)
+{
+	LidState lidState = gLidState;
+
+	CheckLidStateChange();
+	return (lidState != gLidState);
+}
 
-		if (gAccelBase) {
-			AccelRawUpdate(gAccelBase);
+static Bool SensorSrc_CheckPowerSrc(void)
+{
+	PowerSrc powerSrc = g_PowerSrc;
+
+	// Power source(AC/DC)change detection
+	CheckPowerSrcChange();
+	return (powerSrc != g_PowerSrc);
+}
+
+static Bool SensorSrc_CheckBattery(void)
+{
+	UInt32 batteryPercentage = g_BatteryPercentage;
+
+	// Battery percent change detection
+	CheckBatteryPercentChange();
+	return (batteryPercentage != g_BatteryPercentage);
+}
+
+static Bool SensorSrc_CheckPowerSlider(void)
+{
+	PowerSliderMode powerSliderValue = gPowerSliderValue;
+
+	GetPowerSliderMode();
+	return (powerSliderValue != gPowerSliderValue);
+}
+
+static Bool SensorSrc_CheckWorkload(void)
+{
+	char prevWorkload[MAX_PATH] = { 0 };
+
+	// AP Workload Hint feature
+	if (gIsWLHintRegistered != ESIF_TRUE || NULL == gPrevWorkload) {
+		return ESIF_FALSE;
+	}
+	esif_ccb_strcpy(prevWorkload, gPrevWorkload, sizeof(prevWorkload));
+	GetWorkloadHints();
+	return (esif_ccb_strcmp(prevWorkload, gPrevWorkload) != 0);
+}
+
+static void SensorMgr_AddNotifier(SensorSourceId id, int fd, UInt32 events)
+{
+	struct epoll_event ev = { 0 };
+
+	ev.events = events;
+	ev.data.u32 = (UInt32)id;
+	if (epoll_ctl(gSensorMgrEpollFd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+		ESIF_TRACE_WARN("epoll_ctl() failed for sensor source %d: %s\n", id, strerror(errno));
+	}
+	else if (id < SENSOR_SRC_MAX) {
+		gSensorSources[id].notifyFd = fd;
+	}
+}
+
+static void SensorMgr_OpenNotifiers(void)
+{
+	struct sockaddr_nl addr = { 0 };
+	char filepath[MAX_PATH] = { 0 };
+
+	gSensorMgrEpollFd = epoll_create1(EPOLL_CLOEXEC);
+	gSensorMgrStopFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	if (gSensorMgrEpollFd < 0 || gSensorMgrStopFd < 0) {
+		ESIF_TRACE_WARN("Unable to create sensor epoll/eventfd, using fallback intervals only\n");
+		goto exit;
+	}
+	SensorMgr_AddNotifier(SENSOR_SRC_STOP, gSensorMgrStopFd, EPOLLIN);
+
+	// Power supply (AC/DC and battery) changes are announced as kernel uevents
+	gSensorMgrUeventFd = socket(AF_NETLINK, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, NETLINK_KOBJECT_UEVENT);
+	if (gSensorMgrUeventFd >= 0) {
+		addr.nl_family = AF_NETLINK;
+		addr.nl_groups = 1; // Kernel uevent multicast group
+		if (bind(gSensorMgrUeventFd, (struct sockaddr *)&addr, sizeof(addr)) == 0) {
+			SensorMgr_AddNotifier(SENSOR_SRC_UEVENT, gSensorMgrUeventFd, EPOLLIN);
+		}
+		else {
+			ESIF_TRACE_WARN("Unable to bind uevent socket: %s\n", strerror(errno));
+			close(gSensorMgrUeventFd);
+			gSensorMgrUeventFd = -1;
 		}
+	}
+	if (gSensorMgrUeventFd < 0) {
+		gSensorSources[SENSOR_SRC_POWER_SRC].maxInterval = ESIF_SENSOR_MAX_INTERVAL_POLLED;
+		gSensorSources[SENSOR_SRC_BATTERY].maxInterval = ESIF_SENSOR_MAX_INTERVAL_POLLED;
+	}
 
-		// Platform and display orientation are only valid if the lid accel is present
-		if (gAccelLid) {
-			CheckDispPlatOrientation(gAccelLid);
+	// sysfs attributes that support sysfs_notify() report EPOLLPRI until re-read
+	if (gFdDocking > 0) {
+		SensorMgr_AddNotifier(SENSOR_SRC_DOCK_MODE, gFdDocking, EPOLLPRI);
+	}
+	if (gSensorSources[SENSOR_SRC_DOCK_MODE].notifyFd < 0) {
+		gSensorSources[SENSOR_SRC_DOCK_MODE].maxInterval = ESIF_SENSOR_MAX_INTERVAL_POLLED;
+	}
+
+	// cpufreq attributes are not sysfs_notify()'d, but user-space writes (the usual way EPP is changed) raise IN_MODIFY
+	gSensorMgrInotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if (gSensorMgrInotifyFd >= 0) {
+		esif_ccb_sprintf(MAX_PATH, filepath, "%s/%s", gPowerSliderBasePath, "energy_performance_preference");
+		if (inotify_add_watch(gSensorMgrInotifyFd, filepath, IN_MODIFY) >= 0) {
+			SensorMgr_AddNotifier(SENSOR_SRC_POWER_SLIDER, gSensorMgrInotifyFd, EPOLLIN);
+			gSensorSources[SENSOR_SRC_POWER_SLIDER].notifyDrain = ESIF_TRUE;
+		}
+		if (gSensorSources[SENSOR_SRC_POWER_SLIDER].notifyFd < 0) {
+			close(gSensorMgrInotifyFd);
+			gSensorMgrInotifyFd = -1;
 		}
+	}
+	if (gSensorSources[SENSOR_SRC_POWER_SLIDER].notifyFd < 0) {
+		gSensorSources[SENSOR_SRC_POWER_SLIDER].maxInterval = ESIF_SENSOR_MAX_INTERVAL_POLLED;
+	}
+exit:
+	return;
+}
 
-		// Motion detection
-		if (gAccelLid) {
-			CheckMotionChange(gAccelLid);
-		} else if (gAccelBase) {
-			CheckMotionChange(gAccelBase);
+static void SensorMgr_CloseNotifiers(void)
+{
+	int i = 0;
+
+	if (gSensorMgrUeventFd >= 0) close(gSensorMgrUeventFd);
+	if (gSensorMgrInotifyFd >= 0) close(gSensorMgrInotifyFd);
+	if (gSensorMgrStopFd >= 0) close(gSensorMgrStopFd);
+	if (gSensorMgrEpollFd >= 0) close(gSensorMgrEpollFd);
+	gSensorMgrUeventFd = -1;
+	gSensorMgrInotifyFd = -1;
+	gSensorMgrStopFd = -1;
+	gSensorMgrEpollFd = -1;
+
+	for (i = 0; i < SENSOR_SRC_MAX; i++) {
+		gSensorSources[i].notifyFd = -1;
+	}
+}
+
+// Drain all queued uevents and return whether any were for the power_supply subsystem
+static Bool SensorMgr_ReadUevents(void)
+{
+	char buf[ESIF_UEVENT_BUF_SIZE] = { 0 };
+	Bool isPowerSupply = ESIF_FALSE;
+	ssize_t len = 0;
+	size_t offset = 0;
+
+	while ((len = recv(gSensorMgrUeventFd, buf, sizeof(buf) - 1, MSG_DONTWAIT)) > 0) {
+		buf[len] = '\0';
+
+		// Payload is "action@devpath" followed by NUL-separated KEY=VALUE strings
+		for (offset = 0; offset < (size_t)len; offset += esif_ccb_strlen(&buf[offset], sizeof(buf) - offset) + 1) {
+			if (esif_ccb_strcmp(&buf[offset], "SUBSYSTEM=power_supply") == 0) {
+				isPowerSupply = ESIF_TRUE;
+				break;
+			}
 		}
-		// Dock mode change detection
-		CheckDockModeChange();
-		// Power source(AC/DC)change detection
-		CheckPowerSrcChange();
+	}
+	return isPowerSupply;
+}
 
-		// Lid state change detection
-		CheckLidStateChange();
+static void SensorMgr_Drain(int fd)
+{
+	char buf[ESIF_UEVENT_BUF_SIZE];
 
+	while (read(fd, buf, sizeof(buf)) > 0)
+		;
+}
 
-		// Platform type change detection (clamshell, tablet, tent, etc.)
-		CheckPlatTypeChange(gLidAngle);
-		if (gIsWLHintRegistered == ESIF_TRUE)
-		{
-			// AP Workload Hint feature
-			GetWorkloadHints();
+// Wait up to timeoutMs (or forever if < 0) for notifications and mark the affected sources pending
+static void SensorMgr_WaitForEvents(int timeoutMs)
+{
+	struct epoll_event events[SENSOR_SRC_STOP + 1];
+	int numEvents = 0;
+	int i = 0;
+	UInt32 id = 0;
+
+	if (gSensorMgrEpollFd < 0) {
+		esif_ccb_sleep_msec(timeoutMs < 0 ? ESIF_IIO_SAMPLE_PERIOD * 1000 : timeoutMs);
+		return;
+	}
+
+	numEvents = epoll_wait(gSensorMgrEpollFd, events, ESIF_ARRAY_LEN(events), timeoutMs);
+	for (i = 0; i < numEvents; i++) {
+		id = events[i].data.u32;
+		if (SENSOR_SRC_STOP == id) {
+			SensorMgr_Drain(gSensorMgrStopFd);
+		}
+		else if (SENSOR_SRC_UEVENT == id) {
+			if (SensorMgr_ReadUevents()) {
+				gSensorSources[SENSOR_SRC_POWER_SRC].pending = ESIF_TRUE;
+				gSensorSources[SENSOR_SRC_BATTERY].pending = ESIF_TRUE;
+			}
 		}
-		//Power Slider Value
-		GetPowerSliderMode();
+		else if (id < SENSOR_SRC_MAX) {
+			if (gSensorSources[id].notifyDrain) {
+				SensorMgr_Drain(gSensorSources[id].notifyFd);
+			}
+			gSensorSources[id].pending = ESIF_TRUE;
+		}
+	}
+}
 
-		// Battery percent change detection
-		CheckBatteryPercentChange();
+static void *EsifIio_Poll(void *ptr)
+{
+	SensorSourcePtr src = NULL;
+	UInt64 now = 0;
+	UInt64 nextWake = 0;
+	Bool changed = ESIF_FALSE;
+	int timeoutMs = 0;
+	int i = 0;
 
-		esif_ccb_sleep(ESIF_IIO_SAMPLE_PERIOD);
+	UNREFERENCED_PARAMETER(ptr);
+
+	while(gEsifSensorMgrStarted) {
+		now = SensorMgr_GetTimeMs();
+		nextWake = 0;
+
+		// Check each source that was notified or whose fallback interval is (nearly) due
+		for (i = 0; i < SENSOR_SRC_MAX; i++) {
+			src = &gSensorSources[i];
+			if (!src->enabled) {
+				continue;
+			}
+			if (src->pending || src->nextDue <= now + ESIF_SENSOR_COALESCE_MSEC) {
+				changed = src->check();
+				src->pending = ESIF_FALSE;
+				src->interval = (changed ? ESIF_IIO_SAMPLE_PERIOD : esif_ccb_min(src->interval * 2, src->maxInterval));
+				src->nextDue = now + ((UInt64)src->interval * 1000);
+			}
+			if (nextWake == 0 || src->nextDue < nextWake) {
+				nextWake = src->nextDue;
+			}
+		}
+
+		timeoutMs = (nextWake == 0 ? -1 : (int)(nextWake > now ? nextWake - now : 0));
+		SensorMgr_WaitForEvents(timeoutMs);
 	}
 
 	return NULL;
@@ -1077,6 +1381,7 @@ static void StartEsifSensorMgr()
 {
 	eEsifError rc1 = ESIF_OK;
 	eEsifError rc2 = ESIF_OK;
+	int i = 0;
 
 	if (!gEsifSensorMgrStarted) {
 		ESIF_TRACE_DEBUG("Starting ESIF Sensor Manager\n");
@@ -1084,6 +1389,20 @@ static void StartEsifSensorMgr()
 		rc2 = EsifSensorMgr_InitializeNonIioBusSensors();
 
 		if (ESIF_OK == rc1 || ESIF_OK == rc2) {
+			for (i = 0; i < SENSOR_SRC_MAX; i++) {
+				gSensorSources[i].enabled = ESIF_TRUE;
+				gSensorSources[i].pending = ESIF_FALSE;
+				gSensorSources[i].notifyFd = -1;
+				gSensorSources[i].notifyDrain = ESIF_FALSE;
+				gSensorSources[i].interval = ESIF_IIO_SAMPLE_PERIOD;
+				gSensorSources[i].nextDue = 0;
+			}
+			gSensorSources[SENSOR_SRC_ACCEL].enabled = (gAccelLid || gAccelBase);
+			gSensorSources[SENSOR_SRC_LID_ANGLE].enabled = (gLidAngle != NULL);
+			gSensorSources[SENSOR_SRC_DOCK_MODE].enabled = (gFdDocking > 0);
+			gSensorSources[SENSOR_SRC_LID_STATE].enabled = (gFdLidState > 0);
+			SensorMgr_OpenNotifiers();
+
 			gEsifSensorMgrStarted = ESIF_TRUE;
 			esif_ccb_thread_create(&gEsifSensorMgrThread, EsifIio_Poll, NULL);
 		} else {
@@ -1094,11 +1413,16 @@ static void StartEsifSensorMgr()
 
 static void StopEsifSensorMgr()
 {
+	UInt64 stop = 1;
+
 	if (gEsifSensorMgrStarted) {
 		ESIF_TRACE_DEBUG("Stopping ESIF Sensor Manager...\n");
 		gEsifSensorMgrStarted = ESIF_FALSE;
-		pthread_cancel(gEsifSensorMgrThread);
+		if (gSensorMgrStopFd < 0 || write(gSensorMgrStopFd, &stop, sizeof(stop)) != sizeof(stop)) {
+			pthread_cancel(gEsifSensorMgrThread);
+		}
 		esif_ccb_thread_join(&gEsifSensorMgrThread);
+		SensorMgr_CloseNotifiers();
 		EsifSensorMgr_DeregisterSensors();
 	}
 }
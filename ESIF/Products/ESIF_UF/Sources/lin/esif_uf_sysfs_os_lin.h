@@ -66,6 +66,11 @@ typedef struct thermalZone_t {
 extern "C" {
 #endif
 
+// Sysfs Handle Cache: SysfsGetString, SysfsGetInt64 and SysfsGetInt keep an open fd per attribute path
+void SysfsHandleCacheInit(void);
+void SysfsHandleCacheExit(void);
+void SysfsInvalidateHandles(const char *pathPrefix); // NULL = All
+
 int SysfsSetString(const char *path, const char *filename, char *val);
 int SysfsSetStringWithError(const char *path, const char *filename, char *buffer, unsigned int length);
 int SysfsGetInt64Direct(int fd, Int64 *p64);
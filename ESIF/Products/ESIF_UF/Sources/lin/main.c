@@ -38,6 +38,8 @@
 #include <sys/file.h>
 #include <unistd.h>
 #include <poll.h>
+#include <ctype.h>
+#include <signal.h>
 
 #ifdef ESIF_FEAT_OPT_HAVE_EDITLINE
 #include <editline/readline.h>
@@ -117,16 +119,13 @@ static void *EsifSysfsReadListen(void *ptr);
 static void EsifSysfsReadExit();
 static Bool EsifSysfsPollEvent();
 static Bool EsifSysfsPeriodicPolling();
-/* Dedicated thread pool to handle SIGRTMIN timer signals */
-static esif_thread_t *g_sigrtmin_thread_pool;
 static Bool g_os_quit = ESIF_FALSE; /* global flag to supress KW flagging as while(1) alternative */
 static esif_ccb_sem_t g_sigquit; /* global semaphore to signal main thread to quit, called from shell exit or sigterm handler */
 
-/* Number of threads in thread pool: default to 1, but will
- * change to the actual number of processore cores if there
- * is support to the _SC_NPROCESSORS_ONLN system configuration
- * at run time. This value can also be overriden by command
- * line argument for experimental purposes.
+/* Number of threads that call timer callbacks: default to 1, but will
+ * change to the actual number of processor cores if there is support
+ * for the _SC_NPROCESSORS_ONLN system configuration at run time. This
+ * value can also be overriden by command line argument.
  */
 static long g_nproc = 1;
 
@@ -506,6 +505,34 @@ exit:
 
 
 
+// Drop cached sysfs handles for a device being removed so its attributes are reopened if it returns
+static void SysfsInvalidateRemovedHandles(const char *buffer, int len)
+{
+	static const char action_remove[] = "ACTION=remove";
+	static const char dev_path[] = "DEVPATH=";
+	char sysfsPath[MAX_SYSFS_PATH] = { 0 };
+	const char *devPath = NULL;
+	Bool isRemove = ESIF_FALSE;
+	int devPathLen = 0;
+	int i = 0;
+
+	while (i < len) {
+		if (len - i >= (int)sizeof(action_remove) && memcmp(buffer + i, action_remove, sizeof(action_remove)) == 0) {
+			isRemove = ESIF_TRUE;
+		}
+		else if (len - i > (int)sizeof(dev_path) - 1 && esif_ccb_strncmp(buffer + i, dev_path, sizeof(dev_path) - 1) == 0) {
+			devPath = buffer + i + sizeof(dev_path) - 1;
+			devPathLen = (int)esif_ccb_strlen(devPath, len - i - (sizeof(dev_path) - 1));
+		}
+		i += esif_ccb_strlen(buffer + i, len - i) + 1;
+	}
+
+	if (isRemove && devPath != NULL && devPathLen > 0) {
+		esif_ccb_sprintf(sizeof(sysfsPath), sysfsPath, "/sys%.*s/", devPathLen, devPath);
+		SysfsInvalidateHandles(sysfsPath);
+	}
+}
+
 static int check_for_uevent(int fd) {
 	eEsifError rc = ESIF_OK;
 	int i = 0;
@@ -533,6 +560,7 @@ static int check_for_uevent(int fd) {
 	if (len <= 0) {
 		return 0;
 	}
+	SysfsInvalidateRemovedHandles(buffer, len);
 
 	while (i < len) {
 
@@ -664,136 +692,357 @@ static void sigusr1_enable()
 	sigaction(SIGUSR1, &action, NULL);
 }
 
-static void sigrtmin_block(void)
+static long get_nproc(long old, long new, long max)
 {
-	/* Block SIGRTMIN; other threads created from the main thread
-	 * will inherit a copy of the signal mask.
-	 */
-	sigset_t set = {0};
-	sigemptyset(&set);
-	sigaddset(&set, SIGRTMIN);
-	if (pthread_sigmask(SIG_BLOCK, &set, NULL)) {
-		ESIF_TRACE_ERROR("Fail to block SIGRTMIN\n");
+	if (new > 0) {
+		return (new > max) ? max : new;
+	} else {
+		return old;
 	}
 }
 
-static void *sigrtmin_worker_thread(void *ptr)
+/*
+ * Sysfs Handle Cache
+ * Attributes read by path keep an open fd, keyed by the full attribute path, so that
+ * each subsequent read is a single pread() instead of open/read/close. Handles are
+ * dropped when a read fails with ENODEV (or similar), when a device is removed, or on exit.
+ */
+#define SYSFS_HANDLE_CACHE_SIZE		256		// Hash Table Slots (must be a power of 2)
+#define SYSFS_HANDLE_CACHE_MAX		192		// Max Live + Deleted Slots; other Attributes are opened on each read
+#define SYSFS_INT_STRING_LEN		64		// Integer Attributes are parsed from the first bytes only
+
+typedef struct SysfsHandle_s {
+	char	*path;		// Full Attribute Path or NULL if Slot is unused
+	UInt32	hash;		// Hash of path
+	int		fd;			// Cached Read-Only fd
+	Bool	deleted;	// Slot was used and must not end a probe sequence
+} SysfsHandle, *SysfsHandlePtr;
+
+static SysfsHandle g_sysfsHandles[SYSFS_HANDLE_CACHE_SIZE];
+static UInt32 g_sysfsHandlesUsed;	// Live + Deleted Slots
+static esif_ccb_lock_t g_sysfsHandlesLock;
+static Bool g_sysfsHandlesInit = ESIF_FALSE;
+
+static UInt32 SysfsHashPath(const char *path)
 {
-	sigset_t set = {0};
-	siginfo_t info = {0};
-	struct esif_tmrm_cb_obj *cb_object_ptr = NULL;
+	UInt32 hash = 2166136261U; // FNV-1a
 
-	UNREFERENCED_PARAMETER(ptr);
-	sigemptyset(&set);
-	sigaddset(&set, SIGRTMIN);
-
-	while (!g_os_quit) { /* This thread will be canceled/killed after esif_uf_exit() */
-		if (-1 == sigwaitinfo(&set, &info)) { /* sigwaitinfo is a cancellation point */
-			/* When there are multiple worker threads waiting for the same signal,
-			 * only one thread will get the signal and its associated info structure,
-			 * and the rest will get an errno of EINTR. In this case, simply continue
-			 * the loop and wait again.
-			 */
-			continue;
+	while (*path) {
+		hash = (hash ^ (UInt8)*path++) * 16777619U;
+	}
+	return hash;
+}
+
+// Return the Slot holding path, or NULL. Caller must hold the lock.
+static SysfsHandlePtr SysfsFindHandleLocked(const char *path, UInt32 hash)
+{
+	UInt32 j = 0;
+	UInt32 slot = 0;
+
+	for (j = 0; j < SYSFS_HANDLE_CACHE_SIZE; j++) {
+		slot = (hash + j) & (SYSFS_HANDLE_CACHE_SIZE - 1);
+		if (g_sysfsHandles[slot].path == NULL) {
+			if (!g_sysfsHandles[slot].deleted) {
+				break;
+			}
+		}
+		else if (g_sysfsHandles[slot].hash == hash && esif_ccb_strcmp(g_sysfsHandles[slot].path, path) == 0) {
+			return &g_sysfsHandles[slot];
 		}
+	}
+	return NULL;
+}
 
-		if (SIGRTMIN != info.si_signo) {
-			ESIF_TRACE_ERROR("Received signal is not SIGRTMIN, ignore\n");
-			continue;
+// Close a Handle and mark its Slot deleted. Caller must hold the write lock.
+static void SysfsDropHandleLocked(SysfsHandlePtr handle)
+{
+	close(handle->fd);
+	esif_ccb_free(handle->path);
+	handle->path = NULL;
+	handle->fd = -1;
+	handle->deleted = ESIF_TRUE;
+}
+
+// Reclaim Deleted Slots by rebuilding the table in place. Caller must hold the write lock.
+static void SysfsCompactHandlesLocked(void)
+{
+	SysfsHandle live[SYSFS_HANDLE_CACHE_MAX] = { 0 };
+	UInt32 count = 0;
+	UInt32 j = 0;
+	UInt32 slot = 0;
+
+	for (j = 0; j < SYSFS_HANDLE_CACHE_SIZE; j++) {
+		if (g_sysfsHandles[j].path != NULL && count < SYSFS_HANDLE_CACHE_MAX) {
+			live[count++] = g_sysfsHandles[j];
+		}
+	}
+	esif_ccb_memset(g_sysfsHandles, 0, sizeof(g_sysfsHandles));
+	for (j = 0; j < count; j++) {
+		slot = live[j].hash & (SYSFS_HANDLE_CACHE_SIZE - 1);
+		while (g_sysfsHandles[slot].path != NULL) {
+			slot = (slot + 1) & (SYSFS_HANDLE_CACHE_SIZE - 1);
 		}
+		g_sysfsHandles[slot] = live[j];
+	}
+	g_sysfsHandlesUsed = count;
+}
 
-		cb_object_ptr = (struct esif_tmrm_cb_obj *) info.si_value.sival_ptr;
-		if (cb_object_ptr && cb_object_ptr->func) {
-			cb_object_ptr->func(cb_object_ptr->cb_handle);
-			cb_object_ptr->func = NULL;
-			/* Use native free function instead of esif_ccb_free(). For explanation,
-			 * please see the comments under esif_ccb_timer_obj_enable_timer() in
-			 * file esif_ccb_timer_lin_user.h.
-			 */
-			free(cb_object_ptr);
-		} else {
-			ESIF_TRACE_ERROR("Invalid timer callback object: (obj=%p, func=%p)\n",
-				cb_object_ptr, (cb_object_ptr ? cb_object_ptr->func : NULL));
+// Cache fd for path, or return ESIF_FALSE if the caller must close it. Caller must hold the write lock.
+static Bool SysfsAddHandleLocked(const char *path, UInt32 hash, int fd)
+{
+	UInt32 slot = hash & (SYSFS_HANDLE_CACHE_SIZE - 1);
+
+	if (SysfsFindHandleLocked(path, hash) != NULL) {
+		return ESIF_FALSE; // Added by another thread
+	}
+	if (g_sysfsHandlesUsed >= SYSFS_HANDLE_CACHE_MAX) {
+		SysfsCompactHandlesLocked();
+		if (g_sysfsHandlesUsed >= SYSFS_HANDLE_CACHE_MAX) {
+			return ESIF_FALSE;
 		}
 	}
+	while (g_sysfsHandles[slot].path != NULL) {
+		slot = (slot + 1) & (SYSFS_HANDLE_CACHE_SIZE - 1);
+	}
+	if ((g_sysfsHandles[slot].path = esif_ccb_strdup((char *)path)) == NULL) {
+		return ESIF_FALSE;
+	}
+	if (!g_sysfsHandles[slot].deleted) {
+		g_sysfsHandlesUsed++;
+	}
+	g_sysfsHandles[slot].hash = hash;
+	g_sysfsHandles[slot].fd = fd;
+	g_sysfsHandles[slot].deleted = ESIF_FALSE;
+	return ESIF_TRUE;
+}
 
-	return NULL;
+// Read a sysfs Attribute into a NUL-terminated buffer using a cached handle. Returns bytes read or -1 on error.
+static ssize_t SysfsReadCached(const char *filepath, char *buf, size_t buf_len)
+{
+	ssize_t len = -1;
+	UInt32 hash = 0;
+	SysfsHandlePtr handle = NULL;
+	int fd = -1;
+	int err = 0;
+
+	if (buf == NULL || buf_len < 1) {
+		return len;
+	}
+	*buf = '\0';
+
+	if (!g_sysfsHandlesInit) {
+		if ((fd = open(filepath, O_RDONLY | O_CLOEXEC)) != -1) {
+			len = pread(fd, buf, buf_len - 1, 0);
+			close(fd);
+		}
+		goto exit;
+	}
+
+	hash = SysfsHashPath(filepath);
+	esif_ccb_read_lock(&g_sysfsHandlesLock);
+	handle = SysfsFindHandleLocked(filepath, hash);
+	if (handle != NULL) {
+		fd = handle->fd;
+		len = pread(fd, buf, buf_len - 1, 0);
+		err = errno;
+	}
+	esif_ccb_read_unlock(&g_sysfsHandlesLock);
+
+	if (handle != NULL) {
+		if (len >= 0 || (err != ENODEV && err != ENOENT && err != ESTALE && err != ENXIO)) {
+			goto exit;
+		}
+
+		// Device was removed (and possibly re-added): drop the stale handle and reopen
+		esif_ccb_write_lock(&g_sysfsHandlesLock);
+		handle = SysfsFindHandleLocked(filepath, hash);
+		if (handle != NULL && handle->fd == fd) {
+			SysfsDropHandleLocked(handle);
+		}
+		esif_ccb_write_unlock(&g_sysfsHandlesLock);
+	}
+
+	if ((fd = open(filepath, O_RDONLY | O_CLOEXEC)) == -1) {
+		len = -1;
+		goto exit;
+	}
+	len = pread(fd, buf, buf_len - 1, 0);
+	if (len >= 0) {
+		esif_ccb_write_lock(&g_sysfsHandlesLock);
+		if (SysfsAddHandleLocked(filepath, hash, fd)) {
+			fd = -1;
+		}
+		esif_ccb_write_unlock(&g_sysfsHandlesLock);
+	}
+	if (fd != -1) {
+		close(fd);
+	}
+exit:
+	if (len >= 0) {
+		buf[len] = '\0';
+	}
+	return len;
 }
 
-static long get_nproc(long old, long new, long max)
+// Parse a decimal integer like "%lld". Returns 1 if parsed, 0 on mismatch, or EOF if there is no token.
+static int SysfsParseInt64(const char *str, Int64 *p64)
 {
-	if (new > 0) {
-		return (new > max) ? max : new;
-	} else {
-		return old;
+	UInt64 val = 0;
+	Bool negative = ESIF_FALSE;
+	const char *digits = NULL;
+
+	while (isspace((unsigned char)*str)) {
+		str++;
+	}
+	if (*str == '\0') {
+		return EOF;
+	}
+	if (*str == '-' || *str == '+') {
+		negative = (*str++ == '-');
+	}
+	for (digits = str; *str >= '0' && *str <= '9'; str++) {
+		val = (val * 10) + (UInt64)(*str - '0');
+	}
+	if (str == digits) {
+		return 0;
 	}
+	*p64 = (negative ? -(Int64)val : (Int64)val);
+	return 1;
 }
 
-static enum esif_rc create_timer_thread_pool(void)
+void SysfsHandleCacheInit(void)
 {
-	int i = 0;
-	enum esif_rc rc = ESIF_OK;
+	if (!g_sysfsHandlesInit) {
+		esif_ccb_lock_init(&g_sysfsHandlesLock);
+		esif_ccb_memset(g_sysfsHandles, 0, sizeof(g_sysfsHandles));
+		g_sysfsHandlesUsed = 0;
+		g_sysfsHandlesInit = ESIF_TRUE;
+	}
+}
 
-	/* Use native malloc instead of esif_ccb_malloc
-	 * because the poll will be freed after esif_uf_exit().
-	 */
-	g_sigrtmin_thread_pool = (esif_thread_t *) malloc(g_nproc * sizeof(esif_thread_t));
-	if (g_sigrtmin_thread_pool) {
-		pthread_attr_t attr;
-
-		for (i = 0; i < g_nproc; ++i) {
-			pthread_attr_init(&attr);
-			pthread_create(&g_sigrtmin_thread_pool[i], &attr, sigrtmin_worker_thread, NULL);
-			pthread_attr_destroy(&attr);
-		}
-	} else {
-		rc = ESIF_E_NO_MEMORY;
+void SysfsHandleCacheExit(void)
+{
+	if (g_sysfsHandlesInit) {
+		SysfsInvalidateHandles(NULL);
+		g_sysfsHandlesInit = ESIF_FALSE;
+		esif_ccb_lock_uninit(&g_sysfsHandlesLock);
 	}
+}
 
-	return rc;
+void SysfsInvalidateHandles(const char *pathPrefix)
+{
+	size_t prefixLen = (pathPrefix ? esif_ccb_strlen(pathPrefix, MAX_SYSFS_PATH) : 0);
+	UInt32 j = 0;
+
+	if (!g_sysfsHandlesInit) {
+		return;
+	}
+	esif_ccb_write_lock(&g_sysfsHandlesLock);
+	for (j = 0; j < SYSFS_HANDLE_CACHE_SIZE; j++) {
+		if (g_sysfsHandles[j].path != NULL &&
+			(prefixLen == 0 || esif_ccb_strncmp(g_sysfsHandles[j].path, pathPrefix, prefixLen) == 0)) {
+			SysfsDropHandleLocked(&g_sysfsHandles[j]);
+		}
+	}
+	if (prefixLen == 0) {
+		esif_ccb_memset(g_sysfsHandles, 0, sizeof(g_sysfsHandles));
+		g_sysfsHandlesUsed = 0;
+	}
+	esif_ccb_write_unlock(&g_sysfsHandlesLock);
 }
 
-static void release_timer_thread_pool(void)
+// Time reads of an integer attribute opened with stdio on each read, as done before the Handle Cache, and then read through the Handle Cache
+eEsifError esif_uf_os_handle_cache_bench(const char *attributePath, UInt32 iterations, UInt64 *uncachedNsPtr, UInt64 *cachedNsPtr, Bool *isCachedPtr)
 {
-	int i = 0;
+	eEsifError rc = ESIF_OK;
+	char filepath[MAX_SYSFS_PATH] = { 0 };
+	char path[MAX_SYSFS_PATH] = { 0 };
+	char *filename = NULL;
+	FILE *fp = NULL;
+	Int64 val = 0;
+	UInt64 startTime = 0;
+	UInt32 j = 0;
 
-	if (g_sigrtmin_thread_pool) {
-		/* All ESIF timers should have been canceled
-		 * after esif_uf_exit() call, so it is safe
-		 * to terminate the g_sigrtmin_thread_pool now.
-		 */
-		for (i = 0; i < g_nproc; ++i) {
-			pthread_cancel(g_sigrtmin_thread_pool[i]);
+	if (attributePath == NULL || uncachedNsPtr == NULL || cachedNsPtr == NULL || isCachedPtr == NULL) {
+		rc = ESIF_E_PARAMETER_IS_NULL;
+		goto exit;
+	}
+	esif_ccb_strcpy(filepath, attributePath, sizeof(filepath));
+	esif_ccb_strcpy(path, attributePath, sizeof(path));
+	filename = strrchr(path, '/');
+	if (iterations < 1 || filename == NULL || filename == path || filename[1] == '\0') {
+		rc = ESIF_E_PARAMETER_IS_OUT_OF_BOUNDS;
+		goto exit;
+	}
+	*filename++ = '\0';
+
+	startTime = esif_ccb_realtime_current().clockticks;
+	for (j = 0; rc == ESIF_OK && j < iterations; j++) {
+		if ((fp = esif_ccb_fopen(filepath, "r", NULL)) == NULL) {
+			rc = ESIF_E_NOT_FOUND;
+			break;
 		}
-		for (i = 0; i < g_nproc; ++i) {
-			pthread_join(g_sigrtmin_thread_pool[i], NULL);
+		if (esif_ccb_fscanf(fp, "%lld", &val) < 1) {
+			rc = ESIF_E_IO_ERROR;
+		}
+		esif_ccb_fclose(fp);
+	}
+	*uncachedNsPtr = (esif_ccb_realtime_current().clockticks - startTime) / iterations;
+	if (rc != ESIF_OK) {
+		goto exit;
+	}
+
+	// Start without a cached handle so the first read opens it, as it would on the first policy read
+	SysfsInvalidateHandles(filepath);
+	startTime = esif_ccb_realtime_current().clockticks;
+	for (j = 0; rc == ESIF_OK && j < iterations; j++) {
+		if (SysfsGetInt64(path, filename, &val) < 1) {
+			rc = ESIF_E_IO_ERROR;
 		}
-		free(g_sigrtmin_thread_pool);
 	}
+	*cachedNsPtr = (esif_ccb_realtime_current().clockticks - startTime) / iterations;
+
+	// The attribute is opened on each read if the cache was full or is not initialized
+	*isCachedPtr = ESIF_FALSE;
+	if (g_sysfsHandlesInit) {
+		esif_ccb_read_lock(&g_sysfsHandlesLock);
+		*isCachedPtr = (SysfsFindHandleLocked(filepath, SysfsHashPath(filepath)) != NULL);
+		esif_ccb_read_unlock(&g_sysfsHandlesLock);
+	}
+exit:
+	return rc;
 }
 
 int SysfsGetString(const char *path, const char *filename, char *str, size_t buf_len)
 {
-	FILE *fd = NULL;
 	int ret = -1;
 	char filepath[MAX_PATH] = { 0 };
-	char scanf_fmt[IIO_STR_LEN] = { 0 };
+	char buf[MAX_SYSFS_STRING] = { 0 };
+	char *token = buf;
+	size_t len = 0;
 
-	if (str == NULL) {
+	if (str == NULL || buf_len < 1) {
 		return ret;
 	}
 
 	esif_ccb_sprintf(MAX_PATH, filepath, "%s/%s", path, filename);
 
-	if ((fd = esif_ccb_fopen(filepath, "r", NULL)) == NULL) {
+	if (SysfsReadCached(filepath, buf, sizeof(buf)) < 0) {
 		return ret;
 	}
 
-	// Use dynamic format width specifier to avoid scanf buffer overflow
-	esif_ccb_sprintf(sizeof(scanf_fmt), scanf_fmt, "%%%ds", (int)buf_len - 1);
-	ret = esif_ccb_fscanf(fd, scanf_fmt, str);
-	esif_ccb_fclose(fd);
-
+	// Return the first whitespace-delimited token, truncated to buf_len - 1 (same as "%<n>s")
+	while (isspace((unsigned char)*token)) {
+		token++;
+	}
+	while (token[len] != '\0' && !isspace((unsigned char)token[len]) && len < buf_len - 1) {
+		len++;
+	}
+	if (len > 0) {
+		esif_ccb_memcpy(str, token, len);
+		str[len] = '\0';
+		ret = 1;
+	}
 	return ret;
 }
 
@@ -824,9 +1073,9 @@ exit:
 
 int SysfsGetInt64(const char *path, const char *filename, Int64 *p64)
 {
-	FILE *fd = NULL;
 	int rc = 0;
 	char filepath[MAX_SYSFS_PATH] = { 0 };
+	char buf[SYSFS_INT_STRING_LEN] = { 0 };
 
 	if (path == NULL || filename == NULL) {
 		goto exit;
@@ -834,11 +1083,10 @@ int SysfsGetInt64(const char *path, const char *filename, Int64 *p64)
 
 	esif_ccb_sprintf(MAX_SYSFS_PATH, filepath, "%s/%s", path, filename);
 
-	if ((fd = esif_ccb_fopen(filepath, "r", NULL)) == NULL) {
+	if (SysfsReadCached(filepath, buf, sizeof(buf)) < 0) {
 		goto exit;
 	}
-	rc = esif_ccb_fscanf(fd, "%lld", p64);
-	esif_ccb_fclose(fd);
+	rc = SysfsParseInt64(buf, p64);
 
 exit:
 	// Klocwork bounds check. Should depend on context
@@ -851,11 +1099,13 @@ exit:
 int SysfsGetInt64Direct(int fd, Int64 *p64)
 {
 	int rc = 0;
-	char buf[MAX_SYSFS_STRING] = {0};
+	ssize_t len = 0;
+	char buf[SYSFS_INT_STRING_LEN] = {0};
 
-	lseek(fd, 0, SEEK_SET);
-	if (read(fd, buf, MAX_SYSFS_STRING) > 0) {
-		rc = esif_ccb_sscanf(buf, "%lld", p64);
+	len = pread(fd, buf, sizeof(buf) - 1, 0);
+	if (len > 0) {
+		buf[len] = '\0';
+		rc = SysfsParseInt64(buf, p64);
 		if (rc < 1) {
 			ESIF_TRACE_WARN("Failed to get file scan. Error code: %d .\n",rc);
 		}
@@ -869,20 +1119,22 @@ int SysfsGetInt64Direct(int fd, Int64 *p64)
 
 eEsifError SysfsGetInt(const char *path, const char *filename, int *pInt)
 {
-	FILE *fp = NULL;
 	eEsifError rc = ESIF_OK;
 	char filepath[MAX_PATH] = { 0 };
+	char buf[SYSFS_INT_STRING_LEN] = { 0 };
+	Int64 val = 0;
+
 	esif_ccb_sprintf(MAX_PATH, filepath, "%s/%s", path, filename);
 
-	if ((fp = esif_ccb_fopen(filepath, "r", NULL)) == NULL) {
+	if (SysfsReadCached(filepath, buf, sizeof(buf)) < 0) {
 		rc = ESIF_E_INVALID_HANDLE;
 		goto exit;
 	}
-	if (esif_ccb_fscanf(fp, "%d", pInt) <= 0) {
+	if (SysfsParseInt64(buf, &val) <= 0) {
 		rc = ESIF_E_INVALID_HANDLE;
+		goto exit;
 	}
-
-	esif_ccb_fclose(fp);
+	*pInt = (int)val;
 
 exit:
 	return rc;
@@ -891,14 +1143,20 @@ exit:
 eEsifError SysfsGetIntDirect(int fd, int *pInt)
 {
 	eEsifError rc = ESIF_OK;
+	ssize_t len = 0;
+	Int64 val = 0;
 	char buf[IIO_STR_LEN] = {0};
 
-	lseek(fd, 0, SEEK_SET);
-	if (read(fd, buf, IIO_STR_LEN) > 0) {
-		if (esif_ccb_sscanf(buf, "%d", pInt) <= 0) {
+	len = pread(fd, buf, sizeof(buf) - 1, 0);
+	if (len > 0) {
+		buf[len] = '\0';
+		if (SysfsParseInt64(buf, &val) <= 0) {
 			rc = ESIF_E_INVALID_HANDLE;
 			ESIF_TRACE_WARN("Failed to get file scan. Error code: %d .\n",rc);
 		}
+		else {
+			*pInt = (int)val;
+		}
 	}
 	else {
 		rc = ESIF_E_INVALID_HANDLE;
@@ -1649,14 +1907,9 @@ static int run_as_daemon(int start_with_pipe, int start_with_log, int start_in_b
 	if (!instance_lock()) {
 		return ESIF_FALSE;
 	}
-	sigterm_enable();
 
-	/* 4. Block SIGRTMIN (will re-enable it in dedicated thread pool) */
-	sigrtmin_block();
-	/* Start the thread pool that handles SIGRTMIN */
-	if (ESIF_OK != create_timer_thread_pool()) {
-		return ESIF_FALSE;
-	}
+	/* 4. Enable SIGTERM handler */
+	sigterm_enable();
 
 	/* 5. Change to known directory.  Performed in main */
 	/* 6. Close all file descriptors incuding stdin, stdout, stderr */
@@ -1799,12 +2052,6 @@ static int run_as_server(FILE* input, char* command, int quit_after_command)
 	if (!instance_lock()) {
 		goto exit;
 	}
-	sigrtmin_block(); /* Block SIGRTMIN (will re-enable it in dedicated thread pool) */
-	/* Start the thread pool that handles SIGRTMIN */
-	if (ESIF_OK != create_timer_thread_pool()) {
-		CMD_OUT("Cannot create timer thread pool, exiting\n");
-		goto exit;
-	}
 	sigterm_enable();
 	esif_shell_set_start_script(ESIF_STARTUP_SCRIPT_SERVER_MODE);
 	esif_uf_init();
@@ -1929,6 +2176,7 @@ int main (int argc, char **argv)
 	// Init ESIF
 	esif_main_init(ESIF_PATHLIST);
 	esif_ccb_sem_init(&g_sigquit);
+	SysfsHandleCacheInit();
 
 #ifdef ESIF_FEAT_OPT_ACTION_SYSFS
 	// Do not start kernel driver IPC event thread for sysfs builds
@@ -1936,9 +2184,8 @@ int main (int argc, char **argv)
 #endif
 
 	/* Find number of online CPU cores if the feature is available,
-	 * and then assign it to a global which we will use later to
-	 * create the equivalent number of timer worker threads to
-	 * serve timer expiration events most efficiently.
+	 * and use it as the number of timer worker threads so that one
+	 * slow timer callback does not delay the others.
 	 */
 	g_nproc = get_nproc(g_nproc, sysconf(_SC_NPROCESSORS_ONLN), MAX_TIMER_THREADS_AUTO);
 
@@ -2068,6 +2315,8 @@ int main (int argc, char **argv)
 		optind++;
 	}
 
+	esif_ccb_tmrm_set_worker_count((u32)g_nproc);
+
 #if defined (ESIF_ATTR_DAEMON)
 	// Gracefully Terminate all ipf_ufd processes (including this process)
 	// This will automatically reload ipf_ufd if configured in /etc/init/dptf.conf [enabled for Chrome & Android]
@@ -2125,10 +2374,9 @@ int main (int argc, char **argv)
 
 	/* Exit ESIF */
 	esif_uf_exit();
+	SysfsHandleCacheExit();
 
-	/* Stop and join the SIGRTMIN worker thread */
 	g_os_quit = ESIF_TRUE;
-	release_timer_thread_pool();
 	esif_ccb_sem_uninit(&g_sigquit);
 
 	/* Release Instance Lock and exit*/
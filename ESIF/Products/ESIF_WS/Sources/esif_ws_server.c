@@ -43,6 +43,7 @@
 
 #define WS_MAX_CLIENT_SENDBUF	(8*1024*1024)	// Max size of client send buffer (multiple messages)
 #define WS_MAX_CLIENT_RECVBUF	(8*1024*1024)	// Max size of client receive buffer (multiple messages)
+#define WS_MAX_IOVECS			64				// Max Buffers per Gather Send
 
 WebServerPtr g_WebServer = NULL;	// Global Web Server Singleton Intance
 
@@ -255,6 +256,40 @@ void WebListener_Close(WebListenerPtr self)
 	}
 }
 
+//// WebBuffer Object Methods ////
+
+// Create a Reference Counted Output Buffer, optionally initialized with a copy of data
+WebBufferPtr WebBuffer_Create(const void *data, size_t buf_len)
+{
+	WebBufferPtr self = esif_ccb_malloc(sizeof(*self) + buf_len);
+	if (self) {
+		atomic_set(&self->refCount, 1);
+		self->buf_len = buf_len;
+		if (data && buf_len) {
+			esif_ccb_memcpy(self->data, data, buf_len);
+		}
+	}
+	return self;
+}
+
+// Take a Reference
+void WebBuffer_GetRef(WebBufferPtr self)
+{
+	if (self) {
+		atomic_inc(&self->refCount);
+	}
+}
+
+// Release a Reference
+void WebBuffer_PutRef(WebBufferPtr self)
+{
+	if (self) {
+		if (atomic_dec(&self->refCount) == 0) {
+			esif_ccb_free(self);
+		}
+	}
+}
+
 //// WebClient Object Methods ////
 
 // Initialize a WebClient Object
@@ -268,12 +303,105 @@ void WebClient_Init(WebClientPtr self)
 	}
 }
 
+// Append unsent data to the Send Queue, referencing its Output Buffer if it has one, otherwise a copy of it
+static esif_error_t WebClient_QueueSegment(WebClientPtr self, const void *data, size_t length, WebBufferPtr buffer)
+{
+	esif_error_t rc = ESIF_E_NO_MEMORY;
+	WebSegmentPtr segment = NULL;
+
+	if (self->sendBufLen + length <= WS_MAX_CLIENT_SENDBUF && (segment = esif_ccb_malloc(sizeof(*segment))) != NULL) {
+		if (buffer) {
+			WebBuffer_GetRef(buffer);
+			segment->buffer = buffer;
+			segment->data = (u8 *)data;
+		}
+		else if ((segment->buffer = WebBuffer_Create(data, length)) != NULL) {
+			segment->data = segment->buffer->data;
+		}
+
+		if (segment->buffer == NULL) {
+			esif_ccb_free(segment);
+		}
+		else {
+			segment->length = length;
+			if (self->sendTail) {
+				self->sendTail->next = segment;
+			}
+			else {
+				self->sendHead = segment;
+			}
+			self->sendTail = segment;
+			self->sendBufLen += length;
+			rc = ESIF_OK;
+		}
+	}
+	return rc;
+}
+
+// Remove sent bytes from the head of the Send Queue, releasing each Segment once it has been completely sent
+static void WebClient_ConsumeSendQueue(WebClientPtr self, size_t bytes)
+{
+	while (self->sendHead && (bytes > 0 || self->sendHead->length == 0)) {
+		WebSegmentPtr segment = self->sendHead;
+		size_t consumed = esif_ccb_min(bytes, segment->length);
+
+		segment->data += consumed;
+		segment->length -= consumed;
+		self->sendBufLen -= consumed;
+		bytes -= consumed;
+
+		if (segment->length == 0) {
+			self->sendHead = segment->next;
+			if (self->sendHead == NULL) {
+				self->sendTail = NULL;
+			}
+			WebBuffer_PutRef(segment->buffer);
+			esif_ccb_free(segment);
+		}
+	}
+}
+
+// Do Non-Blocking Gather Send of as much of the Send Queue as the socket will accept
+static esif_error_t WebClient_FlushSendQueue(WebClientPtr self)
+{
+	esif_error_t rc = ESIF_OK;
+
+	while (rc == ESIF_OK && self->sendHead != NULL) {
+		esif_ccb_iovec_t iov[WS_MAX_IOVECS];
+		WebSegmentPtr segment = NULL;
+		size_t iovcnt = 0;
+		size_t total = 0;
+		ssize_t ret = 0;
+
+		for (segment = self->sendHead; segment != NULL && iovcnt < WS_MAX_IOVECS; segment = segment->next) {
+			esif_ccb_iovec_set(&iov[iovcnt], segment->data, segment->length);
+			total += segment->length;
+			iovcnt++;
+		}
+
+		ret = esif_ccb_socket_sendv(self->socket, iov, iovcnt, WS_NONBLOCKING_FLAGS);
+		if (ret == SOCKET_ERROR) {
+			if (esif_ccb_socket_error() != ESIF_SOCKERR_EWOULDBLOCK) {
+				rc = ESIF_E_WS_SOCKET_ERROR;
+			}
+			break;
+		}
+		WebClient_ConsumeSendQueue(self, (size_t)ret);
+
+		// Stop when the socket send buffer is full
+		if ((size_t)ret < total) {
+			break;
+		}
+	}
+	return rc;
+}
+
 // Close Web Client
 void WebClient_Close(WebClientPtr self)
 {
 	if (self) {
 		esif_ccb_free(self->ipAddr);
-		esif_ccb_free(self->sendBuf);
+		WebClient_ConsumeSendQueue(self, self->sendBufLen);
 		esif_ccb_free(self->recvBuf);
 		esif_ccb_free(self->httpBuf);
 		esif_ccb_free(self->httpRequest);
@@ -285,82 +413,87 @@ void WebClient_Close(WebClientPtr self)
 	}
 }
 
-// Write a Buffer to a WebClient
-esif_error_t WebClient_Write(WebClientPtr self, void *buffer, size_t buf_len)
+// Write a Vector of Buffers to a WebClient using a single Gather Send.
+// Elements with an Output Buffer are queued by reference if unsent; all others are copied only if unsent.
+esif_error_t WebClient_WriteV(WebClientPtr self, const WebIoVec *iov, size_t iovcnt)
 {
 	esif_error_t rc = ESIF_E_PARAMETER_IS_NULL;
 
-	if (self && self->socket != INVALID_SOCKET) {
+	if (self && self->socket != INVALID_SOCKET && (iov != NULL || iovcnt == 0)) {
 		int send_flags = (self->type == ClientWebsocket ? WS_NONBLOCKING_FLAGS : WS_SEND_FLAGS);
-		ssize_t ret = 0;
+		size_t total = 0;
+		size_t sent = 0;
+		size_t j = 0;
 		rc = ESIF_OK;
 
 		// Debug HTTP Response
-		if (buffer && esif_ccb_strncmp(buffer, "HTTP/", 5) == 0) {
-			WS_TRACE_DEBUG("%.*s", (int)buf_len, (char *)buffer);
+		if (iovcnt > 0 && iov[0].data && iov[0].length >= 5 && esif_ccb_strncmp(iov[0].data, "HTTP/", 5) == 0) {
+			WS_TRACE_DEBUG("%.*s", (int)iov[0].length, (char *)iov[0].data);
 		}
 
-		// Do Non-Blocking Send of any data already in send buffer first
-		if (self->sendBuf != NULL && self->sendBufLen > 0) {
-			ret = send(self->socket, (const char *)self->sendBuf, (int)self->sendBufLen, WS_NONBLOCKING_FLAGS);
+		// Do Non-Blocking Send of any data already in send queue first
+		if (self->sendHead != NULL) {
+			rc = WebClient_FlushSendQueue(self);
+		}
 
-			// Destroy send buffer if Complete send, otherwise remove sent data before appending new data
-			if (ret == (int)self->sendBufLen) {
-				esif_ccb_free(self->sendBuf);
-				self->sendBuf = NULL;
-				self->sendBufLen = 0;
-				ret = 0;
+		// Do Blocking or Non-Blocking Gather Send if send queue is clear
+		if (rc == ESIF_OK && self->sendHead == NULL && iovcnt > 0) {
+			esif_ccb_iovec_t vec[WS_MAX_IOVECS];
+			size_t count = 0;
+			ssize_t ret = 0;
+
+			for (j = 0; j < iovcnt && count < WS_MAX_IOVECS; j++) {
+				if (iov[j].length > 0) {
+					esif_ccb_iovec_set(&vec[count], iov[j].data, iov[j].length);
+					count++;
+				}
 			}
-			else if (ret > 0) {
-				esif_ccb_memmove(self->sendBuf, self->sendBuf + ret, self->sendBufLen - ret);
-				self->sendBufLen -= ret;
-				ret = 0;
+			if (count > 0) {
+				ret = esif_ccb_socket_sendv(self->socket, vec, count, send_flags);
 			}
-		}
-
-		// Do Blocking or Non-Blocking send if send buffer is clear
-		if (self->sendBuf == NULL && buffer != NULL && buf_len > 0) {
-			ret = send(self->socket, (char*)buffer, (int)buf_len, send_flags);
-		}
 
-		// Close Socket on Failure; EWOULDBLOCK is not a failure it is expected if the operation would block
-		if (ret == SOCKET_ERROR) {
-			int errnum = 0;
-			if ((errnum = esif_ccb_socket_error()) == ESIF_SOCKERR_EWOULDBLOCK) {
-				ret = 0;
+			// Close Socket on Failure; EWOULDBLOCK is not a failure it is expected if the operation would block
+			if (ret == SOCKET_ERROR) {
+				if (esif_ccb_socket_error() != ESIF_SOCKERR_EWOULDBLOCK) {
+					rc = ESIF_E_WS_SOCKET_ERROR;
+				}
 			}
 			else {
-				rc = ESIF_E_WS_SOCKET_ERROR;
+				sent = (size_t)ret;
 			}
 		}
 
-		// Append any unsent data to send buffer
-		if (rc == ESIF_OK && buffer != NULL && ret != (ssize_t)buf_len) {
-			size_t newBufLen = self->sendBufLen + buf_len - ret;
-			u8 *newBuffer = NULL;
-			if (newBufLen <= WS_MAX_CLIENT_SENDBUF) {
-				newBuffer = esif_ccb_realloc(self->sendBuf, newBufLen);
-			}
-			if (newBuffer == NULL) {
-				rc = ESIF_E_NO_MEMORY;
+		// Append any unsent data to send queue
+		for (j = 0; rc == ESIF_OK && j < iovcnt; j++) {
+			total += iov[j].length;
+			if (sent >= iov[j].length) {
+				sent -= iov[j].length;
 			}
 			else {
-				esif_ccb_memmove(newBuffer + self->sendBufLen, (u8*)buffer + ret, buf_len - ret);
-				self->sendBuf = newBuffer;
-				self->sendBufLen = newBufLen;
+				rc = WebClient_QueueSegment(self, (const u8 *)iov[j].data + sent, iov[j].length - sent, iov[j].buffer);
+				sent = 0;
 			}
-			WS_TRACE_DEBUG("WS SEND Buffering (%d): buffer=%zd sent=%lu error=%d send_buf=%zd\n", (int)self->socket, buf_len, ret, esif_ccb_socket_error(), self->sendBufLen);
+		}
+		if (rc == ESIF_OK && self->sendHead != NULL && iovcnt > 0) {
+			WS_TRACE_DEBUG("WS SEND Buffering (%d): buffer=%zd error=%d send_buf=%zd\n", (int)self->socket, total, esif_ccb_socket_error(), self->sendBufLen);
 		}
 
 		// Close Socket on Error
 		if (rc != ESIF_OK) {
-			WS_TRACE_DEBUG("WS SEND Failure (%d): buffer=%zd sent=%lu error=%d send_buf=%zd [%zd total]\n", (int)self->socket, buf_len, ret, esif_ccb_socket_error(), self->sendBufLen, self->sendBufLen + buf_len);
+			WS_TRACE_DEBUG("WS SEND Failure (%d): buffer=%zd error=%d send_buf=%zd\n", (int)self->socket, total, esif_ccb_socket_error(), self->sendBufLen);
 			WebClient_Close(self);
 		}
 	}
 	return rc;
 }
 
+// Write a Buffer to a WebClient, or flush its send queue if buffer is NULL
+esif_error_t WebClient_Write(WebClientPtr self, void *buffer, size_t buf_len)
+{
+	WebIoVec iov = { buffer, buf_len, NULL };
+	return WebClient_WriteV(self, &iov, (buffer != NULL && buf_len > 0 ? 1 : 0));
+}
+
 //// WebServer Object Methods ////
 
 // Initialize WebServer Object
@@ -566,7 +699,7 @@ static esif_error_t WebServer_Main(WebServerPtr self)
 					setsize++;
 
 					// Wait for socket to become writable if pending send buffer
-					if (self->clients[j].sendBuf) {
+					if (self->clients[j].sendHead) {
 						FD_SET(self->clients[j].socket, &writeFDs);
 					}
 				}
@@ -61,6 +61,28 @@ typedef struct TcpDoorbell_s {
 	esif_ccb_socket_t	sockets[DOORBELL_SOCKETS];	// Paired TCP Sockets used to signal blocked select()
 } TcpDoorbell, *TcpDoorbellPtr;
 
+// Refcounted Output Buffer that may be referenced by the Send Queues of one or more Clients
+typedef struct WebBuffer_s {
+	atomic_t			refCount;		// Reference Count
+	size_t				buf_len;		// Buffer Length
+	u8					data[1];		// Dynamic Buffer of size buf_len
+} WebBuffer, *WebBufferPtr;
+
+// Client Send Queue Segment: Unsent portion of a referenced Output Buffer
+typedef struct WebSegment_s {
+	struct WebSegment_s	*next;			// Next Segment in Send Queue
+	WebBufferPtr		buffer;			// Referenced Output Buffer
+	u8					*data;			// Unsent Data within Output Buffer
+	size_t				length;			// Unsent Data Length
+} WebSegment, *WebSegmentPtr;
+
+// Output Vector Element for WebClient_WriteV
+typedef struct WebIoVec_s {
+	const void			*data;			// Data to Send
+	size_t				length;			// Data Length
+	WebBufferPtr		buffer;			// Output Buffer containing data, or NULL if data must be copied when queued
+} WebIoVec, *WebIoVecPtr;
+
 // Web Server Listener Object
 typedef struct WebListener_s {
 	esif_ccb_socket_t	socket;					// Listener Socket or INVALID_SOCKET
@@ -74,8 +96,9 @@ typedef struct WebClient_s {
 	ClientType			type;			// Client Type (Closed, Http, Websocket)
 	esif_ccb_socket_t	socket;			// Client Socket Handle or INVALID_SOCKET
 	char				*ipAddr;		// Client IP Address
-	u8					*sendBuf;		// TCP/IP Send Buffer
-	size_t				sendBufLen;		// TCP/IP Send Buffer Length
+	WebSegmentPtr		sendHead;		// TCP/IP Send Queue (Unsent Segments, oldest first)
+	WebSegmentPtr		sendTail;		// TCP/IP Send Queue Last Segment
+	size_t				sendBufLen;		// TCP/IP Send Queue Length (Unsent Bytes)
 	u8					*recvBuf;		// TCP/IP Receive Buffer (Partial HTTP Request or Websocket Frame)
 	size_t				recvBufLen;		// TCP/IP Receive Buffer Length
 	
@@ -134,7 +157,12 @@ Bool WebServer_IsStarted(WebServerPtr self);
 esif_error_t WebServer_Config(WebServerPtr self, u8 instance, char *ipAddr, short port, esif_flags_t flags);
 char *WebServer_ExecRestCmdInternal(WebServerPtr self, const char *rest_cmd, const char *prefix);
 
+WebBufferPtr WebBuffer_Create(const void *data, size_t buf_len);
+void WebBuffer_GetRef(WebBufferPtr self);
+void WebBuffer_PutRef(WebBufferPtr self);
+
 esif_error_t WebClient_Write(WebClientPtr self, void *buffer, size_t buf_len);
+esif_error_t WebClient_WriteV(WebClientPtr self, const WebIoVec *iov, size_t iovcnt);
 void WebClient_Close(WebClientPtr self);
 
 // Trace Messaging
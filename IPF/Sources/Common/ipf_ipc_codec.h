@@ -140,6 +140,7 @@ typedef struct IrpcTransaction_s {
 	IBinary				*request;	// Serialized Request Message, if any
 	IBinary				*response;	// Serialized Response Message, if any
 	esif_error_t		result;		// RPC Request Result
+	size_t				trxIndex;	// Position in Transaction Manager Pool, if Active
 } IrpcTransaction;
 
 /* Definition of these compiler options control how simple native types are encoded in RPC calls
@@ -108,11 +108,17 @@ esif_error_t IrpcTransaction_Wait(IrpcTransaction *self)
 
 /*
 ** IpfTrxMgr Class
+**
+** Active Transactions are kept in a Min-Heap ordered by Timestamp (trxPool) so the next one to
+** expire is always at the root, and indexed by Transaction ID in an open addressing Hash Table
+** (trxTable) so that a response can be matched to its request without scanning the pool.
+** Transaction IDs are unique across all sessions, so the IPF Handle is only verified on lookup.
 */
 
-#define	TRX_POOL_INITIAL			ESIF_MAX_CLIENTS		// Intial Size of Transaction Request Pool (Waiting Threads)
-#define	TRX_POOL_GROWBY				2						// Size to Grow Transaction Request Pool when full
-#define	TRX_POOL_MAXSIZE			(ESIF_MAX_CLIENTS * 64)	// Max Size of Transaction Request Pool (Max Waiting Threads)
+#define	TRX_POOL_INITIAL			ESIF_MAX_CLIENTS		// Intial Size of Transaction Request Pool (Waiting Threads); Power of 2
+#define	TRX_POOL_MAXSIZE			(ESIF_MAX_CLIENTS * 1024)	// Max Size of Transaction Request Pool (Max Waiting Threads)
+#define TRX_TABLE_RATIO				2						// Hash Table Slots per Transaction Request Pool entry (Max Load = 1/2)
+#define TRX_HASH_MULTIPLIER			0x9E3779B97F4A7C15ULL	// Fibonacci Hashing multiplier for sequential Transaction IDs
 
 #ifdef ESIF_ATTR_DEBUG
 #define TRX_EXPIRE_TIMEOUT_SECONDS	(15*60)					// Expire Active Transactions after this many seconds (Default)
@@ -121,9 +127,22 @@ esif_error_t IrpcTransaction_Wait(IrpcTransaction *self)
 #endif
 #define TRX_EXPIRE_ALL				0						// Expire All Active Transactions Immediately
 #define TRX_EXPIRE_TIMEOUT_NEVER	0x7fffffff				// Never Expire Transactions
+#define TRX_EXPIRE_TIMEOUT_MIN		0.001					// Min Timeout returned when a Transaction is past due
+
+#define TRX_HEAP_PARENT(j)			(((j) - 1) / 2)
+#define TRX_HEAP_LEFT(j)			(((j) * 2) + 1)
 
 // Private
 static void IpfTrxMgr_ExpireTimeout(IpfTrxMgr *self, size_t seconds);
+static size_t IpfTrxMgr_HashSlot(IpfTrxMgr *self, UInt64 trxId);
+static size_t IpfTrxMgr_FindSlot(IpfTrxMgr *self, UInt64 trxId);
+static void IpfTrxMgr_InsertSlot(IpfTrxMgr *self, IrpcTransaction *trx);
+static void IpfTrxMgr_RemoveSlot(IpfTrxMgr *self, size_t slot);
+static void IpfTrxMgr_HeapSet(IpfTrxMgr *self, size_t j, IrpcTransaction *trx);
+static void IpfTrxMgr_HeapSiftUp(IpfTrxMgr *self, size_t j);
+static void IpfTrxMgr_HeapSiftDown(IpfTrxMgr *self, size_t j);
+static esif_error_t IpfTrxMgr_Grow(IpfTrxMgr *self);
+static void IpfTrxMgr_RemoveTransaction(IpfTrxMgr *self, IrpcTransaction *trx);
 
 // Public IpfTrxMgr Singleton Instance Functions
 IpfTrxMgr* IpfTrxMgr_GetInstance(void)
@@ -139,12 +158,19 @@ esif_error_t IpfTrxMgr_Init(IpfTrxMgr *self)
 	esif_error_t rc = ESIF_E_PARAMETER_IS_NULL;
 	if (self) {
 		self->trxPool = (IrpcTransaction **)esif_ccb_malloc(sizeof(IrpcTransaction *) * TRX_POOL_INITIAL);
-		if (self->trxPool == NULL) {
+		self->trxTable = (IrpcTransaction **)esif_ccb_malloc(sizeof(IrpcTransaction *) * TRX_POOL_INITIAL * TRX_TABLE_RATIO);
+		if (self->trxPool == NULL || self->trxTable == NULL) {
+			esif_ccb_free(self->trxPool);
+			esif_ccb_free(self->trxTable);
+			self->trxPool = NULL;
+			self->trxTable = NULL;
 			rc = ESIF_E_NO_MEMORY;
 		}
 		else {
 			esif_ccb_lock_init(&self->lock);
 			self->poolSize = TRX_POOL_INITIAL;
+			self->poolCount = 0;
+			self->tableSize = TRX_POOL_INITIAL * TRX_TABLE_RATIO;
 			atomic_set(&self->rpcTimeout, TRX_EXPIRE_TIMEOUT_SECONDS);
 			rc = ESIF_OK;
 		}
@@ -157,8 +183,12 @@ void IpfTrxMgr_Uninit(IpfTrxMgr *self)
 	if (self) {
 		IpfTrxMgr_ExpireAll(self);
 		esif_ccb_free(self->trxPool);
+		esif_ccb_free(self->trxTable);
 		self->trxPool = NULL;
+		self->trxTable = NULL;
 		self->poolSize = 0;
+		self->poolCount = 0;
+		self->tableSize = 0;
 		esif_ccb_lock_uninit(&self->lock);
 	}
 }
@@ -179,18 +209,20 @@ static void IpfTrxMgr_ExpireTimeout(IpfTrxMgr *self, size_t seconds)
 		esif_ccb_write_lock(&self->lock);
 		esif_ccb_realtime_t now = esif_ccb_realtime_current();
 
-		for (size_t j = 0; j < self->poolSize; j++) {
-			IrpcTransaction *trx = self->trxPool[j];
-			if (trx && (seconds == TRX_EXPIRE_ALL || esif_ccb_realtime_diff_sec(trx->timestamp, now) >= (Int64)seconds)) {
-				IPF_TRACE_INFO("Expiring TrxID 0x%llx Session 0x%llx Timeout=%lf\n", trx->trxId, trx->ipfHandle, esif_ccb_realtime_diff_msec(trx->timestamp, now) / 1000);
-				self->trxPool[j] = NULL;
-				IBinary_Destroy(trx->request);
-				IBinary_Destroy(trx->response);
-				trx->request = NULL;
-				trx->response = NULL;
-				IrpcTransaction_Signal(trx);
-				IrpcTransaction_PutRef(trx);
+		// Oldest Transaction is always at the root of the heap
+		while (self->poolCount > 0) {
+			IrpcTransaction *trx = self->trxPool[0];
+			if (seconds != TRX_EXPIRE_ALL && esif_ccb_realtime_diff_sec(trx->timestamp, now) < (Int64)seconds) {
+				break;
 			}
+			IPF_TRACE_INFO("Expiring TrxID 0x%llx Session 0x%llx Timeout=%lf\n", trx->trxId, trx->ipfHandle, esif_ccb_realtime_diff_msec(trx->timestamp, now) / 1000);
+			IpfTrxMgr_RemoveTransaction(self, trx);
+			IBinary_Destroy(trx->request);
+			IBinary_Destroy(trx->response);
+			trx->request = NULL;
+			trx->response = NULL;
+			IrpcTransaction_Signal(trx);
+			IrpcTransaction_PutRef(trx);
 		}
 		esif_ccb_write_unlock(&self->lock);
 	}
@@ -200,30 +232,20 @@ esif_error_t IpfTrxMgr_AddTransaction(IpfTrxMgr *self, IrpcTransaction *trx)
 {
 	esif_error_t rc = ESIF_E_PARAMETER_IS_NULL;
 	if (self && trx) {
-		rc = ESIF_E_MAXIMUM_CAPACITY_REACHED;
+		rc = ESIF_OK;
 
-		// Find next free slot and add Transaction
 		esif_ccb_write_lock(&self->lock);
-		for (size_t j = 0; j < self->poolSize; j++) {
-			if (self->trxPool[j] == NULL) {
-				IrpcTransaction_GetRef(trx);
-				self->trxPool[j] = trx;
-				rc = ESIF_OK;
-				break;
-			}
-		}
 
 		// Grow Transaction Pool if full
-		if (rc != ESIF_OK && self->poolSize + TRX_POOL_GROWBY <= TRX_POOL_MAXSIZE) {
-			IrpcTransaction **newPool = (IrpcTransaction **)esif_ccb_realloc(self->trxPool, sizeof(IrpcTransaction *) * (self->poolSize + TRX_POOL_GROWBY));
-			if (newPool) {
-				esif_ccb_memset(&newPool[self->poolSize], 0, sizeof(IrpcTransaction *) * TRX_POOL_GROWBY);
-				IrpcTransaction_GetRef(trx);
-				newPool[self->poolSize] = trx;
-				self->trxPool = newPool;
-				self->poolSize += TRX_POOL_GROWBY;
-				rc = ESIF_OK;
-			}
+		if (self->poolCount >= self->poolSize) {
+			rc = IpfTrxMgr_Grow(self);
+		}
+
+		if (rc == ESIF_OK) {
+			IrpcTransaction_GetRef(trx);
+			IpfTrxMgr_InsertSlot(self, trx);
+			IpfTrxMgr_HeapSet(self, self->poolCount++, trx);
+			IpfTrxMgr_HeapSiftUp(self, trx->trxIndex);
 		}
 		esif_ccb_write_unlock(&self->lock);
 	}
@@ -235,16 +257,26 @@ IrpcTransaction *IpfTrxMgr_GetTransaction(IpfTrxMgr *self, esif_handle_t ipfHand
 	IrpcTransaction *trx = NULL;
 	if (self) {
 		esif_ccb_write_lock(&self->lock);
-		for (size_t j = 0; j < self->poolSize; j++) {
-			if (self->trxPool[j]
-				&& (self->trxPool[j]->ipfHandle == ipfHandle || ipfHandle == ESIF_INVALID_HANDLE)
-				&& (self->trxPool[j]->trxId == trxId || trxId == IPFTRX_MATCHANY)) {
-				trx = self->trxPool[j];
-				self->trxPool[j] = NULL;
-				IrpcTransaction_PutRef(trx);
-				break;
+		if (trxId != IPFTRX_MATCHANY) {
+			size_t slot = IpfTrxMgr_FindSlot(self, trxId);
+			if (slot < self->tableSize
+				&& (self->trxTable[slot]->ipfHandle == ipfHandle || ipfHandle == ESIF_INVALID_HANDLE)) {
+				trx = self->trxTable[slot];
 			}
 		}
+		else {
+			// Only used when closing a session, so scanning the pool is acceptable
+			for (size_t j = 0; j < self->poolCount; j++) {
+				if (self->trxPool[j]->ipfHandle == ipfHandle || ipfHandle == ESIF_INVALID_HANDLE) {
+					trx = self->trxPool[j];
+					break;
+				}
+			}
+		}
+		if (trx) {
+			IpfTrxMgr_RemoveTransaction(self, trx);
+			IrpcTransaction_PutRef(trx);
+		}
 		esif_ccb_write_unlock(&self->lock);
 	}
 	return trx;
@@ -256,13 +288,10 @@ double IpfTrxMgr_GetMinTimeout(IpfTrxMgr *self)
 	if (self) {
 		esif_ccb_realtime_t now = esif_ccb_realtime_current();
 		esif_ccb_read_lock(&self->lock);
-		for (size_t j = 0; j < self->poolSize; j++) {
-			if (self->trxPool[j]) {
-				double timeout = (double)atomic_read(&self->rpcTimeout) - (esif_ccb_realtime_diff_msec(self->trxPool[j]->timestamp, now) / 1000.0);
-				if (timeout > 0 && timeout < result) {
-					result = timeout;
-				}
-			}
+		if (self->poolCount > 0) {
+			// Wake up promptly to expire a Transaction that is already past due
+			result = (double)atomic_read(&self->rpcTimeout) - (esif_ccb_realtime_diff_msec(self->trxPool[0]->timestamp, now) / 1000.0);
+			result = esif_ccb_max(result, TRX_EXPIRE_TIMEOUT_MIN);
 		}
 		esif_ccb_read_unlock(&self->lock);
 	}
@@ -292,12 +321,152 @@ void IpfTrxMgr_ResetTimeouts(IpfTrxMgr *self)
 {
 	if (self) {
 		esif_ccb_realtime_t now = esif_ccb_realtime_current();
-		esif_ccb_read_lock(&self->lock);
-		for (size_t j = 0; j < self->poolSize; j++) {
-			if (self->trxPool[j]) {
-				self->trxPool[j]->timestamp = now;
+		esif_ccb_write_lock(&self->lock);
+		// All Timestamps are equal afterwards, so the heap remains ordered
+		for (size_t j = 0; j < self->poolCount; j++) {
+			self->trxPool[j]->timestamp = now;
+		}
+		esif_ccb_write_unlock(&self->lock);
+	}
+}
+
+// Private IpfTrxMgr Functions (Lock must be held)
+
+static size_t IpfTrxMgr_HashSlot(IpfTrxMgr *self, UInt64 trxId)
+{
+	UInt64 hash = trxId * TRX_HASH_MULTIPLIER;
+	return (size_t)(hash ^ (hash >> 32)) & (self->tableSize - 1);
+}
+
+// Return Hash Table slot for the given Transaction ID or tableSize if not found
+static size_t IpfTrxMgr_FindSlot(IpfTrxMgr *self, UInt64 trxId)
+{
+	size_t slot = IpfTrxMgr_HashSlot(self, trxId);
+	while (self->trxTable[slot] != NULL) {
+		if (self->trxTable[slot]->trxId == trxId) {
+			return slot;
+		}
+		slot = (slot + 1) & (self->tableSize - 1);
+	}
+	return self->tableSize;
+}
+
+static void IpfTrxMgr_InsertSlot(IpfTrxMgr *self, IrpcTransaction *trx)
+{
+	size_t slot = IpfTrxMgr_HashSlot(self, trx->trxId);
+	while (self->trxTable[slot] != NULL) {
+		slot = (slot + 1) & (self->tableSize - 1);
+	}
+	self->trxTable[slot] = trx;
+}
+
+// Remove a Hash Table slot and shift back any following entries displaced past it
+static void IpfTrxMgr_RemoveSlot(IpfTrxMgr *self, size_t slot)
+{
+	size_t mask = self->tableSize - 1;
+	size_t next = slot;
+
+	for (;;) {
+		next = (next + 1) & mask;
+		if (self->trxTable[next] == NULL) {
+			break;
+		}
+		size_t home = IpfTrxMgr_HashSlot(self, self->trxTable[next]->trxId);
+		if (((next - home) & mask) >= ((next - slot) & mask)) {
+			self->trxTable[slot] = self->trxTable[next];
+			slot = next;
+		}
+	}
+	self->trxTable[slot] = NULL;
+}
+
+static void IpfTrxMgr_HeapSet(IpfTrxMgr *self, size_t j, IrpcTransaction *trx)
+{
+	self->trxPool[j] = trx;
+	trx->trxIndex = j;
+}
+
+static void IpfTrxMgr_HeapSiftUp(IpfTrxMgr *self, size_t j)
+{
+	IrpcTransaction *trx = self->trxPool[j];
+	while (j > 0) {
+		IrpcTransaction *parent = self->trxPool[TRX_HEAP_PARENT(j)];
+		if (parent->timestamp.clockticks <= trx->timestamp.clockticks) {
+			break;
+		}
+		IpfTrxMgr_HeapSet(self, j, parent);
+		j = TRX_HEAP_PARENT(j);
+	}
+	IpfTrxMgr_HeapSet(self, j, trx);
+}
+
+static void IpfTrxMgr_HeapSiftDown(IpfTrxMgr *self, size_t j)
+{
+	IrpcTransaction *trx = self->trxPool[j];
+	for (;;) {
+		size_t child = TRX_HEAP_LEFT(j);
+		if (child >= self->poolCount) {
+			break;
+		}
+		if (child + 1 < self->poolCount
+			&& self->trxPool[child + 1]->timestamp.clockticks < self->trxPool[child]->timestamp.clockticks) {
+			child++;
+		}
+		if (trx->timestamp.clockticks <= self->trxPool[child]->timestamp.clockticks) {
+			break;
+		}
+		IpfTrxMgr_HeapSet(self, j, self->trxPool[child]);
+		j = child;
+	}
+	IpfTrxMgr_HeapSet(self, j, trx);
+}
+
+// Double the Transaction Pool and rebuild the Hash Table
+static esif_error_t IpfTrxMgr_Grow(IpfTrxMgr *self)
+{
+	esif_error_t rc = ESIF_E_MAXIMUM_CAPACITY_REACHED;
+	size_t newSize = esif_ccb_min(self->poolSize * 2, TRX_POOL_MAXSIZE);
+
+	if (newSize > self->poolSize) {
+		IrpcTransaction **newPool = (IrpcTransaction **)esif_ccb_realloc(self->trxPool, sizeof(IrpcTransaction *) * newSize);
+		IrpcTransaction **newTable = (IrpcTransaction **)esif_ccb_malloc(sizeof(IrpcTransaction *) * newSize * TRX_TABLE_RATIO);
+		if (newPool) {
+			self->trxPool = newPool;
+		}
+		if (newPool == NULL || newTable == NULL) {
+			esif_ccb_free(newTable);
+			rc = ESIF_E_NO_MEMORY;
+		}
+		else {
+			esif_ccb_free(self->trxTable);
+			self->trxTable = newTable;
+			self->tableSize = newSize * TRX_TABLE_RATIO;
+			self->poolSize = newSize;
+			for (size_t j = 0; j < self->poolCount; j++) {
+				IpfTrxMgr_InsertSlot(self, self->trxPool[j]);
 			}
+			rc = ESIF_OK;
+		}
+	}
+	return rc;
+}
+
+// Remove an Active Transaction from the Hash Table and Heap without releasing its Reference
+static void IpfTrxMgr_RemoveTransaction(IpfTrxMgr *self, IrpcTransaction *trx)
+{
+	size_t slot = IpfTrxMgr_FindSlot(self, trx->trxId);
+	size_t j = trx->trxIndex;
+
+	if (slot < self->tableSize) {
+		IpfTrxMgr_RemoveSlot(self, slot);
+	}
+	if (j < self->poolCount && self->trxPool[j] == trx) {
+		IrpcTransaction *last = self->trxPool[--self->poolCount];
+		self->trxPool[self->poolCount] = NULL;
+		if (j < self->poolCount) {
+			IpfTrxMgr_HeapSet(self, j, last);
+			IpfTrxMgr_HeapSiftDown(self, j);
+			IpfTrxMgr_HeapSiftUp(self, last->trxIndex);
 		}
-		esif_ccb_read_unlock(&self->lock);
 	}
 }
@@ -31,8 +31,11 @@ esif_error_t IrpcTransaction_Wait(IrpcTransaction *self);
 // IPF Transaction Manager
 typedef struct IpfTrxMgr_s {
 	esif_ccb_lock_t	lock;		// Transaction Manager Lock
-	IrpcTransaction** trxPool;	// Active Transaction Pool
+	IrpcTransaction** trxPool;	// Active Transaction Pool (Min-Heap ordered by Timestamp)
 	size_t poolSize;			// Active Transaction Pool size
+	size_t poolCount;			// Number of Active Transactions
+	IrpcTransaction** trxTable;	// Active Transactions Hashed by Transaction ID
+	size_t tableSize;			// Hash Table size (Power of 2)
 	atomic_t rpcTimeout;		// RPC Timeout in Seconds
 } IpfTrxMgr;
 
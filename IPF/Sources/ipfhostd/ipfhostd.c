@@ -19,7 +19,7 @@
 #include "esif_ccb.h"
 #include "esif_ccb_string.h"
 #include "esif_ccb_thread.h"
-#include "esif_ccb_timer.h"
+#include "esif_ccb_time.h"
 #include "ipf_dll.h"
 #include "ipf_apploader.h"
 #include "ipf_trace.h"
@@ -41,19 +41,6 @@ typedef enum startmode {
 static Bool g_exitApp = ESIF_FALSE;	// Signal to Exit AppLoader
 static int g_tracelevel = IPF_TRACE_LEVEL_ERROR; // AppLoader Trace Level
 
-/* Number of threads in thread pool: default to 1, but will
- * change to the actual number of processore cores if there
- * is support to the _SC_NPROCESSORS_ONLN system configuration
- * at run time.
- */
-static long g_nproc = 1;
-
-#define MAX_TIMER_THREADS_AUTO 16 // max number of timer work threads allowed from auto-detection
-
-// Dedicated thread pool to handle SIGRTMIN timer signals
-static esif_thread_t *g_sigrtmin_thread_pool;
-static Bool g_rtmin_thread_quit = ESIF_FALSE; // global flag to supress KW flagging as while(1) alternative
-
 #  include <syslog.h>
 #  define ESIF_PRIORITY_FATAL   LOG_EMERG
 #  define ESIF_PRIORITY_ERROR   LOG_ERR
@@ -140,139 +127,17 @@ void sigterm_enable()
 	sigaction(SIGQUIT, &action, NULL);
 }
 
-static void sigrtmin_block(void)
-{
-	/* Block SIGRTMIN; other threads created from the main thread
-	 * will inherit a copy of the signal mask.
-	 */
-	sigset_t set = {0};
-	sigemptyset(&set);
-	sigaddset(&set, SIGRTMIN);
-	if (pthread_sigmask(SIG_BLOCK, &set, NULL)) {
-		printf("Fail to block SIGRTMIN\n");
-	}
-}
-
-static void *sigrtmin_worker_thread(void *ptr)
-{
-	sigset_t set = {0};
-	siginfo_t info = {0};
-	struct esif_tmrm_cb_obj *cb_object_ptr = NULL;
-
-	UNREFERENCED_PARAMETER(ptr);
-	sigemptyset(&set);
-	sigaddset(&set, SIGRTMIN);
-	// This thread will be canceled/killed after apploader_exit 
-	while (!g_rtmin_thread_quit) {
-		/* sigwaitinfo is a cancellation point */
-		if (-1 == sigwaitinfo(&set, &info)) {
-			/* When there are multiple worker threads waiting for the same signal,
-			 * only one thread will get the signal and its associated info structure,
-			 * and the rest will get an errno of EINTR. In this case, simply continue
-			 * the loop and wait again.
-			 */
-			continue;
-		}
-		if (SIGRTMIN != info.si_signo) {
-			printf("Received signal is not SIGRTMIN, ignore\n");
-			continue;
-		}
-
-		cb_object_ptr = (struct esif_tmrm_cb_obj *) info.si_value.sival_ptr;
-		if (cb_object_ptr && cb_object_ptr->func) {
-			printf("Calling callback function...\n");
-			cb_object_ptr->func(cb_object_ptr->cb_handle);
-			cb_object_ptr->func = NULL;
-			/* Use native free function instead of esif_ccb_free(). For explanation,
-			 * please see the comments under esif_ccb_timer_obj_enable_timer() in
-			 * file esif_ccb_timer_lin_user.h.
-			 */
-			free(cb_object_ptr);
-		} else {
-			printf("Invalid timer callback object: (obj=%p, func=%p)\n",
-				cb_object_ptr, (cb_object_ptr ? cb_object_ptr->func : NULL));
-		}
-	}
-
-	return NULL;
-}
-
-static enum esif_rc create_timer_thread_pool(void)
-{
-	int i = 0;
-	enum esif_rc rc = ESIF_OK;
-
-	// Use native malloc instead of esif_ccb_malloc
-	g_sigrtmin_thread_pool = (esif_thread_t *) malloc(g_nproc * sizeof(esif_thread_t));
-	if (g_sigrtmin_thread_pool) {
-		pthread_attr_t attr;
-
-		for (i = 0; i < g_nproc; ++i) {
-			pthread_attr_init(&attr);
-			pthread_create(&g_sigrtmin_thread_pool[i], &attr, sigrtmin_worker_thread, NULL);
-			pthread_attr_destroy(&attr);
-		}
-	} else {
-		rc = ESIF_E_NO_MEMORY;
-	}
-
-	return rc;
-}
-
-static void release_timer_thread_pool(void)
-{
-	int i = 0;
-
-	if (g_sigrtmin_thread_pool) {
-		/* All ESIF timers should have been canceled
-		 * after esif_uf_exit() call, so it is safe
-		 * to terminate the g_sigrtmin_thread_pool now.
-		 */
-		for (i = 0; i < g_nproc; ++i) {
-			pthread_cancel(g_sigrtmin_thread_pool[i]);
-		}
-		for (i = 0; i < g_nproc; ++i) {
-			pthread_join(g_sigrtmin_thread_pool[i], NULL);
-		}
-		free(g_sigrtmin_thread_pool);
-	}
-}
-
-static long get_nproc(long old, long new, long max)
-{
-	if (new > 0) {
-		return (new > max) ? max : new;
-	} else {
-		return old;
-	}
-}
-
 // Start Daemon (Foreground or Background) or as a Foreground Console App
 static esif_error_t start_daemon(startmode_t startup_mode, char *libname, char *serveraddr)
 {
 	esif_error_t rc = ESIF_E_PARAMETER_IS_NULL;
 
-	/* Find number of online CPU cores if the feature is available,
-	 * and then assign it to a global which we will use later to
-	 * create the equivalent number of timer worker threads to
-	 * serve timer expiration events most efficiently.
-	 */
-	g_nproc = get_nproc(g_nproc, sysconf(_SC_NPROCESSORS_ONLN), MAX_TIMER_THREADS_AUTO);
-
 	// Run as a Foreground Console App and Exit
 	if (startup_mode == STARTMODE_FOREGROUND_CONSOLE) {
 		printf(
 			PROGRAM_HEADER "\n"
 			PROGRAM_COPYRIGHT "\n"
 		);
-		// Block SIGRTMIN (will re-enable it in dedicated thread pool)
-		sigrtmin_block();
-		// Start the thread pool that handles SIGRTMIN
-		rc = create_timer_thread_pool();
-		if (ESIF_OK != rc) {
-			printf("ipfhostd: Time Thread pool creation failed. Error #%d\n", errno);
-			return rc;
-		}
 		sigterm_enable();
 		rc = start_apploader(libname, serveraddr);
 		goto exit;
@@ -307,15 +172,8 @@ static esif_error_t start_daemon(startmode_t startup_mode, char *libname, char *
 		return ESIF_E_NOT_INITIALIZED;
 	}
 
-	// 4. Block SIGRTMIN (will re-enable it in dedicated thread pool)
+	// 4. Enable SIGTERM handler
 	sigterm_enable();
-	sigrtmin_block();
-	// Start the thread pool that handles SIGRTMIN
-	rc = create_timer_thread_pool();
-	if (ESIF_OK != rc) {
-		printf("ipfhostd: Time Thread pool creation failed. Error #%d\n", errno);
-		return rc;
-	}
 
 	// 5. Close all file descriptors incuding stdin, stdout, stderr
 	close(STDIN_FILENO);
@@ -339,9 +197,6 @@ static esif_error_t start_daemon(startmode_t startup_mode, char *libname, char *
 	}
 
 exit:
-	/* Stop and join the SIGRTMIN worker thread */
-	g_rtmin_thread_quit = ESIF_TRUE;
-	release_timer_thread_pool();
 	return rc;
 }
 
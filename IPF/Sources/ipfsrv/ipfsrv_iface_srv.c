@@ -32,6 +32,9 @@
 
 #define IPFSRV_COPYRIGHT	"Copyright (c) 2013-2023 Intel Corporation All Rights Reserved"
 
+#define WSBENCH_DEFAULT_ROUNDS	100		// Default wsbench PING rounds per Client
+#define WSBENCH_MAX_ROUNDS		100000	// Max wsbench PING rounds per Client
+
 // IPF Server LifeCycle Initializiation Table
 static LifecycleTableEntry g_lifecycleTableSrv[] = {
 	// Init and Exit functions should all be before Start/Stop functions
@@ -494,6 +497,7 @@ esif_error_t ESIF_CALLCONV IpfSrv_AppCommand(
 				"  resume             Resume accepting new Client connections\n"
 				"  queue [limit]      Get or Set Request Queue Limit\n"
 				"  timeout [seconds]  Get or Set Server RPC Session and Transaction Timeout\n"
+				"  wsbench [n] [r]    Benchmark Server with n local Websocket Clients for r PING rounds\n"
 				"\n"
 				, g_ipfAppInfo.appBanner
 				, IPF_SDK_VERSION
@@ -751,6 +755,31 @@ esif_error_t ESIF_CALLCONV IpfSrv_AppCommand(
 			responsePtr->data_len = (u32)esif_ccb_sprintf(responsePtr->buf_len, responsePtr->buf_ptr, "%zd\n", AppSessionMgr_GetTimeout()) + 1;
 			rc = ESIF_OK;
 		}
+		// ipfsrv wsbench [<clients>] [<rounds>]
+		else if (esif_ccb_stricmp(opcode, "wsbench") == 0) {
+			size_t clients = (optarg ? (size_t)atoi(optarg) : IPF_WS_MAX_CLIENTS);
+			size_t rounds = (argc > 2 && argv[2].buf_ptr && argv[2].type == ESIF_DATA_STRING ? (size_t)atoi(argv[2].buf_ptr) : WSBENCH_DEFAULT_ROUNDS);
+			WebBenchResults results = { 0 };
+
+			rc = WebServer_Benchmark(g_WebServer, esif_ccb_max(clients, 1), esif_ccb_min(esif_ccb_max(rounds, 1), WSBENCH_MAX_ROUNDS), &results);
+			responsePtr->data_len = (u32)esif_ccb_sprintf(responsePtr->buf_len, responsePtr->buf_ptr,
+				"\n"
+				"Clients    : %zd\n"
+				"Messages   : %zd\n"
+				"Elapsed    : %.3lf ms\n"
+				"Latency    : %.1lf us min, %.1lf us avg, %.1lf us max\n"
+				"CPU/Message: %.2lf us\n"
+				"Result     : %s\n"
+				"\n"
+				, results.clients
+				, results.messages
+				, results.elapsedMsec
+				, results.minLatencyUsec, results.avgLatencyUsec, results.maxLatencyUsec
+				, results.cpuUsecPerMsg
+				, esif_rc_str(rc)
+			) + 1;
+			rc = ESIF_OK;
+		}
 #ifdef ESIF_ATTR_DEBUG
 		// ipfsrv leak
 		else if (esif_ccb_stricmp(opcode, "leak") == 0) {
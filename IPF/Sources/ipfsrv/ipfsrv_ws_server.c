@@ -39,6 +39,11 @@
 
 //////////////////////////////////////////////
 
+#include <limits.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/resource.h>
+
 // Get Number of Logical CPUs
 #include <sys/sysinfo.h>
 static ESIF_INLINE int esif_ccb_nprocs()
@@ -58,10 +63,11 @@ static void *ESIF_CALLCONV Irpc_WorkerThread(void *ctx);
 #define WS_RECV_FLAGS	0
 
 #define WS_NETWORK_BUFFER_LEN	(1*1024*1024)	// Network Buffer Size for HTTP/Websocket Send and Receive Buffer
-#define WS_SOCKET_TIMEOUT		30				// Socket activity timeout waiting on blocking select() [2 or greater]
+#define WS_SOCKET_TIMEOUT		30				// Socket activity timeout waiting on blocking epoll_wait() [2 or greater]
 
 #define WS_MAX_CLIENT_SENDBUF	(8*1024*1024)	// Max size of client send buffer (multiple messages)
 #define WS_MAX_CLIENT_RECVBUF	(8*1024*1024)	// Max size of client receive buffer (multiple messages)
+#define WS_MAX_IOVECS			64				// Max Buffers per Gather Send
 
 #define WS_MAX_RPCQUEUE_MINVAL	12				// Max RPC Message Queue Lower Limit ~ Max Supported Client SDK Threads
 #define WS_MAX_RPCQUEUE_MAXVAL	(64*1024)		// Max RPC Message Queue Upper Limit
@@ -76,19 +82,29 @@ static void *ESIF_CALLCONV Irpc_WorkerThread(void *ctx);
 
 WebServerPtr g_WebServer = NULL;	// Global Web Server Singleton Intance
 
-// Doorbell Opcodes
+// Doorbell Opcodes (Bitmask)
 #define WS_OPCODE_NOOP			0x00	// No-Operation
 #define WS_OPCODE_MESSAGE		0x01	// Message to Deliver
 #define WS_OPCODE_CLOSE			0x02	// Close Orphan Connections
 #define WS_OPCODE_QUIT			0xFF	// Quit Web Server
 
+// epoll Event Identifiers: Source Type in upper 32 bits and Listener or Client Index in lower 32 bits
+#define WS_POLL_DOORBELL		0x0ULL
+#define WS_POLL_LISTENER		0x1ULL
+#define WS_POLL_CLIENT			0x2ULL
+#define WS_POLL_ID(type, index)	(((type) << 32) | (u32)(index))
+#define WS_POLL_TYPE(id)		((id) >> 32)
+#define WS_POLL_INDEX(id)		((u32)(id))
+
+#define WS_POLL_MAX_EVENTS		64		// Max epoll Events returned per Wakeup
+#define WS_POLL_CLIENT_EVENTS	(EPOLLIN | EPOLLET)	// Client Events; EPOLLOUT added only while Send Buffer is non-empty
+
 //// Message Queue Object Methods ////
 
 // Outgoing Message Queue Node Object
 typedef struct ClientMsg_s {
 	esif_handle_t	ipfHandle;	// Unique IPF Client Handle
-	size_t			buf_len;	// size of data buffer
-	char			data[1];	// dynamic buffer of size buf_len
+	WebBufferPtr	payload;	// Message Payload, referenced until sent to the Client
 } ClientMsg, *ClientMsgPtr;
 
 // Default Data Destructor
@@ -100,7 +116,11 @@ void MessageQueue_Destructor(void *object)
 // ClientMsg Destructor
 void ClientMsg_Destructor(void *object)
 {
-	esif_ccb_free(object);
+	if (object) {
+		ClientMsgPtr self = object;
+		WebBuffer_PutRef(self->payload);
+		esif_ccb_free(self);
+	}
 }
 
 // ClientRequest Destructor
@@ -276,20 +296,19 @@ void *WebServer_DeQueueRpc(WebServerPtr self, WebWorkerPtr rpcWorker)
 void TcpDoorbell_Init(TcpDoorbellPtr self)
 {
 	if (self) {
-		int j = 0;
 		self->isActive = ESIF_FALSE;
-		for (j = 0; j < DOORBELL_SOCKETS; j++) {
-			self->sockets[j] = INVALID_SOCKET;
-		}
+		self->eventfd = -1;
+		atomic_set(&self->opcodes, WS_OPCODE_NOOP);
 	}
 }
 
-// Create a Doorbell object with Paired Sockets for sending signals between threads
+// Create a Doorbell object with an eventfd for sending signals between threads
 esif_error_t TcpDoorbell_Open(TcpDoorbellPtr self)
 {
 	esif_error_t rc = ESIF_E_PARAMETER_IS_NULL;
 	if (self) {
-		if (esif_ccb_socketpair(ESIF_PF_LOCAL, SOCK_STREAM, IPPROTO_IP, self->sockets) == 0) {
+		if ((self->eventfd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) != -1) {
+			atomic_set(&self->opcodes, WS_OPCODE_NOOP);
 			self->isActive = ESIF_TRUE;
 			rc = ESIF_OK;
 		}
@@ -304,32 +323,44 @@ esif_error_t TcpDoorbell_Open(TcpDoorbellPtr self)
 void TcpDoorbell_Close(TcpDoorbellPtr self)
 {
 	if (self) {
-		int j = 0;
 		self->isActive = ESIF_FALSE;
-		for (j = 0; j < DOORBELL_SOCKETS; j++) {
-			if (self->sockets[j] != INVALID_SOCKET) {
-				esif_ccb_socket_close(self->sockets[j]);
-				self->sockets[j] = INVALID_SOCKET;
-			}
+		if (self->eventfd != -1) {
+			close(self->eventfd);
+			self->eventfd = -1;
 		}
 	}
 }
 
-// Stop Doorbell object and signal blocking select() to exit
+// Signal the eventfd to wake the blocking epoll_wait()
+static void TcpDoorbell_Signal(TcpDoorbellPtr self)
+{
+	u64 count = 1;
+	if (write(self->eventfd, &count, sizeof(count)) != sizeof(count)) {
+		WS_TRACE_DEBUG("Doorbell Signal Error (%d)\n", errno);
+	}
+}
+
+// Stop Doorbell object and signal blocking epoll_wait() to exit
 void TcpDoorbell_Stop(TcpDoorbellPtr self)
 {
-	if (self && self->sockets[DOORBELL_BUTTON] != INVALID_SOCKET) {
-		esif_ccb_socket_shutdown(self->sockets[DOORBELL_BUTTON], ESIF_SHUT_RDWR);
+	if (self && self->eventfd != -1) {
 		self->isActive = ESIF_FALSE;
+		TcpDoorbell_Signal(self);
 	}
 }
 
-// Send a signal using Doorbell object and signal blocking select() to exit
+// Send a signal using Doorbell object and signal blocking epoll_wait() to exit
 esif_error_t TcpDoorbell_Ring(TcpDoorbellPtr self, u8 opcode)
 {
 	esif_error_t rc = ESIF_E_PARAMETER_IS_NULL;
-	if (self && self->sockets[DOORBELL_BUTTON] != INVALID_SOCKET) {
-		if (self->isActive && send(self->sockets[DOORBELL_BUTTON], (const char *)&opcode, sizeof(opcode), 0) == sizeof(opcode)) {
+	if (self && self->eventfd != -1) {
+		if (self->isActive) {
+			atomic_t opcodes = atomic_read(&self->opcodes);
+			atomic_t prior = 0;
+			while ((prior = atomic_cmpxchg(&self->opcodes, opcodes, opcodes | opcode)) != opcodes) {
+				opcodes = prior;
+			}
+			TcpDoorbell_Signal(self);
 			rc = ESIF_OK;
 		}
 		else {
@@ -339,13 +370,17 @@ esif_error_t TcpDoorbell_Ring(TcpDoorbellPtr self, u8 opcode)
 	return rc;
 }
 
-// Receive a Doorbell signal from a Listener thread
+// Receive all pending Doorbell signals as an Opcode Bitmask
 esif_error_t TcpDoorbell_Receive(TcpDoorbellPtr self, u8 *opcodePtr)
 {
 	esif_error_t rc = ESIF_E_PARAMETER_IS_NULL;
-	if (self && opcodePtr && self->isActive && self->sockets[DOORBELL_RINGER] != INVALID_SOCKET) {
-		ssize_t messageLength = recv(self->sockets[DOORBELL_RINGER], (char *)opcodePtr, sizeof(*opcodePtr), WS_RECV_FLAGS);
-		if (messageLength == 0 || messageLength == SOCKET_ERROR || messageLength < sizeof(*opcodePtr)) {
+	if (self && opcodePtr && self->eventfd != -1) {
+		u64 count = 0;
+		ssize_t messageLength = read(self->eventfd, &count, sizeof(count));
+		*opcodePtr = (u8)atomic_set(&self->opcodes, WS_OPCODE_NOOP);
+
+		// Doorbell Stopped or eventfd failure (a spurious wakeup that would block is not a failure)
+		if (!self->isActive || (messageLength != sizeof(count) && errno != EAGAIN)) {
 			*opcodePtr = WS_OPCODE_NOOP;
 			rc = ESIF_E_WS_SOCKET_ERROR;
 		}
@@ -702,6 +737,40 @@ void WebWorker_Stop(WebWorkerPtr self)
 	}
 }
 
+//// WebBuffer Object Methods ////
+
+// Create a Reference Counted Output Buffer, optionally initialized with a copy of data
+WebBufferPtr WebBuffer_Create(const void *data, size_t buf_len)
+{
+	WebBufferPtr self = esif_ccb_malloc(sizeof(*self) + buf_len);
+	if (self) {
+		atomic_set(&self->refCount, 1);
+		self->buf_len = buf_len;
+		if (data && buf_len) {
+			esif_ccb_memcpy(self->data, data, buf_len);
+		}
+	}
+	return self;
+}
+
+// Take a Reference
+void WebBuffer_GetRef(WebBufferPtr self)
+{
+	if (self) {
+		atomic_inc(&self->refCount);
+	}
+}
+
+// Release a Reference
+void WebBuffer_PutRef(WebBufferPtr self)
+{
+	if (self) {
+		if (atomic_dec(&self->refCount) == 0) {
+			esif_ccb_free(self);
+		}
+	}
+}
+
 //// WebClient Object Methods ////
 
 // Initialize a WebClient Object
@@ -717,12 +786,105 @@ void WebClient_Init(WebClientPtr self)
 	}
 }
 
+// Append unsent data to the Send Queue, referencing its Output Buffer if it has one, otherwise a copy of it
+static esif_error_t WebClient_QueueSegment(WebClientPtr self, const void *data, size_t length, WebBufferPtr buffer)
+{
+	esif_error_t rc = ESIF_E_NO_MEMORY;
+	WebSegmentPtr segment = NULL;
+
+	if (self->sendBufLen + length <= WS_MAX_CLIENT_SENDBUF && (segment = esif_ccb_malloc(sizeof(*segment))) != NULL) {
+		if (buffer) {
+			WebBuffer_GetRef(buffer);
+			segment->buffer = buffer;
+			segment->data = (u8 *)data;
+		}
+		else if ((segment->buffer = WebBuffer_Create(data, length)) != NULL) {
+			segment->data = segment->buffer->data;
+		}
+
+		if (segment->buffer == NULL) {
+			esif_ccb_free(segment);
+		}
+		else {
+			segment->length = length;
+			if (self->sendTail) {
+				self->sendTail->next = segment;
+			}
+			else {
+				self->sendHead = segment;
+			}
+			self->sendTail = segment;
+			self->sendBufLen += length;
+			rc = ESIF_OK;
+		}
+	}
+	return rc;
+}
+
+// Remove sent bytes from the head of the Send Queue, releasing each Segment once it has been completely sent
+static void WebClient_ConsumeSendQueue(WebClientPtr self, size_t bytes)
+{
+	while (self->sendHead && (bytes > 0 || self->sendHead->length == 0)) {
+		WebSegmentPtr segment = self->sendHead;
+		size_t consumed = esif_ccb_min(bytes, segment->length);
+
+		segment->data += consumed;
+		segment->length -= consumed;
+		self->sendBufLen -= consumed;
+		bytes -= consumed;
+
+		if (segment->length == 0) {
+			self->sendHead = segment->next;
+			if (self->sendHead == NULL) {
+				self->sendTail = NULL;
+			}
+			WebBuffer_PutRef(segment->buffer);
+			esif_ccb_free(segment);
+		}
+	}
+}
+
+// Do Non-Blocking Gather Send of as much of the Send Queue as the socket will accept
+static esif_error_t WebClient_FlushSendQueue(WebClientPtr self)
+{
+	esif_error_t rc = ESIF_OK;
+
+	while (rc == ESIF_OK && self->sendHead != NULL) {
+		esif_ccb_iovec_t iov[WS_MAX_IOVECS];
+		WebSegmentPtr segment = NULL;
+		size_t iovcnt = 0;
+		size_t total = 0;
+		ssize_t ret = 0;
+
+		for (segment = self->sendHead; segment != NULL && iovcnt < WS_MAX_IOVECS; segment = segment->next) {
+			esif_ccb_iovec_set(&iov[iovcnt], segment->data, segment->length);
+			total += segment->length;
+			iovcnt++;
+		}
+
+		ret = esif_ccb_socket_sendv(self->socket, iov, iovcnt, WS_NONBLOCKING_FLAGS);
+		if (ret == SOCKET_ERROR) {
+			if (esif_ccb_socket_error() != ESIF_SOCKERR_EWOULDBLOCK) {
+				rc = ESIF_E_WS_SOCKET_ERROR;
+			}
+			break;
+		}
+		WebClient_ConsumeSendQueue(self, (size_t)ret);
+
+		// Stop when the socket send buffer is full
+		if ((size_t)ret < total) {
+			break;
+		}
+	}
+	return rc;
+}
+
 // Close Web Client
 void WebClient_Close(WebClientPtr self)
 {
 	if (self) {
 		esif_handle_t ipfHandle = self->ipfHandle;
-		esif_ccb_free(self->sendBuf);
+		WebClient_ConsumeSendQueue(self, self->sendBufLen);
 		esif_ccb_free(self->recvBuf);
 		esif_ccb_free(self->httpBuf);
 		esif_ccb_free(self->httpRequest);
@@ -739,82 +901,87 @@ void WebClient_Close(WebClientPtr self)
 	}
 }
 
-// Write a Buffer to a WebClient
-esif_error_t WebClient_Write(WebClientPtr self, void *buffer, size_t buf_len)
+// Write a Vector of Buffers to a WebClient using a single Gather Send.
+// Elements with an Output Buffer are queued by reference if unsent; all others are copied only if unsent.
+esif_error_t WebClient_WriteV(WebClientPtr self, const WebIoVec *iov, size_t iovcnt)
 {
 	esif_error_t rc = ESIF_E_PARAMETER_IS_NULL;
 
-	if (self && self->socket != INVALID_SOCKET) {
+	if (self && self->socket != INVALID_SOCKET && (iov != NULL || iovcnt == 0)) {
 		int send_flags = (self->type == ClientWebsocket ? WS_NONBLOCKING_FLAGS : WS_SEND_FLAGS);
-		ssize_t ret = 0;
+		size_t total = 0;
+		size_t sent = 0;
+		size_t j = 0;
 		rc = ESIF_OK;
 
 		// Debug HTTP Response
-		if (buffer && esif_ccb_strncmp(buffer, "HTTP/", 5) == 0) {
-			WS_TRACE_DEBUG("%.*s", (int)buf_len, (char *)buffer);
+		if (iovcnt > 0 && iov[0].data && iov[0].length >= 5 && esif_ccb_strncmp(iov[0].data, "HTTP/", 5) == 0) {
+			WS_TRACE_DEBUG("%.*s", (int)iov[0].length, (char *)iov[0].data);
+		}
+
+		// Do Non-Blocking Send of any data already in send queue first
+		if (self->sendHead != NULL) {
+			rc = WebClient_FlushSendQueue(self);
 		}
 
-		// Do Non-Blocking Send of any data already in send buffer first
-		if (self->sendBuf != NULL && self->sendBufLen > 0) {
-			ret = send(self->socket, (const char *)self->sendBuf, (int)self->sendBufLen, WS_NONBLOCKING_FLAGS);
+		// Do Blocking or Non-Blocking Gather Send if send queue is clear
+		if (rc == ESIF_OK && self->sendHead == NULL && iovcnt > 0) {
+			esif_ccb_iovec_t vec[WS_MAX_IOVECS];
+			size_t count = 0;
+			ssize_t ret = 0;
 
-			// Destroy send buffer if Complete send, otherwise remove sent data before appending new data
-			if (ret == (int)self->sendBufLen) {
-				esif_ccb_free(self->sendBuf);
-				self->sendBuf = NULL;
-				self->sendBufLen = 0;
-				ret = 0;
+			for (j = 0; j < iovcnt && count < WS_MAX_IOVECS; j++) {
+				if (iov[j].length > 0) {
+					esif_ccb_iovec_set(&vec[count], iov[j].data, iov[j].length);
+					count++;
+				}
 			}
-			else if (ret > 0) {
-				esif_ccb_memmove(self->sendBuf, self->sendBuf + ret, self->sendBufLen - ret);
-				self->sendBufLen -= ret;
-				ret = 0;
+			if (count > 0) {
+				ret = esif_ccb_socket_sendv(self->socket, vec, count, send_flags);
 			}
-		}
-
-		// Do Blocking or Non-Blocking send if send buffer is clear
-		if (self->sendBuf == NULL && buffer != NULL && buf_len > 0) {
-			ret = send(self->socket, (char*)buffer, (int)buf_len, send_flags);
-		}
 
-		// Close Socket on Failure; EWOULDBLOCK is not a failure it is expected if the operation would block
-		if (ret == SOCKET_ERROR) {
-			int errnum = 0;
-			if ((errnum = esif_ccb_socket_error()) == ESIF_SOCKERR_EWOULDBLOCK) {
-				ret = 0;
+			// Close Socket on Failure; EWOULDBLOCK is not a failure it is expected if the operation would block
+			if (ret == SOCKET_ERROR) {
+				if (esif_ccb_socket_error() != ESIF_SOCKERR_EWOULDBLOCK) {
+					rc = ESIF_E_WS_SOCKET_ERROR;
+				}
 			}
 			else {
-				rc = ESIF_E_WS_SOCKET_ERROR;
+				sent = (size_t)ret;
 			}
 		}
 
-		// Append any unsent data to send buffer
-		if (rc == ESIF_OK && buffer != NULL && ret != (ssize_t)buf_len) {
-			size_t newBufLen = self->sendBufLen + buf_len - ret;
-			u8 *newBuffer = NULL;
-			if (newBufLen <= WS_MAX_CLIENT_SENDBUF) {
-				newBuffer = esif_ccb_realloc(self->sendBuf, newBufLen);
-			}
-			if (newBuffer == NULL) {
-				rc = ESIF_E_NO_MEMORY;
+		// Append any unsent data to send queue
+		for (j = 0; rc == ESIF_OK && j < iovcnt; j++) {
+			total += iov[j].length;
+			if (sent >= iov[j].length) {
+				sent -= iov[j].length;
 			}
 			else {
-				esif_ccb_memmove(newBuffer + self->sendBufLen, (u8*)buffer + ret, buf_len - ret);
-				self->sendBuf = newBuffer;
-				self->sendBufLen = newBufLen;
+				rc = WebClient_QueueSegment(self, (const u8 *)iov[j].data + sent, iov[j].length - sent, iov[j].buffer);
+				sent = 0;
 			}
-			WS_TRACE_DEBUG("WS SEND Buffering (%d): buffer=%zd sent=%d error=%d send_buf=%zd\n", (int)self->socket, buf_len, ret, esif_ccb_socket_error(), self->sendBufLen);
+		}
+		if (rc == ESIF_OK && self->sendHead != NULL && iovcnt > 0) {
+			WS_TRACE_DEBUG("WS SEND Buffering (%d): buffer=%zd error=%d send_buf=%zd\n", (int)self->socket, total, esif_ccb_socket_error(), self->sendBufLen);
 		}
 
 		// Close Socket on Error
 		if (rc != ESIF_OK) {
-			WS_TRACE_DEBUG("WS SEND Failure (%d): buffer=%zd sent=%d error=%d send_buf=%zd [%zd total]\n", (int)self->socket, buf_len, ret, esif_ccb_socket_error(), self->sendBufLen, self->sendBufLen + buf_len);
+			WS_TRACE_DEBUG("WS SEND Failure (%d): buffer=%zd error=%d send_buf=%zd\n", (int)self->socket, total, esif_ccb_socket_error(), self->sendBufLen);
 			WebClient_Close(self);
 		}
 	}
 	return rc;
 }
 
+// Write a Buffer to a WebClient, or flush its send queue if buffer is NULL
+esif_error_t WebClient_Write(WebClientPtr self, void *buffer, size_t buf_len)
+{
+	WebIoVec iov = { buffer, buf_len, NULL };
+	return WebClient_WriteV(self, &iov, (buffer != NULL && buf_len > 0 ? 1 : 0));
+}
+
 //// WebServer Object Methods ////
 
 // Initialize WebServer Object
@@ -824,6 +991,7 @@ void WebServer_Init(WebServerPtr self)
 	if (self) {
 		esif_ccb_lock_init(&self->lock);
 		TcpDoorbell_Init(&self->doorbell);
+		self->pollfd = -1;
 		for (j = 0; j < IPF_WS_MAX_LISTENERS; j++) {
 			WebListener_Init(&self->listeners[j]);
 		}
@@ -917,6 +1085,10 @@ void WebServer_Close(WebServerPtr self)
 		for (j = 0; j < IPF_WS_MAX_CLIENTS; j++) {
 			WebClient_Close(&self->clients[j]);
 		}
+		if (self->pollfd != -1) {
+			close(self->pollfd);
+			self->pollfd = -1;
+		}
 		esif_ccb_free(self->netBuf);
 		self->netBuf = NULL;
 		self->netBufLen = 0;
@@ -959,20 +1131,21 @@ esif_error_t WebServer_SendMsg(WebServerPtr self, const esif_handle_t ipfHandle,
 
 	// Queue Outgoing Message
 	if (self && buffer && buf_len > 0) {
-		size_t msg_len = sizeof(ClientMsg) + buf_len;
-		ClientMsgPtr msg_ptr = esif_ccb_malloc(msg_len);
-		if (msg_ptr == NULL) {
+		ClientMsgPtr msg_ptr = esif_ccb_malloc(sizeof(*msg_ptr));
+		WebBufferPtr payload = WebBuffer_Create(buffer, buf_len);
+		if (msg_ptr == NULL || payload == NULL) {
+			esif_ccb_free(msg_ptr);
+			WebBuffer_PutRef(payload);
 			rc = ESIF_E_NO_MEMORY;
 		}
 		else {
 			msg_ptr->ipfHandle = ipfHandle;
-			msg_ptr->buf_len = buf_len;
-			esif_ccb_memcpy((void *)&msg_ptr->data, buffer, buf_len);
+			msg_ptr->payload = payload;
 
 			rc = WebServer_EnQueueMsg(self, msg_ptr);
 
 			if (rc != ESIF_OK) {
-				esif_ccb_free(msg_ptr);
+				ClientMsg_Destructor(msg_ptr);
 			}
 			// Signal Web Server that there is work to do by ringing the Doorbell
 			TcpDoorbell_Ring(&self->doorbell, WS_OPCODE_MESSAGE);
@@ -982,6 +1155,7 @@ esif_error_t WebServer_SendMsg(WebServerPtr self, const esif_handle_t ipfHandle,
 }
 
 // Receive and Process a Client Request, Buffering message if necessary
+// Returns ESIF_I_AGAIN once all data currently available on the socket has been received
 esif_error_t WebServer_ProcessRequest(WebServerPtr self, WebClientPtr client)
 {
 	esif_error_t rc = ESIF_E_PARAMETER_IS_NULL;
@@ -992,14 +1166,23 @@ esif_error_t WebServer_ProcessRequest(WebServerPtr self, WebClientPtr client)
 		ssize_t messageLength = 0;
 		u8 *messageBuffer = NULL;
 
-		esif_ccb_memset(self->netBuf, 0, self->netBufLen);
 		rc = ESIF_OK;
 
 		// Read the next partial or complete message fragment from the client socket.
-		messageLength = recv(client->socket, (char*)buffer, (int)buf_len, WS_RECV_FLAGS);
-		if (messageLength == 0 || messageLength == SOCKET_ERROR) {
+		// Only the received data is NUL-terminated; clearing the entire Network Buffer on every read dominates small messages.
+		messageLength = recv(client->socket, (char*)buffer, (int)buf_len - 1, WS_NONBLOCKING_FLAGS);
+		if (messageLength > 0) {
+			buffer[messageLength] = 0;
+		}
+		if (messageLength == 0) {
+			rc = ESIF_E_WS_DISC;
+		}
+		else if (messageLength == SOCKET_ERROR) {
 			int errnum = 0;
-			if ((errnum = esif_ccb_socket_error()) != ESIF_SOCKERR_EWOULDBLOCK) {
+			if ((errnum = esif_ccb_socket_error()) == ESIF_SOCKERR_EWOULDBLOCK) {
+				rc = ESIF_I_AGAIN;
+			}
+			else {
 				rc = ESIF_E_WS_DISC;
 			}
 		}
@@ -1059,19 +1242,136 @@ void WebServer_CloseOrphans(WebServerPtr self)
 	}
 }
 
+// Register a Listener Socket with the Web Server epoll instance
+static esif_error_t WebServer_PollListener(WebServerPtr self, u32 index)
+{
+	esif_error_t rc = ESIF_E_WS_SOCKET_ERROR;
+	WebListenerPtr listener = &self->listeners[index];
+	if (listener->socket != INVALID_SOCKET) {
+		struct epoll_event event = { 0 };
+		event.events = EPOLLIN;
+		event.data.u64 = WS_POLL_ID(WS_POLL_LISTENER, index);
+		if (epoll_ctl(self->pollfd, EPOLL_CTL_ADD, listener->socket, &event) == 0) {
+			rc = ESIF_OK;
+		}
+	}
+	return rc;
+}
+
+// Register or Update a Client Socket with the Web Server epoll instance
+// Client Sockets are Edge-Triggered and only wait to become writable while the Send Buffer is non-empty
+static esif_error_t WebServer_PollClient(WebServerPtr self, u32 index)
+{
+	esif_error_t rc = ESIF_OK;
+	WebClientPtr client = &self->clients[index];
+	if (client->socket != INVALID_SOCKET) {
+		u32 events = WS_POLL_CLIENT_EVENTS | (client->sendHead ? EPOLLOUT : 0);
+		if (events != client->pollEvents) {
+			struct epoll_event event = { 0 };
+			event.events = events;
+			event.data.u64 = WS_POLL_ID(WS_POLL_CLIENT, index);
+			if (epoll_ctl(self->pollfd, (client->pollEvents ? EPOLL_CTL_MOD : EPOLL_CTL_ADD), client->socket, &event) == 0) {
+				client->pollEvents = events;
+			}
+			else {
+				WS_TRACE_ERROR("Client[%d] Socket[%d]: epoll Error (%d)\n", (int)index, (int)client->socket, errno);
+				rc = ESIF_E_WS_SOCKET_ERROR;
+			}
+		}
+	}
+	return rc;
+}
+
+// Accept a new connection on a readable Listener Socket
+static void WebServer_AcceptClient(WebServerPtr self, u32 index)
+{
+	WebListenerPtr listener = &self->listeners[index];
+	esif_ccb_socket_t clientSocket = INVALID_SOCKET;
+	esif_ccb_sockaddr_t clientSockaddr = { 0 };
+	WebClientPtr client = NULL;
+	u32 k = 0;
+	esif_error_t rc = ESIF_OK;
+
+	// Find first Unused Client
+	for (k = 0; k < IPF_WS_MAX_CLIENTS; k++) {
+		if (self->clients[k].type == ClientClosed) {
+			client = &self->clients[k];
+			break;
+		}
+	}
+
+	// Accept Incoming Connection
+	if ((rc = WebListener_AcceptClient(listener, &clientSocket, &clientSockaddr)) != ESIF_OK) {
+		WS_TRACE_DEBUG("Listener[%d] Socket[%d]: Accept Error: %s (%d)\n", (int)index, listener->socket, esif_rc_str(rc), rc);
+	}
+	// Close Client if Max Connections exceeded or Server Paused
+	else if (client == NULL || atomic_read(&self->isPaused)) {
+		if (client == NULL) {
+			WS_TRACE_WARNING("Connection Limit Exceeded (%d)\n", IPF_WS_MAX_CLIENTS);
+		}
+		else {
+			WS_TRACE_INFO("Server Paused: Connection Closed[%d]", clientSocket);
+		}
+		esif_ccb_socket_close(clientSocket);
+	}
+	else {
+		// Client is now an HTTP Connection
+		client->type = ClientHttp;
+		client->socket = clientSocket;
+		client->sockaddr = clientSockaddr;
+		client->authHandle = listener->authHandle;
+		WS_TRACE_DEBUG("Accepted Client[%d]: Socket[%d]\n", (int)k, (int)client->socket);
+
+		if (WebServer_PollClient(self, k) != ESIF_OK) {
+			WebClient_Close(client);
+		}
+	}
+}
+
+// Process epoll Events for an Active Client
+static void WebServer_ServiceClient(WebServerPtr self, u32 index, u32 events)
+{
+	WebClientPtr client = &self->clients[index];
+	esif_handle_t ipfHandle = client->ipfHandle;
+	esif_error_t rc = ESIF_OK;
+
+	// Receive and Process Requests from Readable Clients until no more data is available (Edge-Triggered)
+	if (client->socket != INVALID_SOCKET && (events & (EPOLLIN | EPOLLERR | EPOLLHUP))) {
+		while ((rc = WebServer_ProcessRequest(self, client)) == ESIF_OK && client->socket != INVALID_SOCKET) {
+			// Keep Reading
+		}
+		if (rc != ESIF_OK && rc != ESIF_I_AGAIN) {
+			WebClient_Close(client);
+			WS_TRACE_DEBUG("Client[%d] Disconnected: %s (%d)\n", (int)index, esif_rc_str(rc), (int)rc);
+		}
+	}
+
+	// Start New IPF Client Session for each new Connection
+	if (client->socket != INVALID_SOCKET && ipfHandle == ESIF_INVALID_HANDLE && client->ipfHandle != ESIF_INVALID_HANDLE) {
+		IpfClient_Start(client->ipfHandle, client->sockaddr, client->authHandle);
+	}
+
+	// Flush pending Send Buffer when socket becomes writable
+	if (client->socket != INVALID_SOCKET && client->sendHead && (events & EPOLLOUT)) {
+		size_t sendBufLen = client->sendBufLen;
+		UNREFERENCED_PARAMETER(sendBufLen);
+		WebClient_Write(client, NULL, 0);
+		WS_TRACE_DEBUG("WS SEND Unbuffering (%d): before=%zd after=%zd\n", (int)client->socket, sendBufLen, client->sendBufLen);
+	}
+
+	if (WebServer_PollClient(self, index) != ESIF_OK) {
+		WebClient_Close(client);
+	}
+}
+
 // Web Server Main Module (One per Thread)
 static esif_error_t WebServer_Main(WebServerPtr self)
 {
 	esif_error_t rc = ESIF_E_PARAMETER_IS_NULL;
 	if (self) {
-		struct timeval tv = { 0 };	// Timeout
-		fd_set readFDs = { 0 };		// Readable Sockets List
-		fd_set writeFDs = { 0 };	// Writable Sockets List
-		fd_set exceptFDs = { 0 };	// Exception Sockets List
-
-		int selectResult = 0;		// select() result
-		int maxfd = 0;				// Max file descriptor ID + 1
-		int setsize = 0;			// Number of items in FD List
+		struct epoll_event events[WS_POLL_MAX_EVENTS] = { 0 };	// Active Sockets List
+		int eventCount = 0;			// epoll_wait() result
+		Bool quit = ESIF_FALSE;		// Quit signaled by Doorbell
 		int j = 0;
 
 		atomic_inc(&self->activeThreads);
@@ -1084,10 +1384,19 @@ static esif_error_t WebServer_Main(WebServerPtr self)
 			rc = ESIF_E_NO_MEMORY;
 		}
 
-		// Create Doorbell Socket Pair
+		// Create Doorbell and epoll instance to monitor it
 		if (rc == ESIF_OK) {
 			rc = TcpDoorbell_Open(&self->doorbell);
 		}
+		if (rc == ESIF_OK) {
+			struct epoll_event event = { 0 };
+			event.events = EPOLLIN;
+			event.data.u64 = WS_POLL_ID(WS_POLL_DOORBELL, 0);
+			if ((self->pollfd = epoll_create1(EPOLL_CLOEXEC)) == -1 ||
+				epoll_ctl(self->pollfd, EPOLL_CTL_ADD, self->doorbell.eventfd, &event) != 0) {
+				rc = ESIF_E_WS_INIT_FAILED;
+			}
+		}
 
 		// Create Listener Socket(s)
 		if (ESIF_OK == rc) {
@@ -1096,6 +1405,9 @@ static esif_error_t WebServer_Main(WebServerPtr self)
 			for (j = 0; j < IPF_WS_MAX_LISTENERS; j++) {
 				if (self->listeners[j].serverAddr[0]) {
 					rc = WebListener_Open(&self->listeners[j]);
+					if (rc == ESIF_OK) {
+						rc = WebServer_PollListener(self, j);
+					}
 				
 					if (rc == ESIF_OK) {
 						running++;
@@ -1119,25 +1431,10 @@ static esif_error_t WebServer_Main(WebServerPtr self)
 		//// MAIN LOOP ////
 		
 		// Process all active sockets and accept new connections until Quit signaled
-		while (rc == ESIF_OK && atomic_read(&self->isActive)) {
-
-			// Reset File Descriptor Lists after each iteration
-			FD_ZERO(&readFDs);
-			FD_ZERO(&writeFDs);
-			FD_ZERO(&exceptFDs);
-			maxfd = 0;
-			setsize = 0;
+		while (rc == ESIF_OK && !quit && atomic_read(&self->isActive)) {
 
-			// Add Doorbell Ringer
-			FD_SET(self->doorbell.sockets[DOORBELL_RINGER], &readFDs);
-			FD_SET(self->doorbell.sockets[DOORBELL_RINGER], &exceptFDs);
-			maxfd = (int)self->doorbell.sockets[DOORBELL_RINGER] + 1;
-			setsize++;
-
-			// Add Listener Socket(s)
-			for (j = 0; j < IPF_WS_MAX_LISTENERS && setsize < WS_MAX_SOCKETS; j++) {
-
-				// Recreate Unix Domain Socket Listener if file was deleted
+			// Recreate Unix Domain Socket Listener(s) if file was deleted
+			for (j = 0; j < IPF_WS_MAX_LISTENERS; j++) {
 				if ((self->listeners[j].sockaddr.type == AF_UNIX) && 
 					(WebServer_GetListenerMask(self) & ((size_t)1 << j)) &&
 					(esif_socket_file_stat(self->listeners[j].sockaddr.un_addr.sun_path) == ESIF_SOCKERR_ENOENT)) {
@@ -1149,6 +1446,9 @@ static esif_error_t WebServer_Main(WebServerPtr self)
 					WebServer_ClearListenerMask(self, ((size_t)1 << j));
 
 					rc = WebListener_Open(&self->listeners[j]);
+					if (rc == ESIF_OK) {
+						rc = WebServer_PollListener(self, j);
+					}
 
 					if (rc == ESIF_OK) {
 						WebServer_SetListenerMask(self, ((size_t)1 << j));
@@ -1159,53 +1459,34 @@ static esif_error_t WebServer_Main(WebServerPtr self)
 						break;
 					}
 				}
-				if (self->listeners[j].socket != INVALID_SOCKET) {
-					FD_SET(self->listeners[j].socket, &readFDs);
-					FD_SET(self->listeners[j].socket, &exceptFDs);
-					maxfd = esif_ccb_max(maxfd, (int)self->listeners[j].socket + 1);
-					setsize++;
-				}
 			}
-
-			// Add Client Socket(s)
-			for (j = 0; j < IPF_WS_MAX_CLIENTS && setsize < WS_MAX_SOCKETS; j++) {
-				if (self->clients[j].socket != INVALID_SOCKET) {
-					FD_SET(self->clients[j].socket, &readFDs);
-					FD_SET(self->clients[j].socket, &exceptFDs);
-					maxfd = esif_ccb_max(maxfd, (int)self->clients[j].socket + 1);
-					setsize++;
-
-					// Wait for socket to become writable if pending send buffer
-					if (self->clients[j].sendBuf) {
-						FD_SET(self->clients[j].socket, &writeFDs);
-					}
-				}
+			if (rc != ESIF_OK) {
+				break;
 			}
 
 			// Use Lowest Remaining Transaction Timeout for all Active Connections, if any
 			double timeout = IpfTrxMgr_GetMinTimeout(IpfTrxMgr_GetInstance());
 			double sessionTimeout = AppSessionMgr_GetMinTimeout();
 			timeout = esif_ccb_min(timeout, sessionTimeout);
-			tv.tv_sec = (long)timeout;
-			tv.tv_usec = (long)((timeout - (Int64)timeout) * 1000000);
-			if (tv.tv_sec == 0 && tv.tv_usec == 0) {
-				tv.tv_sec = WS_SOCKET_TIMEOUT;
-			}
+			int timeoutMsec = (timeout > 0 ? (int)esif_ccb_min(timeout * 1000 + 0.999, (double)INT_MAX) : WS_SOCKET_TIMEOUT * 1000);
 
 			//// WAIT FOR SOCKET ACTIVITY ////
 
-			selectResult = select(maxfd, &readFDs, &writeFDs, &exceptFDs, &tv);
+			eventCount = epoll_wait(self->pollfd, events, WS_POLL_MAX_EVENTS, timeoutMsec);
 
-			// Exit loop if select error or server stopping; continue loop if inactivity timeout
-			if (selectResult == SOCKET_ERROR) {
-				WS_TRACE_ERROR("SELECT Error (%d)\n", selectResult);
+			// Exit loop if epoll error or server stopping; continue loop if inactivity timeout
+			if (eventCount == -1 && errno == EINTR) {
+				continue;
+			}
+			else if (eventCount == -1) {
+				WS_TRACE_ERROR("EPOLL Error (%d)\n", errno);
 				rc = ESIF_E_WS_SOCKET_ERROR;
 				break;
 			}
 			else if (!atomic_read(&self->isActive)) { // Exit if Server not Active
 				break;
 			}
-			else if (selectResult == 0) { // Timeout
+			else if (eventCount == 0) { // Timeout
 				IpfTrxMgr_ExpireInactive(IpfTrxMgr_GetInstance());
 				AppSessionMgr_SessionCleanup();
 				continue;
@@ -1213,129 +1494,77 @@ static esif_error_t WebServer_Main(WebServerPtr self)
 
 			//// PROCESS ALL ACTIVE SOCKETS ////
 
-			// 1. Respond to Incoming Doorbell Socket signals
-			if (FD_ISSET(self->doorbell.sockets[DOORBELL_RINGER], &readFDs)) {
-				u8 opcode = WS_OPCODE_NOOP;
+			for (j = 0; j < eventCount && !quit && atomic_read(&self->isActive); j++) {
+				u32 index = WS_POLL_INDEX(events[j].data.u64);
 
-				// Exit if Doorbell socket(s) shutdown or a QUIT opcode received
-				if (TcpDoorbell_Receive(&self->doorbell, &opcode) != ESIF_OK) {
-					WS_TRACE_DEBUG("Doorbell Closed; Exiting");
-					break;
-				}
-				WS_TRACE_DEBUG("Doorbell Received: 0x%02X", ((int)opcode & 0xFF));
-				if (opcode == WS_OPCODE_QUIT) {
-					break;
-				}
-				else if (opcode == WS_OPCODE_CLOSE) {
-					for (j = 0; j < IPF_WS_MAX_CLIENTS && atomic_read(&self->isActive); j++) {
-						WebClientPtr client = &self->clients[j];
-						if (client->socket != INVALID_SOCKET && client->ipfHandle != ESIF_INVALID_HANDLE && !IpfClient_Exists(client->ipfHandle)) {
-							WebClient_Close(client);
-							WS_TRACE_DEBUG("Closing Client[%d]: (Stopped) Socket[%d]\n", j, (int)client->socket);
-						}
-					}
-				}
-			}
+				switch (WS_POLL_TYPE(events[j].data.u64)) {
 
-			// 2. Close open Sockets with Exceptions
-			for (j = 0; j < IPF_WS_MAX_CLIENTS && atomic_read(&self->isActive); j++) {
-				WebClientPtr client = &self->clients[j];
-				if (client->socket != INVALID_SOCKET && FD_ISSET(client->socket, &exceptFDs)) {
-					WebClient_Close(client);
-					WS_TRACE_DEBUG("Closing Client[%d]: (Exception) Socket[%d]\n", j, (int)client->socket);
-				}
-			}
+				// Respond to Incoming Doorbell signals
+				case WS_POLL_DOORBELL: {
+					u8 opcode = WS_OPCODE_NOOP;
 
-			// 3. Accept any new connections on the Listener Socket(s)
-			int sockets = setsize;
-			for (j = 0; j < IPF_WS_MAX_LISTENERS && atomic_read(&self->isActive); j++) {
-				WebListenerPtr listener = &self->listeners[j];
-				if (listener->socket != INVALID_SOCKET && FD_ISSET(listener->socket, &readFDs)) {
-					esif_ccb_socket_t clientSocket = INVALID_SOCKET;
-					WebClientPtr client = NULL;
-					int k = 0;
-
-					// Find first Unused Client
-					for (k = 0; k < IPF_WS_MAX_CLIENTS && sockets < WS_MAX_SOCKETS; k++) {
-						if (self->clients[k].type == ClientClosed) {
-							client = &self->clients[k];
-							break;
-						}
+					// Exit if Doorbell stopped or a QUIT opcode received
+					if (TcpDoorbell_Receive(&self->doorbell, &opcode) != ESIF_OK) {
+						WS_TRACE_DEBUG("Doorbell Closed; Exiting");
+						quit = ESIF_TRUE;
+						break;
 					}
-
-					// Accept Incoming Connection
-					esif_ccb_sockaddr_t clientSockaddr = { 0 };
-					if ((rc = WebListener_AcceptClient(listener, &clientSocket, &clientSockaddr)) != ESIF_OK) {
-						WS_TRACE_DEBUG("Listener[%d] Socket[%d]: Accept Error: %s (%d)\n", j, listener->socket, esif_rc_str(rc), rc);
+					WS_TRACE_DEBUG("Doorbell Received: 0x%02X", ((int)opcode & 0xFF));
+					if ((opcode & WS_OPCODE_QUIT) == WS_OPCODE_QUIT) {
+						quit = ESIF_TRUE;
 					}
-					else {
-						// Close Client if Max Connections exceeded or Server Paused
-						if (client == NULL || atomic_read(&self->isPaused)) {
-							if (client == NULL) {
-								WS_TRACE_WARNING("Connection Limit Exceeded (%d)\n", IPF_WS_MAX_CLIENTS);
+					else if (opcode & WS_OPCODE_CLOSE) {
+						for (u32 k = 0; k < IPF_WS_MAX_CLIENTS && atomic_read(&self->isActive); k++) {
+							WebClientPtr client = &self->clients[k];
+							if (client->socket != INVALID_SOCKET && client->ipfHandle != ESIF_INVALID_HANDLE && !IpfClient_Exists(client->ipfHandle)) {
+								WebClient_Close(client);
+								WS_TRACE_DEBUG("Closing Client[%d]: (Stopped) Socket[%d]\n", (int)k, (int)client->socket);
 							}
-							else {
-								WS_TRACE_INFO("Server Paused: Connection Closed[%d]", clientSocket);
-							}
-							esif_ccb_socket_close(clientSocket);
-							clientSocket = INVALID_SOCKET;
-							continue;
 						}
-
-						// Client is now an HTTP Connection
-						client->type = ClientHttp;
-						client->socket = clientSocket;
-						client->sockaddr = clientSockaddr;
-						client->authHandle = listener->authHandle;
-						clientSocket = INVALID_SOCKET;
-						sockets++;	
-						WS_TRACE_DEBUG("Accepted Client[%d]: Socket[%d]\n", k, (int)client->socket);
 					}
+					break;
 				}
-			}
 
-			// 4. Process Active Client Requests
-			for (j = 0; j < IPF_WS_MAX_CLIENTS && atomic_read(&self->isActive); j++) {
-				WebClientPtr client = &self->clients[j];
-
-				// Receive and Process Requests from Readable Clients
-				esif_handle_t ipfHandle = client->ipfHandle;
-				if (client->socket != INVALID_SOCKET && FD_ISSET(client->socket, &readFDs)) {
-					if ((rc = WebServer_ProcessRequest(self, client)) != ESIF_OK) {
-						WebClient_Close(client);
-						WS_TRACE_DEBUG("Client[%d] Disconnected: %s (%d)\n", j, esif_rc_str(rc), (int)rc);
+				// Accept any new connections on the Listener Socket(s)
+				case WS_POLL_LISTENER:
+					if (index < IPF_WS_MAX_LISTENERS && self->listeners[index].socket != INVALID_SOCKET) {
+						WebServer_AcceptClient(self, index);
 					}
-				}
+					break;
 
-				// Start New IPF Client Session for each new Connection
-				if (client->socket != INVALID_SOCKET && ipfHandle == ESIF_INVALID_HANDLE && client->ipfHandle != ESIF_INVALID_HANDLE) {
-					IpfClient_Start(client->ipfHandle, client->sockaddr, client->authHandle);
-				}
+				// Process Active Client Requests
+				case WS_POLL_CLIENT:
+					if (index < IPF_WS_MAX_CLIENTS) {
+						WebServer_ServiceClient(self, index, events[j].events);
+					}
+					break;
 
-				// Flush pending Send Buffer when socket becomes writable
-				if (client->socket != INVALID_SOCKET && FD_ISSET(client->socket, &writeFDs)) {
-					size_t sendBufLen = client->sendBufLen;
-					UNREFERENCED_PARAMETER(sendBufLen);
-					rc = WebClient_Write(client, NULL, 0);
-					WS_TRACE_DEBUG("WS SEND Unbuffering (%d): before=%zd after=%zd\n", (int)client->socket, sendBufLen, client->sendBufLen);
+				default:
+					break;
 				}
 			}
+			if (quit) {
+				break;
+			}
 
-			// 5. Deliver Pending Messages to Active IPF Clients
+			// Deliver Pending Messages to Active IPF Clients
 			ClientMsgPtr msg_ptr = NULL;
 			while (atomic_read(&self->isActive) && (msg_ptr = WebServer_DeQueueMsg(self)) != NULL) {
 				rc = ESIF_E_INVALID_HANDLE;
 				for (j = 0; j < IPF_WS_MAX_CLIENTS && atomic_read(&self->isActive); j++) {
 					WebClientPtr client = &self->clients[j];
 					if (client->type == ClientWebsocket && client->socket != INVALID_SOCKET && client->ipfHandle != ESIF_INVALID_HANDLE && client->ipfHandle == msg_ptr->ipfHandle) {
-						rc = WebServer_WebsocketDeliver(self, client, (u8 *)msg_ptr->data, msg_ptr->buf_len);
+						rc = WebServer_WebsocketDeliver(self, client, msg_ptr->payload);
+						if (WebServer_PollClient(self, j) != ESIF_OK) {
+							WebClient_Close(client);
+						}
 						break;
 					}
 				}
-				esif_ccb_free(msg_ptr);
+				ClientMsg_Destructor(msg_ptr);
 			}
 
-			// 6. Destroy Expired Transactions and Dead Sessions
+			// Destroy Expired Transactions and Dead Sessions
 			IpfTrxMgr_ExpireInactive(IpfTrxMgr_GetInstance());
 			AppSessionMgr_SessionCleanup();
 			rc = ESIF_OK;
@@ -1486,7 +1715,7 @@ void WebServer_Stop(WebServerPtr self)
 	if (self && (atomic_read(&self->isActive) || atomic_read(&self->activeThreads))) {
 		atomic_set(&self->isActive, 0);
 
-		// Ring Doorbells to signal blocking select() and FileWatcher threads to exit
+		// Ring Doorbells to signal blocking epoll_wait() and FileWatcher threads to exit
 		TcpDoorbell_Stop(&self->doorbell);
 		if (self->fileDoorbell) {
 			signal_post(self->fileDoorbell);
@@ -1558,6 +1787,211 @@ Bool WebServer_IsDiagnostic(WebServerPtr self)
 	return rc;
 }
 
+//// Web Server Benchmark ////
+
+#define WS_BENCH_PAYLOAD_LEN	8				// PING/PONG Frame Payload Size
+#define WS_BENCH_FRAME_LEN		(2 + sizeof(u32) + WS_BENCH_PAYLOAD_LEN)	// Masked Client PING Frame Size
+#define WS_BENCH_PONG_LEN		(2 + WS_BENCH_PAYLOAD_LEN)	// Unmasked Server PONG Frame Size
+#define WS_BENCH_MASK_KEY		0x5A3C96E1		// Client Frame Mask Key
+#define WS_BENCH_TIMEOUT		5				// Benchmark Client Receive Timeout (seconds)
+
+// Send an entire buffer on a blocking Benchmark Client socket
+static esif_error_t WebBench_SendAll(esif_ccb_socket_t socket, const void *buffer, size_t buf_len)
+{
+	size_t sent = 0;
+	while (sent < buf_len) {
+		ssize_t ret = send(socket, (const char *)buffer + sent, buf_len - sent, WS_SEND_FLAGS);
+		if (ret <= 0) {
+			return ESIF_E_WS_SOCKET_ERROR;
+		}
+		sent += (size_t)ret;
+	}
+	return ESIF_OK;
+}
+
+// Receive an entire buffer on a blocking Benchmark Client socket
+static esif_error_t WebBench_RecvAll(esif_ccb_socket_t socket, void *buffer, size_t buf_len)
+{
+	size_t received = 0;
+	while (received < buf_len) {
+		ssize_t ret = recv(socket, (char *)buffer + received, buf_len - received, WS_RECV_FLAGS);
+		if (ret <= 0) {
+			return ESIF_E_WS_SOCKET_ERROR;
+		}
+		received += (size_t)ret;
+	}
+	return ESIF_OK;
+}
+
+// Connect a simulated Client to a local Listener and Upgrade it to a Websocket Connection
+// The Client does not identify itself as an IPF Client so no IPF Session is created.
+static esif_ccb_socket_t WebBench_Connect(esif_ccb_sockaddr_t sockaddr)
+{
+	esif_ccb_socket_t clientSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+	const char request[] =
+		"GET / HTTP/1.1" CRLF
+		"Host: localhost" CRLF
+		"Origin: http://localhost" CRLF
+		"Upgrade: websocket" CRLF
+		"Connection: Upgrade" CRLF
+		"Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==" CRLF
+		"Sec-WebSocket-Version: 13" CRLF
+		"User-Agent: IpfBench/1.0" CRLF
+		CRLF;
+	char response[512] = { 0 };
+	size_t received = 0;
+	struct timeval tv = { WS_BENCH_TIMEOUT, 0 };
+
+	if (clientSocket == INVALID_SOCKET) {
+		goto exit;
+	}
+	if (setsockopt(clientSocket, SOL_SOCKET, SO_RCVTIMEO, (const char *)&tv, sizeof(tv)) != 0 ||
+		connect(clientSocket, (struct sockaddr *)&sockaddr.un_addr, IpfIpc_SockaddrLen(sockaddr.type)) != 0 ||
+		WebBench_SendAll(clientSocket, request, sizeof(request) - 1) != ESIF_OK) {
+		goto fail;
+	}
+
+	// Wait for complete "101 Switching Protocols" Response
+	while (esif_ccb_strstr(response, CRLF CRLF) == NULL) {
+		ssize_t ret = recv(clientSocket, response + received, sizeof(response) - received - 1, WS_RECV_FLAGS);
+		if (ret <= 0) {
+			goto fail;
+		}
+		received += (size_t)ret;
+		if (received >= sizeof(response) - 1) {
+			goto fail;
+		}
+	}
+	if (esif_ccb_strncmp(response, "HTTP/1.1 101 ", 13) == 0) {
+		goto exit;
+	}
+fail:
+	esif_ccb_socket_close(clientSocket);
+	clientSocket = INVALID_SOCKET;
+exit:
+	return clientSocket;
+}
+
+// Benchmark the Web Server using simulated local Unix Domain Socket Clients
+// Each round every Client sends a PING Frame and then every PONG Response is received, measuring
+// Round-Trip Latency and Process CPU Time (Web Server and Benchmark Clients) per Message.
+esif_error_t WebServer_Benchmark(WebServerPtr self, size_t clients, size_t rounds, WebBenchResultsPtr results)
+{
+	esif_error_t rc = ESIF_E_PARAMETER_IS_NULL;
+	esif_ccb_socket_t *sockets = NULL;
+	esif_ccb_realtime_t *sendTimes = NULL;
+	size_t k = 0;
+
+	if (self && results && clients > 0 && rounds > 0) {
+		esif_ccb_sockaddr_t sockaddr = { 0 };
+		Bool found = ESIF_FALSE;
+		esif_ccb_memset(results, 0, sizeof(*results));
+		clients = esif_ccb_min(clients, IPF_WS_MAX_CLIENTS);
+
+		// Use the first active Unix Domain Socket Listener
+		esif_ccb_read_lock(&self->lock);
+		atomic_t mask = WebServer_GetListenerMask(self);
+		for (size_t j = 0; j < IPF_WS_MAX_LISTENERS && !found; j++) {
+			if ((mask & ((size_t)1 << j)) && self->listeners[j].sockaddr.type == AF_UNIX) {
+				sockaddr = self->listeners[j].sockaddr;
+				found = ESIF_TRUE;
+			}
+		}
+		esif_ccb_read_unlock(&self->lock);
+
+		if (!found || !atomic_read(&self->isActive)) {
+			rc = ESIF_E_WS_INVALID_ADDR;
+			goto exit;
+		}
+
+		sockets = (esif_ccb_socket_t *)esif_ccb_malloc(clients * sizeof(*sockets));
+		sendTimes = (esif_ccb_realtime_t *)esif_ccb_malloc(clients * sizeof(*sendTimes));
+		if (sockets == NULL || sendTimes == NULL) {
+			rc = ESIF_E_NO_MEMORY;
+			goto exit;
+		}
+		for (k = 0; k < clients; k++) {
+			sockets[k] = INVALID_SOCKET;
+		}
+
+		// Connect all Clients before starting measurements
+		for (k = 0; k < clients; k++) {
+			if ((sockets[k] = WebBench_Connect(sockaddr)) == INVALID_SOCKET) {
+				rc = ESIF_E_WS_SOCKET_ERROR;
+				goto exit;
+			}
+		}
+		results->clients = clients;
+		results->minLatencyUsec = (double)INT_MAX;
+
+		struct rusage usageStart = { 0 };
+		struct rusage usageStop = { 0 };
+		getrusage(RUSAGE_SELF, &usageStart);
+		esif_ccb_realtime_t startTime = esif_ccb_realtime_current();
+		double totalLatencyUsec = 0.0;
+		rc = ESIF_OK;
+
+		for (size_t round = 0; round < rounds && rc == ESIF_OK; round++) {
+			for (k = 0; k < clients && rc == ESIF_OK; k++) {
+				u8 frame[WS_BENCH_FRAME_LEN] = { 0 };
+				u32 maskKey = WS_BENCH_MASK_KEY;
+				u64 sequence = (u64)round * clients + k;
+
+				frame[0] = 0x80 | FRAME_PING;				// FIN + PING
+				frame[1] = 0x80 | WS_BENCH_PAYLOAD_LEN;		// Masked + Payload Size
+				esif_ccb_memcpy(&frame[2], &maskKey, sizeof(maskKey));
+				esif_ccb_memcpy(&frame[2 + sizeof(maskKey)], &sequence, sizeof(sequence));
+				for (size_t b = 0; b < WS_BENCH_PAYLOAD_LEN; b++) {
+					frame[2 + sizeof(maskKey) + b] ^= ((u8 *)&maskKey)[b % sizeof(maskKey)];
+				}
+				sendTimes[k] = esif_ccb_realtime_current();
+				rc = WebBench_SendAll(sockets[k], frame, sizeof(frame));
+			}
+			for (k = 0; k < clients && rc == ESIF_OK; k++) {
+				u8 frame[WS_BENCH_PONG_LEN] = { 0 };
+				u64 sequence = (u64)round * clients + k;
+
+				rc = WebBench_RecvAll(sockets[k], frame, sizeof(frame));
+				if (rc == ESIF_OK) {
+					double latencyUsec = esif_ccb_realtime_diff_msec(sendTimes[k], esif_ccb_realtime_current()) * 1000.0;
+					if (frame[0] != (0x80 | FRAME_PONG) || frame[1] != WS_BENCH_PAYLOAD_LEN || memcmp(&frame[2], &sequence, sizeof(sequence)) != 0) {
+						rc = ESIF_E_WS_INVALID_REQUEST;
+						break;
+					}
+					totalLatencyUsec += latencyUsec;
+					results->minLatencyUsec = esif_ccb_min(results->minLatencyUsec, latencyUsec);
+					results->maxLatencyUsec = esif_ccb_max(results->maxLatencyUsec, latencyUsec);
+					results->messages++;
+				}
+			}
+		}
+
+		results->elapsedMsec = esif_ccb_realtime_diff_msec(startTime, esif_ccb_realtime_current());
+		getrusage(RUSAGE_SELF, &usageStop);
+		if (results->messages > 0) {
+			double cpuUsec =
+				(double)(usageStop.ru_utime.tv_sec - usageStart.ru_utime.tv_sec) * 1000000.0 + (double)(usageStop.ru_utime.tv_usec - usageStart.ru_utime.tv_usec) +
+				(double)(usageStop.ru_stime.tv_sec - usageStart.ru_stime.tv_sec) * 1000000.0 + (double)(usageStop.ru_stime.tv_usec - usageStart.ru_stime.tv_usec);
+			results->avgLatencyUsec = totalLatencyUsec / results->messages;
+			results->cpuUsecPerMsg = cpuUsec / results->messages;
+		}
+		else {
+			results->minLatencyUsec = 0.0;
+		}
+	}
+exit:
+	if (sockets) {
+		for (k = 0; k < clients; k++) {
+			if (sockets[k] != INVALID_SOCKET) {
+				esif_ccb_socket_close(sockets[k]);
+			}
+		}
+	}
+	esif_ccb_free(sockets);
+	esif_ccb_free(sendTimes);
+	return rc;
+}
+
 // Initialize Plugin
 esif_error_t WebPlugin_Init()
 {
@@ -52,16 +52,37 @@ typedef enum FinType_e {
 	FIN_FINAL = 1
 } FinType, *FinTypePtr;
 
-// TCP Doorbell Object
-#define DOORBELL_SOCKETS	2	// Pair of Sockets used to signal blocked select()
-#define DOORBELL_RINGER		0	// Ringer   = Socket 0 [recv]
-#define DOORBELL_BUTTON		1	// Doorbell = Socket 1 [send]
-
+// Doorbell Object
+// Opcodes are accumulated in a Bitmask and the eventfd counter wakes the blocked epoll_wait(),
+// so multiple Rings before the Web Server wakes up are coalesced into a single Receive.
 typedef struct TcpDoorbell_s {
-	Bool				isActive;					// Paired Sockets are Active?
-	esif_ccb_socket_t	sockets[DOORBELL_SOCKETS];	// Paired TCP Sockets used to signal blocked select()
+	Bool				isActive;	// Doorbell is Active?
+	int					eventfd;	// eventfd used to signal blocked epoll_wait() or -1
+	atomic_t			opcodes;	// Pending Opcodes Bitmask
 } TcpDoorbell, *TcpDoorbellPtr;
 
+// Refcounted Output Buffer that may be referenced by the Send Queues of one or more Clients
+typedef struct WebBuffer_s {
+	atomic_t			refCount;		// Reference Count
+	size_t				buf_len;		// Buffer Length
+	u8					data[1];		// Dynamic Buffer of size buf_len
+} WebBuffer, *WebBufferPtr;
+
+// Client Send Queue Segment: Unsent portion of a referenced Output Buffer
+typedef struct WebSegment_s {
+	struct WebSegment_s	*next;			// Next Segment in Send Queue
+	WebBufferPtr		buffer;			// Referenced Output Buffer
+	u8					*data;			// Unsent Data within Output Buffer
+	size_t				length;			// Unsent Data Length
+} WebSegment, *WebSegmentPtr;
+
+// Output Vector Element for WebClient_WriteV
+typedef struct WebIoVec_s {
+	const void			*data;			// Data to Send
+	size_t				length;			// Data Length
+	WebBufferPtr		buffer;			// Output Buffer containing data, or NULL if data must be copied when queued
+} WebIoVec, *WebIoVecPtr;
+
 // Binary Message Object Queue
 typedef struct MessageQueue_s {
 	esif_ccb_lock_t				lock;
@@ -96,8 +117,9 @@ typedef struct WebClient_s {
 	esif_ccb_sockaddr_t	sockaddr;		// Client Socket Address
 	esif_handle_t		authHandle;		// Client Authentication Role Handle
 
-	u8					*sendBuf;		// TCP/IP Send Buffer
-	size_t				sendBufLen;		// TCP/IP Send Buffer Length
+	WebSegmentPtr		sendHead;		// TCP/IP Send Queue (Unsent Segments, oldest first)
+	WebSegmentPtr		sendTail;		// TCP/IP Send Queue Last Segment
+	size_t				sendBufLen;		// TCP/IP Send Queue Length (Unsent Bytes)
 	u8					*recvBuf;		// TCP/IP Receive Buffer (Partial HTTP Request or Websocket Frame)
 	size_t				recvBufLen;		// TCP/IP Receive Buffer Length
 	
@@ -110,17 +132,13 @@ typedef struct WebClient_s {
 
 	esif_handle_t		ipfHandle;		// Unique IPF Client Session Handle
 	WebWorkerPtr		rpcWorker;		// RPC Worker Object
+	u32					pollEvents;		// Registered epoll Events or 0 if not registered
 } WebClient, *WebClientPtr;
 
-#define IPF_WS_MAX_LISTENERS	12					// Max Number of Web Server Listeners
-#define IPF_WS_MAX_CLIENTS		ESIF_MAX_CLIENTS	// Max simultaneous websocket clients
-
-// Max Active Sockets (per WebServer) cannot exceed FD_SETSIZE (Default: Windows=64, Linux=1024)
-#if ((IPF_WS_MAX_LISTENERS + IPF_WS_MAX_CLIENTS + 1) > FD_SETSIZE)
-# undef  IPF_WS_MAX_CLIENTS
-# define IPF_WS_MAX_CLIENTS	(FD_SETSIZE - IPF_WS_MAX_LISTENERS - 1)
-#endif
-#define WS_MAX_SOCKETS	(IPF_WS_MAX_LISTENERS + IPF_WS_MAX_CLIENTS + 1)
+// Max simultaneous websocket connections. Active sockets are monitored with epoll so they are not limited
+// by FD_SETSIZE; IPF Client Sessions are still limited to IPFSRV_MAX_SESSIONS (ESIF_MAX_CLIENTS)
+#define IPF_WS_MAX_LISTENERS	12						// Max Number of Web Server Listeners
+#define IPF_WS_MAX_CLIENTS		(ESIF_MAX_CLIENTS * 8)	// Max simultaneous websocket clients
 
 #define CRLF	"\r\n"
 
@@ -129,6 +147,7 @@ typedef struct WebServer_s {
 	esif_ccb_lock_t		lock;							// Thread Lock
 
 	TcpDoorbell			doorbell;						// Doorbell Intra-Process Signal object
+	int					pollfd;							// epoll instance for Doorbell, Listeners and Clients or -1
 	WebListener			listeners[IPF_WS_MAX_LISTENERS];// Web Server Listener Socket(s)
 	WebClient			clients[IPF_WS_MAX_CLIENTS];	// Web Clients
 
@@ -148,6 +167,17 @@ typedef struct WebServer_s {
 	atomic_t			rpcQueueMax;					// Max Incoming RPC Request Queue Size
 } WebServer, *WebServerPtr;
 
+// Web Server Benchmark Results
+typedef struct WebBenchResults_s {
+	size_t				clients;			// Connected Benchmark Clients
+	size_t				messages;			// Completed Round-Trip Messages
+	double				elapsedMsec;		// Elapsed Wall Clock Time
+	double				minLatencyUsec;		// Min Round-Trip Latency
+	double				avgLatencyUsec;		// Average Round-Trip Latency
+	double				maxLatencyUsec;		// Max Round-Trip Latency
+	double				cpuUsecPerMsg;		// Process CPU Time (User + System) per Message
+} WebBenchResults, *WebBenchResultsPtr;
+
 extern WebServerPtr g_WebServer;
 
 // Public Interfaces
@@ -166,6 +196,7 @@ atomic_t WebServer_GetListenerMask(WebServerPtr self);
 atomic_t WebServer_GetPipeMask(WebServerPtr self);
 atomic_t WebServer_GetRpcQueueMax(WebServerPtr self);
 void WebServer_SetRpcQueueMax(WebServerPtr self, size_t maxQueue);
+esif_error_t WebServer_Benchmark(WebServerPtr self, size_t clients, size_t rounds, WebBenchResultsPtr results);
 
 esif_error_t WebServer_EnQueueRpc(WebServerPtr self, WebWorkerPtr rpcWorker, void *object);
 esif_error_t WebServer_EnQueueMsg(WebServerPtr self, void *object);
@@ -179,7 +210,12 @@ void WebWorker_PutRef(WebWorkerPtr self);
 esif_error_t WebWorker_Start(WebWorkerPtr self);
 void WebWorker_Stop(WebWorkerPtr self);
 
+WebBufferPtr WebBuffer_Create(const void *data, size_t buf_len);
+void WebBuffer_GetRef(WebBufferPtr self);
+void WebBuffer_PutRef(WebBufferPtr self);
+
 esif_error_t WebClient_Write(WebClientPtr self, void *buffer, size_t buf_len);
+esif_error_t WebClient_WriteV(WebClientPtr self, const WebIoVec *iov, size_t iovcnt);
 void WebClient_Close(WebClientPtr self);
 void WebServer_CloseOrphans(WebServerPtr self);
 
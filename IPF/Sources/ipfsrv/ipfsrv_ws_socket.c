@@ -225,19 +225,17 @@ static esif_error_t Websocket_GetFrame(
 	return rc;
 }
 
-// Build a WebSocket Frame using the given output buffer
+// Build a WebSocket Frame Header for the given Payload
 static esif_error_t WebSocket_BuildFrame(
 	WsFramePtr frame,		// Normalized WebSocket Frame
-	void *out_buf,			// Frame Output Buffer (Header+Payload)
-	size_t out_buf_len,		// Frame Output Buffer Length
-	void *data_buf,			// Frame Payload Data
+	const void *data_buf,	// Frame Payload Data
 	size_t data_len,		// Frame Payload Data Length
 	FrameType frameType,	// Frame Type
 	FinType finType			// FIN Type
 )
 {
 	esif_error_t rc = ESIF_E_PARAMETER_IS_NULL;
-	if (frame && (out_buf || out_buf_len == 0) && (data_buf || data_len == 0)) {
+	if (frame && (data_buf || data_len == 0)) {
 		size_t header_size = 0;
 		esif_ccb_memset(frame, 0, sizeof(*frame));
 
@@ -265,24 +263,39 @@ static esif_error_t WebSocket_BuildFrame(
 		}
 
 		if (rc == ESIF_OK) {
-			if (out_buf && header_size + data_len > out_buf_len) {
-				rc = ESIF_E_NEED_LARGER_BUFFER;
-			}
-			else if (out_buf) {
-				esif_ccb_memcpy(out_buf, &frame->header, header_size);
-				frame->headerSize = header_size;
-				frame->payloadSize = data_len;
-				frame->frameSize = header_size + data_len;
-				if (data_buf && data_len > 0) {
-					esif_ccb_memcpy((u8 *)out_buf + header_size, data_buf, data_len);
-					frame->payload = (u8 *)out_buf + header_size;
-				}
-			}
+			frame->headerSize = header_size;
+			frame->payloadSize = data_len;
+			frame->frameSize = header_size + data_len;
+			frame->payload = (u8 *)data_buf;
 		}
 	}
 	return rc;
 }
 
+// Send a WebSocket Frame to a Client as a separate Header and Payload without coalescing them.
+// The Payload is queued by reference if it belongs to an Output Buffer, otherwise copied only if unsent.
+static esif_error_t WebSocket_WriteFrame(
+	WebClientPtr client,	// Destination Client
+	const void *data_buf,	// Frame Payload Data
+	size_t data_len,		// Frame Payload Data Length
+	WebBufferPtr buffer,	// Output Buffer containing data_buf or NULL
+	FrameType frameType,	// Frame Type
+	FinType finType			// FIN Type
+)
+{
+	WsFrame outFrame = { 0 };
+	esif_error_t rc = WebSocket_BuildFrame(&outFrame, data_buf, data_len, frameType, finType);
+
+	if (rc == ESIF_OK) {
+		WebIoVec iov[2] = {
+			{ &outFrame.header, outFrame.headerSize, NULL },
+			{ data_buf, data_len, buffer },
+		};
+		rc = WebClient_WriteV(client, iov, (data_len > 0 ? 2 : 1));
+	}
+	return rc;
+}
+
 void IpfSrv_Init(void)
 {
 	IpfTrxMgr_Init(IpfTrxMgr_GetInstance());
@@ -422,8 +435,6 @@ esif_error_t WebServer_WebsocketResponse(
 {
 	esif_error_t rc = ESIF_E_PARAMETER_IS_NULL;
 	if (self && client && request) {
-		WsFrame outFrame = { 0 };
-
 		switch (request->frameType) {
 
 		case FRAME_CONTINUATION:
@@ -470,16 +481,12 @@ esif_error_t WebServer_WebsocketResponse(
 
 		case FRAME_CLOSING:
 			// Send Closing Frame to Client and Disconnect
-			rc = WebSocket_BuildFrame(
-				&outFrame,
-				self->netBuf, self->netBufLen,
-				NULL, 0,
+			rc = WebSocket_WriteFrame(
+				client,
+				NULL, 0, NULL,
 				FRAME_CLOSING,
 				FIN_FINAL);
 
-			if (rc == ESIF_OK) {
-				rc = WebClient_Write(client, self->netBuf, outFrame.frameSize);
-			}
 			if (rc == ESIF_OK) {
 				rc = ESIF_E_WS_DISC;
 			}
@@ -487,30 +494,20 @@ esif_error_t WebServer_WebsocketResponse(
 
 		case FRAME_PING:
 			// Respond to PING Frames with PONG Frame containing Ping's Data
-			rc = WebSocket_BuildFrame(
-				&outFrame,
-				self->netBuf, self->netBufLen,
-				request->payload, request->payloadSize,
+			rc = WebSocket_WriteFrame(
+				client,
+				request->payload, request->payloadSize, NULL,
 				FRAME_PONG,
 				FIN_FINAL);
-
-			if (rc == ESIF_OK) {
-				rc = WebClient_Write(client, self->netBuf, outFrame.frameSize);
-			}
 			break;
 
 		case FRAME_PONG:
 			// Handle unsolicited PONG (keepalive) messages from Internet Explorer 10 (Not required per RFC 6455 but allowed)
-			rc = WebSocket_BuildFrame(
-				&outFrame,
-				self->netBuf, self->netBufLen,
-				NULL, 0,
+			rc = WebSocket_WriteFrame(
+				client,
+				NULL, 0, NULL,
 				FRAME_TEXT,
 				FIN_FINAL);
-
-			if (rc == ESIF_OK) {
-				rc = WebClient_Write(client, self->netBuf, outFrame.frameSize);
-			}
 			break;
 		default:
 			break;
@@ -615,17 +612,12 @@ esif_error_t WebServer_WebsocketRequest(
 				WS_TRACE_DEBUG("Invalid Frame; Closing socket: rc=%s (%d) Type=%02hX FIN=%hd Len=%hd (%zd) Mask=%hd\n", esif_rc_str(rc), rc, request.header.hdr.frameType, request.header.hdr.fin, request.header.hdr.payloadSize, request.payloadSize, request.header.hdr.maskFlag);
 
 				// Send Closing Frame to Client
-				WsFrame outFrame = { 0 };
-				rc = WebSocket_BuildFrame(
-					&outFrame,
-					self->netBuf, self->netBufLen,
-					NULL, 0,
+				rc = WebSocket_WriteFrame(
+					client,
+					NULL, 0, NULL,
 					FRAME_CLOSING,
 					FIN_FINAL);
 
-				if (rc == ESIF_OK) {
-					rc = WebClient_Write(client, self->netBuf, outFrame.payloadSize);
-				}
 				if (rc == ESIF_OK) {
 					rc = ESIF_E_WS_DISC;
 				}
@@ -644,27 +636,19 @@ esif_error_t WebServer_WebsocketRequest(
 	return rc;
 }
 
-// Deliver a buffer to an Active WebSocket Client connection
+// Deliver an Output Buffer to an Active WebSocket Client connection without copying it
 esif_error_t WebServer_WebsocketDeliver(
 	WebServerPtr self,
 	WebClientPtr client,
-	u8 *buffer,
-	size_t buf_len)
+	WebBufferPtr buffer)
 {
 	esif_error_t rc = ESIF_E_PARAMETER_IS_NULL;
-	if (self && client && buffer && buf_len > 0) {
-		WsFrame outFrame = { 0 };
-
-		rc = WebSocket_BuildFrame(
-			&outFrame,
-			self->netBuf, self->netBufLen,
-			buffer, buf_len,
+	if (self && client && buffer && buffer->buf_len > 0) {
+		rc = WebSocket_WriteFrame(
+			client,
+			buffer->data, buffer->buf_len, buffer,
 			FRAME_BINARY,
 			FIN_FINAL);
-
-		if (rc == ESIF_OK) {
-			rc = WebClient_Write(client, self->netBuf, outFrame.frameSize);
-		}
 	}
 	return rc;
 }
\ No newline at end of file
@@ -28,4 +28,4 @@ typedef struct ClientRequest_s {
 
 // WebSocket Server Public Interface
 esif_error_t WebServer_WebsocketRequest(WebServerPtr self, WebClientPtr client, u8 *buffer, size_t buf_len);
-esif_error_t WebServer_WebsocketDeliver(WebServerPtr self, WebClientPtr client, u8 *buffer, size_t buf_len);
+esif_error_t WebServer_WebsocketDeliver(WebServerPtr self, WebClientPtr client, WebBufferPtr buffer);